@@ -0,0 +1,144 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                               BENCHMARK
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                             Configuration
+*
+* File      : APP_CFG.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*
+* Note(s)   : (1) Configuration of the benchmarks (see Cfg/app_cfg.h.tmpl for the notes of each setting).
+*             (2) The settings that change the code paths under test (MB_CFG_CORE_RXRING_EN,
+*                 MB_CFG_CORE_TXBLOCK_EN, MB_CFG_PORT_CRC16_ENGINE, MB_CFG_SLAVE_INPLACERESPONSE_EN and the
+*                 range callbacks) could be overridden on the command line of the compiler (-D), so that
+*                 the variants can be compared with the same source tree.
+*             (3) MB_CFG_CORE_RXRING_EN is enabled by default, without the RX ring buffer the simulated UARTs
+*                 overrun at high baud rates whenever the host doesn't schedule the receiving task within one
+*                 character time.
+*********************************************************************************************************
+*/
+
+#ifndef APP_CFG_H__
+#define APP_CFG_H__
+
+#include <lib_def.h>
+
+#define MB_CFG_MAX_NBR_IF                                            4U      /* See Note #1.                                    */
+
+#define MB_CFG_ARG_CHK_EN                                   DEF_ENABLED      /* See Note #2.                                    */
+
+#define MB_CFG_SLAVE_EN                                     DEF_ENABLED      /* See Note #3.                                    */
+
+#define MB_CFG_SLAVE_CMDTABLE_COMPACT_EN                    DEF_ENABLED      /* See Note #4.                                    */
+#define MB_CFG_SLAVE_CMDTABLE_COMPACT_TABLELEN                      16U      /* See Note #5.                                    */
+
+#define MB_CFG_SLAVE_BUILTIN_CMDLET_READCOILS               DEF_ENABLED      /* See Note #6.                                    */
+#define MB_CFG_SLAVE_BUILTIN_CMDLET_READDISCRETEINPUTS      DEF_ENABLED
+#define MB_CFG_SLAVE_BUILTIN_CMDLET_READHOLDINGREGS         DEF_ENABLED
+#define MB_CFG_SLAVE_BUILTIN_CMDLET_READINPUTREGS           DEF_ENABLED
+#define MB_CFG_SLAVE_BUILTIN_CMDLET_WRITESINGLECOIL         DEF_ENABLED
+#define MB_CFG_SLAVE_BUILTIN_CMDLET_WRITESINGLEREG          DEF_ENABLED
+#define MB_CFG_SLAVE_BUILTIN_CMDLET_WRITEMULTIPLECOILS      DEF_ENABLED
+#define MB_CFG_SLAVE_BUILTIN_CMDLET_WRITEMULTIPLEREGS       DEF_ENABLED
+#define MB_CFG_SLAVE_BUILTIN_CMDLET_MASKWRITEREG            DEF_ENABLED
+#define MB_CFG_SLAVE_BUILTIN_CMDLET_READWRITEMULTIPLEREGS   DEF_ENABLED
+
+#define MB_CFG_SLAVE_GETPREVIOUSFRAMEFLAGS_EN               DEF_ENABLED      /* See Note #7.                                    */
+#define MB_CFG_SLAVE_GETLASTFRAMEFLAGS_EN                   DEF_ENABLED
+#define MB_CFG_SLAVE_GETLASTERROR_EN                        DEF_ENABLED
+#define MB_CFG_SLAVE_GETCOUNTERVALUE_EN                     DEF_ENABLED
+#define MB_CFG_SLAVE_CLEARCOUNTERVALUE_EN                   DEF_ENABLED
+
+#define MB_CFG_SLAVE_DELAYBEFOREREPLY_EN                    DEF_ENABLED      /* See Note #8.                                    */
+#define MB_CFG_SLAVE_LISTENONLY_EN                          DEF_ENABLED
+
+#define MB_CFG_SLAVE_BUSMESSAGECOUNTER_EN                   DEF_ENABLED      /* See Note #9.                                    */
+#define MB_CFG_SLAVE_BUSCOMMERRORCOUNTER_EN                 DEF_ENABLED
+#define MB_CFG_SLAVE_SLAVEMESSAGECOUNTER_EN                 DEF_ENABLED
+#define MB_CFG_SLAVE_SLAVEEXCEPTIONCOUNTER_EN               DEF_ENABLED
+#define MB_CFG_SLAVE_SLAVENORESPONSECOUNTER_EN              DEF_ENABLED
+
+#ifndef MB_CFG_SLAVE_INPLACERESPONSE_EN
+#define MB_CFG_SLAVE_INPLACERESPONSE_EN                    DEF_DISABLED      /* See Note #19.                                   */
+#endif
+
+#ifndef MB_CFG_SLAVE_REGRANGECALLBACK_EN
+#define MB_CFG_SLAVE_REGRANGECALLBACK_EN                    DEF_ENABLED      /* See Note #20.                                   */
+#endif
+#ifndef MB_CFG_SLAVE_BITRANGECALLBACK_EN
+#define MB_CFG_SLAVE_BITRANGECALLBACK_EN                    DEF_ENABLED
+#endif
+
+#define MB_CFG_SLAVE_DATAMODEL_EN                           DEF_ENABLED      /* See Note #21.                                   */
+
+#define MB_CFG_SLAVE_REGMAP_EN                             DEF_DISABLED      /* See Note #22.                                   */
+
+#define MB_CFG_MASTER_EN                                    DEF_ENABLED      /* See Note #10.                                   */
+
+#define MB_CFG_MASTER_BUILTIN_CMDLET_READCOILS_EN           DEF_ENABLED      /* See Note #11.                                   */
+#define MB_CFG_MASTER_BUILTIN_CMDLET_READDISCRETEINPUTS_EN  DEF_ENABLED
+#define MB_CFG_MASTER_BUILTIN_CMDLET_READHOLDREGS_EN        DEF_ENABLED
+#define MB_CFG_MASTER_BUILTIN_CMDLET_READINPUTREGS_EN       DEF_ENABLED
+#define MB_CFG_MASTER_BUILTIN_CMDLET_WRITESINGLEREG         DEF_ENABLED
+#define MB_CFG_MASTER_BUILTIN_CMDLET_WRITESINGLECOIL        DEF_ENABLED
+#define MB_CFG_MASTER_BUILTIN_CMDLET_WRITEMULTIPLECOILS     DEF_ENABLED
+#define MB_CFG_MASTER_BUILTIN_CMDLET_WRITEMULTIPLEREGS      DEF_ENABLED
+#define MB_CFG_MASTER_BUILTIN_CMDLET_MASKWRITEREG           DEF_ENABLED
+#define MB_CFG_MASTER_BUILTIN_CMDLET_RWMULTIPLEREGS         DEF_ENABLED
+
+#define MB_CFG_MASTER_BLOCKRESPONSE_EN                     DEF_DISABLED      /* See Note #26.                                   */
+
+#define MB_CFG_MASTER_QUEUE_EN                             DEF_DISABLED      /* See Note #23.                                   */
+
+#define MB_CFG_MASTER_HEALTH_EN                            DEF_DISABLED      /* See Note #27.                                   */
+#define MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN            DEF_DISABLED      /* See Note #28.                                   */
+
+#define MB_CFG_MASTER_SCHED_EN                             DEF_DISABLED      /* See Note #24.                                   */
+#define MB_CFG_MASTER_SCHED_COALESCE_EN                    DEF_DISABLED      /* See Note #25.                                   */
+#define MB_CFG_MASTER_SCHED_COALESCE_MAX                             8U
+
+#define MB_CFG_MASTER_GROUP_EN                             DEF_DISABLED      /* See Note #29.                                   */
+
+#define MB_CFG_MASTER_RETRY_EN                             DEF_DISABLED      /* See Note #30.                                   */
+
+#define MB_CFG_CORE_PARITYERRORCOUNTER_EN                   DEF_ENABLED      /* See Note #12.                                   */
+#define MB_CFG_CORE_DATAOVERRUNERRORCOUNTER_EN              DEF_ENABLED
+#define MB_CFG_CORE_FRAMEERRORCOUNTER_EN                    DEF_ENABLED
+
+#define MB_CFG_CORE_SETMODE_EN                              DEF_ENABLED      /* See Note #13.                                   */
+#define MB_CFG_CORE_GETMODE_EN                              DEF_ENABLED
+#define MB_CFG_CORE_SETLINEFEED_EN                          DEF_ENABLED
+#define MB_CFG_CORE_GETLINEFEED_EN                          DEF_ENABLED
+#define MB_CFG_CORE_SETCHARTIMEPRESCALE_EN                  DEF_ENABLED
+#define MB_CFG_CORE_GETCHARTIMEPRESCALE_EN                  DEF_ENABLED
+#define MB_CFG_CORE_GETCOUNTERVALUE_EN                      DEF_ENABLED
+#define MB_CFG_CORE_CLEARCOUNTERVALUE_EN                    DEF_ENABLED
+#define MB_CFG_CORE_GETLASTTXADDRESS                        DEF_ENABLED
+#define MB_CFG_CORE_GETLASTTXFUNCTIONCODE                   DEF_ENABLED
+#define MB_CFG_CORE_GETLASTTXEXCEPTIONCODE                  DEF_ENABLED
+#define MB_CFG_CORE_CLEARLASTTXEXCEPTIONCODE                DEF_ENABLED
+
+#define MB_CFG_CORE_RTUMODE                                 DEF_ENABLED      /* See Note #14.                                   */
+#define MB_CFG_CORE_ASCIIMODE                               DEF_ENABLED      /* See Note #15.                                   */
+
+#ifndef MB_CFG_CORE_RXRING_EN
+#define MB_CFG_CORE_RXRING_EN                               DEF_ENABLED      /* See Note #16.                                   */
+#endif
+#define MB_CFG_CORE_RXRING_SIZE                                    256U
+
+#ifndef MB_CFG_CORE_TXBLOCK_EN
+#define MB_CFG_CORE_TXBLOCK_EN                             DEF_DISABLED      /* See Note #17.                                   */
+#endif
+
+#ifndef MB_CFG_PORT_CRC16_ENGINE
+#define MB_CFG_PORT_CRC16_ENGINE              MBPORT_CRC16_ENGINE_TABLE      /* See Note #18.                                   */
+#endif
+
+
+#endif
\ No newline at end of file
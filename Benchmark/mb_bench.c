@@ -0,0 +1,419 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                               BENCHMARK
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                            Common Utilities
+*
+* File      : MB_BENCH.C
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <mb_bench.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/*  Nanoseconds per second.  */
+#define MBBENCH_NSEC_PER_SEC                      ((CPU_INT64U)1000000000U)
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static int MBBench_CounterOpen(
+    CPU_INT64U               config
+);
+
+static CPU_INT64U MBBench_CounterRead(
+    int                      fd
+);
+
+static int MBBench_CompareSamples(
+    const void              *p_a,
+    const void              *p_b
+);
+
+
+/*
+*********************************************************************************************************
+*                                      MBBench_GetTime()
+*
+* Description : Get current time of the monotonic clock.
+*
+* Argument(s) : None.
+*
+* Return(s)   : The time (unit: nanosecond).
+*********************************************************************************************************
+*/
+
+CPU_INT64U MBBench_GetTime(void) {
+    struct timespec  now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (CPU_INT64U)now.tv_sec * MBBENCH_NSEC_PER_SEC + (CPU_INT64U)now.tv_nsec;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_CountersOpen()
+*
+* Description : Open the performance counters (CPU cycles and retired instructions) of the calling thread.
+*
+* Argument(s) : (1) p_counters  Pointer to the counters.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The hardware counters are opened with perf_event_open() and count user-space events only.
+*                   They are not available in most virtual machines and containers, or if
+*                   /proc/sys/kernel/perf_event_paranoid is greater than 2. Such counters read as zero (see
+*                   MBBench_CountersHasCycles() and MBBench_CountersHasInstructions()), the CPU time of the
+*                   thread is always available.
+*********************************************************************************************************
+*/
+
+void MBBench_CountersOpen(
+    MBBENCH_COUNTERS        *p_counters
+) {
+#if defined(__linux__)
+    p_counters->fdCycles       = MBBench_CounterOpen((CPU_INT64U)PERF_COUNT_HW_CPU_CYCLES);
+    p_counters->fdInstructions = MBBench_CounterOpen((CPU_INT64U)PERF_COUNT_HW_INSTRUCTIONS);
+#else
+    p_counters->fdCycles       = -1;
+    p_counters->fdInstructions = -1;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_CountersClose()
+*
+* Description : Close the performance counters.
+*
+* Argument(s) : (1) p_counters  Pointer to the counters.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBBench_CountersClose(
+    MBBENCH_COUNTERS        *p_counters
+) {
+    if (p_counters->fdCycles >= 0) {
+        (void)close(p_counters->fdCycles);
+        p_counters->fdCycles = -1;
+    }
+    if (p_counters->fdInstructions >= 0) {
+        (void)close(p_counters->fdInstructions);
+        p_counters->fdInstructions = -1;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_CountersRead()
+*
+* Description : Take a sample of the time, the CPU time and the performance counters of the calling thread.
+*
+* Argument(s) : (1) p_counters  Pointer to the counters (opened by the calling thread).
+*               (2) p_sample    Pointer to the variable that receives the sample.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBBench_CountersRead(
+    MBBENCH_COUNTERS        *p_counters,
+    MBBENCH_SAMPLE          *p_sample
+) {
+    struct timespec  ts;
+
+    p_sample->cycles       = MBBench_CounterRead(p_counters->fdCycles);
+    p_sample->instructions = MBBench_CounterRead(p_counters->fdInstructions);
+
+    (void)clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    p_sample->cpuTime = (CPU_INT64U)ts.tv_sec * MBBENCH_NSEC_PER_SEC + (CPU_INT64U)ts.tv_nsec;
+
+    p_sample->time = MBBench_GetTime();
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBBench_CountersHasCycles()
+*
+* Description : Check whether the CPU cycle counter is available.
+*
+* Argument(s) : (1) p_counters  Pointer to the counters.
+*
+* Return(s)   : DEF_YES if so, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN MBBench_CountersHasCycles(
+    MBBENCH_COUNTERS        *p_counters
+) {
+    return (p_counters->fdCycles >= 0) ? DEF_YES : DEF_NO;
+}
+
+
+/*
+*********************************************************************************************************
+*                               MBBench_CountersHasInstructions()
+*
+* Description : Check whether the retired instruction counter is available.
+*
+* Argument(s) : (1) p_counters  Pointer to the counters.
+*
+* Return(s)   : DEF_YES if so, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN MBBench_CountersHasInstructions(
+    MBBENCH_COUNTERS        *p_counters
+) {
+    return (p_counters->fdInstructions >= 0) ? DEF_YES : DEF_NO;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_Percentile()
+*
+* Description : Get a percentile of samples.
+*
+* Argument(s) : (1) p_samples   Pointer to the samples (sorted in place).
+*               (2) cnt         Count of samples.
+*               (3) percentile  The percentile (unit: 1/10000, e.g. MBBENCH_PERCENTILE_P99).
+*
+* Return(s)   : The percentile (nearest-rank), or 0 if there is no sample.
+*********************************************************************************************************
+*/
+
+CPU_INT64U MBBench_Percentile(
+    CPU_INT64U              *p_samples,
+    CPU_SIZE_T               cnt,
+    CPU_INT32U               percentile
+) {
+    CPU_SIZE_T  rank;
+
+    if (cnt == (CPU_SIZE_T)0U) {
+        return (CPU_INT64U)0U;
+    }
+
+    qsort(p_samples, cnt, sizeof(CPU_INT64U), MBBench_CompareSamples);
+
+    /*  Nearest-rank: ceil(percentile * cnt / 10000).  */
+    rank = (CPU_SIZE_T)(((CPU_INT64U)percentile * (CPU_INT64U)cnt + (CPU_INT64U)9999U) / (CPU_INT64U)10000U);
+    if (rank == (CPU_SIZE_T)0U) {
+        rank = (CPU_SIZE_T)1U;
+    }
+
+    return p_samples[rank - (CPU_SIZE_T)1U];
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBBench_PrintHeader()
+*
+* Description : Print the header record of a benchmark (one JSON object on one line).
+*
+* Argument(s) : (1) p_file      The output file.
+*               (2) bench       Name of the benchmark.
+*               (3) p_counters  Pointer to the counters of the main thread.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The header records the revision, the compiler and the available counters, so that
+*                   results of different versions could be told apart when they are compared.
+*********************************************************************************************************
+*/
+
+void MBBench_PrintHeader(
+    FILE                    *p_file,
+    const char              *bench,
+    MBBENCH_COUNTERS        *p_counters
+) {
+    fprintf(
+        p_file,
+        "{\"record\":\"header\",\"bench\":\"%s\",\"revision\":\"%s\",\"compiler\":\"%s\","
+        "\"cycles\":%s,\"instructions\":%s}\n",
+        bench,
+        MBBENCH_REVISION,
+#if defined(__VERSION__)
+        __VERSION__,
+#else
+        "unknown",
+#endif
+        MBBench_CountersHasCycles(p_counters) ? "true" : "false",
+        MBBench_CountersHasInstructions(p_counters) ? "true" : "false"
+    );
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBBench_PrintRatio()
+*
+* Description : Print a ratio as a JSON member (",\"key\":value").
+*
+* Argument(s) : (1) p_file      The output file.
+*               (2) key         The member name.
+*               (3) num         The numerator.
+*               (4) den         The denominator.
+*               (5) valid       DEF_NO to print null (e.g. the counter is not available).
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) null is also printed if 'den' is zero.
+*********************************************************************************************************
+*/
+
+void MBBench_PrintRatio(
+    FILE                    *p_file,
+    const char              *key,
+    CPU_INT64U               num,
+    CPU_INT64U               den,
+    CPU_BOOLEAN              valid
+) {
+    if (!valid || den == (CPU_INT64U)0U) {
+        fprintf(p_file, ",\"%s\":null", key);
+    } else {
+        fprintf(p_file, ",\"%s\":%.3f", key, (double)num / (double)den);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_CounterOpen()
+*
+* Description : Open a hardware performance counter of the calling thread.
+*
+* Argument(s) : (1) config      The hardware event (PERF_COUNT_HW_*).
+*
+* Return(s)   : The file descriptor of the counter, or -1 if the counter is not available.
+*********************************************************************************************************
+*/
+
+static int MBBench_CounterOpen(
+    CPU_INT64U               config
+) {
+#if defined(__linux__) && defined(SYS_perf_event_open)
+    struct perf_event_attr  attr;
+    long                    fd;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.size           = sizeof(attr);
+    attr.config         = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+
+    fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0UL);
+
+    return (fd >= 0L) ? (int)fd : -1;
+#else
+    (void)config;
+
+    return -1;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_CounterRead()
+*
+* Description : Read a hardware performance counter.
+*
+* Argument(s) : (1) fd          The file descriptor of the counter (-1 if the counter is not available).
+*
+* Return(s)   : The value of the counter, or 0 if the counter is not available.
+*********************************************************************************************************
+*/
+
+static CPU_INT64U MBBench_CounterRead(
+    int                      fd
+) {
+    CPU_INT64U  value;
+
+    if (fd < 0) {
+        return (CPU_INT64U)0U;
+    }
+    if (read(fd, &value, sizeof(value)) != (ssize_t)sizeof(value)) {
+        return (CPU_INT64U)0U;
+    }
+
+    return value;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBBench_CompareSamples()
+*
+* Description : Compare two samples (for qsort()).
+*
+* Argument(s) : (1) p_a         Pointer to the first sample.
+*               (2) p_b         Pointer to the second sample.
+*
+* Return(s)   : Negative, zero or positive if the first sample is less than, equals to or greater than the
+*               second sample.
+*********************************************************************************************************
+*/
+
+static int MBBench_CompareSamples(
+    const void              *p_a,
+    const void              *p_b
+) {
+    CPU_INT64U  a;
+    CPU_INT64U  b;
+
+    a = *((const CPU_INT64U*)p_a);
+    b = *((const CPU_INT64U*)p_b);
+
+    return (a < b) ? -1 : ((a > b) ? 1 : 0);
+}
\ No newline at end of file
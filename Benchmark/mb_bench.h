@@ -0,0 +1,274 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                               BENCHMARK
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                            Common Utilities
+*
+* File      : MB_BENCH.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef MB_BENCH_H__
+#define MB_BENCH_H__
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+#include <stdio.h>
+
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+/*  Revision of the benchmarked source tree (e.g. -DMBBENCH_REVISION="\"$(git rev-parse --short HEAD)\"").  */
+#ifndef MBBENCH_REVISION
+#define MBBENCH_REVISION                          "unknown"
+#endif
+
+/*  Percentiles (unit: 1/10000).  */
+#define MBBENCH_PERCENTILE_P50                    ((CPU_INT32U)5000U)
+#define MBBENCH_PERCENTILE_P99                    ((CPU_INT32U)9900U)
+#define MBBENCH_PERCENTILE_P999                   ((CPU_INT32U)9990U)
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+/*  Performance counters of a thread.  */
+typedef struct {
+    int                     fdCycles;
+    int                     fdInstructions;
+} MBBENCH_COUNTERS;
+
+/*  Sample of the performance counters.  */
+typedef struct {
+    CPU_INT64U              time;
+    CPU_INT64U              cpuTime;
+    CPU_INT64U              cycles;
+    CPU_INT64U              instructions;
+} MBBENCH_SAMPLE;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      MBBench_GetTime()
+*
+* Description : Get current time of the monotonic clock.
+*
+* Argument(s) : None.
+*
+* Return(s)   : The time (unit: nanosecond).
+*********************************************************************************************************
+*/
+
+CPU_INT64U MBBench_GetTime(void);
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_CountersOpen()
+*
+* Description : Open the performance counters (CPU cycles and retired instructions) of the calling thread.
+*
+* Argument(s) : (1) p_counters  Pointer to the counters.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The hardware counters are opened with perf_event_open() and count user-space events only.
+*                   They are not available in most virtual machines and containers, or if
+*                   /proc/sys/kernel/perf_event_paranoid is greater than 2. Such counters read as zero (see
+*                   MBBench_CountersHasCycles() and MBBench_CountersHasInstructions()), the CPU time of the
+*                   thread is always available.
+*********************************************************************************************************
+*/
+
+void MBBench_CountersOpen(
+    MBBENCH_COUNTERS        *p_counters
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_CountersClose()
+*
+* Description : Close the performance counters.
+*
+* Argument(s) : (1) p_counters  Pointer to the counters.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBBench_CountersClose(
+    MBBENCH_COUNTERS        *p_counters
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_CountersRead()
+*
+* Description : Take a sample of the time, the CPU time and the performance counters of the calling thread.
+*
+* Argument(s) : (1) p_counters  Pointer to the counters (opened by the calling thread).
+*               (2) p_sample    Pointer to the variable that receives the sample.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBBench_CountersRead(
+    MBBENCH_COUNTERS        *p_counters,
+    MBBENCH_SAMPLE          *p_sample
+);
+
+
+/*
+*********************************************************************************************************
+*                                  MBBench_CountersHasCycles()
+*
+* Description : Check whether the CPU cycle counter is available.
+*
+* Argument(s) : (1) p_counters  Pointer to the counters.
+*
+* Return(s)   : DEF_YES if so, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN MBBench_CountersHasCycles(
+    MBBENCH_COUNTERS        *p_counters
+);
+
+
+/*
+*********************************************************************************************************
+*                               MBBench_CountersHasInstructions()
+*
+* Description : Check whether the retired instruction counter is available.
+*
+* Argument(s) : (1) p_counters  Pointer to the counters.
+*
+* Return(s)   : DEF_YES if so, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN MBBench_CountersHasInstructions(
+    MBBENCH_COUNTERS        *p_counters
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_Percentile()
+*
+* Description : Get a percentile of samples.
+*
+* Argument(s) : (1) p_samples   Pointer to the samples (sorted in place).
+*               (2) cnt         Count of samples.
+*               (3) percentile  The percentile (unit: 1/10000, e.g. MBBENCH_PERCENTILE_P99).
+*
+* Return(s)   : The percentile (nearest-rank), or 0 if there is no sample.
+*********************************************************************************************************
+*/
+
+CPU_INT64U MBBench_Percentile(
+    CPU_INT64U              *p_samples,
+    CPU_SIZE_T               cnt,
+    CPU_INT32U               percentile
+);
+
+
+/*
+*********************************************************************************************************
+*                                   MBBench_PrintHeader()
+*
+* Description : Print the header record of a benchmark (one JSON object on one line).
+*
+* Argument(s) : (1) p_file      The output file.
+*               (2) bench       Name of the benchmark.
+*               (3) p_counters  Pointer to the counters of the main thread.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The header records the revision, the compiler and the available counters, so that
+*                   results of different versions could be told apart when they are compared.
+*********************************************************************************************************
+*/
+
+void MBBench_PrintHeader(
+    FILE                    *p_file,
+    const char              *bench,
+    MBBENCH_COUNTERS        *p_counters
+);
+
+
+/*
+*********************************************************************************************************
+*                                   MBBench_PrintRatio()
+*
+* Description : Print a ratio as a JSON member (",\"key\":value").
+*
+* Argument(s) : (1) p_file      The output file.
+*               (2) key         The member name.
+*               (3) num         The numerator.
+*               (4) den         The denominator.
+*               (5) valid       DEF_NO to print null (e.g. the counter is not available).
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) null is also printed if 'den' is zero.
+*********************************************************************************************************
+*/
+
+void MBBench_PrintRatio(
+    FILE                    *p_file,
+    const char              *key,
+    CPU_INT64U               num,
+    CPU_INT64U               den,
+    CPU_BOOLEAN              valid
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
\ No newline at end of file
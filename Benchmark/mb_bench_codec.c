@@ -0,0 +1,793 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                               BENCHMARK
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                         Codec Micro-Benchmark
+*
+* File      : MB_BENCH_CODEC.C
+* Version   : V1.0.320
+* By        : Ji WenCong
+*
+* Note(s)   : (1) Measures the per-character inner loops of the stack in isolation (no driver, no OS), over
+*                 a maximum-size ADU (252 data bytes, i.e. 256 bytes in RTU mode and 513 characters in ASCII
+*                 mode):
+*
+*                     enc_rtu       MBFrameEncRTU_Next()            One call per byte of the RTU frame.
+*                     dec_rtu       MBFrameDecRTU_Update()          One call per byte of the RTU frame.
+*                     enc_ascii     MBFrameEncASCII_Next()          One call per character of the ASCII frame.
+*                     dec_ascii     MBFrameDecASCII_Update()        One call per character between ':' and CR.
+*                     fetch_u16be   MBBufFetcher_ReadUInt16BE()     One call per 2 bytes of the data field.
+*                     emit_u16be    MBBufEmitter_WriteUInt16BE()    One call per 2 bytes of the data field.
+*                     crc16_*       CRC-16 of the RTU frame         See Note #3.
+*
+*                 Each iteration initializes the encoder/decoder/fetcher/emitter once (and ends the decoder),
+*                 so the per-frame cost is amortized over the bytes of the frame like in the Modbus core.
+*             (2) The results are printed as JSON lines (one header record and one record per case), so
+*                 that the results of two versions could be compared line by line.
+*             (3) The CRC-16 cases compute the CRC-16 of the 256 bytes of the RTU frame with each engine of
+*                 the default port (all engines are built into the binary, see mb_bench_crc16.h), in one
+*                 call per frame:
+*
+*                     crc16_bytewise    MBPort_CRC16_GetTableItem() of the table engine, one call per byte
+*                                       (the path of MBCRC16_Update() before the block CRC-16 was added).
+*                     crc16_table       MBPort_CRC16_Compute(), table engine.
+*                     crc16_slicing4    MBPort_CRC16_Compute(), slicing-by-4 engine.
+*                     crc16_slicing8    MBPort_CRC16_Compute(), slicing-by-8 engine.
+*                     crc16_nibble      MBPort_CRC16_Compute(), nibble engine.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include <mb_bench.h>
+#include <mb_bench_crc16.h>
+
+#include <mb.h>
+#include <mb_bufferemitter.h>
+#include <mb_bufferfetcher.h>
+#include <mb_framedec_ascii.h>
+#include <mb_framedec_rtu.h>
+#include <mb_frameenc_ascii.h>
+#include <mb_frameenc_rtu.h>
+
+#include <mbport_limits.h>
+
+#include <cpu.h>
+
+#include <lib_ascii.h>
+#include <lib_def.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/*  Length of the data field of a maximum-size ADU.  */
+#define MBBENCH_CODEC_DATALEN                     ((CPU_SIZE_T)252U)
+
+/*  Length of a maximum-size frame on the line.  */
+#define MBBENCH_CODEC_RTULEN                      (MBBENCH_CODEC_DATALEN + (CPU_SIZE_T)4U)
+#define MBBENCH_CODEC_ASCIILEN                    ((MBBENCH_CODEC_DATALEN + (CPU_SIZE_T)3U) * (CPU_SIZE_T)2U + (CPU_SIZE_T)3U)
+
+/*  Maximum count of repetitions.  */
+#define MBBENCH_CODEC_REPETITION_MAX              ((CPU_SIZE_T)101U)
+
+/*  Defaults of the command line options.  */
+#define MBBENCH_CODEC_DEFAULT_ITERATIONS          ((CPU_SIZE_T)20000U)
+#define MBBENCH_CODEC_DEFAULT_REPETITIONS         ((CPU_SIZE_T)7U)
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+/*  Runs one iteration of a case, returns a value derived from the output (so it can't be optimized out).  */
+typedef CPU_INT32U (*MBBENCH_CODEC_RUN)(void);
+
+/*  A benchmark case.  */
+typedef struct {
+    const char             *name;
+    const char             *function;
+    CPU_SIZE_T              bytes;
+    MBBENCH_CODEC_RUN       run;
+} MBBENCH_CODEC_CASE;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void MBBench_Codec_Setup(void);
+
+static CPU_INT32U MBBench_Codec_EncRTU(void);
+
+static CPU_INT32U MBBench_Codec_DecRTU(void);
+
+static CPU_INT32U MBBench_Codec_EncASCII(void);
+
+static CPU_INT32U MBBench_Codec_DecASCII(void);
+
+static CPU_INT32U MBBench_Codec_FetchUInt16BE(void);
+
+static CPU_INT32U MBBench_Codec_EmitUInt16BE(void);
+
+static CPU_INT32U MBBench_Codec_CRC16Bytewise(void);
+
+static CPU_INT32U MBBench_Codec_CRC16Table(void);
+
+static CPU_INT32U MBBench_Codec_CRC16Slicing4(void);
+
+static CPU_INT32U MBBench_Codec_CRC16Slicing8(void);
+
+static CPU_INT32U MBBench_Codec_CRC16Nibble(void);
+
+static void MBBench_Codec_RunCase(
+    const MBBENCH_CODEC_CASE  *p_case,
+    MBBENCH_COUNTERS          *p_counters
+);
+
+static void MBBench_Codec_Usage(
+    const char              *prog
+);
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/*  Benchmark cases.  */
+static const MBBENCH_CODEC_CASE  g_MBBenchCodec_Cases[] = {
+    { "enc_rtu",        "MBFrameEncRTU_Next",         MBBENCH_CODEC_RTULEN,                    MBBench_Codec_EncRTU        },
+    { "dec_rtu",        "MBFrameDecRTU_Update",       MBBENCH_CODEC_RTULEN,                    MBBench_Codec_DecRTU        },
+    { "enc_ascii",      "MBFrameEncASCII_Next",       MBBENCH_CODEC_ASCIILEN,                  MBBench_Codec_EncASCII      },
+    { "dec_ascii",      "MBFrameDecASCII_Update",     MBBENCH_CODEC_ASCIILEN - (CPU_SIZE_T)3U, MBBench_Codec_DecASCII      },
+    { "fetch_u16be",    "MBBufFetcher_ReadUInt16BE",  MBBENCH_CODEC_DATALEN,                   MBBench_Codec_FetchUInt16BE },
+    { "emit_u16be",     "MBBufEmitter_WriteUInt16BE", MBBENCH_CODEC_DATALEN,                   MBBench_Codec_EmitUInt16BE  },
+    { "crc16_bytewise", "MBPort_CRC16_GetTableItem",  MBBENCH_CODEC_RTULEN,                    MBBench_Codec_CRC16Bytewise },
+    { "crc16_table",    "MBPort_CRC16_Compute",       MBBENCH_CODEC_RTULEN,                    MBBench_Codec_CRC16Table    },
+    { "crc16_slicing4", "MBPort_CRC16_Compute",       MBBENCH_CODEC_RTULEN,                    MBBench_Codec_CRC16Slicing4 },
+    { "crc16_slicing8", "MBPort_CRC16_Compute",       MBBENCH_CODEC_RTULEN,                    MBBench_Codec_CRC16Slicing8 },
+    { "crc16_nibble",   "MBPort_CRC16_Compute",       MBBENCH_CODEC_RTULEN,                    MBBench_Codec_CRC16Nibble   }
+};
+
+/*  Command line options.  */
+static CPU_SIZE_T              g_MBBenchCodec_Iterations;
+static CPU_SIZE_T              g_MBBenchCodec_Repetitions;
+static FILE                   *g_MBBenchCodec_Output;
+
+/*  The frame and its encoded forms.  */
+static CPU_INT08U              g_MBBenchCodec_Data[MBBENCH_CODEC_DATALEN];
+static MB_FRAME                g_MBBenchCodec_Frame;
+static CPU_INT08U              g_MBBenchCodec_RTU[MBBENCH_CODEC_RTULEN];
+static CPU_INT08U              g_MBBenchCodec_ASCII[MBBENCH_CODEC_ASCIILEN];
+
+/*  Output buffer of the decoders and the emitter.  */
+static CPU_INT08U              g_MBBenchCodec_Buffer[MBBENCH_CODEC_DATALEN];
+
+/*  Sink of the values derived from the outputs.  */
+static volatile CPU_INT32U     g_MBBenchCodec_Sink;
+
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Entry of the codec micro-benchmark.
+*
+* Argument(s) : (1) argc        Count of command line arguments.
+*               (2) argv        The command line arguments:
+*
+*                                   -c <cases>      Cases to run, separated by commas (all by default).
+*                                   -n <count>      Count of iterations (frames) per repetition.
+*                                   -r <count>      Count of repetitions (the median is reported).
+*                                   -o <file>       Output file of the JSON lines (stdout by default).
+*
+* Return(s)   : 0 if succeed, 1 if failed.
+*********************************************************************************************************
+*/
+
+int main(
+    int                      argc,
+    char                   **argv
+) {
+    const char        *pCases;
+    const char        *pOutput;
+    char              *pEnd;
+    int                opt;
+    CPU_SIZE_T         i;
+    CPU_SIZE_T         nameLen;
+    const char        *pFound;
+    MBBENCH_COUNTERS   counters;
+
+    g_MBBenchCodec_Iterations  = MBBENCH_CODEC_DEFAULT_ITERATIONS;
+    g_MBBenchCodec_Repetitions = MBBENCH_CODEC_DEFAULT_REPETITIONS;
+    g_MBBenchCodec_Output      = stdout;
+    pCases                     = (const char*)0;
+    pOutput                    = (const char*)0;
+
+    /*  Parse the command line.  */
+    while ((opt = getopt(argc, argv, "c:n:r:o:h")) != -1) {
+        switch (opt) {
+            case 'c':
+                pCases = optarg;
+                break;
+            case 'n':
+                g_MBBenchCodec_Iterations = (CPU_SIZE_T)strtoul(optarg, &pEnd, 10);
+                if (*pEnd != '\0' || g_MBBenchCodec_Iterations == (CPU_SIZE_T)0U) {
+                    MBBench_Codec_Usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'r':
+                g_MBBenchCodec_Repetitions = (CPU_SIZE_T)strtoul(optarg, &pEnd, 10);
+                if (
+                    *pEnd != '\0' ||
+                    g_MBBenchCodec_Repetitions == (CPU_SIZE_T)0U ||
+                    g_MBBenchCodec_Repetitions > MBBENCH_CODEC_REPETITION_MAX
+                ) {
+                    MBBench_Codec_Usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'o':
+                pOutput = optarg;
+                break;
+            default:
+                MBBench_Codec_Usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (pOutput != (const char*)0) {
+        g_MBBenchCodec_Output = fopen(pOutput, "w");
+        if (g_MBBenchCodec_Output == (FILE*)0) {
+            fprintf(stderr, "Can't open %s.\n", pOutput);
+            return 1;
+        }
+    }
+
+    /*  Build the frame and check that the codecs work.  */
+    MBBench_Codec_Setup();
+
+    MBBench_CountersOpen(&counters);
+    MBBench_PrintHeader(g_MBBenchCodec_Output, "codec", &counters);
+
+    for (i = (CPU_SIZE_T)0U; i < sizeof(g_MBBenchCodec_Cases) / sizeof(g_MBBenchCodec_Cases[0]); ++i) {
+        /*  Check whether the case is selected (a whole item of the comma-separated list).  */
+        if (pCases != (const char*)0) {
+            nameLen = (CPU_SIZE_T)strlen(g_MBBenchCodec_Cases[i].name);
+            pFound  = pCases;
+            while ((pFound = strstr(pFound, g_MBBenchCodec_Cases[i].name)) != (const char*)0) {
+                if (
+                    (pFound == pCases || pFound[-1] == ',') &&
+                    (pFound[nameLen] == '\0' || pFound[nameLen] == ',')
+                ) {
+                    break;
+                }
+                pFound += nameLen;
+            }
+            if (pFound == (const char*)0) {
+                continue;
+            }
+        }
+
+        MBBench_Codec_RunCase(&(g_MBBenchCodec_Cases[i]), &counters);
+    }
+
+    MBBench_CountersClose(&counters);
+
+    if (g_MBBenchCodec_Output != stdout) {
+        fclose(g_MBBenchCodec_Output);
+    }
+
+    return 0;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBBench_Codec_Setup()
+*
+* Description : Build the maximum-size frame, encode it in both modes, check that the decoders get the
+*               frame back and that all CRC-16 engines agree.
+*
+* Argument(s) : None.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Exits the process on failure.
+*********************************************************************************************************
+*/
+
+static void MBBench_Codec_Setup(void) {
+    CPU_SIZE_T          i;
+    MB_ERROR            error;
+    MB_FRAME            frame;
+    MB_FRAMEFLAGS       flags;
+    MB_FRAMEENC_RTU     encRTU;
+    MB_FRAMEENC_ASCII   encASCII;
+    MB_FRAMEDEC_RTU     decRTU;
+    MB_FRAMEDEC_ASCII   decASCII;
+
+    for (i = (CPU_SIZE_T)0U; i < MBBENCH_CODEC_DATALEN; ++i) {
+        g_MBBenchCodec_Data[i] = (CPU_INT08U)(i * 37U + 11U);
+    }
+    g_MBBenchCodec_Frame.address      = (CPU_INT08U)0x11U;
+    g_MBBenchCodec_Frame.functionCode = MB_FNCODE_WRITEMULTIPLEREGISTERS;
+    g_MBBenchCodec_Frame.data         = g_MBBenchCodec_Data;
+    g_MBBenchCodec_Frame.dataLength   = MBBENCH_CODEC_DATALEN;
+
+    /*  Encode the frame in RTU mode.  */
+    MBFrameEncRTU_Initialize(&encRTU, &g_MBBenchCodec_Frame, &error);
+    for (i = (CPU_SIZE_T)0U; i < MBBENCH_CODEC_RTULEN && error == MB_ERROR_NONE; ++i) {
+        g_MBBenchCodec_RTU[i] = MBFrameEncRTU_Next(&encRTU, &error);
+    }
+    if (error != MB_ERROR_NONE || MBFrameEncRTU_HasNext(&encRTU, &error)) {
+        fprintf(stderr, "The RTU encoder failed.\n");
+        exit(1);
+    }
+
+    /*  Encode the frame in ASCII mode.  */
+    MBFrameEncASCII_Initialize(&encASCII, &g_MBBenchCodec_Frame, (CPU_CHAR)ASCII_CHAR_LINE_FEED, &error);
+    for (i = (CPU_SIZE_T)0U; i < MBBENCH_CODEC_ASCIILEN && error == MB_ERROR_NONE; ++i) {
+        g_MBBenchCodec_ASCII[i] = MBFrameEncASCII_Next(&encASCII, &error);
+    }
+    if (
+        error != MB_ERROR_NONE ||
+        MBFrameEncASCII_HasNext(&encASCII, &error) ||
+        g_MBBenchCodec_ASCII[0] != (CPU_INT08U)ASCII_CHAR_COLON ||
+        g_MBBenchCodec_ASCII[MBBENCH_CODEC_ASCIILEN - (CPU_SIZE_T)2U] != (CPU_INT08U)ASCII_CHAR_CARRIAGE_RETURN
+    ) {
+        fprintf(stderr, "The ASCII encoder failed.\n");
+        exit(1);
+    }
+
+    /*  Decode the RTU frame.  */
+    memset(&frame, 0, sizeof(frame));
+    MBFrameDecRTU_Initialize(&decRTU, g_MBBenchCodec_Buffer, sizeof(g_MBBenchCodec_Buffer), &error);
+    for (i = (CPU_SIZE_T)0U; i < MBBENCH_CODEC_RTULEN && error == MB_ERROR_NONE; ++i) {
+        MBFrameDecRTU_Update(&decRTU, g_MBBenchCodec_RTU[i], &error);
+    }
+    if (error == MB_ERROR_NONE) {
+        MBFrameDecRTU_End(&decRTU, &error);
+    }
+    if (error == MB_ERROR_NONE) {
+        MBFrameDecRTU_ToFrame(&decRTU, &frame, &flags, &error);
+    }
+    if (
+        error != MB_ERROR_NONE ||
+        flags != (MB_FRAMEFLAGS)0U ||
+        frame.address != g_MBBenchCodec_Frame.address ||
+        frame.functionCode != g_MBBenchCodec_Frame.functionCode ||
+        frame.dataLength != MBBENCH_CODEC_DATALEN ||
+        memcmp(frame.data, g_MBBenchCodec_Data, MBBENCH_CODEC_DATALEN) != 0
+    ) {
+        fprintf(stderr, "The RTU decoder failed.\n");
+        exit(1);
+    }
+
+    /*  Decode the ASCII frame.  */
+    memset(&frame, 0, sizeof(frame));
+    MBFrameDecASCII_Initialize(&decASCII, g_MBBenchCodec_Buffer, sizeof(g_MBBenchCodec_Buffer), &error);
+    for (i = (CPU_SIZE_T)1U; i < MBBENCH_CODEC_ASCIILEN - (CPU_SIZE_T)2U && error == MB_ERROR_NONE; ++i) {
+        MBFrameDecASCII_Update(&decASCII, g_MBBenchCodec_ASCII[i], &error);
+    }
+    if (error == MB_ERROR_NONE) {
+        MBFrameDecASCII_End(&decASCII, &error);
+    }
+    if (error == MB_ERROR_NONE) {
+        MBFrameDecASCII_ToFrame(&decASCII, &frame, &flags, &error);
+    }
+    if (
+        error != MB_ERROR_NONE ||
+        flags != (MB_FRAMEFLAGS)0U ||
+        frame.address != g_MBBenchCodec_Frame.address ||
+        frame.functionCode != g_MBBenchCodec_Frame.functionCode ||
+        frame.dataLength != MBBENCH_CODEC_DATALEN ||
+        memcmp(frame.data, g_MBBenchCodec_Data, MBBENCH_CODEC_DATALEN) != 0
+    ) {
+        fprintf(stderr, "The ASCII decoder failed.\n");
+        exit(1);
+    }
+
+    /*  Check the CRC-16 engines (the CRC-16 of a frame followed by its CRC-16 is zero).  */
+    if (
+        MBBench_Codec_CRC16Bytewise() != (CPU_INT32U)0U ||
+        MBBench_Codec_CRC16Table() != (CPU_INT32U)0U ||
+        MBBench_Codec_CRC16Slicing4() != (CPU_INT32U)0U ||
+        MBBench_Codec_CRC16Slicing8() != (CPU_INT32U)0U ||
+        MBBench_Codec_CRC16Nibble() != (CPU_INT32U)0U
+    ) {
+        fprintf(stderr, "The CRC-16 engines failed.\n");
+        exit(1);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBBench_Codec_EncRTU()
+*
+* Description : Encode the frame in RTU mode (one iteration of "enc_rtu").
+*
+* Argument(s) : None.
+*
+* Return(s)   : Sum of the encoded bytes.
+*********************************************************************************************************
+*/
+
+static CPU_INT32U MBBench_Codec_EncRTU(void) {
+    MB_FRAMEENC_RTU  encoder;
+    MB_ERROR         error;
+    CPU_SIZE_T       i;
+    CPU_INT32U       sum;
+
+    sum = (CPU_INT32U)0U;
+
+    MBFrameEncRTU_Initialize(&encoder, &g_MBBenchCodec_Frame, &error);
+    for (i = (CPU_SIZE_T)0U; i < MBBENCH_CODEC_RTULEN; ++i) {
+        sum += (CPU_INT32U)MBFrameEncRTU_Next(&encoder, &error);
+    }
+
+    return sum;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBBench_Codec_DecRTU()
+*
+* Description : Decode the RTU frame (one iteration of "dec_rtu").
+*
+* Argument(s) : None.
+*
+* Return(s)   : The count of decoded data bytes.
+*********************************************************************************************************
+*/
+
+static CPU_INT32U MBBench_Codec_DecRTU(void) {
+    MB_FRAMEDEC_RTU  decoder;
+    MB_ERROR         error;
+    CPU_SIZE_T       i;
+
+    MBFrameDecRTU_Initialize(&decoder, g_MBBenchCodec_Buffer, sizeof(g_MBBenchCodec_Buffer), &error);
+    for (i = (CPU_SIZE_T)0U; i < MBBENCH_CODEC_RTULEN; ++i) {
+        MBFrameDecRTU_Update(&decoder, g_MBBenchCodec_RTU[i], &error);
+    }
+    MBFrameDecRTU_End(&decoder, &error);
+
+    return (CPU_INT32U)decoder.dataBufferWrittenSize;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_Codec_EncASCII()
+*
+* Description : Encode the frame in ASCII mode (one iteration of "enc_ascii").
+*
+* Argument(s) : None.
+*
+* Return(s)   : Sum of the encoded characters.
+*********************************************************************************************************
+*/
+
+static CPU_INT32U MBBench_Codec_EncASCII(void) {
+    MB_FRAMEENC_ASCII  encoder;
+    MB_ERROR           error;
+    CPU_SIZE_T         i;
+    CPU_INT32U         sum;
+
+    sum = (CPU_INT32U)0U;
+
+    MBFrameEncASCII_Initialize(&encoder, &g_MBBenchCodec_Frame, (CPU_CHAR)ASCII_CHAR_LINE_FEED, &error);
+    for (i = (CPU_SIZE_T)0U; i < MBBENCH_CODEC_ASCIILEN; ++i) {
+        sum += (CPU_INT32U)MBFrameEncASCII_Next(&encoder, &error);
+    }
+
+    return sum;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_Codec_DecASCII()
+*
+* Description : Decode the ASCII frame (one iteration of "dec_ascii").
+*
+* Argument(s) : None.
+*
+* Return(s)   : The count of decoded data bytes.
+*
+* Note(s)     : (1) Like the Modbus core, only the characters between ':' and CR are passed to the decoder.
+*********************************************************************************************************
+*/
+
+static CPU_INT32U MBBench_Codec_DecASCII(void) {
+    MB_FRAMEDEC_ASCII  decoder;
+    MB_ERROR           error;
+    CPU_SIZE_T         i;
+
+    MBFrameDecASCII_Initialize(&decoder, g_MBBenchCodec_Buffer, sizeof(g_MBBenchCodec_Buffer), &error);
+    for (i = (CPU_SIZE_T)1U; i < MBBENCH_CODEC_ASCIILEN - (CPU_SIZE_T)2U; ++i) {
+        MBFrameDecASCII_Update(&decoder, g_MBBenchCodec_ASCII[i], &error);
+    }
+    MBFrameDecASCII_End(&decoder, &error);
+
+    return (CPU_INT32U)decoder.dataBufferWrittenSize;
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBBench_Codec_FetchUInt16BE()
+*
+* Description : Read the data field as big-endian 16-bit integers (one iteration of "fetch_u16be").
+*
+* Argument(s) : None.
+*
+* Return(s)   : Sum of the integers.
+*********************************************************************************************************
+*/
+
+static CPU_INT32U MBBench_Codec_FetchUInt16BE(void) {
+    MB_BUFFERFETCHER  fetcher;
+    MB_ERROR          error;
+    CPU_SIZE_T        i;
+    CPU_INT32U        sum;
+
+    sum = (CPU_INT32U)0U;
+
+    MBBufFetcher_Initialize(&fetcher, g_MBBenchCodec_Data, MBBENCH_CODEC_DATALEN, &error);
+    for (i = (CPU_SIZE_T)0U; i < MBBENCH_CODEC_DATALEN; i += (CPU_SIZE_T)2U) {
+        sum += (CPU_INT32U)MBBufFetcher_ReadUInt16BE(&fetcher, &error);
+    }
+
+    return sum;
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBBench_Codec_EmitUInt16BE()
+*
+* Description : Write the data field as big-endian 16-bit integers (one iteration of "emit_u16be").
+*
+* Argument(s) : None.
+*
+* Return(s)   : The count of written bytes.
+*********************************************************************************************************
+*/
+
+static CPU_INT32U MBBench_Codec_EmitUInt16BE(void) {
+    MB_BUFFEREMITTER  emitter;
+    MB_ERROR          error;
+    CPU_SIZE_T        i;
+
+    MBBufEmitter_Initialize(&emitter, g_MBBenchCodec_Buffer, sizeof(g_MBBenchCodec_Buffer), &error);
+    for (i = (CPU_SIZE_T)0U; i < MBBENCH_CODEC_DATALEN; i += (CPU_SIZE_T)2U) {
+        MBBufEmitter_WriteUInt16BE(&emitter, (CPU_INT16U)i, &error);
+    }
+
+    return (CPU_INT32U)MBBufEmitter_GetWrittenLength(&emitter, &error);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBBench_Codec_CRC16Bytewise()
+*
+* Description : Compute the CRC-16 of the RTU frame one byte at a time with the table engine (one iteration
+*               of "crc16_bytewise").
+*
+* Argument(s) : None.
+*
+* Return(s)   : The CRC-16 value.
+*
+* Note(s)     : (1) This is the loop of MBCRC16_Update() before MBPort_CRC16_Compute() was added.
+*********************************************************************************************************
+*/
+
+static CPU_INT32U MBBench_Codec_CRC16Bytewise(void) {
+    CPU_SIZE_T   i;
+    CPU_INT16U   crc;
+
+    crc = MBPORT_UINT16_MAX;
+    for (i = (CPU_SIZE_T)0U; i < MBBENCH_CODEC_RTULEN; ++i) {
+        crc = (CPU_INT16U)(
+            (crc >> 8) ^
+            MBBench_CRC16_GetTableItemTable((CPU_INT08U)((crc ^ (CPU_INT16U)g_MBBenchCodec_RTU[i]) & (CPU_INT16U)0xFFU))
+        );
+    }
+
+    return (CPU_INT32U)crc;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBBench_Codec_CRC16<Engine>()
+*
+* Description : Compute the CRC-16 of the RTU frame with the table, slicing-by-4, slicing-by-8 and nibble
+*               engines (one iteration of "crc16_table", "crc16_slicing4", "crc16_slicing8" and
+*               "crc16_nibble").
+*
+* Argument(s) : None.
+*
+* Return(s)   : The CRC-16 value.
+*********************************************************************************************************
+*/
+
+static CPU_INT32U MBBench_Codec_CRC16Table(void) {
+    return (CPU_INT32U)MBBench_CRC16_ComputeTable(g_MBBenchCodec_RTU, MBBENCH_CODEC_RTULEN, MBPORT_UINT16_MAX);
+}
+
+static CPU_INT32U MBBench_Codec_CRC16Slicing4(void) {
+    return (CPU_INT32U)MBBench_CRC16_ComputeSlicing4(g_MBBenchCodec_RTU, MBBENCH_CODEC_RTULEN, MBPORT_UINT16_MAX);
+}
+
+static CPU_INT32U MBBench_Codec_CRC16Slicing8(void) {
+    return (CPU_INT32U)MBBench_CRC16_ComputeSlicing8(g_MBBenchCodec_RTU, MBBENCH_CODEC_RTULEN, MBPORT_UINT16_MAX);
+}
+
+static CPU_INT32U MBBench_Codec_CRC16Nibble(void) {
+    return (CPU_INT32U)MBBench_CRC16_ComputeNibble(g_MBBenchCodec_RTU, MBBENCH_CODEC_RTULEN, MBPORT_UINT16_MAX);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_Codec_RunCase()
+*
+* Description : Run one case and print its results.
+*
+* Argument(s) : (1) p_case      Pointer to the case.
+*               (2) p_counters  Pointer to the counters of the main thread.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Each repetition runs all iterations back to back between two samples of the counters.
+*                   The median of the repetitions is reported (each measure is sorted on its own), together
+*                   with the minimum of the wall time.
+*               (2) One iteration is run before the first repetition to warm up the caches.
+*********************************************************************************************************
+*/
+
+static void MBBench_Codec_RunCase(
+    const MBBENCH_CODEC_CASE  *p_case,
+    MBBENCH_COUNTERS          *p_counters
+) {
+    CPU_INT64U        times[MBBENCH_CODEC_REPETITION_MAX];
+    CPU_INT64U        cpuTimes[MBBENCH_CODEC_REPETITION_MAX];
+    CPU_INT64U        cycles[MBBENCH_CODEC_REPETITION_MAX];
+    CPU_INT64U        instructions[MBBENCH_CODEC_REPETITION_MAX];
+    MBBENCH_SAMPLE    begin;
+    MBBENCH_SAMPLE    end;
+    CPU_SIZE_T        rep;
+    CPU_SIZE_T        i;
+    CPU_INT32U        sink;
+    CPU_INT64U        bytes;
+    CPU_INT64U        timeMin;
+    CPU_INT64U        timeMedian;
+    FILE             *p_file;
+
+    /*  Warm up.  */
+    sink = p_case->run();
+
+    for (rep = (CPU_SIZE_T)0U; rep < g_MBBenchCodec_Repetitions; ++rep) {
+        MBBench_CountersRead(p_counters, &begin);
+        for (i = (CPU_SIZE_T)0U; i < g_MBBenchCodec_Iterations; ++i) {
+            sink += p_case->run();
+        }
+        MBBench_CountersRead(p_counters, &end);
+
+        times[rep]        = end.time - begin.time;
+        cpuTimes[rep]     = end.cpuTime - begin.cpuTime;
+        cycles[rep]       = end.cycles - begin.cycles;
+        instructions[rep] = end.instructions - begin.instructions;
+    }
+    g_MBBenchCodec_Sink = sink;
+
+    bytes      = (CPU_INT64U)p_case->bytes * (CPU_INT64U)g_MBBenchCodec_Iterations;
+    timeMedian = MBBench_Percentile(times, g_MBBenchCodec_Repetitions, MBBENCH_PERCENTILE_P50);
+    timeMin    = times[0];      /*  Sorted by MBBench_Percentile().  */
+
+    /*  JSON line.  */
+    p_file = g_MBBenchCodec_Output;
+    fprintf(
+        p_file,
+        "{\"record\":\"result\",\"bench\":\"codec\",\"case\":\"%s\",\"function\":\"%s\",\"bytes\":%lu,"
+        "\"iterations\":%lu,\"repetitions\":%lu",
+        p_case->name,
+        p_case->function,
+        (unsigned long)p_case->bytes,
+        (unsigned long)g_MBBenchCodec_Iterations,
+        (unsigned long)g_MBBenchCodec_Repetitions
+    );
+    MBBench_PrintRatio(p_file, "ns_per_byte", timeMedian, bytes, DEF_YES);
+    MBBench_PrintRatio(p_file, "ns_per_byte_min", timeMin, bytes, DEF_YES);
+    MBBench_PrintRatio(
+        p_file,
+        "cpu_ns_per_byte",
+        MBBench_Percentile(cpuTimes, g_MBBenchCodec_Repetitions, MBBENCH_PERCENTILE_P50),
+        bytes,
+        DEF_YES
+    );
+    MBBench_PrintRatio(
+        p_file,
+        "cycles_per_byte",
+        MBBench_Percentile(cycles, g_MBBenchCodec_Repetitions, MBBENCH_PERCENTILE_P50),
+        bytes,
+        MBBench_CountersHasCycles(p_counters)
+    );
+    MBBench_PrintRatio(
+        p_file,
+        "instructions_per_byte",
+        MBBench_Percentile(instructions, g_MBBenchCodec_Repetitions, MBBENCH_PERCENTILE_P50),
+        bytes,
+        MBBench_CountersHasInstructions(p_counters)
+    );
+    fprintf(p_file, "}\n");
+    fflush(p_file);
+
+    /*  Summary.  */
+    fprintf(
+        stderr,
+        "%-16s %-28s %8.3f ns/B (min %.3f)\n",
+        p_case->name,
+        p_case->function,
+        (double)timeMedian / (double)bytes,
+        (double)timeMin / (double)bytes
+    );
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_Codec_Usage()
+*
+* Description : Print the usage of the benchmark.
+*
+* Argument(s) : (1) prog        Name of the program.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBBench_Codec_Usage(
+    const char              *prog
+) {
+    fprintf(
+        stderr,
+        "Usage: %s [-c enc_rtu,dec_rtu,enc_ascii,dec_ascii,fetch_u16be,emit_u16be,crc16_bytewise,\n"
+        "          crc16_table,crc16_slicing4,crc16_slicing8,crc16_nibble] [-n iterations]\n"
+        "          [-r repetitions] [-o output.jsonl]\n",
+        prog
+    );
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                               BENCHMARK
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                            CRC-16 Engines
+*
+* File      : MB_BENCH_CRC16.C
+* Version   : V1.0.320
+* By        : Ji WenCong
+*
+* Note(s)   : (1) Builds the default port CRC-16 implementation (Port/Default/mbport_crc16.c) for the engine
+*                 selected by MB_CFG_PORT_CRC16_ENGINE, with its functions renamed after the engine (see
+*                 mb_bench_crc16.h). Compile this file once per engine, for example:
+*
+*                     cc -c -DMB_CFG_PORT_CRC16_ENGINE=MBPORT_CRC16_ENGINE_SLICING8 ... mb_bench_crc16.c
+*
+*             (2) The hardware engine is not supported (there is no implementation to build).
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include <mbport_cfg.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#if   (MB_CFG_PORT_CRC16_ENGINE == MBPORT_CRC16_ENGINE_TABLE)
+#define MBPort_CRC16_InitializeTable      MBBench_CRC16_InitializeTableTable
+#define MBPort_CRC16_GetTableItem         MBBench_CRC16_GetTableItemTable
+#define MBPort_CRC16_Compute              MBBench_CRC16_ComputeTable
+#elif (MB_CFG_PORT_CRC16_ENGINE == MBPORT_CRC16_ENGINE_SLICING4)
+#define MBPort_CRC16_InitializeTable      MBBench_CRC16_InitializeTableSlicing4
+#define MBPort_CRC16_GetTableItem         MBBench_CRC16_GetTableItemSlicing4
+#define MBPort_CRC16_Compute              MBBench_CRC16_ComputeSlicing4
+#elif (MB_CFG_PORT_CRC16_ENGINE == MBPORT_CRC16_ENGINE_SLICING8)
+#define MBPort_CRC16_InitializeTable      MBBench_CRC16_InitializeTableSlicing8
+#define MBPort_CRC16_GetTableItem         MBBench_CRC16_GetTableItemSlicing8
+#define MBPort_CRC16_Compute              MBBench_CRC16_ComputeSlicing8
+#elif (MB_CFG_PORT_CRC16_ENGINE == MBPORT_CRC16_ENGINE_NIBBLE)
+#define MBPort_CRC16_InitializeTable      MBBench_CRC16_InitializeTableNibble
+#define MBPort_CRC16_GetTableItem         MBBench_CRC16_GetTableItemNibble
+#define MBPort_CRC16_Compute              MBBench_CRC16_ComputeNibble
+#else
+#    error  "MB_BENCH_CRC16.C can't be built for the hardware CRC-16 engine."
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        PORT IMPLEMENTATION
+*********************************************************************************************************
+*/
+
+#include <mb_bench_crc16.h>
+
+#include <mbport_crc16.c>
\ No newline at end of file
@@ -0,0 +1,113 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                               BENCHMARK
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                            CRC-16 Engines
+*
+* File      : MB_BENCH_CRC16.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*
+* Note(s)   : (1) MB_BENCH_CRC16.C is compiled once per CRC-16 engine (with -DMB_CFG_PORT_CRC16_ENGINE=...),
+*                 each object provides the port CRC-16 functions of one engine under the names below, so
+*                 that all engines could be compared in one binary.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef MB_BENCH_CRC16_H__
+#define MB_BENCH_CRC16_H__
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                  MBBench_CRC16_Compute<Engine>()
+*
+* Description : MBPort_CRC16_Compute() of the table, slicing-by-4, slicing-by-8 and nibble engines.
+*
+* Argument(s) : p_data  Pointer to the first character.
+*               size    Count of characters.
+*               seed    The initial CRC-16 value.
+*
+* Return(s)   : The CRC-16 value.
+*********************************************************************************************************
+*/
+
+CPU_INT16U MBBench_CRC16_ComputeTable(
+    const CPU_INT08U  *p_data,
+    CPU_SIZE_T         size,
+    CPU_INT16U         seed
+);
+
+CPU_INT16U MBBench_CRC16_ComputeSlicing4(
+    const CPU_INT08U  *p_data,
+    CPU_SIZE_T         size,
+    CPU_INT16U         seed
+);
+
+CPU_INT16U MBBench_CRC16_ComputeSlicing8(
+    const CPU_INT08U  *p_data,
+    CPU_SIZE_T         size,
+    CPU_INT16U         seed
+);
+
+CPU_INT16U MBBench_CRC16_ComputeNibble(
+    const CPU_INT08U  *p_data,
+    CPU_SIZE_T         size,
+    CPU_INT16U         seed
+);
+
+
+/*
+*********************************************************************************************************
+*                                MBBench_CRC16_GetTableItemTable()
+*
+* Description : MBPort_CRC16_GetTableItem() of the table engine (the g_CRC16Table lookup that the Modbus
+*               core did once per character before MBPort_CRC16_Compute() was added).
+*
+* Argument(s) : offset  The offset of the item.
+*
+* Return(s)   : The item.
+*********************************************************************************************************
+*/
+
+CPU_INT16U MBBench_CRC16_GetTableItemTable(CPU_INT08U offset);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
\ No newline at end of file
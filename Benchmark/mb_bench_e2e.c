@@ -0,0 +1,1655 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                               BENCHMARK
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                      End-to-End Master/Slave Benchmark
+*
+* File      : MB_BENCH_E2E.C
+* Version   : V1.0.320
+* By        : Ji WenCong
+*
+* Note(s)   : (1) A master and a slave talk to each other over a pair of simulated UARTs (MBDRV_SIM0 and
+*                 MBDRV_SIM1) on the POSIX port. For each transmission mode, baud rate, function code and
+*                 payload size, the benchmark reports the transactions per second, the request latency
+*                 percentiles and the CPU cost per byte of MB_ReceiveFrame() and MB_TransmitFrame().
+*             (2) The results are printed as JSON lines (one header record and one record per case), so
+*                 that the results of two versions could be compared line by line.
+*             (3) MB_ReceiveFrame() and MB_TransmitFrame() are measured by wrapping them at link time, the
+*                 benchmark must be linked with:
+*
+*                     -Wl,--wrap=MB_ReceiveFrame -Wl,--wrap=MB_TransmitFrame
+*
+*                 The cost is measured in the thread that calls the function (the master task or the slave
+*                 task), the time spent by the RX/TX interrupts of the simulated UARTs is not included.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include <mb_bench.h>
+
+#include <mb.h>
+#include <mb_core.h>
+
+#include <mbmaster.h>
+#include <mbmaster_cmdlet_maskwriteregister.h>
+#include <mbmaster_cmdlet_readcoils.h>
+#include <mbmaster_cmdlet_readdiscreteinputs.h>
+#include <mbmaster_cmdlet_readholdregisters.h>
+#include <mbmaster_cmdlet_readinputregisters.h>
+#include <mbmaster_cmdlet_rwmultipleregisters.h>
+#include <mbmaster_cmdlet_writemultiplecoils.h>
+#include <mbmaster_cmdlet_writemultipleregisters.h>
+#include <mbmaster_cmdlet_writesinglecoil.h>
+#include <mbmaster_cmdlet_writesingleregister.h>
+
+#include <mbslave.h>
+#include <mbslave_cmdtable.h>
+#include <mbslave_datamodel.h>
+
+#include <mbdrv_sim.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/*  Address of the slave.  */
+#define MBBENCH_E2E_SLAVEADDRESS                  ((CPU_INT08U)1U)
+
+/*  Size of the frame buffers.  */
+#define MBBENCH_E2E_BUFSIZE                       ((CPU_SIZE_T)256U)
+
+/*  Size of the data areas of the slave.  */
+#define MBBENCH_E2E_BITCNT                        ((CPU_INT16U)2000U)
+#define MBBENCH_E2E_REGCNT                        ((CPU_INT16U)256U)
+
+/*  Poll timeout of the slave task (unit: milliseconds, must be longer than the longest ASCII frame, the
+    timeout of MB_ReceiveFrame() covers the whole frame in ASCII mode).  */
+#define MBBENCH_E2E_POLLTIMEOUT                   ((MB_TIMESPAN)1000U)
+
+/*  Maximum count of baud rates, modes and function codes on the command line.  */
+#define MBBENCH_E2E_LIST_MAX                      ((CPU_SIZE_T)16U)
+
+/*  Defaults of the command line options.  */
+#define MBBENCH_E2E_DEFAULT_MAXCNT                ((CPU_SIZE_T)1000U)
+#define MBBENCH_E2E_DEFAULT_BUDGET                ((CPU_INT32U)1000U)
+#define MBBENCH_E2E_DEFAULT_TIMEOUT               ((MB_TIMESPAN)1000U)
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+/*  A benchmark case (function code and payload size).  */
+typedef struct {
+    CPU_INT08U              fc;
+    CPU_INT16U              qty;
+    CPU_INT16U              qtyWrite;
+} MBBENCH_E2E_CASE;
+
+/*  Cost accumulated by the wrappers of MB_ReceiveFrame() and MB_TransmitFrame().  */
+typedef struct {
+    CPU_INT64U              frames;
+    CPU_INT64U              bytes;
+    CPU_INT64U              cpuTime;
+    CPU_INT64U              cycles;
+} MBBENCH_E2E_COST;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void __real_MB_ReceiveFrame(
+    MB_IFINDEX               ifnbr,
+    CPU_INT08U              *p_buffer,
+    CPU_SIZE_T               buffer_size,
+    MB_FRAME                *p_frame,
+    MB_FRAMEFLAGS           *p_frameflags,
+    MB_TIMESPAN              timeout,
+    MB_ERROR                *p_error
+);
+
+void __real_MB_TransmitFrame(
+    MB_IFINDEX               ifnbr,
+    MB_FRAME                *p_frame,
+    MB_ERROR                *p_error
+);
+
+void __wrap_MB_ReceiveFrame(
+    MB_IFINDEX               ifnbr,
+    CPU_INT08U              *p_buffer,
+    CPU_SIZE_T               buffer_size,
+    MB_FRAME                *p_frame,
+    MB_FRAMEFLAGS           *p_frameflags,
+    MB_TIMESPAN              timeout,
+    MB_ERROR                *p_error
+);
+
+void __wrap_MB_TransmitFrame(
+    MB_IFINDEX               ifnbr,
+    MB_FRAME                *p_frame,
+    MB_ERROR                *p_error
+);
+
+static MBBENCH_COUNTERS *MBBench_E2E_ThreadCounters(void);
+
+static void MBBench_E2E_AddCost(
+    MBBENCH_E2E_COST        *p_cost,
+    MBBENCH_SAMPLE          *p_begin,
+    MBBENCH_SAMPLE          *p_end,
+    CPU_SIZE_T               bytes
+);
+
+static CPU_SIZE_T MBBench_E2E_WireSize(
+    MB_FRAME                *p_frame
+);
+
+static void *MBBench_E2E_SlaveTask(
+    void                    *p_arg
+);
+
+static void MBBench_E2E_Setup(void);
+
+static CPU_BOOLEAN MBBench_E2E_RunConfig(
+    MB_TRMODE                mode,
+    MB_BAUDRATE              baudrate
+);
+
+static CPU_BOOLEAN MBBench_E2E_Post(
+    const MBBENCH_E2E_CASE  *p_case
+);
+
+static void MBBench_E2E_RunCase(
+    MB_TRMODE                mode,
+    MB_BAUDRATE              baudrate,
+    const MBBENCH_E2E_CASE  *p_case
+);
+
+static void MBBench_E2E_GetLineErrors(
+    MB_COUNTERVALUE         *p_overrun,
+    MB_COUNTERVALUE         *p_drop
+);
+
+static CPU_BOOLEAN MBBench_E2E_ParseList(
+    const char              *arg,
+    CPU_INT32U              *p_list,
+    CPU_SIZE_T              *p_cnt
+);
+
+static void MBBench_E2E_Usage(
+    const char              *prog
+);
+
+static void MBBench_E2E_OnBitValue(
+    CPU_INT16U               address,
+    CPU_BOOLEAN              value,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+static void MBBench_E2E_OnRegValue(
+    CPU_INT16U               address,
+    CPU_INT16U               value,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+static void MBBench_E2E_OnCoilWritten(
+    CPU_INT16U               address,
+    CPU_BOOLEAN              value,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+static void MBBench_E2E_OnRegWritten(
+    CPU_INT16U               address,
+    CPU_INT16U               value,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+static void MBBench_E2E_OnRegMaskWritten(
+    CPU_INT16U               address,
+    CPU_INT16U               andMask,
+    CPU_INT16U               orMask,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+static void MBBench_E2E_OnCoilsWritten(
+    CPU_INT16U               startAddress,
+    CPU_INT16U               quantity,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+static void MBBench_E2E_OnRegsWritten(
+    CPU_INT16U               startAddress,
+    CPU_INT16U               quantity,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+static CPU_BOOLEAN MBBench_E2E_GetBit(
+    const CPU_INT08U        *p_bitmap,
+    CPU_INT16U               address
+);
+
+static CPU_BOOLEAN MBBench_E2E_CheckRegs(
+    CPU_INT16U               startAddress,
+    const CPU_INT16U        *p_values,
+    CPU_INT16U               quantity
+);
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/*  Benchmark cases.  */
+static const MBBENCH_E2E_CASE  g_MBBenchE2E_Cases[] = {
+    { MB_FNCODE_READCOILS,                  1U,    0U },
+    { MB_FNCODE_READCOILS,                200U,    0U },
+    { MB_FNCODE_READCOILS,               2000U,    0U },
+    { MB_FNCODE_READDISCRETEINPUTS,         1U,    0U },
+    { MB_FNCODE_READDISCRETEINPUTS,       200U,    0U },
+    { MB_FNCODE_READDISCRETEINPUTS,      2000U,    0U },
+    { MB_FNCODE_READHOLDINGREGISTERS,       1U,    0U },
+    { MB_FNCODE_READHOLDINGREGISTERS,      32U,    0U },
+    { MB_FNCODE_READHOLDINGREGISTERS,     125U,    0U },
+    { MB_FNCODE_READINPUTREGISTERS,         1U,    0U },
+    { MB_FNCODE_READINPUTREGISTERS,        32U,    0U },
+    { MB_FNCODE_READINPUTREGISTERS,       125U,    0U },
+    { MB_FNCODE_WRITESINGLECOIL,            1U,    0U },
+    { MB_FNCODE_WRITESINGLEREGISTER,        1U,    0U },
+    { MB_FNCODE_WRITEMULTIPLECOILS,         1U,    0U },
+    { MB_FNCODE_WRITEMULTIPLECOILS,       200U,    0U },
+    { MB_FNCODE_WRITEMULTIPLECOILS,      1968U,    0U },
+    { MB_FNCODE_WRITEMULTIPLEREGISTERS,     1U,    0U },
+    { MB_FNCODE_WRITEMULTIPLEREGISTERS,    32U,    0U },
+    { MB_FNCODE_WRITEMULTIPLEREGISTERS,   123U,    0U },
+    { MB_FNCODE_MASKWRITEREGISTER,          1U,    0U },
+    { MB_FNCODE_READWRITEMULTIPLEREGISTERS, 1U,    1U },
+    { MB_FNCODE_READWRITEMULTIPLEREGISTERS, 32U,  32U },
+    { MB_FNCODE_READWRITEMULTIPLEREGISTERS, 125U, 121U }
+};
+
+/*  Default baud rates.  */
+static const CPU_INT32U        g_MBBenchE2E_DefaultBaudrates[] = {
+    9600U,
+    115200U,
+    921600U
+};
+
+/*  Command line options.  */
+static CPU_INT32U              g_MBBenchE2E_Baudrates[MBBENCH_E2E_LIST_MAX];
+static CPU_SIZE_T              g_MBBenchE2E_BaudrateCnt;
+static CPU_INT32U              g_MBBenchE2E_FunctionCodes[MBBENCH_E2E_LIST_MAX];
+static CPU_SIZE_T              g_MBBenchE2E_FunctionCodeCnt;
+static CPU_BOOLEAN             g_MBBenchE2E_RunRTU;
+static CPU_BOOLEAN             g_MBBenchE2E_RunASCII;
+static CPU_SIZE_T              g_MBBenchE2E_MaxCnt;
+static CPU_INT32U              g_MBBenchE2E_Budget;
+static MB_TIMESPAN             g_MBBenchE2E_Timeout;
+static FILE                   *g_MBBenchE2E_Output;
+
+/*  Devices, master and slave.  */
+static MB_IFINDEX              g_MBBenchE2E_MasterIf;
+static MB_IFINDEX              g_MBBenchE2E_SlaveIf;
+static MBMASTER                g_MBBenchE2E_Master;
+static MBSLAVE                 g_MBBenchE2E_Slave;
+static MBSLAVE_CMDTABLE        g_MBBenchE2E_CmdTable;
+static MBSLAVE_DATAMODEL       g_MBBenchE2E_DataModel;
+static CPU_INT08U              g_MBBenchE2E_MasterBuf[MBBENCH_E2E_BUFSIZE];
+#if (MB_CFG_SLAVE_INPLACERESPONSE_EN == DEF_ENABLED)
+static CPU_INT08U              g_MBBenchE2E_SlaveBuf[MBBENCH_E2E_BUFSIZE];
+#else
+static CPU_INT08U              g_MBBenchE2E_SlaveRcvBuf[MBBENCH_E2E_BUFSIZE];
+static CPU_INT08U              g_MBBenchE2E_SlaveSndBuf[MBBENCH_E2E_BUFSIZE];
+#endif
+
+/*  Data areas of the slave.  */
+static CPU_INT08U              g_MBBenchE2E_Coils[(MBBENCH_E2E_BITCNT + 7U) / 8U];
+static CPU_INT08U              g_MBBenchE2E_DiscreteInputs[(MBBENCH_E2E_BITCNT + 7U) / 8U];
+static CPU_INT16U              g_MBBenchE2E_HoldingRegs[MBBENCH_E2E_REGCNT];
+static CPU_INT16U              g_MBBenchE2E_InputRegs[MBBENCH_E2E_REGCNT];
+
+/*  Values written by the master.  */
+static CPU_BOOLEAN             g_MBBenchE2E_CoilValues[MBBENCH_E2E_BITCNT];
+static CPU_INT16U              g_MBBenchE2E_RegValues[MBBENCH_E2E_REGCNT];
+
+/*  Slave task.  */
+static pthread_t               g_MBBenchE2E_SlaveThread;
+static volatile CPU_BOOLEAN    g_MBBenchE2E_SlaveStop;
+
+/*  Count of items (values read or writes confirmed) of the current transaction.  */
+static CPU_SIZE_T              g_MBBenchE2E_Items;
+
+/*  Cost of MB_ReceiveFrame() and MB_TransmitFrame() of the current case.  */
+static pthread_mutex_t         g_MBBenchE2E_CostLock = PTHREAD_MUTEX_INITIALIZER;
+static MBBENCH_E2E_COST        g_MBBenchE2E_RxCost;
+static MBBENCH_E2E_COST        g_MBBenchE2E_TxCost;
+static CPU_BOOLEAN             g_MBBenchE2E_CyclesValid = DEF_YES;
+static volatile MB_TRMODE      g_MBBenchE2E_Mode;
+
+/*  Performance counters of each thread.  */
+static __thread MBBENCH_COUNTERS  g_MBBenchE2E_TlsCounters;
+static __thread CPU_BOOLEAN       g_MBBenchE2E_TlsOpened;
+
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Entry of the end-to-end benchmark.
+*
+* Argument(s) : (1) argc        Count of command line arguments.
+*               (2) argv        The command line arguments:
+*
+*                                   -m <modes>      Transmission modes ("rtu", "ascii" or "rtu,ascii").
+*                                   -b <baudrates>  Baud rates (e.g. "9600,115200,921600").
+*                                   -f <fcs>        Function codes (decimal, e.g. "3,16"; all by default).
+*                                   -n <count>      Maximum count of transactions per case.
+*                                   -t <ms>         Time budget per case (unit: milliseconds).
+*                                   -T <ms>         Response timeout of the master (unit: milliseconds).
+*                                   -s <factor>     Speed factor of the simulated lines (see
+*                                                   MBDrv_Sim_SetSpeedFactor()).
+*                                   -o <file>       Output file of the JSON lines (stdout by default).
+*
+* Return(s)   : 0 if succeed, 1 if failed.
+*
+* Note(s)     : (1) A case runs until the count of transactions or the time budget is reached (but at least
+*                   one transaction).
+*               (2) A human readable summary of each case is printed to stderr.
+*********************************************************************************************************
+*/
+
+int main(
+    int                      argc,
+    char                   **argv
+) {
+    CPU_INT32U        modes[MBBENCH_E2E_LIST_MAX];
+    CPU_SIZE_T        modeCnt;
+    CPU_SIZE_T        i;
+    CPU_SIZE_T        j;
+    const char       *pModes;
+    const char       *pOutput;
+    char             *pEnd;
+    int               opt;
+    MB_ERROR          error;
+    MBBENCH_COUNTERS  counters;
+
+    /*  Defaults.  */
+    g_MBBenchE2E_BaudrateCnt     = sizeof(g_MBBenchE2E_DefaultBaudrates) / sizeof(g_MBBenchE2E_DefaultBaudrates[0]);
+    memcpy(g_MBBenchE2E_Baudrates, g_MBBenchE2E_DefaultBaudrates, sizeof(g_MBBenchE2E_DefaultBaudrates));
+    g_MBBenchE2E_FunctionCodeCnt = (CPU_SIZE_T)0U;
+    g_MBBenchE2E_MaxCnt          = MBBENCH_E2E_DEFAULT_MAXCNT;
+    g_MBBenchE2E_Budget          = MBBENCH_E2E_DEFAULT_BUDGET;
+    g_MBBenchE2E_Timeout         = MBBENCH_E2E_DEFAULT_TIMEOUT;
+    g_MBBenchE2E_Output          = stdout;
+    pModes                       = "rtu,ascii";
+    pOutput                      = (const char*)0;
+
+    /*  Parse the command line.  */
+    while ((opt = getopt(argc, argv, "m:b:f:n:t:T:s:o:h")) != -1) {
+        switch (opt) {
+            case 'm':
+                pModes = optarg;
+                break;
+            case 'b':
+                if (!MBBench_E2E_ParseList(optarg, g_MBBenchE2E_Baudrates, &g_MBBenchE2E_BaudrateCnt)) {
+                    MBBench_E2E_Usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'f':
+                if (!MBBench_E2E_ParseList(optarg, g_MBBenchE2E_FunctionCodes, &g_MBBenchE2E_FunctionCodeCnt)) {
+                    MBBench_E2E_Usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'n':
+                g_MBBenchE2E_MaxCnt = (CPU_SIZE_T)strtoul(optarg, &pEnd, 10);
+                if (*pEnd != '\0' || g_MBBenchE2E_MaxCnt == (CPU_SIZE_T)0U) {
+                    MBBench_E2E_Usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 't':
+                g_MBBenchE2E_Budget = (CPU_INT32U)strtoul(optarg, &pEnd, 10);
+                if (*pEnd != '\0') {
+                    MBBench_E2E_Usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'T':
+                g_MBBenchE2E_Timeout = (MB_TIMESPAN)strtoul(optarg, &pEnd, 10);
+                if (*pEnd != '\0' || g_MBBenchE2E_Timeout == (MB_TIMESPAN)0U) {
+                    MBBench_E2E_Usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 's':
+                MBDrv_Sim_SetSpeedFactor((CPU_INT32U)strtoul(optarg, &pEnd, 10), &error);
+                if (*pEnd != '\0' || error != MB_ERROR_NONE) {
+                    MBBench_E2E_Usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'o':
+                pOutput = optarg;
+                break;
+            default:
+                MBBench_E2E_Usage(argv[0]);
+                return 1;
+        }
+    }
+
+    /*  Parse the modes.  */
+    g_MBBenchE2E_RunRTU   = (strstr(pModes, "rtu") != (char*)0) ? DEF_YES : DEF_NO;
+    g_MBBenchE2E_RunASCII = (strstr(pModes, "ascii") != (char*)0) ? DEF_YES : DEF_NO;
+    modeCnt = (CPU_SIZE_T)0U;
+    if (g_MBBenchE2E_RunRTU) {
+        modes[modeCnt++] = (CPU_INT32U)MB_TRMODE_RTU;
+    }
+    if (g_MBBenchE2E_RunASCII) {
+        modes[modeCnt++] = (CPU_INT32U)MB_TRMODE_ASCII;
+    }
+    if (modeCnt == (CPU_SIZE_T)0U) {
+        MBBench_E2E_Usage(argv[0]);
+        return 1;
+    }
+
+    if (pOutput != (const char*)0) {
+        g_MBBenchE2E_Output = fopen(pOutput, "w");
+        if (g_MBBenchE2E_Output == (FILE*)0) {
+            fprintf(stderr, "Can't open %s.\n", pOutput);
+            return 1;
+        }
+    }
+
+    /*  Initialize the stack, the master and the slave.  */
+    MBBench_E2E_Setup();
+
+    MBBench_CountersOpen(&counters);
+    MBBench_PrintHeader(g_MBBenchE2E_Output, "e2e", &counters);
+    MBBench_CountersClose(&counters);
+
+    /*  Run all configurations.  */
+    for (i = (CPU_SIZE_T)0U; i < modeCnt; ++i) {
+        for (j = (CPU_SIZE_T)0U; j < g_MBBenchE2E_BaudrateCnt; ++j) {
+            if (!MBBench_E2E_RunConfig((MB_TRMODE)modes[i], (MB_BAUDRATE)g_MBBenchE2E_Baudrates[j])) {
+                return 1;
+            }
+        }
+    }
+
+    if (g_MBBenchE2E_Output != stdout) {
+        fclose(g_MBBenchE2E_Output);
+    }
+
+    return 0;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    __wrap_MB_ReceiveFrame()
+*
+* Description : Wrapper of MB_ReceiveFrame() that measures its cost.
+*
+* Argument(s) : Same as MB_ReceiveFrame().
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Only calls that received a frame are accounted, the calls that timed out (the idle polls
+*                   of the slave) are not.
+*********************************************************************************************************
+*/
+
+void __wrap_MB_ReceiveFrame(
+    MB_IFINDEX               ifnbr,
+    CPU_INT08U              *p_buffer,
+    CPU_SIZE_T               buffer_size,
+    MB_FRAME                *p_frame,
+    MB_FRAMEFLAGS           *p_frameflags,
+    MB_TIMESPAN              timeout,
+    MB_ERROR                *p_error
+) {
+    MBBENCH_COUNTERS  *p_counters;
+    MBBENCH_SAMPLE     begin;
+    MBBENCH_SAMPLE     end;
+
+    p_counters = MBBench_E2E_ThreadCounters();
+
+    MBBench_CountersRead(p_counters, &begin);
+    __real_MB_ReceiveFrame(ifnbr, p_buffer, buffer_size, p_frame, p_frameflags, timeout, p_error);
+    MBBench_CountersRead(p_counters, &end);
+
+    if (*p_error == MB_ERROR_NONE) {
+        MBBench_E2E_AddCost(&g_MBBenchE2E_RxCost, &begin, &end, MBBench_E2E_WireSize(p_frame));
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    __wrap_MB_TransmitFrame()
+*
+* Description : Wrapper of MB_TransmitFrame() that measures its cost.
+*
+* Argument(s) : Same as MB_TransmitFrame().
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void __wrap_MB_TransmitFrame(
+    MB_IFINDEX               ifnbr,
+    MB_FRAME                *p_frame,
+    MB_ERROR                *p_error
+) {
+    MBBENCH_COUNTERS  *p_counters;
+    MBBENCH_SAMPLE     begin;
+    MBBENCH_SAMPLE     end;
+    CPU_SIZE_T         bytes;
+
+    p_counters = MBBench_E2E_ThreadCounters();
+    bytes      = MBBench_E2E_WireSize(p_frame);
+
+    MBBench_CountersRead(p_counters, &begin);
+    __real_MB_TransmitFrame(ifnbr, p_frame, p_error);
+    MBBench_CountersRead(p_counters, &end);
+
+    if (*p_error == MB_ERROR_NONE) {
+        MBBench_E2E_AddCost(&g_MBBenchE2E_TxCost, &begin, &end, bytes);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBBench_E2E_ThreadCounters()
+*
+* Description : Get the performance counters of the calling thread (open them at the first call).
+*
+* Argument(s) : None.
+*
+* Return(s)   : Pointer to the counters.
+*
+* Note(s)     : (1) The cycle counts are only reported if the counters of all measured threads are available.
+*********************************************************************************************************
+*/
+
+static MBBENCH_COUNTERS *MBBench_E2E_ThreadCounters(void) {
+    if (!g_MBBenchE2E_TlsOpened) {
+        MBBench_CountersOpen(&g_MBBenchE2E_TlsCounters);
+        g_MBBenchE2E_TlsOpened = DEF_YES;
+
+        pthread_mutex_lock(&g_MBBenchE2E_CostLock);
+        if (!MBBench_CountersHasCycles(&g_MBBenchE2E_TlsCounters)) {
+            g_MBBenchE2E_CyclesValid = DEF_NO;
+        }
+        pthread_mutex_unlock(&g_MBBenchE2E_CostLock);
+    }
+
+    return &g_MBBenchE2E_TlsCounters;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBBench_E2E_AddCost()
+*
+* Description : Accumulate the cost of one call.
+*
+* Argument(s) : (1) p_cost      Pointer to the accumulated cost.
+*               (2) p_begin     Pointer to the sample taken before the call.
+*               (3) p_end       Pointer to the sample taken after the call.
+*               (4) bytes       Count of bytes of the frame on the line.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBBench_E2E_AddCost(
+    MBBENCH_E2E_COST        *p_cost,
+    MBBENCH_SAMPLE          *p_begin,
+    MBBENCH_SAMPLE          *p_end,
+    CPU_SIZE_T               bytes
+) {
+    pthread_mutex_lock(&g_MBBenchE2E_CostLock);
+    p_cost->frames  += (CPU_INT64U)1U;
+    p_cost->bytes   += (CPU_INT64U)bytes;
+    p_cost->cpuTime += p_end->cpuTime - p_begin->cpuTime;
+    p_cost->cycles  += p_end->cycles - p_begin->cycles;
+    pthread_mutex_unlock(&g_MBBenchE2E_CostLock);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_E2E_WireSize()
+*
+* Description : Get the count of bytes of a frame on the line.
+*
+* Argument(s) : (1) p_frame     Pointer to the frame.
+*
+* Return(s)   : The count of bytes.
+*
+* Note(s)     : (1) RTU: address, function code, data and CRC-16. ASCII: ':', the hexadecimal digits of the
+*                   address, the function code, the data and the LRC, then CR and LF.
+*********************************************************************************************************
+*/
+
+static CPU_SIZE_T MBBench_E2E_WireSize(
+    MB_FRAME                *p_frame
+) {
+    if (g_MBBenchE2E_Mode == MB_TRMODE_ASCII) {
+        return (p_frame->dataLength + (CPU_SIZE_T)3U) * (CPU_SIZE_T)2U + (CPU_SIZE_T)3U;
+    }
+
+    return p_frame->dataLength + (CPU_SIZE_T)4U;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_E2E_SlaveTask()
+*
+* Description : Slave task, polls the slave until the configuration is finished.
+*
+* Argument(s) : (1) p_arg       Not used.
+*
+* Return(s)   : Always NULL.
+*********************************************************************************************************
+*/
+
+static void *MBBench_E2E_SlaveTask(
+    void                    *p_arg
+) {
+    MB_ERROR  error;
+
+    (void)p_arg;
+
+    while (!g_MBBenchE2E_SlaveStop) {
+        MBSlave_Poll(&g_MBBenchE2E_Slave, MBBENCH_E2E_POLLTIMEOUT, &error);
+    }
+
+    return (void*)0;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      MBBench_E2E_Setup()
+*
+* Description : Initialize the stack, register the simulated devices and initialize the master and the slave.
+*
+* Argument(s) : None.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Exits the process on failure.
+*               (2) If MB_CFG_SLAVE_INPLACERESPONSE_EN is enabled, the slave is initialized with one single
+*                   RX/TX buffer (MBSlave_InitializeInPlace()), so that the in-place response path is measured.
+*********************************************************************************************************
+*/
+
+static void MBBench_E2E_Setup(void) {
+    CPU_SIZE_T  i;
+    MB_ERROR    error;
+
+    MB_Initialize(&error);
+    if (error != MB_ERROR_NONE) {
+        fprintf(stderr, "MB_Initialize() failed (error=%u).\n", (unsigned int)error);
+        exit(1);
+    }
+
+    g_MBBenchE2E_MasterIf = MB_RegisterDevice(&MBDRV_SIM0_DRIVERDESC, &error);
+    if (error != MB_ERROR_NONE) {
+        fprintf(stderr, "MB_RegisterDevice() failed (error=%u).\n", (unsigned int)error);
+        exit(1);
+    }
+    g_MBBenchE2E_SlaveIf = MB_RegisterDevice(&MBDRV_SIM1_DRIVERDESC, &error);
+    if (error != MB_ERROR_NONE) {
+        fprintf(stderr, "MB_RegisterDevice() failed (error=%u).\n", (unsigned int)error);
+        exit(1);
+    }
+
+    /*  Data areas of the slave.  */
+    for (i = (CPU_SIZE_T)0U; i < sizeof(g_MBBenchE2E_Coils); ++i) {
+        g_MBBenchE2E_Coils[i]          = (CPU_INT08U)(0x5AU ^ (CPU_INT08U)i);
+        g_MBBenchE2E_DiscreteInputs[i] = (CPU_INT08U)(0xA5U ^ (CPU_INT08U)i);
+    }
+    for (i = (CPU_SIZE_T)0U; i < (CPU_SIZE_T)MBBENCH_E2E_REGCNT; ++i) {
+        g_MBBenchE2E_HoldingRegs[i] = (CPU_INT16U)(i * 3U);
+        g_MBBenchE2E_InputRegs[i]   = (CPU_INT16U)(i * 5U);
+        g_MBBenchE2E_RegValues[i]   = (CPU_INT16U)(i * 7U);
+    }
+    for (i = (CPU_SIZE_T)0U; i < (CPU_SIZE_T)MBBENCH_E2E_BITCNT; ++i) {
+        g_MBBenchE2E_CoilValues[i] = ((i % 3U) == 0U) ? DEF_YES : DEF_NO;
+    }
+
+    MBSlave_CmdTable_Initialize(&g_MBBenchE2E_CmdTable, &error);
+    if (error == MB_ERROR_NONE) {
+        MBSlave_DataModel_Initialize(&g_MBBenchE2E_DataModel, &error);
+    }
+    if (error == MB_ERROR_NONE) {
+        MBSlave_DataModel_SetCoils(&g_MBBenchE2E_DataModel, g_MBBenchE2E_Coils, 0U, MBBENCH_E2E_BITCNT, &error);
+    }
+    if (error == MB_ERROR_NONE) {
+        MBSlave_DataModel_SetDiscreteInputs(&g_MBBenchE2E_DataModel, g_MBBenchE2E_DiscreteInputs, 0U, MBBENCH_E2E_BITCNT, &error);
+    }
+    if (error == MB_ERROR_NONE) {
+        MBSlave_DataModel_SetHoldingRegisters(&g_MBBenchE2E_DataModel, g_MBBenchE2E_HoldingRegs, 0U, MBBENCH_E2E_REGCNT, &error);
+    }
+    if (error == MB_ERROR_NONE) {
+        MBSlave_DataModel_SetInputRegisters(&g_MBBenchE2E_DataModel, g_MBBenchE2E_InputRegs, 0U, MBBENCH_E2E_REGCNT, &error);
+    }
+    if (error == MB_ERROR_NONE) {
+        MBSlave_DataModel_Register(&g_MBBenchE2E_DataModel, &g_MBBenchE2E_CmdTable, &error);
+    }
+    if (error == MB_ERROR_NONE) {
+#if (MB_CFG_SLAVE_INPLACERESPONSE_EN == DEF_ENABLED)
+        MBSlave_InitializeInPlace(
+            &g_MBBenchE2E_Slave,
+            &g_MBBenchE2E_CmdTable,
+            g_MBBenchE2E_SlaveIf,
+            g_MBBenchE2E_SlaveBuf,
+            sizeof(g_MBBenchE2E_SlaveBuf),
+            &error
+        );
+#else
+        MBSlave_Initialize(
+            &g_MBBenchE2E_Slave,
+            &g_MBBenchE2E_CmdTable,
+            g_MBBenchE2E_SlaveIf,
+            g_MBBenchE2E_SlaveRcvBuf,
+            sizeof(g_MBBenchE2E_SlaveRcvBuf),
+            g_MBBenchE2E_SlaveSndBuf,
+            sizeof(g_MBBenchE2E_SlaveSndBuf),
+            &error
+        );
+#endif
+    }
+    if (error == MB_ERROR_NONE) {
+        MBSlave_SetAddress(&g_MBBenchE2E_Slave, MBBENCH_E2E_SLAVEADDRESS, &error);
+    }
+    if (error != MB_ERROR_NONE) {
+        fprintf(stderr, "Failed to initialize the slave (error=%u).\n", (unsigned int)error);
+        exit(1);
+    }
+
+    MBMaster_Initialize(
+        &g_MBBenchE2E_Master,
+        g_MBBenchE2E_MasterIf,
+        g_MBBenchE2E_MasterBuf,
+        sizeof(g_MBBenchE2E_MasterBuf),
+        &error
+    );
+    if (error != MB_ERROR_NONE) {
+        fprintf(stderr, "Failed to initialize the master (error=%u).\n", (unsigned int)error);
+        exit(1);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_E2E_RunConfig()
+*
+* Description : Run all selected cases with one transmission mode and one baud rate.
+*
+* Argument(s) : (1) mode        The transmission mode.
+*               (2) baudrate    The baud rate.
+*
+* Return(s)   : DEF_YES if succeed, DEF_NO if the devices couldn't be opened.
+*
+* Note(s)     : (1) ASCII mode uses 7 data bits with even parity, RTU mode uses 8 data bits without parity.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBBench_E2E_RunConfig(
+    MB_TRMODE                mode,
+    MB_BAUDRATE              baudrate
+) {
+    MB_SERIAL_SETUP  setup;
+    MB_ERROR         error;
+    CPU_SIZE_T       i;
+    CPU_SIZE_T       j;
+    CPU_BOOLEAN      selected;
+
+    setup.baudrate = baudrate;
+    setup.stopBits = MB_SERIAL_STOPBITS_1;
+    if (mode == MB_TRMODE_ASCII) {
+        setup.dataBits = MB_SERIAL_DATABITS_7;
+        setup.parity   = MB_SERIAL_PARITY_EVEN;
+    } else {
+        setup.dataBits = MB_SERIAL_DATABITS_8;
+        setup.parity   = MB_SERIAL_PARITY_NONE;
+    }
+
+    g_MBBenchE2E_Mode = mode;
+
+    MB_OpenDevice(g_MBBenchE2E_MasterIf, mode, &setup, &error);
+    if (error != MB_ERROR_NONE) {
+        fprintf(stderr, "MB_OpenDevice() failed (baudrate=%lu, error=%u).\n", (unsigned long)baudrate, (unsigned int)error);
+        return DEF_NO;
+    }
+    MB_OpenDevice(g_MBBenchE2E_SlaveIf, mode, &setup, &error);
+    if (error != MB_ERROR_NONE) {
+        fprintf(stderr, "MB_OpenDevice() failed (baudrate=%lu, error=%u).\n", (unsigned long)baudrate, (unsigned int)error);
+        MB_CloseDevice(g_MBBenchE2E_MasterIf, &error);
+        return DEF_NO;
+    }
+
+    /*  Start the slave task.  */
+    g_MBBenchE2E_SlaveStop = DEF_NO;
+    if (pthread_create(&g_MBBenchE2E_SlaveThread, (const pthread_attr_t*)0, MBBench_E2E_SlaveTask, (void*)0) != 0) {
+        fprintf(stderr, "Failed to create the slave task.\n");
+        MB_CloseDevice(g_MBBenchE2E_SlaveIf, &error);
+        MB_CloseDevice(g_MBBenchE2E_MasterIf, &error);
+        return DEF_NO;
+    }
+
+    for (i = (CPU_SIZE_T)0U; i < sizeof(g_MBBenchE2E_Cases) / sizeof(g_MBBenchE2E_Cases[0]); ++i) {
+        selected = (g_MBBenchE2E_FunctionCodeCnt == (CPU_SIZE_T)0U) ? DEF_YES : DEF_NO;
+        for (j = (CPU_SIZE_T)0U; j < g_MBBenchE2E_FunctionCodeCnt; ++j) {
+            if (g_MBBenchE2E_FunctionCodes[j] == (CPU_INT32U)g_MBBenchE2E_Cases[i].fc) {
+                selected = DEF_YES;
+            }
+        }
+        if (selected) {
+            MBBench_E2E_RunCase(mode, baudrate, &(g_MBBenchE2E_Cases[i]));
+        }
+    }
+
+    /*  Stop the slave task.  */
+    g_MBBenchE2E_SlaveStop = DEF_YES;
+    pthread_join(g_MBBenchE2E_SlaveThread, (void**)0);
+
+    MB_CloseDevice(g_MBBenchE2E_SlaveIf, &error);
+    MB_CloseDevice(g_MBBenchE2E_MasterIf, &error);
+
+    return DEF_YES;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      MBBench_E2E_Post()
+*
+* Description : Post one request of a case and wait for the response.
+*
+* Argument(s) : (1) p_case      Pointer to the case.
+*
+* Return(s)   : DEF_YES if the transaction succeeded, DEF_NO if not.
+*
+* Note(s)     : (1) A transaction succeeds if the master reports no error and all values are read (or the
+*                   write is confirmed).
+*               (2) The master and the slave share the process, so each value read (or confirmed) is checked
+*                   against the data areas of the slave, and the registers written by 0x17 are checked after
+*                   the response. A mismatch fails the transaction, so that a response built wrongly (e.g.
+*                   in-place response overwriting request data that is still needed) could be noticed.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBBench_E2E_Post(
+    const MBBENCH_E2E_CASE  *p_case
+) {
+    MB_ERROR                                        error;
+    CPU_SIZE_T                                      expected;
+    MBMASTER_CMDLET                                *p_cmdlet;
+    void                                           *p_request;
+    void                                           *p_response;
+    void                                           *p_responsearg;
+    MBMASTER_CMDLET_READCOILS_REQUEST               rqReadCoils;
+    MBMASTER_CMDLET_READCOILS_RESPONSE              rsReadCoils;
+    MBMASTER_CMDLET_READDISCRETEINPUTS_REQUEST      rqReadDiscreteInputs;
+    MBMASTER_CMDLET_READDISCRETEINPUTS_RESPONSE     rsReadDiscreteInputs;
+    MBMASTER_CMDLET_READHOLDINGREGISTERS_REQUEST    rqReadHoldingRegs;
+    MBMASTER_CMDLET_READHOLDINGREGISTERS_RESPONSE   rsReadHoldingRegs;
+    MBMASTER_CMDLET_READINPUTREGISTERS_REQUEST      rqReadInputRegs;
+    MBMASTER_CMDLET_READINPUTREGISTERS_RESPONSE     rsReadInputRegs;
+    MBMASTER_CMDLET_WRITESINGLECOIL_REQUEST         rqWriteSingleCoil;
+    MBMASTER_CMDLET_WRITESINGLECOIL_RESPONSE        rsWriteSingleCoil;
+    MBMASTER_CMDLET_WRITESINGLEREGISTER_REQUEST     rqWriteSingleReg;
+    MBMASTER_CMDLET_WRITESINGLEREGISTER_RESPONSE    rsWriteSingleReg;
+    MBMASTER_CMDLET_WRITEMULTIPLECOILS_REQUEST      rqWriteMultipleCoils;
+    MBMASTER_CMDLET_WRITEMULTIPLECOILS_RESPONSE     rsWriteMultipleCoils;
+    MBMASTER_CMDLET_WRITEMULTIPLEREGISTERS_REQUEST  rqWriteMultipleRegs;
+    MBMASTER_CMDLET_WRITEMULTIPLEREGISTERS_RESPONSE rsWriteMultipleRegs;
+    MBMASTER_CMDLET_MASKWRITEREGISTER_REQUEST       rqMaskWriteReg;
+    MBMASTER_CMDLET_MASKWRITEREGISTER_RESPONSE      rsMaskWriteReg;
+    MBMASTER_CMDLET_RWMULTIPLEREGISTERS_REQUEST     rqReadWriteRegs;
+    MBMASTER_CMDLET_RWMULTIPLEREGISTERS_RESPONSE    rsReadWriteRegs;
+
+    expected = (CPU_SIZE_T)1U;
+
+    switch (p_case->fc) {
+        case MB_FNCODE_READCOILS:
+            memset(&rsReadCoils, 0, sizeof(rsReadCoils));
+            rqReadCoils.coilStartAddress  = 0U;
+            rqReadCoils.coilQuantity      = p_case->qty;
+            rsReadCoils.cbCoilValueUpdate = MBBench_E2E_OnBitValue;
+            p_cmdlet      = MBMASTER_CMDLETDESCRIPTOR_READCOILS;
+            p_request     = &rqReadCoils;
+            p_response    = &rsReadCoils;
+            p_responsearg = g_MBBenchE2E_Coils;
+            expected      = (CPU_SIZE_T)p_case->qty;
+            break;
+        case MB_FNCODE_READDISCRETEINPUTS:
+            memset(&rsReadDiscreteInputs, 0, sizeof(rsReadDiscreteInputs));
+            rqReadDiscreteInputs.discreteInputStartAddress  = 0U;
+            rqReadDiscreteInputs.discreteInputQuantity      = p_case->qty;
+            rsReadDiscreteInputs.cbDiscreteInputValueUpdate = MBBench_E2E_OnBitValue;
+            p_cmdlet      = MBMASTER_CMDLETDESCRIPTOR_READDISCRETEINPUTS;
+            p_request     = &rqReadDiscreteInputs;
+            p_response    = &rsReadDiscreteInputs;
+            p_responsearg = g_MBBenchE2E_DiscreteInputs;
+            expected      = (CPU_SIZE_T)p_case->qty;
+            break;
+        case MB_FNCODE_READHOLDINGREGISTERS:
+            memset(&rsReadHoldingRegs, 0, sizeof(rsReadHoldingRegs));
+            rqReadHoldingRegs.hregStartAddress  = 0U;
+            rqReadHoldingRegs.hregQuantity      = p_case->qty;
+            rsReadHoldingRegs.cbHRegValueUpdate = MBBench_E2E_OnRegValue;
+            p_cmdlet      = MBMASTER_CMDLETDESCRIPTOR_READHOLDINGREGISTERS;
+            p_request     = &rqReadHoldingRegs;
+            p_response    = &rsReadHoldingRegs;
+            p_responsearg = g_MBBenchE2E_HoldingRegs;
+            expected      = (CPU_SIZE_T)p_case->qty;
+            break;
+        case MB_FNCODE_READINPUTREGISTERS:
+            memset(&rsReadInputRegs, 0, sizeof(rsReadInputRegs));
+            rqReadInputRegs.iregStartAddress  = 0U;
+            rqReadInputRegs.iregQuantity      = p_case->qty;
+            rsReadInputRegs.cbIRegValueUpdate = MBBench_E2E_OnRegValue;
+            p_cmdlet      = MBMASTER_CMDLETDESCRIPTOR_READINPUTREGISTERS;
+            p_request     = &rqReadInputRegs;
+            p_response    = &rsReadInputRegs;
+            p_responsearg = g_MBBenchE2E_InputRegs;
+            expected      = (CPU_SIZE_T)p_case->qty;
+            break;
+        case MB_FNCODE_WRITESINGLECOIL:
+            memset(&rsWriteSingleCoil, 0, sizeof(rsWriteSingleCoil));
+            rqWriteSingleCoil.coilAddress = 1U;
+            rqWriteSingleCoil.coilValue   = DEF_YES;
+            rsWriteSingleCoil.cbComplete  = MBBench_E2E_OnCoilWritten;
+            p_cmdlet      = MBMASTER_CMDLETDESCRIPTOR_WRITESINGLECOIL;
+            p_request     = &rqWriteSingleCoil;
+            p_response    = &rsWriteSingleCoil;
+            p_responsearg = &rqWriteSingleCoil;
+            break;
+        case MB_FNCODE_WRITESINGLEREGISTER:
+            memset(&rsWriteSingleReg, 0, sizeof(rsWriteSingleReg));
+            rqWriteSingleReg.hregAddress = 1U;
+            rqWriteSingleReg.hregValue   = 0x1234U;
+            rsWriteSingleReg.cbComplete  = MBBench_E2E_OnRegWritten;
+            p_cmdlet      = MBMASTER_CMDLETDESCRIPTOR_WRITESINGLEREGISTER;
+            p_request     = &rqWriteSingleReg;
+            p_response    = &rsWriteSingleReg;
+            p_responsearg = &rqWriteSingleReg;
+            break;
+        case MB_FNCODE_WRITEMULTIPLECOILS:
+            memset(&rsWriteMultipleCoils, 0, sizeof(rsWriteMultipleCoils));
+            rqWriteMultipleCoils.coilStartAddress = 0U;
+            rqWriteMultipleCoils.coilValues       = g_MBBenchE2E_CoilValues;
+            rqWriteMultipleCoils.coilQuantity     = p_case->qty;
+            rsWriteMultipleCoils.cbComplete       = MBBench_E2E_OnCoilsWritten;
+            p_cmdlet      = MBMASTER_CMDLETDESCRIPTOR_WRITEMULTIPLECOILS;
+            p_request     = &rqWriteMultipleCoils;
+            p_response    = &rsWriteMultipleCoils;
+            p_responsearg = &rqWriteMultipleCoils;
+            break;
+        case MB_FNCODE_WRITEMULTIPLEREGISTERS:
+            memset(&rsWriteMultipleRegs, 0, sizeof(rsWriteMultipleRegs));
+            rqWriteMultipleRegs.hregStartAddress = 0U;
+            rqWriteMultipleRegs.hregValues       = g_MBBenchE2E_RegValues;
+            rqWriteMultipleRegs.hregQuantity     = p_case->qty;
+            rsWriteMultipleRegs.cbComplete       = MBBench_E2E_OnRegsWritten;
+            p_cmdlet      = MBMASTER_CMDLETDESCRIPTOR_WRITEMULTIPLEREGISTERS;
+            p_request     = &rqWriteMultipleRegs;
+            p_response    = &rsWriteMultipleRegs;
+            p_responsearg = &rqWriteMultipleRegs;
+            break;
+        case MB_FNCODE_MASKWRITEREGISTER:
+            memset(&rsMaskWriteReg, 0, sizeof(rsMaskWriteReg));
+            rqMaskWriteReg.hregAddress = 2U;
+            rqMaskWriteReg.hregAndMask = 0xF0F0U;
+            rqMaskWriteReg.hregOrMask  = 0x0505U;
+            rsMaskWriteReg.cbComplete  = MBBench_E2E_OnRegMaskWritten;
+            p_cmdlet      = MBMASTER_CMDLETDESCRIPTOR_MASKWRITEREGISTER;
+            p_request     = &rqMaskWriteReg;
+            p_response    = &rsMaskWriteReg;
+            p_responsearg = &rqMaskWriteReg;
+            break;
+        case MB_FNCODE_READWRITEMULTIPLEREGISTERS:
+            memset(&rsReadWriteRegs, 0, sizeof(rsReadWriteRegs));
+            rqReadWriteRegs.hregReadStartAddress  = 0U;
+            rqReadWriteRegs.hregReadQuantity      = p_case->qty;
+            rqReadWriteRegs.hregWriteStartAddress = 128U;
+            rqReadWriteRegs.hregWriteValues       = g_MBBenchE2E_RegValues;
+            rqReadWriteRegs.hregWriteQuantity     = p_case->qtyWrite;
+            rsReadWriteRegs.cbHRegValueUpdate     = MBBench_E2E_OnRegValue;
+            p_cmdlet      = MBMASTER_CMDLETDESCRIPTOR_RWMULTIPLEREGISTERS;
+            p_request     = &rqReadWriteRegs;
+            p_response    = &rsReadWriteRegs;
+            p_responsearg = g_MBBenchE2E_HoldingRegs;
+            expected      = (CPU_SIZE_T)p_case->qty;
+            break;
+        default:
+            return DEF_NO;
+    }
+
+    g_MBBenchE2E_Items = (CPU_SIZE_T)0U;
+    MBMaster_Post(
+        &g_MBBenchE2E_Master,
+        MBBENCH_E2E_SLAVEADDRESS,
+        p_cmdlet,
+        p_request,
+        p_response,
+        p_responsearg,
+        g_MBBenchE2E_Timeout,
+        &error
+    );
+    if (error != MB_ERROR_NONE) {
+        return DEF_NO;
+    }
+
+    /*  The written registers of 0x17 are not reported by any callback.  */
+    if (p_case->fc == MB_FNCODE_READWRITEMULTIPLEREGISTERS) {
+        if (!MBBench_E2E_CheckRegs(rqReadWriteRegs.hregWriteStartAddress, rqReadWriteRegs.hregWriteValues, rqReadWriteRegs.hregWriteQuantity)) {
+            return DEF_NO;
+        }
+    }
+
+    return (g_MBBenchE2E_Items == expected) ? DEF_YES : DEF_NO;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBBench_E2E_RunCase()
+*
+* Description : Run one case and print its results.
+*
+* Argument(s) : (1) mode        The transmission mode.
+*               (2) baudrate    The baud rate.
+*               (3) p_case      Pointer to the case.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The latency is measured around MBMaster_Post(), from the call until the response is parsed.
+*               (2) Latency percentiles only include the transactions that succeeded.
+*               (3) The overrun and dropped characters of the simulated lines are reported, so that failures
+*                   caused by the scheduling latency of the host could be told apart from the stack.
+*               (4) The longest critical section of the case (master, slave and simulated drivers) is reported
+*                   if the CPU shim is built with CPU_CFG_CRITICAL_MEAS_EN, otherwise null is printed.
+*********************************************************************************************************
+*/
+
+static void MBBench_E2E_RunCase(
+    MB_TRMODE                mode,
+    MB_BAUDRATE              baudrate,
+    const MBBENCH_E2E_CASE  *p_case
+) {
+    CPU_INT64U        *p_latencies;
+    CPU_SIZE_T         cntOk;
+    CPU_SIZE_T         cntFail;
+    CPU_INT64U         begin;
+    CPU_INT64U         start;
+    CPU_INT64U         end;
+    CPU_INT64U         deadline;
+    CPU_INT64U         elapsed;
+    CPU_INT64U         p50;
+    CPU_INT64U         p99;
+    CPU_INT64U         p999;
+    CPU_INT64U         pmax;
+    MBBENCH_E2E_COST   rxCost;
+    MBBENCH_E2E_COST   txCost;
+    CPU_BOOLEAN        cyclesValid;
+    MB_COUNTERVALUE    lineOverrun;
+    MB_COUNTERVALUE    lineDrop;
+    MB_COUNTERVALUE    lineOverrunEnd;
+    MB_COUNTERVALUE    lineDropEnd;
+#ifdef CPU_CFG_CRITICAL_MEAS_EN
+    CPU_CRITICAL_MEAS  critMeas;
+#endif
+    FILE              *p_file;
+
+    p_latencies = (CPU_INT64U*)malloc(g_MBBenchE2E_MaxCnt * sizeof(CPU_INT64U));
+    if (p_latencies == (CPU_INT64U*)0) {
+        fprintf(stderr, "Out of memory.\n");
+        exit(1);
+    }
+
+    /*  Reset the cost.  */
+    pthread_mutex_lock(&g_MBBenchE2E_CostLock);
+    memset(&g_MBBenchE2E_RxCost, 0, sizeof(g_MBBenchE2E_RxCost));
+    memset(&g_MBBenchE2E_TxCost, 0, sizeof(g_MBBenchE2E_TxCost));
+    pthread_mutex_unlock(&g_MBBenchE2E_CostLock);
+#ifdef CPU_CFG_CRITICAL_MEAS_EN
+    CPU_CriticalMeasReset();
+#endif
+
+    /*  Snapshot the statistics of the simulated lines.  */
+    MBBench_E2E_GetLineErrors(&lineOverrun, &lineDrop);
+
+    /*  Run the transactions.  */
+    cntOk    = (CPU_SIZE_T)0U;
+    cntFail  = (CPU_SIZE_T)0U;
+    begin    = MBBench_GetTime();
+    deadline = begin + (CPU_INT64U)g_MBBenchE2E_Budget * (CPU_INT64U)1000000U;
+    end      = begin;
+    while (cntOk + cntFail < g_MBBenchE2E_MaxCnt) {
+        start = MBBench_GetTime();
+        if (MBBench_E2E_Post(p_case)) {
+            end = MBBench_GetTime();
+            p_latencies[cntOk++] = end - start;
+        } else {
+            end = MBBench_GetTime();
+            ++cntFail;
+        }
+        if (end >= deadline) {
+            break;
+        }
+    }
+    elapsed = end - begin;
+
+#ifdef CPU_CFG_CRITICAL_MEAS_EN
+    CPU_CriticalMeasGet(&critMeas);
+#endif
+    MBBench_E2E_GetLineErrors(&lineOverrunEnd, &lineDropEnd);
+    lineOverrun = lineOverrunEnd - lineOverrun;
+    lineDrop    = lineDropEnd - lineDrop;
+
+    pthread_mutex_lock(&g_MBBenchE2E_CostLock);
+    rxCost      = g_MBBenchE2E_RxCost;
+    txCost      = g_MBBenchE2E_TxCost;
+    cyclesValid = g_MBBenchE2E_CyclesValid;
+    pthread_mutex_unlock(&g_MBBenchE2E_CostLock);
+
+    p50  = MBBench_Percentile(p_latencies, cntOk, MBBENCH_PERCENTILE_P50);
+    p99  = MBBench_Percentile(p_latencies, cntOk, MBBENCH_PERCENTILE_P99);
+    p999 = MBBench_Percentile(p_latencies, cntOk, MBBENCH_PERCENTILE_P999);
+    pmax = (cntOk != (CPU_SIZE_T)0U) ? p_latencies[cntOk - (CPU_SIZE_T)1U] : (CPU_INT64U)0U;
+    free(p_latencies);
+
+    /*  JSON line.  */
+    p_file = g_MBBenchE2E_Output;
+    fprintf(
+        p_file,
+        "{\"record\":\"result\",\"bench\":\"e2e\",\"mode\":\"%s\",\"baudrate\":%lu,\"fc\":%u,\"qty\":%u,\"qtyWrite\":%u,"
+        "\"ok\":%lu,\"fail\":%lu,\"elapsed_ms\":%.3f",
+        (mode == MB_TRMODE_ASCII) ? "ascii" : "rtu",
+        (unsigned long)baudrate,
+        (unsigned int)p_case->fc,
+        (unsigned int)p_case->qty,
+        (unsigned int)p_case->qtyWrite,
+        (unsigned long)cntOk,
+        (unsigned long)cntFail,
+        (double)elapsed / 1e6
+    );
+    MBBench_PrintRatio(p_file, "tps", (CPU_INT64U)cntOk * (CPU_INT64U)1000000000U, elapsed, DEF_YES);
+    MBBench_PrintRatio(p_file, "lat_p50_us", p50, (CPU_INT64U)1000U, (cntOk != (CPU_SIZE_T)0U) ? DEF_YES : DEF_NO);
+    MBBench_PrintRatio(p_file, "lat_p99_us", p99, (CPU_INT64U)1000U, (cntOk != (CPU_SIZE_T)0U) ? DEF_YES : DEF_NO);
+    MBBench_PrintRatio(p_file, "lat_p999_us", p999, (CPU_INT64U)1000U, (cntOk != (CPU_SIZE_T)0U) ? DEF_YES : DEF_NO);
+    MBBench_PrintRatio(p_file, "lat_max_us", pmax, (CPU_INT64U)1000U, (cntOk != (CPU_SIZE_T)0U) ? DEF_YES : DEF_NO);
+    fprintf(p_file, ",\"rx_frames\":%lu,\"rx_bytes\":%lu", (unsigned long)rxCost.frames, (unsigned long)rxCost.bytes);
+    MBBench_PrintRatio(p_file, "rx_cpu_ns_per_byte", rxCost.cpuTime, rxCost.bytes, DEF_YES);
+    MBBench_PrintRatio(p_file, "rx_cycles_per_byte", rxCost.cycles, rxCost.bytes, cyclesValid);
+    fprintf(p_file, ",\"tx_frames\":%lu,\"tx_bytes\":%lu", (unsigned long)txCost.frames, (unsigned long)txCost.bytes);
+    MBBench_PrintRatio(p_file, "tx_cpu_ns_per_byte", txCost.cpuTime, txCost.bytes, DEF_YES);
+    MBBench_PrintRatio(p_file, "tx_cycles_per_byte", txCost.cycles, txCost.bytes, cyclesValid);
+#ifdef CPU_CFG_CRITICAL_MEAS_EN
+    fprintf(
+        p_file,
+        ",\"crit_cnt\":%lu,\"crit_max_ns\":%lu,\"crit_max_cpu_ns\":%lu",
+        (unsigned long)critMeas.cnt,
+        (unsigned long)critMeas.timeMax,
+        (unsigned long)critMeas.cpuTimeMax
+    );
+#else
+    fprintf(p_file, ",\"crit_cnt\":null,\"crit_max_ns\":null,\"crit_max_cpu_ns\":null");
+#endif
+    fprintf(p_file, ",\"line_overrun\":%lu,\"line_drop\":%lu}\n", (unsigned long)lineOverrun, (unsigned long)lineDrop);
+    fflush(p_file);
+
+    /*  Summary.  */
+    fprintf(
+        stderr,
+        "%-5s %6lu FC%02X qty=%-4u ok=%-5lu fail=%-3lu tps=%-8.1f p50=%.0fus p99=%.0fus p999=%.0fus\n",
+        (mode == MB_TRMODE_ASCII) ? "ascii" : "rtu",
+        (unsigned long)baudrate,
+        (unsigned int)p_case->fc,
+        (unsigned int)p_case->qty,
+        (unsigned long)cntOk,
+        (unsigned long)cntFail,
+        (elapsed != (CPU_INT64U)0U) ? (double)cntOk * 1e9 / (double)elapsed : 0.0,
+        (double)p50 / 1e3,
+        (double)p99 / 1e3,
+        (double)p999 / 1e3
+    );
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBBench_E2E_GetLineErrors()
+*
+* Description : Get the count of overrun and dropped characters of the master and the slave ports.
+*
+* Argument(s) : (1) p_overrun   Pointer to the variable that receives the count of overrun characters.
+*               (2) p_drop      Pointer to the variable that receives the count of dropped characters.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBBench_E2E_GetLineErrors(
+    MB_COUNTERVALUE         *p_overrun,
+    MB_COUNTERVALUE         *p_drop
+) {
+    MBDRV_SIM_STATISTICS  stats;
+    CPU_SIZE_T            port;
+    MB_ERROR              error;
+
+    *p_overrun = (MB_COUNTERVALUE)0U;
+    *p_drop    = (MB_COUNTERVALUE)0U;
+
+    for (port = (CPU_SIZE_T)0U; port < (CPU_SIZE_T)2U; ++port) {
+        MBDrv_Sim_GetStatistics(port, &stats, &error);
+        if (error == MB_ERROR_NONE) {
+            *p_overrun += stats.cntOverrun;
+            *p_drop    += stats.cntDrop;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_E2E_ParseList()
+*
+* Description : Parse a comma-separated list of decimal numbers.
+*
+* Argument(s) : (1) arg         The list.
+*               (2) p_list      Pointer to the array that receives the numbers.
+*               (3) p_cnt       Pointer to the variable that receives the count of numbers.
+*
+* Return(s)   : DEF_YES if succeed, DEF_NO if the list is malformed or too long.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBBench_E2E_ParseList(
+    const char              *arg,
+    CPU_INT32U              *p_list,
+    CPU_SIZE_T              *p_cnt
+) {
+    const char  *p;
+    char        *pEnd;
+    CPU_SIZE_T   cnt;
+
+    cnt = (CPU_SIZE_T)0U;
+    p   = arg;
+    while (DEF_YES) {
+        if (cnt >= MBBENCH_E2E_LIST_MAX) {
+            return DEF_NO;
+        }
+        p_list[cnt++] = (CPU_INT32U)strtoul(p, &pEnd, 10);
+        if (pEnd == p) {
+            return DEF_NO;
+        }
+        if (*pEnd == '\0') {
+            break;
+        }
+        if (*pEnd != ',') {
+            return DEF_NO;
+        }
+        p = pEnd + 1;
+    }
+    *p_cnt = cnt;
+
+    return DEF_YES;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBBench_E2E_Usage()
+*
+* Description : Print the usage of the benchmark.
+*
+* Argument(s) : (1) prog        Name of the program.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBBench_E2E_Usage(
+    const char              *prog
+) {
+    fprintf(
+        stderr,
+        "Usage: %s [-m rtu,ascii] [-b 9600,115200,921600] [-f 1,2,3,4,5,6,15,16,22,23]\n"
+        "          [-n count] [-t budget_ms] [-T timeout_ms] [-s speed_factor] [-o output.jsonl]\n",
+        prog
+    );
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBBench_E2E_OnBitValue()
+*
+* Description : Count one coil/discrete input value read by the master (if it matches the slave).
+*
+* Argument(s) : (1) address     Address of the coil/discrete input.
+*               (2) value       Value of the coil/discrete input.
+*               (3) p_arg       Pointer to the coils/discrete inputs bitmap of the slave.
+*               (4) p_error     Pointer to the variable that receives error code from this function.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBBench_E2E_OnBitValue(
+    CPU_INT16U               address,
+    CPU_BOOLEAN              value,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    if (MBBench_E2E_GetBit((const CPU_INT08U*)p_arg, address) == value) {
+        ++g_MBBenchE2E_Items;
+    }
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBBench_E2E_OnRegValue()
+*
+* Description : Count one register value read by the master (if it matches the slave).
+*
+* Argument(s) : (1) address     Address of the register.
+*               (2) value       Value of the register.
+*               (3) p_arg       Pointer to the holding/input registers of the slave.
+*               (4) p_error     Pointer to the variable that receives error code from this function.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBBench_E2E_OnRegValue(
+    CPU_INT16U               address,
+    CPU_INT16U               value,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    if (((const CPU_INT16U*)p_arg)[address] == value) {
+        ++g_MBBenchE2E_Items;
+    }
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBBench_E2E_OnCoilWritten()
+*
+* Description : Count the confirmation of a single coil write (if it matches the request and the slave).
+*
+* Argument(s) : (1) address     Address of the coil.
+*               (2) value       Value written.
+*               (3) p_arg       Pointer to the request.
+*               (4) p_error     Pointer to the variable that receives error code from this function.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBBench_E2E_OnCoilWritten(
+    CPU_INT16U               address,
+    CPU_BOOLEAN              value,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    const MBMASTER_CMDLET_WRITESINGLECOIL_REQUEST  *p_request;
+
+    p_request = (const MBMASTER_CMDLET_WRITESINGLECOIL_REQUEST*)p_arg;
+    if (address == p_request->coilAddress &&
+        value == p_request->coilValue &&
+        MBBench_E2E_GetBit(g_MBBenchE2E_Coils, address) == value) {
+        ++g_MBBenchE2E_Items;
+    }
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBBench_E2E_OnRegWritten()
+*
+* Description : Count the confirmation of a single register write (if it matches the request and the slave).
+*
+* Argument(s) : (1) address     Address of the register.
+*               (2) value       Value written.
+*               (3) p_arg       Pointer to the request.
+*               (4) p_error     Pointer to the variable that receives error code from this function.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBBench_E2E_OnRegWritten(
+    CPU_INT16U               address,
+    CPU_INT16U               value,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    const MBMASTER_CMDLET_WRITESINGLEREGISTER_REQUEST  *p_request;
+
+    p_request = (const MBMASTER_CMDLET_WRITESINGLEREGISTER_REQUEST*)p_arg;
+    if (address == p_request->hregAddress &&
+        value == p_request->hregValue &&
+        g_MBBenchE2E_HoldingRegs[address] == value) {
+        ++g_MBBenchE2E_Items;
+    }
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                               MBBench_E2E_OnRegMaskWritten()
+*
+* Description : Count the confirmation of a mask write (if it matches the request).
+*
+* Argument(s) : (1) address     Address of the register.
+*               (2) andMask     The AND mask.
+*               (3) orMask      The OR mask.
+*               (4) p_arg       Pointer to the request.
+*               (5) p_error     Pointer to the variable that receives error code from this function.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBBench_E2E_OnRegMaskWritten(
+    CPU_INT16U               address,
+    CPU_INT16U               andMask,
+    CPU_INT16U               orMask,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    const MBMASTER_CMDLET_MASKWRITEREGISTER_REQUEST  *p_request;
+
+    p_request = (const MBMASTER_CMDLET_MASKWRITEREGISTER_REQUEST*)p_arg;
+    if (address == p_request->hregAddress &&
+        andMask == p_request->hregAndMask &&
+        orMask == p_request->hregOrMask) {
+        ++g_MBBenchE2E_Items;
+    }
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                MBBench_E2E_OnCoilsWritten()
+*
+* Description : Count the confirmation of a multiple coils write (if it matches the request and the slave).
+*
+* Argument(s) : (1) startAddress    Address of the first coil.
+*               (2) quantity        Count of coils written.
+*               (3) p_arg           Pointer to the request.
+*               (4) p_error         Pointer to the variable that receives error code from this function.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBBench_E2E_OnCoilsWritten(
+    CPU_INT16U               startAddress,
+    CPU_INT16U               quantity,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    const MBMASTER_CMDLET_WRITEMULTIPLECOILS_REQUEST  *p_request;
+    CPU_INT16U                                         i;
+
+    *p_error  = MB_ERROR_NONE;
+    p_request = (const MBMASTER_CMDLET_WRITEMULTIPLECOILS_REQUEST*)p_arg;
+    if (startAddress != p_request->coilStartAddress || quantity != p_request->coilQuantity) {
+        return;
+    }
+    for (i = 0U; i < quantity; ++i) {
+        if (MBBench_E2E_GetBit(g_MBBenchE2E_Coils, (CPU_INT16U)(startAddress + i)) != p_request->coilValues[i]) {
+            return;
+        }
+    }
+
+    ++g_MBBenchE2E_Items;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBBench_E2E_OnRegsWritten()
+*
+* Description : Count the confirmation of a multiple registers write (if it matches the request and the
+*               slave).
+*
+* Argument(s) : (1) startAddress    Address of the first register.
+*               (2) quantity        Count of registers written.
+*               (3) p_arg           Pointer to the request.
+*               (4) p_error         Pointer to the variable that receives error code from this function.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBBench_E2E_OnRegsWritten(
+    CPU_INT16U               startAddress,
+    CPU_INT16U               quantity,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    const MBMASTER_CMDLET_WRITEMULTIPLEREGISTERS_REQUEST  *p_request;
+
+    p_request = (const MBMASTER_CMDLET_WRITEMULTIPLEREGISTERS_REQUEST*)p_arg;
+    if (startAddress == p_request->hregStartAddress &&
+        quantity == p_request->hregQuantity &&
+        MBBench_E2E_CheckRegs(startAddress, p_request->hregValues, quantity)) {
+        ++g_MBBenchE2E_Items;
+    }
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_E2E_GetBit()
+*
+* Description : Get a coil/discrete input of the slave.
+*
+* Argument(s) : (1) p_bitmap    Pointer to the coils/discrete inputs bitmap of the slave.
+*               (2) address     Address of the coil/discrete input.
+*
+* Return(s)   : The value.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBBench_E2E_GetBit(
+    const CPU_INT08U        *p_bitmap,
+    CPU_INT16U               address
+) {
+    return ((p_bitmap[address >> 3] >> (address & 7U)) & 1U) != 0U ? DEF_YES : DEF_NO;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBBench_E2E_CheckRegs()
+*
+* Description : Check the holding registers of the slave against the values written by the master.
+*
+* Argument(s) : (1) startAddress    Address of the first register.
+*               (2) p_values        Pointer to the values written.
+*               (3) quantity        Count of registers written.
+*
+* Return(s)   : DEF_YES if all registers match.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBBench_E2E_CheckRegs(
+    CPU_INT16U               startAddress,
+    const CPU_INT16U        *p_values,
+    CPU_INT16U               quantity
+) {
+    CPU_INT16U  i;
+
+    for (i = 0U; i < quantity; ++i) {
+        if (g_MBBenchE2E_HoldingRegs[startAddress + i] != p_values[i]) {
+            return DEF_NO;
+        }
+    }
+
+    return DEF_YES;
+}
\ No newline at end of file
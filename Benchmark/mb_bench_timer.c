@@ -0,0 +1,521 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                               BENCHMARK
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                      RX Timeout Timer Micro-Benchmark
+*
+* File      : MB_BENCH_TIMER.C
+* Version   : V1.0.320
+* By        : Ji WenCong
+*
+* Note(s)   : (1) Measures the OS timer calls that MB_WaitStartup() and MB_ReceiveFrame() make once per call
+*                 with a timeout, before and after the RX timeout timer became a per-device object:
+*
+*                     tmr_oneshot   MBOS_TimerCreate() + MBOS_TimerStart() + MBOS_TimerDispose()
+*                                   (a one-shot timer created and disposed on every call).
+*                     tmr_rearm     MBOS_TimerSetInterval() + MBOS_TimerStart() + MBOS_TimerStop()
+*                                   (the per-device timer, re-armed on every call).
+*
+*                 One iteration is one such sequence, i.e. the timer cost of one MB_ReceiveFrame() call.
+*             (2) The timers never expire (the interval is much longer than one iteration).
+*             (3) The results are printed as JSON lines (one header record and one record per case), like
+*                 the other benchmarks.
+*             (4) The results are those of the OS port the benchmark is built with (the POSIX port on a
+*                 host), they don't tell the cost of the kernel calls of other ports.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include <mb_bench.h>
+
+#include <mb.h>
+#include <mb_os.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/*  Maximum count of repetitions.  */
+#define MBBENCH_TIMER_REPETITION_MAX              ((CPU_SIZE_T)101U)
+
+/*  Defaults of the command line options.  */
+#define MBBENCH_TIMER_DEFAULT_ITERATIONS          ((CPU_SIZE_T)100000U)
+#define MBBENCH_TIMER_DEFAULT_REPETITIONS         ((CPU_SIZE_T)7U)
+#define MBBENCH_TIMER_DEFAULT_TIMEOUT             ((MB_TIMESPAN)1000U)
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+/*  Runs one iteration of a case, returns DEF_NO if any OS call failed.  */
+typedef CPU_BOOLEAN (*MBBENCH_TIMER_RUN)(void);
+
+/*  A benchmark case.  */
+typedef struct {
+    const char             *name;
+    const char             *sequence;
+    MBBENCH_TIMER_RUN       run;
+} MBBENCH_TIMER_CASE;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void MBBench_Timer_Callback(
+    void                    *p_tmr,
+    void                    *p_cbarg
+);
+
+static CPU_BOOLEAN MBBench_Timer_OneShot(void);
+
+static CPU_BOOLEAN MBBench_Timer_Rearm(void);
+
+static CPU_BOOLEAN MBBench_Timer_RunCase(
+    const MBBENCH_TIMER_CASE  *p_case,
+    MBBENCH_COUNTERS          *p_counters
+);
+
+static void MBBench_Timer_Usage(
+    const char              *prog
+);
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/*  Benchmark cases.  */
+static const MBBENCH_TIMER_CASE  g_MBBenchTimer_Cases[] = {
+    { "tmr_oneshot", "MBOS_TimerCreate+MBOS_TimerStart+MBOS_TimerDispose",      MBBench_Timer_OneShot },
+    { "tmr_rearm",   "MBOS_TimerSetInterval+MBOS_TimerStart+MBOS_TimerStop",    MBBench_Timer_Rearm   }
+};
+
+/*  Command line options.  */
+static CPU_SIZE_T              g_MBBenchTimer_Iterations;
+static CPU_SIZE_T              g_MBBenchTimer_Repetitions;
+static MB_TIMESPAN             g_MBBenchTimer_Timeout;
+static FILE                   *g_MBBenchTimer_Output;
+
+/*  The per-device timer of "tmr_rearm" (created once).  */
+static MB_TIMER                g_MBBenchTimer_Timer;
+
+/*  Count of expired timers (expected to be zero).  */
+static volatile CPU_INT32U     g_MBBenchTimer_Expired;
+
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Entry of the RX timeout timer micro-benchmark.
+*
+* Argument(s) : (1) argc        Count of command line arguments.
+*               (2) argv        The command line arguments:
+*
+*                                   -c <cases>      Cases to run, separated by commas (all by default).
+*                                   -n <count>      Count of iterations per repetition.
+*                                   -r <count>      Count of repetitions (the median is reported).
+*                                   -T <ms>         Interval of the timers (milliseconds).
+*                                   -o <file>       Output file of the JSON lines (stdout by default).
+*
+* Return(s)   : 0 if succeed, 1 if failed.
+*********************************************************************************************************
+*/
+
+int main(
+    int                      argc,
+    char                   **argv
+) {
+    const char        *pCases;
+    const char        *pOutput;
+    char              *pEnd;
+    int                opt;
+    int                ret;
+    CPU_SIZE_T         i;
+    CPU_SIZE_T         nameLen;
+    const char        *pFound;
+    MB_ERROR           error;
+    MBBENCH_COUNTERS   counters;
+
+    g_MBBenchTimer_Iterations  = MBBENCH_TIMER_DEFAULT_ITERATIONS;
+    g_MBBenchTimer_Repetitions = MBBENCH_TIMER_DEFAULT_REPETITIONS;
+    g_MBBenchTimer_Timeout     = MBBENCH_TIMER_DEFAULT_TIMEOUT;
+    g_MBBenchTimer_Output      = stdout;
+    pCases                     = (const char*)0;
+    pOutput                    = (const char*)0;
+
+    /*  Parse the command line.  */
+    while ((opt = getopt(argc, argv, "c:n:r:T:o:h")) != -1) {
+        switch (opt) {
+            case 'c':
+                pCases = optarg;
+                break;
+            case 'n':
+                g_MBBenchTimer_Iterations = (CPU_SIZE_T)strtoul(optarg, &pEnd, 10);
+                if (*pEnd != '\0' || g_MBBenchTimer_Iterations == (CPU_SIZE_T)0U) {
+                    MBBench_Timer_Usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'r':
+                g_MBBenchTimer_Repetitions = (CPU_SIZE_T)strtoul(optarg, &pEnd, 10);
+                if (
+                    *pEnd != '\0' ||
+                    g_MBBenchTimer_Repetitions == (CPU_SIZE_T)0U ||
+                    g_MBBenchTimer_Repetitions > MBBENCH_TIMER_REPETITION_MAX
+                ) {
+                    MBBench_Timer_Usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'T':
+                g_MBBenchTimer_Timeout = (MB_TIMESPAN)strtoul(optarg, &pEnd, 10);
+                if (*pEnd != '\0' || g_MBBenchTimer_Timeout == (MB_TIMESPAN)0U) {
+                    MBBench_Timer_Usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'o':
+                pOutput = optarg;
+                break;
+            default:
+                MBBench_Timer_Usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (pOutput != (const char*)0) {
+        g_MBBenchTimer_Output = fopen(pOutput, "w");
+        if (g_MBBenchTimer_Output == (FILE*)0) {
+            fprintf(stderr, "Can't open %s.\n", pOutput);
+            return 1;
+        }
+    }
+
+    /*  Create the per-device timer (like MB_Context_Initialize() does).  */
+    MBOS_TimerCreate(
+        &g_MBBenchTimer_Timer,
+        g_MBBenchTimer_Timeout,
+        MB_TIMER_MODE_ONESHOT,
+        MBBench_Timer_Callback,
+        (void*)0,
+        &error
+    );
+    if (error != MB_ERROR_NONE) {
+        fprintf(stderr, "Can't create the timer (error=%u).\n", (unsigned int)error);
+        return 1;
+    }
+
+    MBBench_CountersOpen(&counters);
+    MBBench_PrintHeader(g_MBBenchTimer_Output, "timer", &counters);
+
+    ret = 0;
+    for (i = (CPU_SIZE_T)0U; i < sizeof(g_MBBenchTimer_Cases) / sizeof(g_MBBenchTimer_Cases[0]); ++i) {
+        /*  Check whether the case is selected (a whole item of the comma-separated list).  */
+        if (pCases != (const char*)0) {
+            nameLen = (CPU_SIZE_T)strlen(g_MBBenchTimer_Cases[i].name);
+            pFound  = pCases;
+            while ((pFound = strstr(pFound, g_MBBenchTimer_Cases[i].name)) != (const char*)0) {
+                if (
+                    (pFound == pCases || pFound[-1] == ',') &&
+                    (pFound[nameLen] == '\0' || pFound[nameLen] == ',')
+                ) {
+                    break;
+                }
+                pFound += nameLen;
+            }
+            if (pFound == (const char*)0) {
+                continue;
+            }
+        }
+
+        if (MBBench_Timer_RunCase(&(g_MBBenchTimer_Cases[i]), &counters) != DEF_YES) {
+            fprintf(stderr, "Case %s failed.\n", g_MBBenchTimer_Cases[i].name);
+            ret = 1;
+        }
+    }
+
+    MBBench_CountersClose(&counters);
+
+    MBOS_TimerDispose(&g_MBBenchTimer_Timer, &error);
+
+    if (g_MBBenchTimer_Output != stdout) {
+        fclose(g_MBBenchTimer_Output);
+    }
+
+    return ret;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_Timer_Callback()
+*
+* Description : Callback of the timers (counts the expired timers).
+*
+* Argument(s) : (1) p_tmr       Pointer to the timer object.
+*               (2) p_cbarg     Callback argument (unused).
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBBench_Timer_Callback(
+    void                    *p_tmr,
+    void                    *p_cbarg
+) {
+    (void)p_tmr;
+    (void)p_cbarg;
+
+    ++g_MBBenchTimer_Expired;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_Timer_OneShot()
+*
+* Description : Create, start and dispose a one-shot timer (one iteration of "tmr_oneshot").
+*
+* Argument(s) : None.
+*
+* Return(s)   : DEF_YES if all calls succeeded, DEF_NO if not.
+*
+* Note(s)     : (1) This is what MB_ReceiveFrame() did on every call before the RX timeout timer became a
+*                   per-device object.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBBench_Timer_OneShot(void) {
+    MB_TIMER  timeouter;
+    MB_ERROR  error;
+
+    MBOS_TimerCreate(
+        &timeouter,
+        g_MBBenchTimer_Timeout,
+        MB_TIMER_MODE_ONESHOT,
+        MBBench_Timer_Callback,
+        (void*)0,
+        &error
+    );
+    if (error != MB_ERROR_NONE) {
+        return DEF_NO;
+    }
+    MBOS_TimerStart(&timeouter, &error);
+    if (error != MB_ERROR_NONE) {
+        return DEF_NO;
+    }
+    MBOS_TimerDispose(&timeouter, &error);
+    if (error != MB_ERROR_NONE) {
+        return DEF_NO;
+    }
+
+    return DEF_YES;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBBench_Timer_Rearm()
+*
+* Description : Re-arm, start and stop the per-device timer (one iteration of "tmr_rearm").
+*
+* Argument(s) : None.
+*
+* Return(s)   : DEF_YES if all calls succeeded, DEF_NO if not.
+*
+* Note(s)     : (1) This is what MB_ReceiveFrame() does on every call.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBBench_Timer_Rearm(void) {
+    MB_ERROR  error;
+
+    MBOS_TimerSetInterval(&g_MBBenchTimer_Timer, g_MBBenchTimer_Timeout, &error);
+    if (error != MB_ERROR_NONE) {
+        return DEF_NO;
+    }
+    MBOS_TimerStart(&g_MBBenchTimer_Timer, &error);
+    if (error != MB_ERROR_NONE) {
+        return DEF_NO;
+    }
+    MBOS_TimerStop(&g_MBBenchTimer_Timer, &error);
+    if (error != MB_ERROR_NONE) {
+        return DEF_NO;
+    }
+
+    return DEF_YES;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBench_Timer_RunCase()
+*
+* Description : Run one case and print its results.
+*
+* Argument(s) : (1) p_case      Pointer to the case.
+*               (2) p_counters  Pointer to the counters of the main thread.
+*
+* Return(s)   : DEF_YES if all iterations succeeded, DEF_NO if not.
+*
+* Note(s)     : (1) Each repetition runs all iterations back to back between two samples of the counters.
+*                   The median of the repetitions is reported (each measure is sorted on its own), together
+*                   with the minimum of the wall time.
+*               (2) One iteration is run before the first repetition to start the timer task and warm up
+*                   the caches.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBBench_Timer_RunCase(
+    const MBBENCH_TIMER_CASE  *p_case,
+    MBBENCH_COUNTERS          *p_counters
+) {
+    CPU_INT64U        times[MBBENCH_TIMER_REPETITION_MAX];
+    CPU_INT64U        cpuTimes[MBBENCH_TIMER_REPETITION_MAX];
+    CPU_INT64U        cycles[MBBENCH_TIMER_REPETITION_MAX];
+    CPU_INT64U        instructions[MBBENCH_TIMER_REPETITION_MAX];
+    MBBENCH_SAMPLE    begin;
+    MBBENCH_SAMPLE    end;
+    CPU_SIZE_T        rep;
+    CPU_SIZE_T        i;
+    CPU_BOOLEAN       ok;
+    CPU_INT64U        calls;
+    CPU_INT64U        timeMin;
+    CPU_INT64U        timeMedian;
+    FILE             *p_file;
+
+    /*  Warm up.  */
+    ok = p_case->run();
+
+    for (rep = (CPU_SIZE_T)0U; rep < g_MBBenchTimer_Repetitions && ok == DEF_YES; ++rep) {
+        MBBench_CountersRead(p_counters, &begin);
+        for (i = (CPU_SIZE_T)0U; i < g_MBBenchTimer_Iterations; ++i) {
+            if (p_case->run() != DEF_YES) {
+                ok = DEF_NO;
+                break;
+            }
+        }
+        MBBench_CountersRead(p_counters, &end);
+
+        times[rep]        = end.time - begin.time;
+        cpuTimes[rep]     = end.cpuTime - begin.cpuTime;
+        cycles[rep]       = end.cycles - begin.cycles;
+        instructions[rep] = end.instructions - begin.instructions;
+    }
+    if (ok != DEF_YES) {
+        return DEF_NO;
+    }
+
+    calls      = (CPU_INT64U)g_MBBenchTimer_Iterations;
+    timeMedian = MBBench_Percentile(times, g_MBBenchTimer_Repetitions, MBBENCH_PERCENTILE_P50);
+    timeMin    = times[0];      /*  Sorted by MBBench_Percentile().  */
+
+    /*  JSON line.  */
+    p_file = g_MBBenchTimer_Output;
+    fprintf(
+        p_file,
+        "{\"record\":\"result\",\"bench\":\"timer\",\"case\":\"%s\",\"sequence\":\"%s\",\"iterations\":%lu,"
+        "\"repetitions\":%lu,\"expired\":%lu",
+        p_case->name,
+        p_case->sequence,
+        (unsigned long)g_MBBenchTimer_Iterations,
+        (unsigned long)g_MBBenchTimer_Repetitions,
+        (unsigned long)g_MBBenchTimer_Expired
+    );
+    MBBench_PrintRatio(p_file, "ns_per_call", timeMedian, calls, DEF_YES);
+    MBBench_PrintRatio(p_file, "ns_per_call_min", timeMin, calls, DEF_YES);
+    MBBench_PrintRatio(
+        p_file,
+        "cpu_ns_per_call",
+        MBBench_Percentile(cpuTimes, g_MBBenchTimer_Repetitions, MBBENCH_PERCENTILE_P50),
+        calls,
+        DEF_YES
+    );
+    MBBench_PrintRatio(
+        p_file,
+        "cycles_per_call",
+        MBBench_Percentile(cycles, g_MBBenchTimer_Repetitions, MBBENCH_PERCENTILE_P50),
+        calls,
+        MBBench_CountersHasCycles(p_counters)
+    );
+    MBBench_PrintRatio(
+        p_file,
+        "instructions_per_call",
+        MBBench_Percentile(instructions, g_MBBenchTimer_Repetitions, MBBENCH_PERCENTILE_P50),
+        calls,
+        MBBench_CountersHasInstructions(p_counters)
+    );
+    fprintf(p_file, "}\n");
+    fflush(p_file);
+
+    /*  Summary.  */
+    fprintf(
+        stderr,
+        "%-12s %-56s %8.1f ns/call (min %.1f)\n",
+        p_case->name,
+        p_case->sequence,
+        (double)timeMedian / (double)calls,
+        (double)timeMin / (double)calls
+    );
+
+    return DEF_YES;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBBench_Timer_Usage()
+*
+* Description : Print the usage of the benchmark.
+*
+* Argument(s) : (1) prog        Name of the program.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBBench_Timer_Usage(
+    const char              *prog
+) {
+    fprintf(
+        stderr,
+        "Usage: %s [-c tmr_oneshot,tmr_rearm] [-n iterations] [-r repetitions] [-T interval_ms]\n"
+        "          [-o output.jsonl]\n",
+        prog
+    );
+}
\ No newline at end of file
@@ -0,0 +1,2004 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                              DEVICE DRIVER
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                          Linux TTY (termios)
+*
+* File      : MBDRV_TTY.C
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#define MBDRV_TTY_SOURCE
+
+#include <mbdrv_tty.h>
+#include <mbdrv_cfg.h>
+#include <mbdrv_types.h>
+
+#include <mb_constants.h>
+#include <mb_types.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/prctl.h>
+#include <sys/timerfd.h>
+#include <linux/serial.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/*  Nanoseconds per second.  */
+#define MBDRV_TTY_NSEC_PER_SEC                    ((CPU_INT64U)1000000000U)
+
+/*  Half-character timer interval for baud rates greater than 19200 bps (unit: nanoseconds).  */
+#define MBDRV_TTY_HALFCHARTIME_FIXED              ((CPU_INT64U)250000U)
+
+/*  Maximum count of half-character timer interrupts raised for one timer wake-up.  */
+#define MBDRV_TTY_HALFCHARTICK_MAX                ((CPU_INT64U)8U)
+
+/*  Size of the read buffer of the I/O task.  */
+#define MBDRV_TTY_READ_SIZE                       ((CPU_SIZE_T)256U)
+
+/*  Receive errors.  */
+#define MBDRV_TTY_ERROR_PARITY                    ((CPU_INT08U)0x01U)
+#define MBDRV_TTY_ERROR_OVERRUN                   ((CPU_INT08U)0x02U)
+#define MBDRV_TTY_ERROR_FRAME                     ((CPU_INT08U)0x04U)
+
+/*  States of the PARMRK sequence parser (\377 \0 <char> marks an erroneous character, \377 \377 is \377).  */
+#define MBDRV_TTY_MARK_NONE                       ((CPU_INT08U)0U)
+#define MBDRV_TTY_MARK_FF                         ((CPU_INT08U)1U)
+#define MBDRV_TTY_MARK_FF00                       ((CPU_INT08U)2U)
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+typedef struct {
+    MB_DRIVER                     *desc;
+    void                          *mbctx;
+    MB_DRIVER_CALLBACKS           *drvcb;
+
+    CPU_CHAR                       path[MBDRV_TTY_PATH_MAX];
+    CPU_INT64U                     minHalfCharTime;
+
+    CPU_BOOLEAN                    opened;
+    CPU_BOOLEAN                    stop;
+    CPU_BOOLEAN                    taskAlive;
+    CPU_BOOLEAN                    hangUp;
+    CPU_BOOLEAN                    rxWatched;
+
+    int                            fd;
+    int                            epfd;
+    int                            evfd;
+    int                            tmrfd;
+    int                            txTmrfd;
+    int                            rxTmrfd;
+
+    CPU_BOOLEAN                    rxEnabled;
+    CPU_BOOLEAN                    txEnabled;
+    MB_DUPLEXMODE                  duplexMode;
+    CPU_BOOLEAN                    parityEnabled;
+
+    CPU_INT64U                     charTime;
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+    CPU_INT64U                     halfCharTime;
+    CPU_BOOLEAN                    halfCharTmrActive;
+#endif
+
+    CPU_BOOLEAN                    txPending;
+    CPU_INT32U                     txSeq;
+    CPU_INT64U                     txDoneAt;
+
+    CPU_INT08U                     rxData;
+    CPU_INT08U                     rxErrors;
+    CPU_INT08U                     rxErrorsNext;
+    CPU_INT08U                     errFlags;
+    CPU_INT08U                     markState;
+
+    CPU_INT08U                     rxQueueData[MBDRV_TTY_READ_SIZE];
+    CPU_INT08U                     rxQueueErrors[MBDRV_TTY_READ_SIZE];
+    CPU_SIZE_T                     rxQueueHead;
+    CPU_SIZE_T                     rxQueueCnt;
+    CPU_INT64U                     rxNextAt;
+
+    CPU_BOOLEAN                    icountValid;
+    struct serial_icounter_struct  icount;
+
+    MBDRV_TTY_STATISTICS           stats;
+} MBDRV_TTY_PORT;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_Initialize(
+    MBDRV_TTY_PORT          *p_port,
+    MB_DRIVER               *p_desc,
+    void                    *p_mbctx,
+    MB_DRIVER_CALLBACKS     *p_drvcb,
+    MB_ERROR                *p_error
+);
+
+static void MBDrv_Tty_DeviceOpen(
+    MBDRV_TTY_PORT          *p_port,
+    MB_SERIAL_SETUP         *p_setup,
+    MB_ERROR                *p_error
+);
+
+static void MBDrv_Tty_DeviceClose(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+static void MBDrv_Tty_HalfCharacterTimerStart(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+
+static void MBDrv_Tty_HalfCharacterTimerStop(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+#endif
+
+static void MBDrv_Tty_RxStart(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+
+static void MBDrv_Tty_RxStop(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+
+static CPU_INT08U MBDrv_Tty_RxRead(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+
+static void MBDrv_Tty_TxStart(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+
+static void MBDrv_Tty_TxStop(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+
+static void MBDrv_Tty_TxTransmit(
+    MBDRV_TTY_PORT          *p_port,
+    CPU_INT08U               datum,
+    MB_ERROR                *p_error
+);
+
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+static void MBDrv_Tty_TxTransmitBlock(
+    MBDRV_TTY_PORT          *p_port,
+    const CPU_INT08U        *p_data,
+    CPU_SIZE_T               size,
+    MB_ERROR                *p_error
+);
+#endif
+
+static void MBDrv_Tty_HalfDuplex_SetMode(
+    MBDRV_TTY_PORT          *p_port,
+    MB_DUPLEXMODE            duplexMode,
+    MB_ERROR                *p_error
+);
+
+static CPU_BOOLEAN MBDrv_Tty_HasError(
+    MBDRV_TTY_PORT          *p_port,
+    CPU_INT08U               error
+);
+
+static void MBDrv_Tty_ClearError(
+    MBDRV_TTY_PORT          *p_port,
+    CPU_INT08U               error
+);
+
+static CPU_BOOLEAN MBDrv_Tty_SetupTermios(
+    int                      fd,
+    MB_SERIAL_SETUP         *p_setup
+);
+
+static CPU_INT64U MBDrv_Tty_GetTime(void);
+
+static void MBDrv_Tty_SetTimer(
+    int                      tmrfd,
+    CPU_INT64U               value,
+    CPU_INT64U               interval,
+    CPU_BOOLEAN              absolute
+);
+
+static void MBDrv_Tty_Transmitted(
+    MBDRV_TTY_PORT          *p_port,
+    CPU_SIZE_T               size
+);
+
+static void MBDrv_Tty_Wakeup(
+    MBDRV_TTY_PORT          *p_port
+);
+
+static void MBDrv_Tty_UpdateErrorCounters(
+    MBDRV_TTY_PORT          *p_port,
+    CPU_INT08U              *p_errors
+);
+
+static void MBDrv_Tty_Enqueue(
+    MBDRV_TTY_PORT          *p_port,
+    CPU_INT08U               datum,
+    CPU_INT08U               errors
+);
+
+static void MBDrv_Tty_Receive(
+    MBDRV_TTY_PORT          *p_port
+);
+
+static void MBDrv_Tty_ReceiveChunk(
+    MBDRV_TTY_PORT          *p_port
+);
+
+static void MBDrv_Tty_CloseFiles(
+    MBDRV_TTY_PORT          *p_port
+);
+
+static void *MBDrv_Tty_IoTask(
+    void                    *p_arg
+);
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/*  TTY ports.  */
+static MBDRV_TTY_PORT   g_MBDrvTty_Ports[MBDRV_TTY_PORT_CNT];
+
+
+/*
+*********************************************************************************************************
+*                                          PORT DEFINITIONS
+*
+* Note(s) : (1) The functions of MB_DRIVER don't take the driver as a parameter, so each TTY port gets its
+*               own set of (thin) functions and its own driver descriptor (MBDRV_TTY{n}_DRIVERDESC).
+*********************************************************************************************************
+*/
+
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+#define MBDRV_TTY_PORT_DEFINE_RTU(n)                                                                    \
+    static void MBDrv_Tty##n##_HalfCharacterTimerStart(MB_ERROR *p_error) {                             \
+        MBDrv_Tty_HalfCharacterTimerStart(&(g_MBDrvTty_Ports[n]), p_error);                             \
+    }                                                                                                   \
+    static void MBDrv_Tty##n##_HalfCharacterTimerStop(MB_ERROR *p_error) {                              \
+        MBDrv_Tty_HalfCharacterTimerStop(&(g_MBDrvTty_Ports[n]), p_error);                              \
+    }
+#define MBDRV_TTY_PORT_DESC_RTU(n)                                                                      \
+    .halfCharacterTimerStart = MBDrv_Tty##n##_HalfCharacterTimerStart,                                  \
+    .halfCharacterTimerStop  = MBDrv_Tty##n##_HalfCharacterTimerStop,
+#else
+#define MBDRV_TTY_PORT_DEFINE_RTU(n)
+#define MBDRV_TTY_PORT_DESC_RTU(n)
+#endif
+
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+#define MBDRV_TTY_PORT_DEFINE_TXBLOCK(n)                                                                \
+    static void MBDrv_Tty##n##_TxTransmitBlock(const CPU_INT08U *p_data, CPU_SIZE_T size,               \
+                                               MB_ERROR *p_error) {                                     \
+        MBDrv_Tty_TxTransmitBlock(&(g_MBDrvTty_Ports[n]), p_data, size, p_error);                       \
+    }
+#define MBDRV_TTY_PORT_DESC_TXBLOCK(n)                                                                  \
+    .txTransmitBlock         = MBDrv_Tty##n##_TxTransmitBlock,
+#else
+#define MBDRV_TTY_PORT_DEFINE_TXBLOCK(n)
+#define MBDRV_TTY_PORT_DESC_TXBLOCK(n)
+#endif
+
+#define MBDRV_TTY_PORT_DEFINE(n)                                                                        \
+    extern MB_DRIVER MBDRV_TTY##n##_DRIVERDESC;                                                         \
+    static void MBDrv_Tty##n##_Initialize(void *p_mbctx, MB_DRIVER_CALLBACKS *p_drvcb,                  \
+                                          MB_ERROR *p_error) {                                          \
+        MBDrv_Tty_Initialize(&(g_MBDrvTty_Ports[n]), &(MBDRV_TTY##n##_DRIVERDESC), p_mbctx, p_drvcb,    \
+                             p_error);                                                                  \
+    }                                                                                                   \
+    static void MBDrv_Tty##n##_DeviceOpen(MB_SERIAL_SETUP *p_setup, MB_ERROR *p_error) {                \
+        MBDrv_Tty_DeviceOpen(&(g_MBDrvTty_Ports[n]), p_setup, p_error);                                 \
+    }                                                                                                   \
+    static void MBDrv_Tty##n##_DeviceClose(MB_ERROR *p_error) {                                         \
+        MBDrv_Tty_DeviceClose(&(g_MBDrvTty_Ports[n]), p_error);                                         \
+    }                                                                                                   \
+    MBDRV_TTY_PORT_DEFINE_RTU(n)                                                                        \
+    static void MBDrv_Tty##n##_RxStart(MB_ERROR *p_error) {                                             \
+        MBDrv_Tty_RxStart(&(g_MBDrvTty_Ports[n]), p_error);                                             \
+    }                                                                                                   \
+    static void MBDrv_Tty##n##_RxStop(MB_ERROR *p_error) {                                              \
+        MBDrv_Tty_RxStop(&(g_MBDrvTty_Ports[n]), p_error);                                              \
+    }                                                                                                   \
+    static CPU_INT08U MBDrv_Tty##n##_RxRead(MB_ERROR *p_error) {                                        \
+        return MBDrv_Tty_RxRead(&(g_MBDrvTty_Ports[n]), p_error);                                       \
+    }                                                                                                   \
+    static void MBDrv_Tty##n##_TxStart(MB_ERROR *p_error) {                                             \
+        MBDrv_Tty_TxStart(&(g_MBDrvTty_Ports[n]), p_error);                                             \
+    }                                                                                                   \
+    static void MBDrv_Tty##n##_TxStop(MB_ERROR *p_error) {                                              \
+        MBDrv_Tty_TxStop(&(g_MBDrvTty_Ports[n]), p_error);                                              \
+    }                                                                                                   \
+    static void MBDrv_Tty##n##_TxTransmit(CPU_INT08U datum, MB_ERROR *p_error) {                        \
+        MBDrv_Tty_TxTransmit(&(g_MBDrvTty_Ports[n]), datum, p_error);                                   \
+    }                                                                                                   \
+    MBDRV_TTY_PORT_DEFINE_TXBLOCK(n)                                                                    \
+    static void MBDrv_Tty##n##_HalfDuplex_SetMode(MB_DUPLEXMODE duplexMode, MB_ERROR *p_error) {        \
+        MBDrv_Tty_HalfDuplex_SetMode(&(g_MBDrvTty_Ports[n]), duplexMode, p_error);                      \
+    }                                                                                                   \
+    static CPU_BOOLEAN MBDrv_Tty##n##_HasParityError() {                                                \
+        return MBDrv_Tty_HasError(&(g_MBDrvTty_Ports[n]), MBDRV_TTY_ERROR_PARITY);                      \
+    }                                                                                                   \
+    static void MBDrv_Tty##n##_ClearParityError() {                                                     \
+        MBDrv_Tty_ClearError(&(g_MBDrvTty_Ports[n]), MBDRV_TTY_ERROR_PARITY);                           \
+    }                                                                                                   \
+    static CPU_BOOLEAN MBDrv_Tty##n##_HasDataOverRunError() {                                           \
+        return MBDrv_Tty_HasError(&(g_MBDrvTty_Ports[n]), MBDRV_TTY_ERROR_OVERRUN);                     \
+    }                                                                                                   \
+    static void MBDrv_Tty##n##_ClearDataOverRunError() {                                                \
+        MBDrv_Tty_ClearError(&(g_MBDrvTty_Ports[n]), MBDRV_TTY_ERROR_OVERRUN);                          \
+    }                                                                                                   \
+    static CPU_BOOLEAN MBDrv_Tty##n##_HasFrameError() {                                                 \
+        return MBDrv_Tty_HasError(&(g_MBDrvTty_Ports[n]), MBDRV_TTY_ERROR_FRAME);                       \
+    }                                                                                                   \
+    static void MBDrv_Tty##n##_ClearFrameError() {                                                      \
+        MBDrv_Tty_ClearError(&(g_MBDrvTty_Ports[n]), MBDRV_TTY_ERROR_FRAME);                            \
+    }                                                                                                   \
+    MB_DRIVER MBDRV_TTY##n##_DRIVERDESC = {                                                             \
+        .initialize              = MBDrv_Tty##n##_Initialize,                                           \
+        .deviceOpen              = MBDrv_Tty##n##_DeviceOpen,                                           \
+        .deviceClose             = MBDrv_Tty##n##_DeviceClose,                                          \
+        MBDRV_TTY_PORT_DESC_RTU(n)                                                                      \
+        .rxStart                 = MBDrv_Tty##n##_RxStart,                                              \
+        .rxStop                  = MBDrv_Tty##n##_RxStop,                                               \
+        .rxRead                  = MBDrv_Tty##n##_RxRead,                                               \
+        .txStart                 = MBDrv_Tty##n##_TxStart,                                              \
+        .txStop                  = MBDrv_Tty##n##_TxStop,                                               \
+        .txTransmit              = MBDrv_Tty##n##_TxTransmit,                                           \
+        MBDRV_TTY_PORT_DESC_TXBLOCK(n)                                                                  \
+        .halfDuplexModeSetup     = MBDrv_Tty##n##_HalfDuplex_SetMode,                                   \
+        .hasParityError          = MBDrv_Tty##n##_HasParityError,                                       \
+        .clearParityError        = MBDrv_Tty##n##_ClearParityError,                                     \
+        .hasDataOverRunError     = MBDrv_Tty##n##_HasDataOverRunError,                                  \
+        .clearDataOverRunError   = MBDrv_Tty##n##_ClearDataOverRunError,                                \
+        .hasFrameError           = MBDrv_Tty##n##_HasFrameError,                                        \
+        .clearFrameError         = MBDrv_Tty##n##_ClearFrameError                                       \
+    };
+
+MBDRV_TTY_PORT_DEFINE(0)
+MBDRV_TTY_PORT_DEFINE(1)
+MBDRV_TTY_PORT_DEFINE(2)
+MBDRV_TTY_PORT_DEFINE(3)
+
+
+/*
+*********************************************************************************************************
+*                                      MBDrv_Tty_SetPath()
+*
+* Description : Set the device path of a TTY port.
+*
+* Argument(s) : (1) port        Index of the port.
+*               (2) path        The device path (e.g. "/dev/ttyUSB0" or one end of a pty pair).
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 No error occurred.
+*                                   MB_ERROR_NULLREFERENCE        'path' is NULL.
+*                                   MB_ERROR_INVALIDPARAMETER     'port' is out of range.
+*                                   MB_ERROR_OVERFLOW             'path' is too long.
+*                                   MB_ERROR_DEVICEOPENED         The port is opened.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) This function must be called before the port is opened (MB_OpenDevice()).
+*********************************************************************************************************
+*/
+
+void MBDrv_Tty_SetPath(
+    CPU_SIZE_T               port,
+    const CPU_CHAR          *path,
+    MB_ERROR                *p_error
+) {
+    MBDRV_TTY_PORT  *p_port;
+    CPU_SIZE_T       len;
+    CPU_SR_ALLOC();
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'path' parameter.  */
+    if (path == (const CPU_CHAR*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Check 'port' parameter.  */
+    if (port >= MBDRV_TTY_PORT_CNT) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+
+    /*  Check the length of the path.  */
+    len = (CPU_SIZE_T)strlen(path);
+    if (len >= MBDRV_TTY_PATH_MAX) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+
+    p_port = &(g_MBDrvTty_Ports[port]);
+
+    CPU_CRITICAL_ENTER();
+    if (p_port->opened) {
+        CPU_CRITICAL_EXIT();
+        *p_error = MB_ERROR_DEVICEOPENED;
+        return;
+    }
+    memcpy(p_port->path, path, len + (CPU_SIZE_T)1U);
+    CPU_CRITICAL_EXIT();
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_SetMinHalfCharTime()
+*
+* Description : Set the minimum half-character time of a TTY port.
+*
+* Argument(s) : (1) port        Index of the port.
+*               (2) minTime     The minimum half-character time (unit: microseconds, 0 to disable).
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 No error occurred.
+*                                   MB_ERROR_INVALIDPARAMETER     'port' is out of range.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The received characters are timestamped when they are read from the TTY, so the RTU 1.5
+*                   and 3.5 character times (3 and 7 half-character times) are only as accurate as the latency
+*                   of the device. USB adapters usually pass the characters in chunks (every 1ms to 16ms), a
+*                   minimum half-character time that is greater than the chunk period keeps frames from being
+*                   split.
+*               (2) Applies to the port when it is opened next time.
+*********************************************************************************************************
+*/
+
+void MBDrv_Tty_SetMinHalfCharTime(
+    CPU_SIZE_T               port,
+    CPU_INT32U               minTime,
+    MB_ERROR                *p_error
+) {
+    CPU_SR_ALLOC();
+
+    /*  Check 'port' parameter.  */
+    if (port >= MBDRV_TTY_PORT_CNT) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    g_MBDrvTty_Ports[port].minHalfCharTime = (CPU_INT64U)minTime * (CPU_INT64U)1000U;
+    CPU_CRITICAL_EXIT();
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBDrv_Tty_GetStatistics()
+*
+* Description : Get the statistics of a TTY port.
+*
+* Argument(s) : (1) port        Index of the port.
+*               (2) p_stats     Pointer to the variable that receives the statistics.
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 No error occurred.
+*                                   MB_ERROR_NULLREFERENCE        'p_stats' is NULL.
+*                                   MB_ERROR_INVALIDPARAMETER     'port' is out of range.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The counters are cleared when the port is opened.
+*********************************************************************************************************
+*/
+
+void MBDrv_Tty_GetStatistics(
+    CPU_SIZE_T               port,
+    MBDRV_TTY_STATISTICS    *p_stats,
+    MB_ERROR                *p_error
+) {
+    CPU_SR_ALLOC();
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_stats' parameter.  */
+    if (p_stats == (MBDRV_TTY_STATISTICS*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Check 'port' parameter.  */
+    if (port >= MBDRV_TTY_PORT_CNT) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    *p_stats = g_MBDrvTty_Ports[port].stats;
+    CPU_CRITICAL_EXIT();
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBDrv_Tty_Initialize()
+*
+* Description : Initialize the driver of a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) p_desc      Pointer to the driver descriptor of the port.
+*               (3) p_mbctx     Pointer to the Modbus context.
+*               (4) p_drvcb     Pointer to the driver callbacks.
+*               (5) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Driver initialized successfully.
+*                                   MB_ERROR_NULLREFERENCE        'p_mbctx' or 'p_drvcb' is NULL.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) The device path and the minimum half-character time of the port are kept.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_Initialize(
+    MBDRV_TTY_PORT          *p_port,
+    MB_DRIVER               *p_desc,
+    void                    *p_mbctx,
+    MB_DRIVER_CALLBACKS     *p_drvcb,
+    MB_ERROR                *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_mbctx' parameter.  */
+    if (p_mbctx == (void*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_drvcb' parameter.  */
+    if (p_drvcb == (MB_DRIVER_CALLBACKS*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Save the context.  */
+    p_port->desc  = p_desc;
+    p_port->mbctx = p_mbctx;
+    p_port->drvcb = p_drvcb;
+
+    /*  Mark the port as not opened.  */
+    p_port->opened     = DEF_NO;
+    p_port->rxEnabled  = DEF_NO;
+    p_port->txEnabled  = DEF_NO;
+    p_port->duplexMode = MB_HALFDUPLEX_RECEIVE;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBDrv_Tty_DeviceOpen()
+*
+* Description : Open a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) p_setup     Pointer to the serial port configuration.
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Device opened successfully.
+*                                   MB_ERROR_NULLREFERENCE        'p_setup' is NULL.
+*                                   MB_ERROR_INVALIDPARAMETER     Serial port configuration corrupted (or not
+*                                                                 supported by termios).
+*                                   MB_ERROR_DEVICEOPENED         Device was already opened.
+*                                   MB_ERROR_DEVICEBUSY           The I/O task of the previous session is still
+*                                                                 exiting.
+*                                   MB_ERROR_DEVICEFAIL           Failed to open or to configure the device.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) The device is opened in non-blocking raw mode. Parity and frame errors are marked by the
+*                   line discipline (PARMRK) and are classified (together with overrun errors) through
+*                   TIOCGICOUNT if the device supports it.
+*               (3) On serial ports that support it, ASYNC_LOW_LATENCY is enabled to reduce the receive
+*                   latency.
+*               (4) One I/O task per port waits for the device, the half-character timer and the TX timer
+*                   (epoll) and invokes the driver callbacks inside a critical section, like ISRs.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_DeviceOpen(
+    MBDRV_TTY_PORT          *p_port,
+    MB_SERIAL_SETUP         *p_setup,
+    MB_ERROR                *p_error
+) {
+    CPU_INT64U            halfBits;
+    CPU_INT64U            charTime;
+    struct epoll_event    ev;
+    struct serial_struct  serial;
+    pthread_attr_t        attr;
+    pthread_t             thread;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_setup' parameter.  */
+    if (p_setup == (MB_SERIAL_SETUP*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Check whether the device is already opened.  */
+    if (p_port->opened) {
+        *p_error = MB_ERROR_DEVICEOPENED;
+        return;
+    }
+    if (p_port->taskAlive) {
+        *p_error = MB_ERROR_DEVICEBUSY;
+        return;
+    }
+
+    /*  Count the bits of a character (unit: half bit).  */
+    if (p_setup->baudrate == (MB_BAUDRATE)0U) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+    halfBits = (CPU_INT64U)(1U + p_setup->dataBits) * (CPU_INT64U)2U;
+    if (p_setup->parity != MB_SERIAL_PARITY_NONE) {
+        halfBits += (CPU_INT64U)2U;
+    }
+    halfBits += (p_setup->stopBits == MB_SERIAL_STOPBITS_2) ? (CPU_INT64U)4U : (CPU_INT64U)2U;
+
+    /*  Character time (unit: nanosecond).  */
+    charTime  = halfBits * MBDRV_TTY_NSEC_PER_SEC;
+    charTime += (CPU_INT64U)(p_setup->baudrate) * (CPU_INT64U)2U - (CPU_INT64U)1U;
+    charTime /= (CPU_INT64U)(p_setup->baudrate) * (CPU_INT64U)2U;
+
+    /*  Open the device.  */
+    p_port->fd      = -1;
+    p_port->epfd    = -1;
+    p_port->evfd    = -1;
+    p_port->tmrfd   = -1;
+    p_port->txTmrfd = -1;
+    p_port->rxTmrfd = -1;
+    p_port->fd = open(p_port->path, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+    if (p_port->fd < 0) {
+        *p_error = MB_ERROR_DEVICEFAIL;
+        return;
+    }
+
+    /*  Configure the device.  */
+    if (!MBDrv_Tty_SetupTermios(p_port->fd, p_setup)) {
+        MBDrv_Tty_CloseFiles(p_port);
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+    if (ioctl(p_port->fd, TIOCGSERIAL, &serial) == 0) {
+        serial.flags |= ASYNC_LOW_LATENCY;
+        (void)ioctl(p_port->fd, TIOCSSERIAL, &serial);
+    }
+    (void)tcflush(p_port->fd, TCIOFLUSH);
+    p_port->icountValid = (ioctl(p_port->fd, TIOCGICOUNT, &(p_port->icount)) == 0) ? DEF_YES : DEF_NO;
+
+    /*  Create the event, the timers and the epoll instance.  */
+    p_port->evfd    = eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+    p_port->tmrfd   = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    p_port->txTmrfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    p_port->rxTmrfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    p_port->epfd    = epoll_create1(EPOLL_CLOEXEC);
+    if (p_port->evfd < 0 || p_port->tmrfd < 0 || p_port->txTmrfd < 0 || p_port->rxTmrfd < 0 || p_port->epfd < 0) {
+        MBDrv_Tty_CloseFiles(p_port);
+        *p_error = MB_ERROR_DEVICEFAIL;
+        return;
+    }
+    memset(&ev, 0, sizeof(ev));
+    ev.events  = EPOLLIN;
+    ev.data.fd = p_port->evfd;
+    if (epoll_ctl(p_port->epfd, EPOLL_CTL_ADD, p_port->evfd, &ev) != 0) {
+        MBDrv_Tty_CloseFiles(p_port);
+        *p_error = MB_ERROR_DEVICEFAIL;
+        return;
+    }
+    ev.data.fd = p_port->tmrfd;
+    if (epoll_ctl(p_port->epfd, EPOLL_CTL_ADD, p_port->tmrfd, &ev) != 0) {
+        MBDrv_Tty_CloseFiles(p_port);
+        *p_error = MB_ERROR_DEVICEFAIL;
+        return;
+    }
+    ev.data.fd = p_port->txTmrfd;
+    if (epoll_ctl(p_port->epfd, EPOLL_CTL_ADD, p_port->txTmrfd, &ev) != 0) {
+        MBDrv_Tty_CloseFiles(p_port);
+        *p_error = MB_ERROR_DEVICEFAIL;
+        return;
+    }
+    ev.data.fd = p_port->rxTmrfd;
+    if (epoll_ctl(p_port->epfd, EPOLL_CTL_ADD, p_port->rxTmrfd, &ev) != 0) {
+        MBDrv_Tty_CloseFiles(p_port);
+        *p_error = MB_ERROR_DEVICEFAIL;
+        return;
+    }
+
+    /*  Reset the port.  */
+    p_port->charTime = charTime;
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+    if (p_setup->baudrate > (MB_BAUDRATE)19200U) {
+        p_port->halfCharTime = MBDRV_TTY_HALFCHARTIME_FIXED;
+    } else {
+        p_port->halfCharTime = (charTime + (CPU_INT64U)1U) / (CPU_INT64U)2U;
+    }
+    if (p_port->halfCharTime < p_port->minHalfCharTime) {
+        p_port->halfCharTime = p_port->minHalfCharTime;
+    }
+    p_port->halfCharTmrActive = DEF_NO;
+#endif
+    p_port->parityEnabled = (p_setup->parity != MB_SERIAL_PARITY_NONE) ? DEF_YES : DEF_NO;
+    p_port->stop          = DEF_NO;
+    p_port->hangUp        = DEF_NO;
+    p_port->rxWatched     = DEF_NO;
+    p_port->rxEnabled     = DEF_NO;
+    p_port->txEnabled     = DEF_NO;
+    p_port->duplexMode    = MB_HALFDUPLEX_RECEIVE;
+    p_port->txPending     = DEF_NO;
+    p_port->txSeq         = (CPU_INT32U)0U;
+    p_port->txDoneAt      = (CPU_INT64U)0U;
+    p_port->rxErrors      = (CPU_INT08U)0U;
+    p_port->rxErrorsNext  = (CPU_INT08U)0U;
+    p_port->errFlags      = (CPU_INT08U)0U;
+    p_port->markState     = MBDRV_TTY_MARK_NONE;
+    p_port->rxQueueHead   = (CPU_SIZE_T)0U;
+    p_port->rxQueueCnt    = (CPU_SIZE_T)0U;
+    p_port->rxNextAt      = (CPU_INT64U)0U;
+    memset(&(p_port->stats), 0, sizeof(p_port->stats));
+
+    /*  Start the I/O task.  */
+    if (pthread_attr_init(&attr) != 0) {
+        MBDrv_Tty_CloseFiles(p_port);
+        *p_error = MB_ERROR_DEVICEFAIL;
+        return;
+    }
+    (void)pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    if (pthread_create(&thread, &attr, MBDrv_Tty_IoTask, (void*)p_port) != 0) {
+        (void)pthread_attr_destroy(&attr);
+        MBDrv_Tty_CloseFiles(p_port);
+        *p_error = MB_ERROR_DEVICEFAIL;
+        return;
+    }
+    (void)pthread_attr_destroy(&attr);
+    p_port->taskAlive = DEF_YES;
+    p_port->opened    = DEF_YES;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBDrv_Tty_DeviceClose()
+*
+* Description : Close a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Device closed successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called, so the I/O task can't
+*                   be joined here. The I/O task closes the device and exits by itself.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_DeviceClose(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    /*  Check whether the device is opened.  */
+    if (!(p_port->opened)) {
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+
+    /*  Stop the I/O task.  */
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+    p_port->halfCharTmrActive = DEF_NO;
+#endif
+    p_port->rxEnabled = DEF_NO;
+    p_port->txEnabled = DEF_NO;
+    p_port->txPending = DEF_NO;
+    p_port->opened    = DEF_NO;
+    p_port->stop      = DEF_YES;
+    MBDrv_Tty_Wakeup(p_port);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                             MBDrv_Tty_HalfCharacterTimerStart()
+*
+* Description : Start the half-character timer of a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Timer started successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) If the timer is already started, the timer would be restarted (expirations that are not
+*                   handled yet are discarded by timerfd_settime()).
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_HalfCharacterTimerStart(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    if (!(p_port->opened)) {
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+
+    MBDrv_Tty_SetTimer(p_port->tmrfd, p_port->halfCharTime, p_port->halfCharTime, DEF_NO);
+    p_port->halfCharTmrActive = DEF_YES;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                             MBDrv_Tty_HalfCharacterTimerStop()
+*
+* Description : Stop the half-character timer of a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Timer stopped successfully.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_HalfCharacterTimerStop(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    if (p_port->opened) {
+        MBDrv_Tty_SetTimer(p_port->tmrfd, (CPU_INT64U)0U, (CPU_INT64U)0U, DEF_NO);
+    }
+    p_port->halfCharTmrActive = DEF_NO;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     MBDrv_Tty_RxStart()
+*
+* Description : Start the receiver of a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Receiver started successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) Characters that arrived while the receiver was stopped are kept by the TTY and are passed
+*                   right after the receiver is started.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_RxStart(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    if (!(p_port->opened)) {
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+
+    p_port->rxEnabled = DEF_YES;
+    MBDrv_Tty_Wakeup(p_port);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBDrv_Tty_RxStop()
+*
+* Description : Stop the receiver of a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Receiver stopped successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_RxStop(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    if (!(p_port->opened)) {
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+
+    p_port->rxEnabled = DEF_NO;
+    MBDrv_Tty_Wakeup(p_port);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBDrv_Tty_RxRead()
+*
+* Description : Read one byte from the receiver of a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Read from the receiver successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*
+* Return(s)   : The byte received.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) The receive errors of the character are latched to the error flags of the driver.
+*********************************************************************************************************
+*/
+
+static CPU_INT08U MBDrv_Tty_RxRead(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    if (!(p_port->opened)) {
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return (CPU_INT08U)0x00U;
+    }
+
+    p_port->errFlags |= p_port->rxErrors;
+    p_port->rxErrors  = (CPU_INT08U)0U;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+
+    return p_port->rxData;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBDrv_Tty_TxStart()
+*
+* Description : Start the transmitter of a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Transmitter started successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_TxStart(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    if (!(p_port->opened)) {
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+
+    p_port->txEnabled = DEF_YES;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBDrv_Tty_TxStop()
+*
+* Description : Stop the transmitter of a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Transmitter stopped successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_TxStop(
+    MBDRV_TTY_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    if (!(p_port->opened)) {
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+
+    p_port->txEnabled = DEF_NO;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBDrv_Tty_TxTransmit()
+*
+* Description : Transmit one byte through a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) datum       Byte to be written.
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Transmit successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*                                   MB_ERROR_DEVICEBUSY           The output buffer of the TTY is full.
+*                                   MB_ERROR_DEVICEFAIL           Failed to write to the device.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) The TX complete interrupt is raised when the byte has been transmitted (see
+*                   MBDrv_Tty_Transmitted()).
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_TxTransmit(
+    MBDRV_TTY_PORT          *p_port,
+    CPU_INT08U               datum,
+    MB_ERROR                *p_error
+) {
+    ssize_t  rc;
+
+    if (!(p_port->opened)) {
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+
+    rc = write(p_port->fd, &datum, (size_t)1U);
+    if (rc != (ssize_t)1) {
+        *p_error = (rc < 0 && errno == EAGAIN) ? MB_ERROR_DEVICEBUSY : MB_ERROR_DEVICEFAIL;
+        return;
+    }
+    MBDrv_Tty_Transmitted(p_port, (CPU_SIZE_T)1U);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_TxTransmitBlock()
+*
+* Description : Transmit a block of bytes (burst transmission) through a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) p_data      Pointer to the bytes to be written.
+*               (3) size        Count of bytes to be written.
+*               (4) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Transmit successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*                                   MB_ERROR_DEVICEBUSY           The output buffer of the TTY is full.
+*                                   MB_ERROR_DEVICEFAIL           Failed to write to the device.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) The whole block is written with one write() and the TX complete interrupt is raised once,
+*                   after the last byte has been transmitted.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_TxTransmitBlock(
+    MBDRV_TTY_PORT          *p_port,
+    const CPU_INT08U        *p_data,
+    CPU_SIZE_T               size,
+    MB_ERROR                *p_error
+) {
+    ssize_t  rc;
+
+    if (!(p_port->opened)) {
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+
+    rc = write(p_port->fd, p_data, (size_t)size);
+    if (rc < 0) {
+        *p_error = (errno == EAGAIN) ? MB_ERROR_DEVICEBUSY : MB_ERROR_DEVICEFAIL;
+        return;
+    }
+    if (rc == (ssize_t)0) {
+        *p_error = MB_ERROR_DEVICEBUSY;
+        return;
+    }
+    MBDrv_Tty_Transmitted(p_port, (CPU_SIZE_T)rc);
+    if ((CPU_SIZE_T)rc != size) {
+        /*  The remaining bytes were not accepted by the TTY.  */
+        *p_error = MB_ERROR_DEVICEBUSY;
+        return;
+    }
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_HalfDuplex_SetMode()
+*
+* Description : Set half-duplex transaction mode of a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) duplexMode  The duplex mode, one of following:
+*
+*                                   MB_HALFDUPLEX_RECEIVE         Receive mode.
+*                                   MB_HALFDUPLEX_TRANSMIT        Transmit mode.
+*
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 No error occurred.
+*                                   MB_ERROR_INVALIDPARAMETER     'duplexMode' is not valid.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) The direction of RS-485 adapters is switched by the adapter (or by the kernel, see
+*                   TIOCSRS485), so the mode is only recorded.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_HalfDuplex_SetMode(
+    MBDRV_TTY_PORT          *p_port,
+    MB_DUPLEXMODE            duplexMode,
+    MB_ERROR                *p_error
+) {
+    /*  Check 'duplexMode' parameter.  */
+    switch (duplexMode) {
+        case MB_HALFDUPLEX_RECEIVE:
+        case MB_HALFDUPLEX_TRANSMIT:
+            break;
+        default:
+            *p_error = MB_ERROR_INVALIDPARAMETER;
+            return;
+    }
+
+    p_port->duplexMode = duplexMode;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_HasError()
+*
+* Description : Check whether specific receive error occurred on a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) error       The error (MBDRV_TTY_ERROR_PARITY, MBDRV_TTY_ERROR_OVERRUN or
+*                               MBDRV_TTY_ERROR_FRAME).
+*
+* Return(s)   : DEF_YES if so, DEF_NO if not.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBDrv_Tty_HasError(
+    MBDRV_TTY_PORT          *p_port,
+    CPU_INT08U               error
+) {
+    return ((p_port->errFlags & error) != (CPU_INT08U)0U) ? DEF_YES : DEF_NO;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_ClearError()
+*
+* Description : Clear specific receive error flag of a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) error       The error (MBDRV_TTY_ERROR_PARITY, MBDRV_TTY_ERROR_OVERRUN or
+*                               MBDRV_TTY_ERROR_FRAME).
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_ClearError(
+    MBDRV_TTY_PORT          *p_port,
+    CPU_INT08U               error
+) {
+    p_port->errFlags &= (CPU_INT08U)(~error);
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_SetupTermios()
+*
+* Description : Put a TTY to raw mode with specific serial port configuration.
+*
+* Argument(s) : (1) fd          The file descriptor of the TTY.
+*               (2) p_setup     Pointer to the serial port configuration.
+*
+* Return(s)   : DEF_YES if succeed, DEF_NO if the configuration is not supported.
+*
+* Note(s)     : (1) 1.5 stop bits can't be represented by termios. Mark and space parity need CMSPAR.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBDrv_Tty_SetupTermios(
+    int                      fd,
+    MB_SERIAL_SETUP         *p_setup
+) {
+    struct termios  tio;
+    speed_t         speed;
+
+    switch (p_setup->baudrate) {
+        case MB_SERIAL_BAUDRATE_110:
+            speed = B110;
+            break;
+        case MB_SERIAL_BAUDRATE_300:
+            speed = B300;
+            break;
+        case MB_SERIAL_BAUDRATE_1200:
+            speed = B1200;
+            break;
+        case MB_SERIAL_BAUDRATE_2400:
+            speed = B2400;
+            break;
+        case MB_SERIAL_BAUDRATE_4800:
+            speed = B4800;
+            break;
+        case MB_SERIAL_BAUDRATE_9600:
+            speed = B9600;
+            break;
+        case MB_SERIAL_BAUDRATE_19200:
+            speed = B19200;
+            break;
+        case MB_SERIAL_BAUDRATE_38400:
+            speed = B38400;
+            break;
+        case MB_SERIAL_BAUDRATE_57600:
+            speed = B57600;
+            break;
+        case MB_SERIAL_BAUDRATE_115200:
+            speed = B115200;
+            break;
+        case MB_SERIAL_BAUDRATE_230400:
+            speed = B230400;
+            break;
+        case MB_SERIAL_BAUDRATE_460800:
+            speed = B460800;
+            break;
+        case MB_SERIAL_BAUDRATE_921600:
+            speed = B921600;
+            break;
+        default:
+            return DEF_NO;
+    }
+
+    if (tcgetattr(fd, &tio) != 0) {
+        return DEF_NO;
+    }
+
+    /*  Raw mode (errors are marked with PARMRK).  */
+    tio.c_iflag &= (tcflag_t)~(IGNBRK | BRKINT | IGNPAR | INPCK | ISTRIP | INLCR | IGNCR | ICRNL | IXON | IXOFF | IXANY);
+    tio.c_iflag |= (tcflag_t)PARMRK;
+    tio.c_oflag &= (tcflag_t)~(OPOST);
+    tio.c_lflag &= (tcflag_t)~(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+    tio.c_cflag &= (tcflag_t)~(CSIZE | PARENB | PARODD | CSTOPB | CRTSCTS);
+#ifdef CMSPAR
+    tio.c_cflag &= (tcflag_t)~(CMSPAR);
+#endif
+    tio.c_cflag |= (tcflag_t)(CREAD | CLOCAL);
+    tio.c_cc[VMIN]  = 0;
+    tio.c_cc[VTIME] = 0;
+
+    /*  Data bits.  */
+    switch (p_setup->dataBits) {
+        case MB_SERIAL_DATABITS_7:
+            tio.c_cflag |= (tcflag_t)CS7;
+            break;
+        case MB_SERIAL_DATABITS_8:
+            tio.c_cflag |= (tcflag_t)CS8;
+            break;
+        default:
+            return DEF_NO;
+    }
+
+    /*  Parity.  */
+    switch (p_setup->parity) {
+        case MB_SERIAL_PARITY_NONE:
+            break;
+        case MB_SERIAL_PARITY_ODD:
+            tio.c_iflag |= (tcflag_t)INPCK;
+            tio.c_cflag |= (tcflag_t)(PARENB | PARODD);
+            break;
+        case MB_SERIAL_PARITY_EVEN:
+            tio.c_iflag |= (tcflag_t)INPCK;
+            tio.c_cflag |= (tcflag_t)PARENB;
+            break;
+#ifdef CMSPAR
+        case MB_SERIAL_PARITY_MARK:
+            tio.c_iflag |= (tcflag_t)INPCK;
+            tio.c_cflag |= (tcflag_t)(PARENB | PARODD | CMSPAR);
+            break;
+        case MB_SERIAL_PARITY_SPACE:
+            tio.c_iflag |= (tcflag_t)INPCK;
+            tio.c_cflag |= (tcflag_t)(PARENB | CMSPAR);
+            break;
+#endif
+        default:
+            return DEF_NO;
+    }
+
+    /*  Stop bits.  */
+    switch (p_setup->stopBits) {
+        case MB_SERIAL_STOPBITS_1:
+            break;
+        case MB_SERIAL_STOPBITS_2:
+            tio.c_cflag |= (tcflag_t)CSTOPB;
+            break;
+        default:
+            return DEF_NO;
+    }
+
+    /*  Baud rate.  */
+    if (cfsetispeed(&tio, speed) != 0 || cfsetospeed(&tio, speed) != 0) {
+        return DEF_NO;
+    }
+
+    return (tcsetattr(fd, TCSANOW, &tio) == 0) ? DEF_YES : DEF_NO;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_GetTime()
+*
+* Description : Get current time of the monotonic clock.
+*
+* Argument(s) : None.
+*
+* Return(s)   : The time (unit: nanosecond).
+*********************************************************************************************************
+*/
+
+static CPU_INT64U MBDrv_Tty_GetTime(void) {
+    struct timespec  now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (CPU_INT64U)now.tv_sec * MBDRV_TTY_NSEC_PER_SEC + (CPU_INT64U)now.tv_nsec;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_SetTimer()
+*
+* Description : Arm (or disarm) a timer file descriptor.
+*
+* Argument(s) : (1) tmrfd       The timer file descriptor.
+*               (2) value       The expiration time (unit: nanosecond, 0 to disarm the timer).
+*               (3) interval    The interval of a periodic timer (unit: nanosecond, 0 for an one-shot timer).
+*               (4) absolute    DEF_YES if 'value' is an absolute time of the monotonic clock.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_SetTimer(
+    int                      tmrfd,
+    CPU_INT64U               value,
+    CPU_INT64U               interval,
+    CPU_BOOLEAN              absolute
+) {
+    struct itimerspec  its;
+
+    its.it_value.tv_sec     = (time_t)(value / MBDRV_TTY_NSEC_PER_SEC);
+    its.it_value.tv_nsec    = (long)(value % MBDRV_TTY_NSEC_PER_SEC);
+    its.it_interval.tv_sec  = (time_t)(interval / MBDRV_TTY_NSEC_PER_SEC);
+    its.it_interval.tv_nsec = (long)(interval % MBDRV_TTY_NSEC_PER_SEC);
+    (void)timerfd_settime(tmrfd, absolute ? TFD_TIMER_ABSTIME : 0, &its, (struct itimerspec*)0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_Transmitted()
+*
+* Description : Schedule the TX completion check after bytes were written to a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) size        Count of bytes written.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) The bytes are assumed to leave the port back-to-back at the configured baud rate, the TX
+*                   timer expires when the last byte should have been transmitted. Then the I/O task checks
+*                   the output queue (TIOCOUTQ) and waits for the device to drain (tcdrain()) before it raises
+*                   the TX complete interrupt. So pseudo terminals (which drain at once) are paced like a
+*                   real serial line.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_Transmitted(
+    MBDRV_TTY_PORT          *p_port,
+    CPU_SIZE_T               size
+) {
+    CPU_INT64U  now;
+
+    now = MBDrv_Tty_GetTime();
+    if (p_port->txDoneAt < now) {
+        p_port->txDoneAt = now;
+    }
+    p_port->txDoneAt += (CPU_INT64U)size * p_port->charTime;
+    p_port->txPending = DEF_YES;
+    ++(p_port->txSeq);
+    p_port->stats.cntTx += (MB_COUNTERVALUE)size;
+
+    MBDrv_Tty_SetTimer(p_port->txTmrfd, p_port->txDoneAt, (CPU_INT64U)0U, DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_Wakeup()
+*
+* Description : Wake up the I/O task of a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_Wakeup(
+    MBDRV_TTY_PORT          *p_port
+) {
+    CPU_INT64U  one;
+
+    one = (CPU_INT64U)1U;
+    (void)write(p_port->evfd, &one, sizeof(one));
+}
+
+
+/*
+*********************************************************************************************************
+*                             MBDrv_Tty_UpdateErrorCounters()
+*
+* Description : Read the error counters of the serial port (TIOCGICOUNT) and classify the errors occurred.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) p_errors    Pointer to the variable that receives the errors occurred since last call.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Pseudo terminals and some USB adapters don't support TIOCGICOUNT, no error is reported
+*                   then.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_UpdateErrorCounters(
+    MBDRV_TTY_PORT          *p_port,
+    CPU_INT08U              *p_errors
+) {
+    struct serial_icounter_struct  icount;
+
+    *p_errors = (CPU_INT08U)0U;
+    if (!(p_port->icountValid)) {
+        return;
+    }
+    if (ioctl(p_port->fd, TIOCGICOUNT, &icount) != 0) {
+        return;
+    }
+
+    if (icount.parity != p_port->icount.parity) {
+        *p_errors |= MBDRV_TTY_ERROR_PARITY;
+    }
+    if (icount.frame != p_port->icount.frame || icount.brk != p_port->icount.brk) {
+        *p_errors |= MBDRV_TTY_ERROR_FRAME;
+    }
+    if (icount.overrun != p_port->icount.overrun || icount.buf_overrun != p_port->icount.buf_overrun) {
+        *p_errors |= MBDRV_TTY_ERROR_OVERRUN;
+        ++(p_port->stats.cntOverrun);
+    }
+    p_port->icount = icount;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_Enqueue()
+*
+* Description : Put one received character to the receive queue of a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*               (2) datum       The character.
+*               (3) errors      The receive errors of the character.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) The queue is only refilled when it is empty and one read() returns at most
+*                   MBDRV_TTY_READ_SIZE characters, so the queue never overflows.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_Enqueue(
+    MBDRV_TTY_PORT          *p_port,
+    CPU_INT08U               datum,
+    CPU_INT08U               errors
+) {
+    CPU_SIZE_T  pos;
+
+    ++(p_port->stats.cntRx);
+    if ((errors & MBDRV_TTY_ERROR_PARITY) != (CPU_INT08U)0U) {
+        ++(p_port->stats.cntParityError);
+    }
+    if ((errors & MBDRV_TTY_ERROR_FRAME) != (CPU_INT08U)0U) {
+        ++(p_port->stats.cntFrameError);
+    }
+
+    pos = (p_port->rxQueueHead + p_port->rxQueueCnt) % MBDRV_TTY_READ_SIZE;
+    p_port->rxQueueData[pos]   = datum;
+    p_port->rxQueueErrors[pos] = errors;
+    ++(p_port->rxQueueCnt);
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_Receive()
+*
+* Description : Pass the first character in the receive queue of a TTY port to the Modbus core module.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) The characters are passed one character time apart (just like a real UART raises its RX
+*                   interrupts), so that the Modbus core module has the time to read each of them. Otherwise
+*                   the characters of a chunk would overrun each other.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_Receive(
+    MBDRV_TTY_PORT          *p_port
+) {
+    CPU_SIZE_T  pos;
+    CPU_INT64U  now;
+
+    pos = p_port->rxQueueHead;
+    p_port->rxQueueHead = (pos + (CPU_SIZE_T)1U) % MBDRV_TTY_READ_SIZE;
+    --(p_port->rxQueueCnt);
+
+    /*  Overrun errors are reported with the next character.  */
+    p_port->rxData       = p_port->rxQueueData[pos];
+    p_port->rxErrors     = (CPU_INT08U)(p_port->rxQueueErrors[pos] | p_port->rxErrorsNext);
+    p_port->rxErrorsNext = (CPU_INT08U)0U;
+
+    /*  Schedule the next character.  */
+    now = MBDrv_Tty_GetTime();
+    p_port->rxNextAt = now + p_port->charTime;
+    if (p_port->rxQueueCnt != (CPU_SIZE_T)0U) {
+        MBDrv_Tty_SetTimer(p_port->rxTmrfd, p_port->rxNextAt, (CPU_INT64U)0U, DEF_YES);
+    }
+
+    p_port->drvcb->rxComplete(p_port->desc, p_port->mbctx);
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_ReceiveChunk()
+*
+* Description : Read the characters available on a TTY port to the receive queue.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) With PARMRK, an erroneous character is passed as \377 \0 <char> and a valid \377 is
+*                   passed as \377 \377. The parser state is kept across reads.
+*               (3) If the device hangs up (e.g. the other end of a pty pair is closed), the device is no longer
+*                   watched until the port is reopened.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_ReceiveChunk(
+    MBDRV_TTY_PORT          *p_port
+) {
+    CPU_INT08U   buf[MBDRV_TTY_READ_SIZE];
+    CPU_INT08U   counted;
+    CPU_INT08U   errors;
+    CPU_INT08U   datum;
+    ssize_t      rc;
+    ssize_t      i;
+
+    rc = read(p_port->fd, buf, sizeof(buf));
+    if (rc <= (ssize_t)0) {
+        if (rc == (ssize_t)0 || (errno != EAGAIN && errno != EINTR)) {
+            p_port->hangUp = DEF_YES;
+        }
+        return;
+    }
+
+    /*  Get the errors counted by the serial port driver.  */
+    MBDrv_Tty_UpdateErrorCounters(p_port, &counted);
+    if ((counted & MBDRV_TTY_ERROR_OVERRUN) != (CPU_INT08U)0U) {
+        p_port->rxErrorsNext |= MBDRV_TTY_ERROR_OVERRUN;
+    }
+
+    for (i = (ssize_t)0; i < rc; ++i) {
+        datum = buf[i];
+        switch (p_port->markState) {
+            case MBDRV_TTY_MARK_FF:
+                if (datum == (CPU_INT08U)0x00U) {
+                    p_port->markState = MBDRV_TTY_MARK_FF00;
+                } else {
+                    /*  \377 \377 is a valid \377.  */
+                    p_port->markState = MBDRV_TTY_MARK_NONE;
+                    MBDrv_Tty_Enqueue(p_port, datum, (CPU_INT08U)0U);
+                }
+                break;
+            case MBDRV_TTY_MARK_FF00:
+                /*  Erroneous character, use the counters to tell parity errors from frame errors.  */
+                p_port->markState = MBDRV_TTY_MARK_NONE;
+                errors = (CPU_INT08U)(counted & (MBDRV_TTY_ERROR_PARITY | MBDRV_TTY_ERROR_FRAME));
+                if (errors == (CPU_INT08U)0U) {
+                    errors = p_port->parityEnabled ? MBDRV_TTY_ERROR_PARITY : MBDRV_TTY_ERROR_FRAME;
+                }
+                MBDrv_Tty_Enqueue(p_port, datum, errors);
+                break;
+            default:
+                if (datum == (CPU_INT08U)0xFFU) {
+                    p_port->markState = MBDRV_TTY_MARK_FF;
+                } else {
+                    MBDrv_Tty_Enqueue(p_port, datum, (CPU_INT08U)0U);
+                }
+                break;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_CloseFiles()
+*
+* Description : Close all file descriptors of a TTY port.
+*
+* Argument(s) : (1) p_port      Pointer to the TTY port.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Tty_CloseFiles(
+    MBDRV_TTY_PORT          *p_port
+) {
+    if (p_port->epfd >= 0) {
+        (void)close(p_port->epfd);
+        p_port->epfd = -1;
+    }
+    if (p_port->rxTmrfd >= 0) {
+        (void)close(p_port->rxTmrfd);
+        p_port->rxTmrfd = -1;
+    }
+    if (p_port->txTmrfd >= 0) {
+        (void)close(p_port->txTmrfd);
+        p_port->txTmrfd = -1;
+    }
+    if (p_port->tmrfd >= 0) {
+        (void)close(p_port->tmrfd);
+        p_port->tmrfd = -1;
+    }
+    if (p_port->evfd >= 0) {
+        (void)close(p_port->evfd);
+        p_port->evfd = -1;
+    }
+    if (p_port->fd >= 0) {
+        (void)close(p_port->fd);
+        p_port->fd = -1;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_IoTask()
+*
+* Description : I/O task of a TTY port, waits for the device and the timers and raises the interrupts.
+*
+* Argument(s) : (1) p_arg       Pointer to the TTY port.
+*
+* Return(s)   : Always NULL.
+*
+* Note(s)     : (1) The driver callbacks are invoked inside a critical section (CPU_CRITICAL_ENTER()), so
+*                   they run like ISRs with interrupts disabled. The state of the port is also protected by
+*                   the critical section, since the Modbus core module calls the driver functions inside it.
+*               (2) The received characters are handled before the half-character timer, so that a timer
+*                   tick that raced with a character doesn't break the frame.
+*               (3) The characters read from the device are queued and passed one character time apart (see
+*                   MBDrv_Tty_Receive()). The device is not watched while the queue is not empty.
+*               (4) The output queue check and tcdrain() are done outside the critical section because they
+*                   may block.
+*               (5) The task closes the device and exits when the port is closed.
+*********************************************************************************************************
+*/
+
+static void *MBDrv_Tty_IoTask(
+    void                    *p_arg
+) {
+    MBDRV_TTY_PORT      *p_port;
+    struct epoll_event   evs[5];
+    struct epoll_event   ev;
+    CPU_BOOLEAN          rxReady;
+    CPU_BOOLEAN          tmrReady;
+    CPU_BOOLEAN          txReady;
+    CPU_BOOLEAN          txDrained;
+    CPU_BOOLEAN          txPending;
+    CPU_BOOLEAN          rxWatch;
+    CPU_INT32U           txSeq;
+    CPU_INT64U           cnt;
+    CPU_INT64U           i;
+    int                  outq;
+    int                  n;
+    int                  k;
+    CPU_SR_ALLOC();
+
+    p_port = (MBDRV_TTY_PORT*)p_arg;
+
+#if defined(__linux__)
+    (void)prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+#endif
+
+    while (DEF_YES) {
+        /*  Wait for the device, the timers or the wake-up event.  */
+        n = epoll_wait(p_port->epfd, evs, 5, -1);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            n = 0;
+        }
+        rxReady  = DEF_NO;
+        tmrReady = DEF_NO;
+        txReady  = DEF_NO;
+        for (k = 0; k < n; ++k) {
+            if (evs[k].data.fd == p_port->fd) {
+                rxReady = DEF_YES;
+            } else if (evs[k].data.fd == p_port->tmrfd) {
+                tmrReady = DEF_YES;
+            } else if (evs[k].data.fd == p_port->txTmrfd) {
+                txReady = DEF_YES;
+            } else if (evs[k].data.fd == p_port->rxTmrfd) {
+                (void)read(p_port->rxTmrfd, &cnt, sizeof(cnt));
+            } else {
+                (void)read(p_port->evfd, &cnt, sizeof(cnt));
+            }
+        }
+
+        /*  Wait for the transmission to complete (outside the critical section).  */
+        txDrained = DEF_NO;
+        txSeq     = (CPU_INT32U)0U;
+        if (txReady) {
+            (void)read(p_port->txTmrfd, &cnt, sizeof(cnt));
+
+            CPU_CRITICAL_ENTER();
+            txPending = p_port->txPending;
+            txSeq     = p_port->txSeq;
+            CPU_CRITICAL_EXIT();
+
+            if (txPending) {
+                if (ioctl(p_port->fd, TIOCOUTQ, &outq) == 0 && outq > 0) {
+                    /*  Check again when the bytes in the output queue should have been transmitted.  */
+                    CPU_CRITICAL_ENTER();
+                    if (p_port->txPending && p_port->txSeq == txSeq) {
+                        MBDrv_Tty_SetTimer(
+                            p_port->txTmrfd,
+                            MBDrv_Tty_GetTime() + (CPU_INT64U)outq * p_port->charTime,
+                            (CPU_INT64U)0U,
+                            DEF_YES
+                        );
+                    }
+                    CPU_CRITICAL_EXIT();
+                } else {
+                    (void)tcdrain(p_port->fd);
+                    txDrained = DEF_YES;
+                }
+            }
+        }
+
+        CPU_CRITICAL_ENTER();
+
+        /*  Exit if the port was closed.  */
+        if (p_port->stop) {
+            MBDrv_Tty_CloseFiles(p_port);
+            p_port->taskAlive = DEF_NO;
+            CPU_CRITICAL_EXIT();
+            break;
+        }
+
+        /*  Handle received characters (one character per character time).  */
+        if (p_port->rxEnabled) {
+            if (rxReady && p_port->rxQueueCnt == (CPU_SIZE_T)0U && !(p_port->hangUp)) {
+                MBDrv_Tty_ReceiveChunk(p_port);
+            }
+            if (p_port->rxQueueCnt != (CPU_SIZE_T)0U) {
+                if (MBDrv_Tty_GetTime() >= p_port->rxNextAt) {
+                    MBDrv_Tty_Receive(p_port);
+                } else {
+                    MBDrv_Tty_SetTimer(p_port->rxTmrfd, p_port->rxNextAt, (CPU_INT64U)0U, DEF_YES);
+                }
+            }
+        }
+
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+        /*  Handle the half-character timer (a restarted timer has no expiration left).  */
+        if (tmrReady && read(p_port->tmrfd, &cnt, sizeof(cnt)) == (ssize_t)sizeof(cnt) && p_port->halfCharTmrActive) {
+            if (cnt > MBDRV_TTY_HALFCHARTICK_MAX) {
+                cnt = MBDRV_TTY_HALFCHARTICK_MAX;
+            }
+            for (i = (CPU_INT64U)0U; i < cnt && p_port->halfCharTmrActive; ++i) {
+                p_port->drvcb->halfCharacterTimeExceed(p_port->desc, p_port->mbctx);
+            }
+        }
+#else
+        (void)tmrReady;
+        (void)i;
+#endif
+
+        /*  Raise the TX complete interrupt if no byte was written since the check.  */
+        if (txDrained && p_port->txPending && p_port->txSeq == txSeq) {
+            p_port->txPending = DEF_NO;
+            if (p_port->txEnabled) {
+                p_port->drvcb->txComplete(p_port->desc, p_port->mbctx);
+            }
+        }
+
+        /*  Watch the device only if the receiver is started and the receive queue is empty.  */
+        rxWatch = (p_port->rxEnabled && p_port->rxQueueCnt == (CPU_SIZE_T)0U && !(p_port->hangUp)) ? DEF_YES : DEF_NO;
+        if (rxWatch != p_port->rxWatched) {
+            memset(&ev, 0, sizeof(ev));
+            ev.events  = EPOLLIN;
+            ev.data.fd = p_port->fd;
+            (void)epoll_ctl(p_port->epfd, rxWatch ? EPOLL_CTL_ADD : EPOLL_CTL_DEL, p_port->fd, &ev);
+            p_port->rxWatched = rxWatch;
+        }
+
+        CPU_CRITICAL_EXIT();
+    }
+
+    return (void*)0;
+}
\ No newline at end of file
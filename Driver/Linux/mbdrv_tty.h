@@ -0,0 +1,188 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                              DEVICE DRIVER
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                          Linux TTY (termios)
+*
+* File      : MBDRV_TTY.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef MBDRV_TTY_H__
+#define MBDRV_TTY_H__
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include <mbdrv_cfg.h>
+#include <mbdrv_types.h>
+
+#include <mb_types.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+/*  Count of TTY ports.  */
+#define MBDRV_TTY_PORT_CNT                        ((CPU_SIZE_T)4U)
+
+/*  Maximum length of the device path (including the terminating NUL character).  */
+#define MBDRV_TTY_PATH_MAX                        ((CPU_SIZE_T)128U)
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+typedef struct {
+    MB_COUNTERVALUE         cntTx;
+    MB_COUNTERVALUE         cntRx;
+    MB_COUNTERVALUE         cntParityError;
+    MB_COUNTERVALUE         cntFrameError;
+    MB_COUNTERVALUE         cntOverrun;
+} MBDRV_TTY_STATISTICS;
+
+
+/*
+*********************************************************************************************************
+*                                         DRIVER DESCRIPTORS
+*********************************************************************************************************
+*/
+
+#ifndef MBDRV_TTY_SOURCE
+extern MB_DRIVER                                         MBDRV_TTY0_DRIVERDESC;
+extern MB_DRIVER                                         MBDRV_TTY1_DRIVERDESC;
+extern MB_DRIVER                                         MBDRV_TTY2_DRIVERDESC;
+extern MB_DRIVER                                         MBDRV_TTY3_DRIVERDESC;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      MBDrv_Tty_SetPath()
+*
+* Description : Set the device path of a TTY port.
+*
+* Argument(s) : (1) port        Index of the port.
+*               (2) path        The device path (e.g. "/dev/ttyUSB0" or one end of a pty pair).
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 No error occurred.
+*                                   MB_ERROR_NULLREFERENCE        'path' is NULL.
+*                                   MB_ERROR_INVALIDPARAMETER     'port' is out of range.
+*                                   MB_ERROR_OVERFLOW             'path' is too long.
+*                                   MB_ERROR_DEVICEOPENED         The port is opened.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) This function must be called before the port is opened (MB_OpenDevice()).
+*********************************************************************************************************
+*/
+
+void MBDrv_Tty_SetPath(
+    CPU_SIZE_T               port,
+    const CPU_CHAR          *path,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Tty_SetMinHalfCharTime()
+*
+* Description : Set the minimum half-character time of a TTY port.
+*
+* Argument(s) : (1) port        Index of the port.
+*               (2) minTime     The minimum half-character time (unit: microseconds, 0 to disable).
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 No error occurred.
+*                                   MB_ERROR_INVALIDPARAMETER     'port' is out of range.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The received characters are timestamped when they are read from the TTY, so the RTU 1.5
+*                   and 3.5 character times (3 and 7 half-character times) are only as accurate as the latency
+*                   of the device. USB adapters usually pass the characters in chunks (every 1ms to 16ms), a
+*                   minimum half-character time that is greater than the chunk period keeps frames from being
+*                   split.
+*               (2) Applies to the port when it is opened next time.
+*********************************************************************************************************
+*/
+
+void MBDrv_Tty_SetMinHalfCharTime(
+    CPU_SIZE_T               port,
+    CPU_INT32U               minTime,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBDrv_Tty_GetStatistics()
+*
+* Description : Get the statistics of a TTY port.
+*
+* Argument(s) : (1) port        Index of the port.
+*               (2) p_stats     Pointer to the variable that receives the statistics.
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 No error occurred.
+*                                   MB_ERROR_NULLREFERENCE        'p_stats' is NULL.
+*                                   MB_ERROR_INVALIDPARAMETER     'port' is out of range.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The counters are cleared when the port is opened.
+*********************************************************************************************************
+*/
+
+void MBDrv_Tty_GetStatistics(
+    CPU_SIZE_T               port,
+    MBDRV_TTY_STATISTICS    *p_stats,
+    MB_ERROR                *p_error
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
\ No newline at end of file
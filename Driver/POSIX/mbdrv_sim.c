@@ -0,0 +1,1660 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                              DEVICE DRIVER
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                         POSIX Simulated UART
+*
+* File      : MBDRV_SIM.C
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE  200112L
+#endif
+
+#define MBDRV_SIM_SOURCE
+
+#include <mbdrv_sim.h>
+#include <mbdrv_cfg.h>
+#include <mbdrv_types.h>
+
+#include <mb_constants.h>
+#include <mb_types.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+#include <pthread.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <sys/prctl.h>
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/*  Nanoseconds per second.  */
+#define MBDRV_SIM_NSEC_PER_SEC                    ((CPU_INT64U)1000000000U)
+
+/*  Half-character timer interval for baud rates greater than 19200 bps (unit: nanoseconds).  */
+#define MBDRV_SIM_HALFCHARTIME_FIXED              ((CPU_INT64U)250000U)
+
+/*  Maximum count of interrupts raised by one line event.  */
+#define MBDRV_SIM_IRQ_MAX                         ((CPU_SIZE_T)2U)
+
+/*  Line events.  */
+#define MBDRV_SIM_EVENT_NONE                      ((CPU_INT08U)0U)
+#define MBDRV_SIM_EVENT_RXPENDING                 ((CPU_INT08U)1U)
+#define MBDRV_SIM_EVENT_TXSHIFTED                 ((CPU_INT08U)2U)
+#define MBDRV_SIM_EVENT_HALFCHARTIME              ((CPU_INT08U)3U)
+
+/*  Simulated interrupts.  */
+#define MBDRV_SIM_IRQ_RXCOMPLETE                  ((CPU_INT08U)0U)
+#define MBDRV_SIM_IRQ_TXCOMPLETE                  ((CPU_INT08U)1U)
+#define MBDRV_SIM_IRQ_HALFCHARTIME                ((CPU_INT08U)2U)
+
+/*  All receive errors.  */
+#define MBDRV_SIM_ERROR_ALL                       ((CPU_INT08U)(MBDRV_SIM_ERROR_PARITY  | \
+                                                                MBDRV_SIM_ERROR_OVERRUN | \
+                                                                MBDRV_SIM_ERROR_FRAME))
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+typedef struct {
+    MB_DRIVER              *desc;
+    void                   *mbctx;
+    MB_DRIVER_CALLBACKS    *drvcb;
+
+    CPU_BOOLEAN             opened;
+    CPU_BOOLEAN             rxEnabled;
+    CPU_BOOLEAN             txEnabled;
+    MB_DUPLEXMODE           duplexMode;
+
+    CPU_INT64U              charTime;
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+    CPU_INT64U              halfCharTime;
+    CPU_BOOLEAN             halfCharTmrActive;
+    CPU_INT64U              halfCharTmrNext;
+#endif
+
+    CPU_BOOLEAN             txBusy;
+    CPU_INT08U              txShift;
+    CPU_INT64U              txDone;
+    CPU_BOOLEAN             txHoldFull;
+    CPU_INT08U              txHold;
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+    CPU_BOOLEAN             txBlockActive;
+    const CPU_INT08U       *txBlock;
+    CPU_SIZE_T              txBlockRemain;
+#endif
+
+    CPU_BOOLEAN             rxFull;
+    CPU_INT08U              rxData;
+    CPU_INT08U              rxErrors;
+    CPU_BOOLEAN             rxPending;
+
+    CPU_INT08U              errFlags;
+    CPU_INT08U              errInject;
+
+    MBDRV_SIM_STATISTICS    stats;
+} MBDRV_SIM_PORT;
+
+typedef struct {
+    MBDRV_SIM_PORT         *port;
+    CPU_INT08U              irq;
+} MBDRV_SIM_IRQ;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_Initialize(
+    MBDRV_SIM_PORT          *p_port,
+    MB_DRIVER               *p_desc,
+    void                    *p_mbctx,
+    MB_DRIVER_CALLBACKS     *p_drvcb,
+    MB_ERROR                *p_error
+);
+
+static void MBDrv_Sim_DeviceOpen(
+    MBDRV_SIM_PORT          *p_port,
+    MB_SERIAL_SETUP         *p_setup,
+    MB_ERROR                *p_error
+);
+
+static void MBDrv_Sim_DeviceClose(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+static void MBDrv_Sim_HalfCharacterTimerStart(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+
+static void MBDrv_Sim_HalfCharacterTimerStop(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+#endif
+
+static void MBDrv_Sim_RxStart(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+
+static void MBDrv_Sim_RxStop(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+
+static CPU_INT08U MBDrv_Sim_RxRead(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+
+static void MBDrv_Sim_TxStart(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+
+static void MBDrv_Sim_TxStop(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+);
+
+static void MBDrv_Sim_TxTransmit(
+    MBDRV_SIM_PORT          *p_port,
+    CPU_INT08U               datum,
+    MB_ERROR                *p_error
+);
+
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+static void MBDrv_Sim_TxTransmitBlock(
+    MBDRV_SIM_PORT          *p_port,
+    const CPU_INT08U        *p_data,
+    CPU_SIZE_T               size,
+    MB_ERROR                *p_error
+);
+#endif
+
+static void MBDrv_Sim_HalfDuplex_SetMode(
+    MBDRV_SIM_PORT          *p_port,
+    MB_DUPLEXMODE            duplexMode,
+    MB_ERROR                *p_error
+);
+
+static CPU_BOOLEAN MBDrv_Sim_HasError(
+    MBDRV_SIM_PORT          *p_port,
+    CPU_INT08U               error
+);
+
+static void MBDrv_Sim_ClearError(
+    MBDRV_SIM_PORT          *p_port,
+    CPU_INT08U               error
+);
+
+static CPU_INT64U MBDrv_Sim_GetTime(void);
+
+static void MBDrv_Sim_LineInit(void);
+
+static CPU_BOOLEAN MBDrv_Sim_LineGetNext(
+    CPU_INT64U              *p_next
+);
+
+static CPU_SIZE_T MBDrv_Sim_LineStep(
+    CPU_INT64U               now,
+    MBDRV_SIM_IRQ           *p_irqs,
+    CPU_BOOLEAN             *p_found
+);
+
+static void *MBDrv_Sim_LineTask(
+    void                    *p_arg
+);
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/*  Simulated ports.  */
+static MBDRV_SIM_PORT   g_MBDrvSim_Ports[MBDRV_SIM_PORT_CNT];
+
+/*  Speed factor of the simulated lines.  */
+static CPU_INT32U       g_MBDrvSim_SpeedFactor  = (CPU_INT32U)1U;
+
+/*  Line task initialization control.  */
+static pthread_once_t   g_MBDrvSim_LineOnce     = PTHREAD_ONCE_INIT;
+
+/*  Line task status (DEF_YES if the line task is running).  */
+static CPU_BOOLEAN      g_MBDrvSim_LineReady    = DEF_NO;
+
+/*  Line lock (protects all simulated ports).  */
+static pthread_mutex_t  g_MBDrvSim_LineLock     = PTHREAD_MUTEX_INITIALIZER;
+
+/*  Line condition (signaled when the next event of the lines changes).  */
+static pthread_cond_t   g_MBDrvSim_LineCond;
+
+/*  Line task.  */
+static pthread_t        g_MBDrvSim_LineThread;
+
+
+/*
+*********************************************************************************************************
+*                                          PORT DEFINITIONS
+*
+* Note(s) : (1) The functions of MB_DRIVER don't take the driver as a parameter, so each simulated port
+*               gets its own set of (thin) functions and its own driver descriptor (MBDRV_SIM{n}_DRIVERDESC).
+*********************************************************************************************************
+*/
+
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+#define MBDRV_SIM_PORT_DEFINE_RTU(n)                                                                    \
+    static void MBDrv_Sim##n##_HalfCharacterTimerStart(MB_ERROR *p_error) {                             \
+        MBDrv_Sim_HalfCharacterTimerStart(&(g_MBDrvSim_Ports[n]), p_error);                             \
+    }                                                                                                   \
+    static void MBDrv_Sim##n##_HalfCharacterTimerStop(MB_ERROR *p_error) {                              \
+        MBDrv_Sim_HalfCharacterTimerStop(&(g_MBDrvSim_Ports[n]), p_error);                              \
+    }
+#define MBDRV_SIM_PORT_DESC_RTU(n)                                                                      \
+    .halfCharacterTimerStart = MBDrv_Sim##n##_HalfCharacterTimerStart,                                  \
+    .halfCharacterTimerStop  = MBDrv_Sim##n##_HalfCharacterTimerStop,
+#else
+#define MBDRV_SIM_PORT_DEFINE_RTU(n)
+#define MBDRV_SIM_PORT_DESC_RTU(n)
+#endif
+
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+#define MBDRV_SIM_PORT_DEFINE_TXBLOCK(n)                                                                \
+    static void MBDrv_Sim##n##_TxTransmitBlock(const CPU_INT08U *p_data, CPU_SIZE_T size,               \
+                                               MB_ERROR *p_error) {                                     \
+        MBDrv_Sim_TxTransmitBlock(&(g_MBDrvSim_Ports[n]), p_data, size, p_error);                       \
+    }
+#define MBDRV_SIM_PORT_DESC_TXBLOCK(n)                                                                  \
+    .txTransmitBlock         = MBDrv_Sim##n##_TxTransmitBlock,
+#else
+#define MBDRV_SIM_PORT_DEFINE_TXBLOCK(n)
+#define MBDRV_SIM_PORT_DESC_TXBLOCK(n)
+#endif
+
+#define MBDRV_SIM_PORT_DEFINE(n)                                                                        \
+    extern MB_DRIVER MBDRV_SIM##n##_DRIVERDESC;                                                         \
+    static void MBDrv_Sim##n##_Initialize(void *p_mbctx, MB_DRIVER_CALLBACKS *p_drvcb,                  \
+                                          MB_ERROR *p_error) {                                          \
+        MBDrv_Sim_Initialize(&(g_MBDrvSim_Ports[n]), &(MBDRV_SIM##n##_DRIVERDESC), p_mbctx, p_drvcb,    \
+                             p_error);                                                                  \
+    }                                                                                                   \
+    static void MBDrv_Sim##n##_DeviceOpen(MB_SERIAL_SETUP *p_setup, MB_ERROR *p_error) {                \
+        MBDrv_Sim_DeviceOpen(&(g_MBDrvSim_Ports[n]), p_setup, p_error);                                 \
+    }                                                                                                   \
+    static void MBDrv_Sim##n##_DeviceClose(MB_ERROR *p_error) {                                         \
+        MBDrv_Sim_DeviceClose(&(g_MBDrvSim_Ports[n]), p_error);                                         \
+    }                                                                                                   \
+    MBDRV_SIM_PORT_DEFINE_RTU(n)                                                                        \
+    static void MBDrv_Sim##n##_RxStart(MB_ERROR *p_error) {                                             \
+        MBDrv_Sim_RxStart(&(g_MBDrvSim_Ports[n]), p_error);                                             \
+    }                                                                                                   \
+    static void MBDrv_Sim##n##_RxStop(MB_ERROR *p_error) {                                              \
+        MBDrv_Sim_RxStop(&(g_MBDrvSim_Ports[n]), p_error);                                              \
+    }                                                                                                   \
+    static CPU_INT08U MBDrv_Sim##n##_RxRead(MB_ERROR *p_error) {                                        \
+        return MBDrv_Sim_RxRead(&(g_MBDrvSim_Ports[n]), p_error);                                       \
+    }                                                                                                   \
+    static void MBDrv_Sim##n##_TxStart(MB_ERROR *p_error) {                                             \
+        MBDrv_Sim_TxStart(&(g_MBDrvSim_Ports[n]), p_error);                                             \
+    }                                                                                                   \
+    static void MBDrv_Sim##n##_TxStop(MB_ERROR *p_error) {                                              \
+        MBDrv_Sim_TxStop(&(g_MBDrvSim_Ports[n]), p_error);                                              \
+    }                                                                                                   \
+    static void MBDrv_Sim##n##_TxTransmit(CPU_INT08U datum, MB_ERROR *p_error) {                        \
+        MBDrv_Sim_TxTransmit(&(g_MBDrvSim_Ports[n]), datum, p_error);                                   \
+    }                                                                                                   \
+    MBDRV_SIM_PORT_DEFINE_TXBLOCK(n)                                                                    \
+    static void MBDrv_Sim##n##_HalfDuplex_SetMode(MB_DUPLEXMODE duplexMode, MB_ERROR *p_error) {        \
+        MBDrv_Sim_HalfDuplex_SetMode(&(g_MBDrvSim_Ports[n]), duplexMode, p_error);                      \
+    }                                                                                                   \
+    static CPU_BOOLEAN MBDrv_Sim##n##_HasParityError() {                                                \
+        return MBDrv_Sim_HasError(&(g_MBDrvSim_Ports[n]), MBDRV_SIM_ERROR_PARITY);                      \
+    }                                                                                                   \
+    static void MBDrv_Sim##n##_ClearParityError() {                                                     \
+        MBDrv_Sim_ClearError(&(g_MBDrvSim_Ports[n]), MBDRV_SIM_ERROR_PARITY);                           \
+    }                                                                                                   \
+    static CPU_BOOLEAN MBDrv_Sim##n##_HasDataOverRunError() {                                           \
+        return MBDrv_Sim_HasError(&(g_MBDrvSim_Ports[n]), MBDRV_SIM_ERROR_OVERRUN);                     \
+    }                                                                                                   \
+    static void MBDrv_Sim##n##_ClearDataOverRunError() {                                                \
+        MBDrv_Sim_ClearError(&(g_MBDrvSim_Ports[n]), MBDRV_SIM_ERROR_OVERRUN);                          \
+    }                                                                                                   \
+    static CPU_BOOLEAN MBDrv_Sim##n##_HasFrameError() {                                                 \
+        return MBDrv_Sim_HasError(&(g_MBDrvSim_Ports[n]), MBDRV_SIM_ERROR_FRAME);                       \
+    }                                                                                                   \
+    static void MBDrv_Sim##n##_ClearFrameError() {                                                      \
+        MBDrv_Sim_ClearError(&(g_MBDrvSim_Ports[n]), MBDRV_SIM_ERROR_FRAME);                            \
+    }                                                                                                   \
+    MB_DRIVER MBDRV_SIM##n##_DRIVERDESC = {                                                             \
+        .initialize              = MBDrv_Sim##n##_Initialize,                                           \
+        .deviceOpen              = MBDrv_Sim##n##_DeviceOpen,                                           \
+        .deviceClose             = MBDrv_Sim##n##_DeviceClose,                                          \
+        MBDRV_SIM_PORT_DESC_RTU(n)                                                                      \
+        .rxStart                 = MBDrv_Sim##n##_RxStart,                                              \
+        .rxStop                  = MBDrv_Sim##n##_RxStop,                                               \
+        .rxRead                  = MBDrv_Sim##n##_RxRead,                                               \
+        .txStart                 = MBDrv_Sim##n##_TxStart,                                              \
+        .txStop                  = MBDrv_Sim##n##_TxStop,                                               \
+        .txTransmit              = MBDrv_Sim##n##_TxTransmit,                                           \
+        MBDRV_SIM_PORT_DESC_TXBLOCK(n)                                                                  \
+        .halfDuplexModeSetup     = MBDrv_Sim##n##_HalfDuplex_SetMode,                                   \
+        .hasParityError          = MBDrv_Sim##n##_HasParityError,                                       \
+        .clearParityError        = MBDrv_Sim##n##_ClearParityError,                                     \
+        .hasDataOverRunError     = MBDrv_Sim##n##_HasDataOverRunError,                                  \
+        .clearDataOverRunError   = MBDrv_Sim##n##_ClearDataOverRunError,                                \
+        .hasFrameError           = MBDrv_Sim##n##_HasFrameError,                                        \
+        .clearFrameError         = MBDrv_Sim##n##_ClearFrameError                                       \
+    };
+
+MBDRV_SIM_PORT_DEFINE(0)
+MBDRV_SIM_PORT_DEFINE(1)
+MBDRV_SIM_PORT_DEFINE(2)
+MBDRV_SIM_PORT_DEFINE(3)
+
+
+/*
+*********************************************************************************************************
+*                                    MBDrv_Sim_SetSpeedFactor()
+*
+* Description : Set the speed factor of the simulated serial lines.
+*
+* Argument(s) : (1) factor      The speed factor (1 to run the lines at the configured baud rate, N to run
+*                               them N times faster).
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 No error occurred.
+*                                   MB_ERROR_UNDERFLOW            'factor' equals to zero.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The factor applies to the character time and the half-character timer of the ports
+*                   opened after this call.
+*               (2) The timeouts of the Modbus stack are not scaled.
+*********************************************************************************************************
+*/
+
+void MBDrv_Sim_SetSpeedFactor(
+    CPU_INT32U               factor,
+    MB_ERROR                *p_error
+) {
+    /*  Check 'factor' parameter.  */
+    if (factor == (CPU_INT32U)0U) {
+        *p_error = MB_ERROR_UNDERFLOW;
+        return;
+    }
+
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    g_MBDrvSim_SpeedFactor = factor;
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBDrv_Sim_InjectError()
+*
+* Description : Inject receive errors to the next character received by a simulated port.
+*
+* Argument(s) : (1) port        Index of the port.
+*               (2) errors      The errors (any combination of MBDRV_SIM_ERROR_PARITY, MBDRV_SIM_ERROR_OVERRUN
+*                               and MBDRV_SIM_ERROR_FRAME).
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 No error occurred.
+*                                   MB_ERROR_INVALIDPARAMETER     'port' is out of range or 'errors' contains
+*                                                                 invalid bit(s).
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The errors are reported (through the error flags of the driver) together with the next
+*                   character, just like a real UART. A real overrun is also reported if a character arrives
+*                   before the previous one is read.
+*********************************************************************************************************
+*/
+
+void MBDrv_Sim_InjectError(
+    CPU_SIZE_T               port,
+    CPU_INT08U               errors,
+    MB_ERROR                *p_error
+) {
+    /*  Check 'port' and 'errors' parameter.  */
+    if (port >= MBDRV_SIM_PORT_CNT || (errors & (CPU_INT08U)(~MBDRV_SIM_ERROR_ALL)) != (CPU_INT08U)0U) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    g_MBDrvSim_Ports[port].errInject |= errors;
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBDrv_Sim_GetStatistics()
+*
+* Description : Get the statistics of a simulated port.
+*
+* Argument(s) : (1) port        Index of the port.
+*               (2) p_stats     Pointer to the variable that receives the statistics.
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 No error occurred.
+*                                   MB_ERROR_NULLREFERENCE        'p_stats' is NULL.
+*                                   MB_ERROR_INVALIDPARAMETER     'port' is out of range.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) 'cntDrop' counts the characters that were lost because the receiving port was closed or
+*                   was in transmit mode (half-duplex).
+*********************************************************************************************************
+*/
+
+void MBDrv_Sim_GetStatistics(
+    CPU_SIZE_T               port,
+    MBDRV_SIM_STATISTICS    *p_stats,
+    MB_ERROR                *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_stats' parameter.  */
+    if (p_stats == (MBDRV_SIM_STATISTICS*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Check 'port' parameter.  */
+    if (port >= MBDRV_SIM_PORT_CNT) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    *p_stats = g_MBDrvSim_Ports[port].stats;
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBDrv_Sim_Initialize()
+*
+* Description : Initialize the driver of a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) p_desc      Pointer to the driver descriptor of the port.
+*               (3) p_mbctx     Pointer to the Modbus context.
+*               (4) p_drvcb     Pointer to the driver callbacks.
+*               (5) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Driver initialized successfully.
+*                                   MB_ERROR_NULLREFERENCE        'p_mbctx' or 'p_drvcb' is NULL.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_Initialize(
+    MBDRV_SIM_PORT          *p_port,
+    MB_DRIVER               *p_desc,
+    void                    *p_mbctx,
+    MB_DRIVER_CALLBACKS     *p_drvcb,
+    MB_ERROR                *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_mbctx' parameter.  */
+    if (p_mbctx == (void*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_drvcb' parameter.  */
+    if (p_drvcb == (MB_DRIVER_CALLBACKS*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+
+    /*  Save the context.  */
+    p_port->desc  = p_desc;
+    p_port->mbctx = p_mbctx;
+    p_port->drvcb = p_drvcb;
+
+    /*  Mark the port as not opened.  */
+    p_port->opened     = DEF_NO;
+    p_port->rxEnabled  = DEF_NO;
+    p_port->txEnabled  = DEF_NO;
+    p_port->duplexMode = MB_HALFDUPLEX_RECEIVE;
+
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+    /*  Clear the half-character timer.  */
+    p_port->halfCharTmrActive = DEF_NO;
+#endif
+
+    /*  Clear the transmitter and the receiver.  */
+    p_port->txBusy     = DEF_NO;
+    p_port->txHoldFull = DEF_NO;
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+    p_port->txBlockActive = DEF_NO;
+#endif
+    p_port->rxFull     = DEF_NO;
+    p_port->rxErrors   = (CPU_INT08U)0U;
+    p_port->rxPending  = DEF_NO;
+    p_port->errFlags   = (CPU_INT08U)0U;
+    p_port->errInject  = (CPU_INT08U)0U;
+
+    /*  Clear all counters.  */
+    p_port->stats.cntTx       = (MB_COUNTERVALUE)0U;
+    p_port->stats.cntRx       = (MB_COUNTERVALUE)0U;
+    p_port->stats.cntDrop     = (MB_COUNTERVALUE)0U;
+    p_port->stats.cntOverrun  = (MB_COUNTERVALUE)0U;
+    p_port->stats.cntInjected = (MB_COUNTERVALUE)0U;
+
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBDrv_Sim_DeviceOpen()
+*
+* Description : Open a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) p_setup     Pointer to the serial port configuration.
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Device opened successfully.
+*                                   MB_ERROR_NULLREFERENCE        'p_setup' is NULL.
+*                                   MB_ERROR_INVALIDPARAMETER     Serial port configuration corrupted.
+*                                   MB_ERROR_DEVICEOPENED         Device was already opened.
+*                                   MB_ERROR_DEVICEFAIL           Failed to start the line task.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The character time is computed from the baud rate and the character format (start bit,
+*                   data bits, parity bit and stop bits) in nanoseconds, then divided by the speed factor.
+*               (2) Like a hardware driver, the half-character timer is fixed to 250us for baud rates greater
+*                   than 19200 bps.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_DeviceOpen(
+    MBDRV_SIM_PORT          *p_port,
+    MB_SERIAL_SETUP         *p_setup,
+    MB_ERROR                *p_error
+) {
+    CPU_INT64U  halfBits;
+    CPU_INT64U  charTime;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_setup' parameter.  */
+    if (p_setup == (MB_SERIAL_SETUP*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Count the bits of a character (unit: half bit).  */
+    if (p_setup->baudrate == (MB_BAUDRATE)0U) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+    switch (p_setup->dataBits) {
+        case MB_SERIAL_DATABITS_7:
+        case MB_SERIAL_DATABITS_8:
+            halfBits = (CPU_INT64U)(1U + p_setup->dataBits) * (CPU_INT64U)2U;
+            break;
+        default:
+            *p_error = MB_ERROR_INVALIDPARAMETER;
+            return;
+    }
+    switch (p_setup->parity) {
+        case MB_SERIAL_PARITY_NONE:
+            break;
+        case MB_SERIAL_PARITY_ODD:
+        case MB_SERIAL_PARITY_EVEN:
+        case MB_SERIAL_PARITY_MARK:
+        case MB_SERIAL_PARITY_SPACE:
+            halfBits += (CPU_INT64U)2U;
+            break;
+        default:
+            *p_error = MB_ERROR_INVALIDPARAMETER;
+            return;
+    }
+    switch (p_setup->stopBits) {
+        case MB_SERIAL_STOPBITS_1:
+            halfBits += (CPU_INT64U)2U;
+            break;
+        case MB_SERIAL_STOPBITS_1D5:
+            halfBits += (CPU_INT64U)3U;
+            break;
+        case MB_SERIAL_STOPBITS_2:
+            halfBits += (CPU_INT64U)4U;
+            break;
+        default:
+            *p_error = MB_ERROR_INVALIDPARAMETER;
+            return;
+    }
+
+    /*
+     *  Character time (unit: nanosecond) is calculated through following formula:
+     *
+     *                                halfBits * 10^9
+     *    charTime = Math.ceil (------------------------)
+     *                              2 * baudrate
+     *
+     */
+    charTime  = halfBits * MBDRV_SIM_NSEC_PER_SEC;
+    charTime += (CPU_INT64U)(p_setup->baudrate) * (CPU_INT64U)2U - (CPU_INT64U)1U;
+    charTime /= (CPU_INT64U)(p_setup->baudrate) * (CPU_INT64U)2U;
+
+    /*  Start the line task.  */
+    if (pthread_once(&g_MBDrvSim_LineOnce, MBDrv_Sim_LineInit) != 0 || g_MBDrvSim_LineReady != DEF_YES) {
+        *p_error = MB_ERROR_DEVICEFAIL;
+        return;
+    }
+
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+
+    /*  Check whether the device is already opened.  */
+    if (p_port->opened) {
+        (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+        *p_error = MB_ERROR_DEVICEOPENED;
+        return;
+    }
+
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+    /*  Calculate half character time.  */
+    if (p_setup->baudrate > (MB_BAUDRATE)19200U) {
+        p_port->halfCharTime = MBDRV_SIM_HALFCHARTIME_FIXED;
+    } else {
+        p_port->halfCharTime = (charTime + (CPU_INT64U)1U) / (CPU_INT64U)2U;
+    }
+    p_port->halfCharTime /= (CPU_INT64U)g_MBDrvSim_SpeedFactor;
+    if (p_port->halfCharTime == (CPU_INT64U)0U) {
+        p_port->halfCharTime = (CPU_INT64U)1U;
+    }
+    p_port->halfCharTmrActive = DEF_NO;
+#endif
+
+    /*  Open the port.  */
+    p_port->charTime = charTime / (CPU_INT64U)g_MBDrvSim_SpeedFactor;
+    if (p_port->charTime == (CPU_INT64U)0U) {
+        p_port->charTime = (CPU_INT64U)1U;
+    }
+    p_port->rxEnabled  = DEF_NO;
+    p_port->txEnabled  = DEF_NO;
+    p_port->txBusy     = DEF_NO;
+    p_port->txHoldFull = DEF_NO;
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+    p_port->txBlockActive = DEF_NO;
+#endif
+    p_port->rxFull     = DEF_NO;
+    p_port->rxErrors   = (CPU_INT08U)0U;
+    p_port->rxPending  = DEF_NO;
+    p_port->errFlags   = (CPU_INT08U)0U;
+    p_port->opened     = DEF_YES;
+
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBDrv_Sim_DeviceClose()
+*
+* Description : Close a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Device closed successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The character being transmitted (if any) is dropped.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_DeviceClose(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+
+    /*  Check whether the device is opened.  */
+    if (!(p_port->opened)) {
+        (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+
+    /*  Close the port.  */
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+    p_port->halfCharTmrActive = DEF_NO;
+#endif
+    p_port->rxEnabled  = DEF_NO;
+    p_port->txEnabled  = DEF_NO;
+    p_port->txBusy     = DEF_NO;
+    p_port->txHoldFull = DEF_NO;
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+    p_port->txBlockActive = DEF_NO;
+#endif
+    p_port->rxFull     = DEF_NO;
+    p_port->rxPending  = DEF_NO;
+    p_port->opened     = DEF_NO;
+
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                             MBDrv_Sim_HalfCharacterTimerStart()
+*
+* Description : Start the half-character timer of a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Timer started successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) If the timer is already started, the timer would be restarted.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_HalfCharacterTimerStart(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    CPU_INT64U  now;
+
+    now = MBDrv_Sim_GetTime();
+
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    if (!(p_port->opened)) {
+        (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+    p_port->halfCharTmrActive = DEF_YES;
+    p_port->halfCharTmrNext   = now + p_port->halfCharTime;
+    (void)pthread_cond_signal(&g_MBDrvSim_LineCond);
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                             MBDrv_Sim_HalfCharacterTimerStop()
+*
+* Description : Stop the half-character timer of a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Timer stopped successfully.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_HalfCharacterTimerStop(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    p_port->halfCharTmrActive = DEF_NO;
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     MBDrv_Sim_RxStart()
+*
+* Description : Start the receiver of a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Receiver started successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) Like a hardware UART, if a character is already in the receive buffer, the RX complete
+*                   interrupt is raised right after the receiver is started.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_RxStart(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    if (!(p_port->opened)) {
+        (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+    p_port->rxEnabled = DEF_YES;
+    if (p_port->rxFull) {
+        p_port->rxPending = DEF_YES;
+        (void)pthread_cond_signal(&g_MBDrvSim_LineCond);
+    }
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBDrv_Sim_RxStop()
+*
+* Description : Stop the receiver of a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Receiver stopped successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_RxStop(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    if (!(p_port->opened)) {
+        (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+    p_port->rxEnabled = DEF_NO;
+    p_port->rxPending = DEF_NO;
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBDrv_Sim_RxRead()
+*
+* Description : Read one byte from the receiver of a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Read from the receiver successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*
+* Return(s)   : The byte received.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) The receive errors of the character are latched to the error flags of the driver.
+*********************************************************************************************************
+*/
+
+static CPU_INT08U MBDrv_Sim_RxRead(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    CPU_INT08U  datum;
+
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    if (!(p_port->opened)) {
+        (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return (CPU_INT08U)0x00U;
+    }
+    datum              = p_port->rxData;
+    p_port->errFlags  |= p_port->rxErrors;
+    p_port->rxErrors   = (CPU_INT08U)0U;
+    p_port->rxFull     = DEF_NO;
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+
+    return datum;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBDrv_Sim_TxStart()
+*
+* Description : Start the transmitter of a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Transmitter started successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_TxStart(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    if (!(p_port->opened)) {
+        (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+    p_port->txEnabled = DEF_YES;
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MBDrv_Sim_TxStop()
+*
+* Description : Stop the transmitter of a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Transmitter stopped successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_TxStop(
+    MBDRV_SIM_PORT          *p_port,
+    MB_ERROR                *p_error
+) {
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    if (!(p_port->opened)) {
+        (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+    p_port->txEnabled = DEF_NO;
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBDrv_Sim_TxTransmit()
+*
+* Description : Transmit one byte through a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) datum       Byte to be written.
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Transmit successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*                                   MB_ERROR_DEVICEBUSY           The transmit buffer is full.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) The transmitter has a shift register and a one-byte transmit buffer. The byte reaches the
+*                   peer port one character time after it enters the shift register.
+*               (3) This function can't block (interrupts are disabled), so it fails if both the shift
+*                   register and the transmit buffer are full.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_TxTransmit(
+    MBDRV_SIM_PORT          *p_port,
+    CPU_INT08U               datum,
+    MB_ERROR                *p_error
+) {
+    CPU_INT64U  now;
+
+    now = MBDrv_Sim_GetTime();
+
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    if (!(p_port->opened)) {
+        (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+    if (!(p_port->txBusy)) {
+        p_port->txBusy  = DEF_YES;
+        p_port->txShift = datum;
+        p_port->txDone  = now + p_port->charTime;
+        (void)pthread_cond_signal(&g_MBDrvSim_LineCond);
+    } else if (!(p_port->txHoldFull)) {
+        p_port->txHoldFull = DEF_YES;
+        p_port->txHold     = datum;
+    } else {
+        (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+        *p_error = MB_ERROR_DEVICEBUSY;
+        return;
+    }
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                 MBDrv_Sim_TxTransmitBlock()
+*
+* Description : Transmit a block of bytes (burst transmission) through a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) p_data      Pointer to the bytes to be written.
+*               (3) size        Count of bytes to be written.
+*               (4) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 Transmit successfully.
+*                                   MB_ERROR_DEVICENOTOPENED      Device is not opened yet.
+*                                   MB_ERROR_DEVICEBUSY           The transmitter is busy.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) The bytes are shifted out back-to-back (like a DMA transfer) and the TX complete
+*                   interrupt is raised once, after the last byte has been transmitted.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_TxTransmitBlock(
+    MBDRV_SIM_PORT          *p_port,
+    const CPU_INT08U        *p_data,
+    CPU_SIZE_T               size,
+    MB_ERROR                *p_error
+) {
+    CPU_INT64U  now;
+
+    now = MBDrv_Sim_GetTime();
+
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    if (!(p_port->opened)) {
+        (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+        *p_error = MB_ERROR_DEVICENOTOPENED;
+        return;
+    }
+    if (p_port->txBusy || size == (CPU_SIZE_T)0U) {
+        (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+        *p_error = MB_ERROR_DEVICEBUSY;
+        return;
+    }
+    p_port->txBlockActive = DEF_YES;
+    p_port->txBlock       = p_data + 1;
+    p_port->txBlockRemain = size - (CPU_SIZE_T)1U;
+    p_port->txBusy        = DEF_YES;
+    p_port->txShift       = p_data[0];
+    p_port->txDone        = now + p_port->charTime;
+    (void)pthread_cond_signal(&g_MBDrvSim_LineCond);
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Sim_HalfDuplex_SetMode()
+*
+* Description : Set half-duplex transaction mode of a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) duplexMode  The duplex mode, one of following:
+*
+*                                   MB_HALFDUPLEX_RECEIVE         Receive mode.
+*                                   MB_HALFDUPLEX_TRANSMIT        Transmit mode.
+*
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 No error occurred.
+*                                   MB_ERROR_INVALIDPARAMETER     'duplexMode' is not valid.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*               (2) Characters that arrive while the port is in transmit mode are dropped (like a RS-485
+*                   transceiver with its receiver disabled).
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_HalfDuplex_SetMode(
+    MBDRV_SIM_PORT          *p_port,
+    MB_DUPLEXMODE            duplexMode,
+    MB_ERROR                *p_error
+) {
+    /*  Check 'duplexMode' parameter.  */
+    switch (duplexMode) {
+        case MB_HALFDUPLEX_RECEIVE:
+        case MB_HALFDUPLEX_TRANSMIT:
+            break;
+        default:
+            *p_error = MB_ERROR_INVALIDPARAMETER;
+            return;
+    }
+
+    /*  Switch half-duplex direction.  */
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    p_port->duplexMode = duplexMode;
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Sim_HasError()
+*
+* Description : Check whether specific receive error occurred on a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) error       The error (MBDRV_SIM_ERROR_PARITY, MBDRV_SIM_ERROR_OVERRUN or
+*                               MBDRV_SIM_ERROR_FRAME).
+*
+* Return(s)   : DEF_YES if so, DEF_NO if not.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBDrv_Sim_HasError(
+    MBDRV_SIM_PORT          *p_port,
+    CPU_INT08U               error
+) {
+    CPU_BOOLEAN  r;
+
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    r = ((p_port->errFlags & error) != (CPU_INT08U)0U) ? DEF_YES : DEF_NO;
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+    return r;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Sim_ClearError()
+*
+* Description : Clear specific receive error flag of a simulated port.
+*
+* Argument(s) : (1) p_port      Pointer to the simulated port.
+*               (2) error       The error (MBDRV_SIM_ERROR_PARITY, MBDRV_SIM_ERROR_OVERRUN or
+*                               MBDRV_SIM_ERROR_FRAME).
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_ClearError(
+    MBDRV_SIM_PORT          *p_port,
+    CPU_INT08U               error
+) {
+    (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+    p_port->errFlags &= (CPU_INT08U)(~error);
+    (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Sim_GetTime()
+*
+* Description : Get current time of the monotonic clock.
+*
+* Argument(s) : None.
+*
+* Return(s)   : The time (unit: nanosecond).
+*********************************************************************************************************
+*/
+
+static CPU_INT64U MBDrv_Sim_GetTime(void) {
+    struct timespec  now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (CPU_INT64U)now.tv_sec * MBDRV_SIM_NSEC_PER_SEC + (CPU_INT64U)now.tv_nsec;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Sim_LineInit()
+*
+* Description : Initialize the line condition and start the line task.
+*
+* Argument(s) : None.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Called once (through pthread_once()), g_MBDrvSim_LineReady is set if succeed.
+*********************************************************************************************************
+*/
+
+static void MBDrv_Sim_LineInit(void) {
+    pthread_condattr_t  attr;
+
+    if (pthread_condattr_init(&attr) != 0) {
+        return;
+    }
+    if (pthread_condattr_setclock(&attr, CLOCK_MONOTONIC) != 0 ||
+        pthread_cond_init(&g_MBDrvSim_LineCond, &attr) != 0) {
+        (void)pthread_condattr_destroy(&attr);
+        return;
+    }
+    (void)pthread_condattr_destroy(&attr);
+
+    if (pthread_create(&g_MBDrvSim_LineThread, (const pthread_attr_t*)0, MBDrv_Sim_LineTask, (void*)0) != 0) {
+        (void)pthread_cond_destroy(&g_MBDrvSim_LineCond);
+        return;
+    }
+    (void)pthread_detach(g_MBDrvSim_LineThread);
+
+    g_MBDrvSim_LineReady = DEF_YES;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Sim_LineGetNext()
+*
+* Description : Get the time of the next event of all simulated lines.
+*
+* Argument(s) : (1) p_next      Pointer to the variable that receives the time (unit: nanosecond).
+*
+* Return(s)   : DEF_YES if there is a pending event, DEF_NO if not.
+*
+* Note(s)     : (1) The line lock must be held by the caller.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBDrv_Sim_LineGetNext(
+    CPU_INT64U              *p_next
+) {
+    MBDRV_SIM_PORT  *p_port;
+    CPU_BOOLEAN      found;
+    CPU_SIZE_T       i;
+
+    found = DEF_NO;
+    for (i = (CPU_SIZE_T)0U; i < MBDRV_SIM_PORT_CNT; ++i) {
+        p_port = &(g_MBDrvSim_Ports[i]);
+        if (!(p_port->opened)) {
+            continue;
+        }
+        if (p_port->rxPending) {
+            *p_next = (CPU_INT64U)0U;
+            return DEF_YES;
+        }
+        if (p_port->txBusy && (!found || p_port->txDone < *p_next)) {
+            *p_next = p_port->txDone;
+            found   = DEF_YES;
+        }
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+        if (p_port->halfCharTmrActive && (!found || p_port->halfCharTmrNext < *p_next)) {
+            *p_next = p_port->halfCharTmrNext;
+            found   = DEF_YES;
+        }
+#endif
+    }
+
+    return found;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Sim_LineStep()
+*
+* Description : Handle the earliest line event that is due and collect the interrupts it raises.
+*
+* Argument(s) : (1) now         Current time (unit: nanosecond).
+*               (2) p_irqs      Pointer to the first element of the interrupt array (MBDRV_SIM_IRQ_MAX elements).
+*               (3) p_found     Pointer to the variable that receives whether a line event was handled.
+*
+* Return(s)   : Count of interrupts in the array.
+*
+* Note(s)     : (1) The line lock must be held by the caller.
+*               (2) Only one line event is handled per call, so that the interrupts raised by an event (which
+*                   may restart the half-character timer) are handled before the next event is evaluated.
+*               (3) A character shifted out is delivered to the peer port (port 2n <-> port 2n + 1).
+*********************************************************************************************************
+*/
+
+static CPU_SIZE_T MBDrv_Sim_LineStep(
+    CPU_INT64U               now,
+    MBDRV_SIM_IRQ           *p_irqs,
+    CPU_BOOLEAN             *p_found
+) {
+    MBDRV_SIM_PORT  *p_port;
+    MBDRV_SIM_PORT  *p_peer;
+    MBDRV_SIM_PORT  *p_evPort;
+    CPU_INT08U       evType;
+    CPU_INT64U       evTime;
+    CPU_SIZE_T       irqCnt;
+    CPU_SIZE_T       i;
+
+    /*  Find the earliest line event that is due.  */
+    p_evPort = (MBDRV_SIM_PORT*)0;
+    evType   = MBDRV_SIM_EVENT_NONE;
+    evTime   = now;
+    for (i = (CPU_SIZE_T)0U; i < MBDRV_SIM_PORT_CNT; ++i) {
+        p_port = &(g_MBDrvSim_Ports[i]);
+        if (!(p_port->opened)) {
+            continue;
+        }
+        if (p_port->rxPending) {
+            p_evPort = p_port;
+            evType   = MBDRV_SIM_EVENT_RXPENDING;
+            break;
+        }
+        if (p_port->txBusy && p_port->txDone <= evTime) {
+            p_evPort = p_port;
+            evType   = MBDRV_SIM_EVENT_TXSHIFTED;
+            evTime   = p_port->txDone;
+        }
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+        if (p_port->halfCharTmrActive && p_port->halfCharTmrNext <= evTime) {
+            p_evPort = p_port;
+            evType   = MBDRV_SIM_EVENT_HALFCHARTIME;
+            evTime   = p_port->halfCharTmrNext;
+        }
+#endif
+    }
+
+    irqCnt = (CPU_SIZE_T)0U;
+    switch (evType) {
+        case MBDRV_SIM_EVENT_RXPENDING:
+            /*  Raise the pending RX complete interrupt.  */
+            p_evPort->rxPending = DEF_NO;
+            if (p_evPort->rxEnabled && p_evPort->rxFull) {
+                p_irqs[irqCnt].port = p_evPort;
+                p_irqs[irqCnt].irq  = MBDRV_SIM_IRQ_RXCOMPLETE;
+                ++irqCnt;
+            }
+            break;
+
+        case MBDRV_SIM_EVENT_TXSHIFTED:
+            p_peer = &(g_MBDrvSim_Ports[(CPU_SIZE_T)(p_evPort - g_MBDrvSim_Ports) ^ (CPU_SIZE_T)1U]);
+            ++(p_evPort->stats.cntTx);
+
+            /*  Deliver the character to the peer port.  */
+            if (p_peer->opened && p_peer->duplexMode == MB_HALFDUPLEX_RECEIVE) {
+                if (p_peer->rxFull) {
+                    /*  The receive buffer is not read yet, the character is lost.  */
+                    p_peer->rxErrors |= MBDRV_SIM_ERROR_OVERRUN;
+                    ++(p_peer->stats.cntOverrun);
+                } else {
+                    p_peer->rxData    = p_evPort->txShift;
+                    p_peer->rxErrors  = p_peer->errInject;
+                    p_peer->rxFull    = DEF_YES;
+                    ++(p_peer->stats.cntRx);
+                    if (p_peer->errInject != (CPU_INT08U)0U) {
+                        p_peer->errInject = (CPU_INT08U)0U;
+                        ++(p_peer->stats.cntInjected);
+                    }
+                    if (p_peer->rxEnabled) {
+                        p_irqs[irqCnt].port = p_peer;
+                        p_irqs[irqCnt].irq  = MBDRV_SIM_IRQ_RXCOMPLETE;
+                        ++irqCnt;
+                    }
+                }
+            } else {
+                ++(p_peer->stats.cntDrop);
+            }
+
+            /*  Load the next character (if any).  */
+            if (p_evPort->txHoldFull) {
+                p_evPort->txHoldFull = DEF_NO;
+                p_evPort->txShift    = p_evPort->txHold;
+                p_evPort->txDone    += p_evPort->charTime;
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+            } else if (p_evPort->txBlockActive && p_evPort->txBlockRemain != (CPU_SIZE_T)0U) {
+                p_evPort->txShift    = *(p_evPort->txBlock);
+                p_evPort->txDone    += p_evPort->charTime;
+                ++(p_evPort->txBlock);
+                --(p_evPort->txBlockRemain);
+#endif
+            } else {
+                /*  The transmitter is empty now.  */
+                p_evPort->txBusy = DEF_NO;
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+                p_evPort->txBlockActive = DEF_NO;
+#endif
+                if (p_evPort->txEnabled) {
+                    p_irqs[irqCnt].port = p_evPort;
+                    p_irqs[irqCnt].irq  = MBDRV_SIM_IRQ_TXCOMPLETE;
+                    ++irqCnt;
+                }
+            }
+            break;
+
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+        case MBDRV_SIM_EVENT_HALFCHARTIME:
+            /*  Raise the half-character timer interrupt (ticks that were missed are skipped).  */
+            p_evPort->halfCharTmrNext += p_evPort->halfCharTime;
+            if (p_evPort->halfCharTmrNext <= now) {
+                p_evPort->halfCharTmrNext = now + p_evPort->halfCharTime;
+            }
+            p_irqs[irqCnt].port = p_evPort;
+            p_irqs[irqCnt].irq  = MBDRV_SIM_IRQ_HALFCHARTIME;
+            ++irqCnt;
+            break;
+#endif
+
+        default:
+            *p_found = DEF_NO;
+            return irqCnt;
+    }
+
+    *p_found = DEF_YES;
+
+    return irqCnt;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MBDrv_Sim_LineTask()
+*
+* Description : Line task, simulates the serial lines and raises the interrupts of all simulated ports.
+*
+* Argument(s) : (1) p_arg       Not used.
+*
+* Return(s)   : Never returns.
+*
+* Note(s)     : (1) The driver callbacks are invoked inside a critical section (CPU_CRITICAL_ENTER()), so
+*                   they run like ISRs with interrupts disabled.
+*               (2) The critical section is always entered before the line lock is acquired (the driver
+*                   functions are called by the Modbus core module inside critical sections).
+*               (3) On Linux, the timer slack of the task is reduced to 1ns, so that character times of
+*                   high baud rates (about 12us at 921600 bps) can be simulated.
+*********************************************************************************************************
+*/
+
+static void *MBDrv_Sim_LineTask(
+    void                    *p_arg
+) {
+    MBDRV_SIM_IRQ     irqs[MBDRV_SIM_IRQ_MAX];
+    CPU_SIZE_T        irqCnt;
+    CPU_SIZE_T        i;
+    CPU_INT64U        next = (CPU_INT64U)0U;
+    CPU_INT64U        now;
+    CPU_BOOLEAN       found;
+    struct timespec   deadline;
+    MBDRV_SIM_PORT   *p_port;
+    CPU_SR_ALLOC();
+
+    (void)p_arg;
+
+#if defined(__linux__)
+    (void)prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+#endif
+
+    while (DEF_YES) {
+        /*  Wait for the next event.  */
+        (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+        while (DEF_YES) {
+            if (MBDrv_Sim_LineGetNext(&next) != DEF_YES) {
+                (void)pthread_cond_wait(&g_MBDrvSim_LineCond, &g_MBDrvSim_LineLock);
+                continue;
+            }
+            if (next <= MBDrv_Sim_GetTime()) {
+                break;
+            }
+            deadline.tv_sec  = (time_t)(next / MBDRV_SIM_NSEC_PER_SEC);
+            deadline.tv_nsec = (long)(next % MBDRV_SIM_NSEC_PER_SEC);
+            (void)pthread_cond_timedwait(&g_MBDrvSim_LineCond, &g_MBDrvSim_LineLock, &deadline);
+        }
+        (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+
+        CPU_CRITICAL_ENTER();
+
+        /*  Handle all line events that are due (one at a time).  */
+        now = MBDrv_Sim_GetTime();
+        while (DEF_YES) {
+            (void)pthread_mutex_lock(&g_MBDrvSim_LineLock);
+            irqCnt = MBDrv_Sim_LineStep(now, irqs, &found);
+            (void)pthread_mutex_unlock(&g_MBDrvSim_LineLock);
+            if (!found) {
+                break;
+            }
+
+            /*  Invoke the driver callbacks.  */
+            for (i = (CPU_SIZE_T)0U; i < irqCnt; ++i) {
+                p_port = irqs[i].port;
+                switch (irqs[i].irq) {
+                    case MBDRV_SIM_IRQ_RXCOMPLETE:
+                        p_port->drvcb->rxComplete(p_port->desc, p_port->mbctx);
+                        break;
+                    case MBDRV_SIM_IRQ_TXCOMPLETE:
+                        p_port->drvcb->txComplete(p_port->desc, p_port->mbctx);
+                        break;
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+                    case MBDRV_SIM_IRQ_HALFCHARTIME:
+                        p_port->drvcb->halfCharacterTimeExceed(p_port->desc, p_port->mbctx);
+                        break;
+#endif
+                    default:
+                        break;
+                }
+            }
+        }
+
+        CPU_CRITICAL_EXIT();
+    }
+
+    return (void*)0;
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                              DEVICE DRIVER
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                         POSIX Simulated UART
+*
+* File      : MBDRV_SIM.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef MBDRV_SIM_H__
+#define MBDRV_SIM_H__
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include <mbdrv_cfg.h>
+#include <mbdrv_types.h>
+
+#include <mb_types.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+/*  Count of simulated ports (port 2n is wired to port 2n + 1).  */
+#define MBDRV_SIM_PORT_CNT                        ((CPU_SIZE_T)4U)
+
+/*  Receive errors (see MBDrv_Sim_InjectError()).  */
+#define MBDRV_SIM_ERROR_PARITY                    ((CPU_INT08U)0x01U)
+#define MBDRV_SIM_ERROR_OVERRUN                   ((CPU_INT08U)0x02U)
+#define MBDRV_SIM_ERROR_FRAME                     ((CPU_INT08U)0x04U)
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+typedef struct {
+    MB_COUNTERVALUE         cntTx;
+    MB_COUNTERVALUE         cntRx;
+    MB_COUNTERVALUE         cntDrop;
+    MB_COUNTERVALUE         cntOverrun;
+    MB_COUNTERVALUE         cntInjected;
+} MBDRV_SIM_STATISTICS;
+
+
+/*
+*********************************************************************************************************
+*                                         DRIVER DESCRIPTORS
+*********************************************************************************************************
+*/
+
+#ifndef MBDRV_SIM_SOURCE
+extern MB_DRIVER                                         MBDRV_SIM0_DRIVERDESC;
+extern MB_DRIVER                                         MBDRV_SIM1_DRIVERDESC;
+extern MB_DRIVER                                         MBDRV_SIM2_DRIVERDESC;
+extern MB_DRIVER                                         MBDRV_SIM3_DRIVERDESC;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                    MBDrv_Sim_SetSpeedFactor()
+*
+* Description : Set the speed factor of the simulated serial lines.
+*
+* Argument(s) : (1) factor      The speed factor (1 to run the lines at the configured baud rate, N to run
+*                               them N times faster).
+*               (2) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 No error occurred.
+*                                   MB_ERROR_UNDERFLOW            'factor' equals to zero.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The factor applies to the character time and the half-character timer of the ports
+*                   opened after this call.
+*               (2) The timeouts of the Modbus stack are not scaled.
+*********************************************************************************************************
+*/
+
+void MBDrv_Sim_SetSpeedFactor(
+    CPU_INT32U               factor,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBDrv_Sim_InjectError()
+*
+* Description : Inject receive errors to the next character received by a simulated port.
+*
+* Argument(s) : (1) port        Index of the port.
+*               (2) errors      The errors (any combination of MBDRV_SIM_ERROR_PARITY, MBDRV_SIM_ERROR_OVERRUN
+*                               and MBDRV_SIM_ERROR_FRAME).
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 No error occurred.
+*                                   MB_ERROR_INVALIDPARAMETER     'port' is out of range or 'errors' contains
+*                                                                 invalid bit(s).
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The errors are reported (through the error flags of the driver) together with the next
+*                   character, just like a real UART. A real overrun is also reported if a character arrives
+*                   before the previous one is read.
+*********************************************************************************************************
+*/
+
+void MBDrv_Sim_InjectError(
+    CPU_SIZE_T               port,
+    CPU_INT08U               errors,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBDrv_Sim_GetStatistics()
+*
+* Description : Get the statistics of a simulated port.
+*
+* Argument(s) : (1) port        Index of the port.
+*               (2) p_stats     Pointer to the variable that receives the statistics.
+*               (3) p_error     Pointer to variable that will receive the return error code from this function:
+*
+*                                   MB_ERROR_NONE                 No error occurred.
+*                                   MB_ERROR_NULLREFERENCE        'p_stats' is NULL.
+*                                   MB_ERROR_INVALIDPARAMETER     'port' is out of range.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) 'cntDrop' counts the characters that were lost because the receiving port was closed or
+*                   was in transmit mode (half-duplex).
+*********************************************************************************************************
+*/
+
+void MBDrv_Sim_GetStatistics(
+    CPU_SIZE_T               port,
+    MBDRV_SIM_STATISTICS    *p_stats,
+    MB_ERROR                *p_error
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
\ No newline at end of file
@@ -52,6 +52,10 @@
 #define MB_CFG_CORE_ASCIIMODE                                DEF_DISABLED
 #endif
 
+#ifndef MB_CFG_CORE_TXBLOCK_EN
+#define MB_CFG_CORE_TXBLOCK_EN                               DEF_DISABLED
+#endif
+
 
 /*
 *********************************************************************************************************
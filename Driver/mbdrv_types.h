@@ -65,6 +65,15 @@ typedef struct mb_driver_callbacks {
     void (*txComplete)(MB_DRIVER *mbdrv, void *mbctx);
 } MB_DRIVER_CALLBACKS;
 
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+/*  Device driver burst transmission function type (optional, NULL if not supported).  */
+typedef void (*MB_DRIVER_TXTRANSMITBLOCK)(
+    const CPU_INT08U *p_data,
+    CPU_SIZE_T        size,
+    MB_ERROR         *p_error
+);
+#endif
+
 /*  Device driver descriptor type.  */
 typedef struct mb_driver {
     void        (*initialize)(
@@ -106,6 +115,10 @@ typedef struct mb_driver {
         CPU_INT08U datum, 
         MB_ERROR  *p_error
     );
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+    MB_DRIVER_TXTRANSMITBLOCK
+                  txTransmitBlock;
+#endif
     void        (*halfDuplexModeSetup)(
         MB_DUPLEXMODE  duplexMode,
         MB_ERROR      *p_error
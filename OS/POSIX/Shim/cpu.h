@@ -0,0 +1,183 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                            OS ABSTRACT LAYER
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                               POSIX Port
+*
+* File      : CPU.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*
+* Note(s) : (1) Minimal replacement of <cpu.h> (uC/CPU) for host builds with the POSIX port. Only the
+*               definitions used by the Modbus stack are provided.
+*********************************************************************************************************
+*/
+
+#ifndef CPU_H__
+#define CPU_H__
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+typedef void            CPU_VOID;
+typedef char            CPU_CHAR;
+typedef uint8_t         CPU_BOOLEAN;
+typedef uint8_t         CPU_INT08U;
+typedef int8_t          CPU_INT08S;
+typedef uint16_t        CPU_INT16U;
+typedef int16_t         CPU_INT16S;
+typedef uint32_t        CPU_INT32U;
+typedef int32_t         CPU_INT32S;
+typedef uint64_t        CPU_INT64U;
+typedef int64_t         CPU_INT64S;
+typedef uintptr_t       CPU_ADDR;
+typedef size_t          CPU_SIZE_T;
+typedef CPU_INT32U      CPU_TS;
+
+/*  CPU status register type (not used, kept for source compatibility).  */
+typedef CPU_INT32U      CPU_SR;
+
+#ifdef CPU_CFG_CRITICAL_MEAS_EN
+/*  Critical section measurement (see CPU_CriticalMeasGet()).  */
+typedef struct {
+    /*  Count of outermost critical sections.  */
+    CPU_INT64U  cnt;
+
+    /*  Longest hold time of the outermost critical sections (ns, monotonic clock).  */
+    CPU_INT64U  timeMax;
+
+    /*  Longest hold time of the outermost critical sections (ns, CPU time of the holding thread).  */
+    CPU_INT64U  cpuTimeMax;
+} CPU_CRITICAL_MEAS;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      CRITICAL SECTION MACROS
+*
+* Note(s) : (1) Disabling interrupts is emulated by one process-wide recursive lock, so code that runs in
+*               "interrupt context" (e.g. simulated drivers and timer callbacks) must enter the critical
+*               section before calling the ISR entries of the Modbus core module.
+*********************************************************************************************************
+*/
+
+#define  CPU_SR_ALLOC()             CPU_SR  cpu_sr = (CPU_SR)0
+
+#define  CPU_CRITICAL_ENTER()       do { cpu_sr = CPU_SR_Save(); } while (0)
+
+#define  CPU_CRITICAL_EXIT()        do { CPU_SR_Restore(cpu_sr); } while (0)
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                    CPU_SR_Save()
+*
+* Description : Enter the critical section ("disable interrupts").
+*
+* Argument(s) : None.
+*
+* Return(s)   : The saved status (always 0).
+*
+* Note(s)     : (1) Critical sections can be nested.
+*********************************************************************************************************
+*/
+
+CPU_SR  CPU_SR_Save(void);
+
+
+/*
+*********************************************************************************************************
+*                                    CPU_SR_Restore()
+*
+* Description : Leave the critical section ("restore interrupts").
+*
+* Argument(s) : (1) cpu_sr    The status returned by CPU_SR_Save().
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void  CPU_SR_Restore(CPU_SR  cpu_sr);
+
+
+#ifdef CPU_CFG_CRITICAL_MEAS_EN
+/*
+*********************************************************************************************************
+*                                    CPU_CriticalMeasGet()
+*
+* Description : Get the critical section measurement since the last CPU_CriticalMeasReset().
+*
+* Argument(s) : (1) p_meas    Pointer to the variable that receives the measurement.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Only built when CPU_CFG_CRITICAL_MEAS_EN is defined, the measurement adds two clock
+*                   reads to each outermost CPU_SR_Save()/CPU_SR_Restore() pair.
+*               (2) The hold time is the time between the outermost CPU_SR_Save() acquired the lock and the
+*                   matching CPU_SR_Restore() released it, i.e. the time that "interrupts" were held off.
+*                   The monotonic clock value includes the time that the holding thread was preempted by
+*                   the host, the CPU time value doesn't.
+*********************************************************************************************************
+*/
+
+void  CPU_CriticalMeasGet(CPU_CRITICAL_MEAS  *p_meas);
+
+
+/*
+*********************************************************************************************************
+*                                    CPU_CriticalMeasReset()
+*
+* Description : Reset the critical section measurement.
+*
+* Argument(s) : None.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void  CPU_CriticalMeasReset(void);
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,239 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                            OS ABSTRACT LAYER
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                               POSIX Port
+*
+* File      : CPU_CORE.C
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#ifndef _XOPEN_SOURCE
+#define _XOPEN_SOURCE  600
+#endif
+
+#include <cpu.h>
+
+#include <pthread.h>
+
+#ifdef CPU_CFG_CRITICAL_MEAS_EN
+#include <time.h>
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void CPU_CriticalInit(void);
+
+#ifdef CPU_CFG_CRITICAL_MEAS_EN
+static CPU_INT64U CPU_CriticalGetTime(clockid_t clock);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/*  Critical section lock initialization control.  */
+static pthread_once_t   g_CPU_CriticalOnce = PTHREAD_ONCE_INIT;
+
+/*  Critical section lock.  */
+static pthread_mutex_t  g_CPU_CriticalLock;
+
+#ifdef CPU_CFG_CRITICAL_MEAS_EN
+/*  Critical section nesting level (protected by the critical section lock).  */
+static CPU_INT32U         g_CPU_CriticalNesting = 0U;
+
+/*  Time that the outermost critical section was entered (monotonic clock / thread CPU time).  */
+static CPU_INT64U         g_CPU_CriticalStart = 0U;
+static CPU_INT64U         g_CPU_CriticalCPUStart = 0U;
+
+/*  Critical section measurement (protected by the critical section lock).  */
+static CPU_CRITICAL_MEAS  g_CPU_CriticalMeas = {0U, 0U, 0U};
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    CPU_SR_Save()
+*
+* Description : Enter the critical section ("disable interrupts").
+*
+* Argument(s) : None.
+*
+* Return(s)   : The saved status (always 0).
+*
+* Note(s)     : (1) Critical sections can be nested.
+*               (2) If CPU_CFG_CRITICAL_MEAS_EN is defined, the outermost critical section is timed from
+*                   here (after the lock was acquired).
+*********************************************************************************************************
+*/
+
+CPU_SR  CPU_SR_Save(void) {
+    (void)pthread_once(&g_CPU_CriticalOnce, CPU_CriticalInit);
+    (void)pthread_mutex_lock(&g_CPU_CriticalLock);
+
+#ifdef CPU_CFG_CRITICAL_MEAS_EN
+    if (g_CPU_CriticalNesting++ == 0U) {
+        g_CPU_CriticalStart    = CPU_CriticalGetTime(CLOCK_MONOTONIC);
+        g_CPU_CriticalCPUStart = CPU_CriticalGetTime(CLOCK_THREAD_CPUTIME_ID);
+    }
+#endif
+
+    return (CPU_SR)0;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    CPU_SR_Restore()
+*
+* Description : Leave the critical section ("restore interrupts").
+*
+* Argument(s) : (1) cpu_sr    The status returned by CPU_SR_Save().
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) If CPU_CFG_CRITICAL_MEAS_EN is defined, the hold time of the outermost critical section
+*                   is recorded here (before the lock is released).
+*********************************************************************************************************
+*/
+
+void  CPU_SR_Restore(CPU_SR  cpu_sr) {
+#ifdef CPU_CFG_CRITICAL_MEAS_EN
+    CPU_INT64U  time;
+    CPU_INT64U  cpuTime;
+
+    if (--g_CPU_CriticalNesting == 0U) {
+        cpuTime = CPU_CriticalGetTime(CLOCK_THREAD_CPUTIME_ID) - g_CPU_CriticalCPUStart;
+        time    = CPU_CriticalGetTime(CLOCK_MONOTONIC) - g_CPU_CriticalStart;
+
+        ++(g_CPU_CriticalMeas.cnt);
+        if (time > g_CPU_CriticalMeas.timeMax) {
+            g_CPU_CriticalMeas.timeMax = time;
+        }
+        if (cpuTime > g_CPU_CriticalMeas.cpuTimeMax) {
+            g_CPU_CriticalMeas.cpuTimeMax = cpuTime;
+        }
+    }
+#endif
+
+    (void)cpu_sr;
+    (void)pthread_mutex_unlock(&g_CPU_CriticalLock);
+}
+
+
+#ifdef CPU_CFG_CRITICAL_MEAS_EN
+/*
+*********************************************************************************************************
+*                                    CPU_CriticalMeasGet()
+*
+* Description : Get the critical section measurement since the last CPU_CriticalMeasReset().
+*
+* Argument(s) : (1) p_meas    Pointer to the variable that receives the measurement.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void  CPU_CriticalMeasGet(CPU_CRITICAL_MEAS  *p_meas) {
+    (void)pthread_once(&g_CPU_CriticalOnce, CPU_CriticalInit);
+    (void)pthread_mutex_lock(&g_CPU_CriticalLock);
+    *p_meas = g_CPU_CriticalMeas;
+    (void)pthread_mutex_unlock(&g_CPU_CriticalLock);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    CPU_CriticalMeasReset()
+*
+* Description : Reset the critical section measurement.
+*
+* Argument(s) : None.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) A critical section that is being held by another thread is still measured when it ends.
+*********************************************************************************************************
+*/
+
+void  CPU_CriticalMeasReset(void) {
+    (void)pthread_once(&g_CPU_CriticalOnce, CPU_CriticalInit);
+    (void)pthread_mutex_lock(&g_CPU_CriticalLock);
+    g_CPU_CriticalMeas.cnt        = 0U;
+    g_CPU_CriticalMeas.timeMax    = 0U;
+    g_CPU_CriticalMeas.cpuTimeMax = 0U;
+    (void)pthread_mutex_unlock(&g_CPU_CriticalLock);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    CPU_CriticalInit()
+*
+* Description : Initialize the (recursive) critical section lock.
+*
+* Argument(s) : None.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void CPU_CriticalInit(void) {
+    pthread_mutexattr_t  attr;
+
+    (void)pthread_mutexattr_init(&attr);
+    (void)pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    (void)pthread_mutex_init(&g_CPU_CriticalLock, &attr);
+    (void)pthread_mutexattr_destroy(&attr);
+}
+
+
+#ifdef CPU_CFG_CRITICAL_MEAS_EN
+/*
+*********************************************************************************************************
+*                                    CPU_CriticalGetTime()
+*
+* Description : Read a clock.
+*
+* Argument(s) : (1) clock     The clock.
+*
+* Return(s)   : The clock value (ns).
+*********************************************************************************************************
+*/
+
+static CPU_INT64U CPU_CriticalGetTime(clockid_t clock) {
+    struct timespec  ts;
+
+    (void)clock_gettime(clock, &ts);
+
+    return (CPU_INT64U)ts.tv_sec * (CPU_INT64U)1000000000U + (CPU_INT64U)ts.tv_nsec;
+}
+#endif
\ No newline at end of file
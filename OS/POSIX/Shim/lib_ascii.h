@@ -0,0 +1,60 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                            OS ABSTRACT LAYER
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                               POSIX Port
+*
+* File      : LIB_ASCII.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*
+* Note(s) : (1) Minimal replacement of <lib_ascii.h> (uC/LIB) for host builds with the POSIX port.
+*********************************************************************************************************
+*/
+
+#ifndef LIB_ASCII_H__
+#define LIB_ASCII_H__
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  ASCII_CHAR_LINE_FEED                             0x0A
+#define  ASCII_CHAR_CARRIAGE_RETURN                       0x0D
+#define  ASCII_CHAR_COLON                                 0x3A
+
+#define  ASCII_CHAR_DIGIT_ZERO                            0x30
+#define  ASCII_CHAR_DIGIT_NINE                            0x39
+#define  ASCII_CHAR_DIG_ZERO                 ASCII_CHAR_DIGIT_ZERO
+#define  ASCII_CHAR_DIG_NINE                 ASCII_CHAR_DIGIT_NINE
+
+#define  ASCII_CHAR_LATIN_UPPER_A                         0x41
+#define  ASCII_CHAR_LATIN_UPPER_F                         0x46
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,31 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                            OS ABSTRACT LAYER
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                               POSIX Port
+*
+* File      : LIB_CFG.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*
+* Note(s) : (1) Placeholder of <lib_cfg.h> (uC/LIB configuration) for host builds with the POSIX port,
+*               the Modbus stack doesn't use any uC/LIB configuration.
+*********************************************************************************************************
+*/
+
+#ifndef LIB_CFG_H__
+#define LIB_CFG_H__
+
+
+#endif
\ No newline at end of file
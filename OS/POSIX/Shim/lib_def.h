@@ -0,0 +1,60 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                            OS ABSTRACT LAYER
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                               POSIX Port
+*
+* File      : LIB_DEF.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*
+* Note(s) : (1) Minimal replacement of <lib_def.h> (uC/LIB) for host builds with the POSIX port.
+*********************************************************************************************************
+*/
+
+#ifndef LIB_DEF_H__
+#define LIB_DEF_H__
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include <cpu.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  DEF_NULL                                  ((void *)0)
+
+#define  DEF_FALSE                                          0u
+#define  DEF_TRUE                                           1u
+
+#define  DEF_NO                                             0u
+#define  DEF_YES                                            1u
+
+#define  DEF_DISABLED                                       0u
+#define  DEF_ENABLED                                        1u
+
+#define  DEF_FAIL                                           0u
+#define  DEF_OK                                             1u
+
+
+#endif
\ No newline at end of file
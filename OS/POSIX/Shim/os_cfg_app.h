@@ -0,0 +1,46 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                            OS ABSTRACT LAYER
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                               POSIX Port
+*
+* File      : OS_CFG_APP.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*
+* Note(s) : (1) Replacement of <os_cfg_app.h> (uC/OS-III application configuration) for host builds with
+*               the POSIX port, only the tick rate is used.
+*********************************************************************************************************
+*/
+
+#ifndef OS_CFG_APP_H__
+#define OS_CFG_APP_H__
+
+
+/*
+*********************************************************************************************************
+*                                           DEFAULT DEFINES
+*
+* Note(s) : (1) OS_CFG_TICK_RATE_HZ is the resolution of system ticks, timers and timeouts. A higher rate
+*               (e.g. 10000u, define it on the compiler command line) gives finer character timing at
+*               high baud rates, but reduces the maximum timespan (see MBOS_GetMaxTimeValue()).
+*********************************************************************************************************
+*/
+
+#ifndef OS_CFG_TICK_RATE_HZ
+#define OS_CFG_TICK_RATE_HZ                             1000u
+#endif
+
+
+#endif
\ No newline at end of file
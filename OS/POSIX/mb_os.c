@@ -0,0 +1,1560 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                            OS ABSTRACT LAYER
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                               POSIX Port
+*
+* File      : MB_OS.C
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE  200112L
+#endif
+
+#define MBOS_SOURCE
+
+#include <mb_os.h>
+#include <mb_constants.h>
+#include <mb_os_basetypes.h>
+#include <mb_os_cfg.h>
+#include <mb_types.h>
+
+#include <mbport_limits.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/*  Nanoseconds per second.  */
+#define MBOS_POSIX_NSEC_PER_SEC                   ((CPU_INT64U)1000000000U)
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBOS_POSIX_GetTicks(
+    CPU_INT64U         *p_ticks
+);
+
+static CPU_BOOLEAN MBOS_POSIX_GetDeadline(
+    MB_SYSTICK          ticks,
+    struct timespec    *p_deadline
+);
+
+static void MBOS_POSIX_TicksToTimespec(
+    CPU_INT64U          ticks,
+    struct timespec    *p_ts
+);
+
+static int MBOS_POSIX_CondInit(
+    pthread_cond_t     *p_cond
+);
+
+static CPU_BOOLEAN MBOS_POSIX_FlagGroupCheck(
+    MB_FLAGS            flags,
+    MB_FLAGS            mask,
+    MB_OPT              opt,
+    MB_FLAGS           *p_rdy
+);
+
+static void MBOS_POSIX_TimerServiceInit(void);
+
+static void MBOS_POSIX_TimerUnlink(
+    MB_TIMER           *p_tmr
+);
+
+static MB_TIMER *MBOS_POSIX_TimerGetEarliest(void);
+
+static void *MBOS_POSIX_TimerTask(
+    void               *p_arg
+);
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/*  Timer service initialization control.  */
+static pthread_once_t   g_MBOS_TimerOnce    = PTHREAD_ONCE_INIT;
+
+/*  Timer service status (DEF_YES if the timer task is running).  */
+static CPU_BOOLEAN      g_MBOS_TimerReady   = DEF_NO;
+
+/*  Timer service lock (protects the timer list and all timer objects in it).  */
+static pthread_mutex_t  g_MBOS_TimerLock    = PTHREAD_MUTEX_INITIALIZER;
+
+/*  Timer service condition (signaled when the timer list changes).  */
+static pthread_cond_t   g_MBOS_TimerCond;
+
+/*  Timer task.  */
+static pthread_t        g_MBOS_TimerThread;
+
+/*  Active timers.  */
+static MB_TIMER        *g_MBOS_TimerList    = (MB_TIMER*)0;
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_GetMaxTimeValue()
+*
+* Description : Get the maximum allowed value of a timespan variable.
+*
+* Argument(s) : None.
+*
+* Return(s)   : The maximum value.
+*********************************************************************************************************
+*/
+
+MB_TIMESPAN MBOS_GetMaxTimeValue() {
+    MB_TIMESPAN r;
+
+    /*
+     *  Maximum timespan (tsmax, unit: millisecond) is calculated through
+     *  following formula:
+     *
+     *                           MB_TIMESPAN_MAX
+     *    tsmax = Math.floor (---------------------)
+     *                         OS_CFG_TICK_RATE_HZ
+     *
+     */
+    r  = MB_TIMESPAN_MAX;
+    r /= (MB_TIMESPAN)OS_CFG_TICK_RATE_HZ;
+
+    return r;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_TimeToTickCount()
+*
+* Description : Convert timespan to system tick count.
+*
+* Argument(s) : (1) time      The timespan (unit: millisecond).
+*               (2) p_error   Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE              No error occurred.
+*                                 MB_ERROR_OVERFLOW          'time' parameter exceeds.
+*
+* Return(s)   : The tick count.
+*
+* Note(s)     : (1) The value of 'time' parameter must not be larger than the value returned by
+*                   MBOS_GetMaxTimeValue().
+*********************************************************************************************************
+*/
+
+MB_SYSTICK  MBOS_TimeToTickCount(
+    MB_TIMESPAN  time,
+    MB_ERROR    *p_error
+) {
+    MB_TIMESPAN  r;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (time > MBOS_GetMaxTimeValue()) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return (MB_SYSTICK)0;
+    }
+#endif
+
+    /*
+     *  Tick count is calculated through following formula:
+     *
+     *                        time * OS_CFG_TICK_RATE_HZ
+     *    ticks = Math.ceil (----------------------------)
+     *                                  10^3
+     *
+     */
+    r  = time;
+    r *= (MB_TIMESPAN)OS_CFG_TICK_RATE_HZ;
+    r -= (MB_TIMESPAN)1U;
+    r /= (MB_TIMESPAN)1000U;
+    r += (MB_TIMESPAN)1U;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+
+    return (MB_SYSTICK)r;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_TickCountToTime()
+*
+* Description : Convert system tick count to time.
+*
+* Argument(s) : (1) ticks     The system tick count.
+*               (2) p_error   Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE              No error occurred.
+*
+* Return(s)   : The time (unit: milliseconds).
+*
+* Note(s)     : (1) No overflow check is applied in this function.
+*               (2) Generally, if the value of 'ticks' comes from the return value of MBOS_TimeToTickCount(),
+*                   there would be no overflow.
+*********************************************************************************************************
+*/
+
+MB_TIMESPAN  MBOS_TickCountToTime(
+    MB_SYSTICK    ticks,
+    MB_ERROR     *p_error
+) {
+    MB_TIMESPAN   r;
+
+    /*
+     *  Time is calculated through following formula:
+     *
+     *                          ticks * 10^3
+     *    time = Math.ceil (---------------------)
+     *                       OS_CFG_TICK_RATE_HZ
+     *
+     */
+    r  = (MB_TIMESPAN)ticks;
+    r *= (MB_TIMESPAN)1000U;
+    r -= (MB_TIMESPAN)1U;
+    r /= (MB_TIMESPAN)OS_CFG_TICK_RATE_HZ;
+    r += (MB_TIMESPAN)1U;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+
+    return r;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_GetTickCount()
+*
+* Description : Get current system tick count.
+*
+* Argument(s) : (1) p_error  Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_OS_TIME_FAILEDGET       Failed to get the tick count.
+*
+* Return(s)   : The tick count.
+*
+* Note(s)     : (1) The tick count is derived from the monotonic clock (CLOCK_MONOTONIC) at the rate of
+*                   OS_CFG_TICK_RATE_HZ, so it wraps around like the tick counter of an RTOS.
+*********************************************************************************************************
+*/
+
+MB_SYSTICK  MBOS_GetTickCount(
+    MB_ERROR    *p_error
+) {
+    CPU_INT64U   ticks;
+
+    /*  Get the tick count.  */
+    if (MBOS_POSIX_GetTicks(&ticks) != DEF_YES) {
+        *p_error = MB_ERROR_OS_TIME_FAILEDGET;
+        return (MB_SYSTICK)0U;
+    }
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+
+    return (MB_SYSTICK)ticks;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_MutexCreate()
+*
+* Description : Create a mutex object.
+*
+* Argument(s) : (1) p_mutex  Pointer to the mutex object.
+*               (2) p_error  Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_mutex' points to NULL.
+*                                 MB_ERROR_OS_MUTEX_FAILEDCREATE   Failed to create the mutex object.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBOS_MutexCreate(
+    MB_MUTEX *p_mutex,
+    MB_ERROR *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_mutex' parameter.  */
+    if (p_mutex == (MB_MUTEX*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Create the lock of the mutex object.  */
+    if (pthread_mutex_init(&(p_mutex->lock), (const pthread_mutexattr_t*)0) != 0) {
+        *p_error = MB_ERROR_OS_MUTEX_FAILEDCREATE;
+        return;
+    }
+
+    /*  Create the condition of the mutex object.  */
+    if (MBOS_POSIX_CondInit(&(p_mutex->cond)) != 0) {
+        (void)pthread_mutex_destroy(&(p_mutex->lock));
+        *p_error = MB_ERROR_OS_MUTEX_FAILEDCREATE;
+        return;
+    }
+
+    /*  Not owned.  */
+    p_mutex->locked = DEF_NO;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_MutexDispose()
+*
+* Description : Dispose a mutex object.
+*
+* Argument(s) : (1) p_mutex  Pointer to the mutex object.
+*               (2) p_error  Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_mutex' points to NULL.
+*                                 MB_ERROR_OS_MUTEX_FAILEDDISPOSE  Failed to dispose the mutex object.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBOS_MutexDispose(
+    MB_MUTEX *p_mutex,
+    MB_ERROR *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_mutex' parameter.  */
+    if (p_mutex == (MB_MUTEX*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Dispose the mutex object.  */
+    if (pthread_cond_destroy(&(p_mutex->cond)) != 0) {
+        *p_error = MB_ERROR_OS_MUTEX_FAILEDDISPOSE;
+        return;
+    }
+    if (pthread_mutex_destroy(&(p_mutex->lock)) != 0) {
+        *p_error = MB_ERROR_OS_MUTEX_FAILEDDISPOSE;
+        return;
+    }
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_MutexPend()
+*
+* Description : Acquire specified mutex.
+*
+* Argument(s) : (1) p_mutex  Pointer to the mutex object.
+*               (2) timeout  The timeout value (unit: millisecond).
+*               (3) p_error  Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_mutex' points to NULL.
+*                                 MB_ERROR_OVERFLOW                'timeout' parameter exceeds.
+*                                 MB_ERROR_TIMEOUT                 Failed to acquire the mutex object due
+*                                                                  to the expiration of the timeout limit.
+*                                 MB_ERROR_OS_MUTEX_FAILEDPEND     Failed to acquire the mutex object due
+*                                                                  to other reasons.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The value of 'timeout' parameter must not be larger than the value returned by
+*                   MBOS_GetMaxTimeValue().
+*               (2) If caller want to wait infinitely, set 'timeout' to 0U.
+*               (3) Like uC/OS-III, acquiring a mutex that is already owned by the calling thread fails
+*                   (with MB_ERROR_OS_MUTEX_FAILEDPEND).
+*********************************************************************************************************
+*/
+
+void MBOS_MutexPend(
+    MB_MUTEX      *p_mutex,
+    MB_TIMESPAN    timeout,
+    MB_ERROR      *p_error
+) {
+    MB_SYSTICK       timeoutTicks;
+    struct timespec  deadline;
+    int              rc;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_mutex' parameter.  */
+    if (p_mutex == (MB_MUTEX*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Convert timespan to system tick count.  */
+    if (timeout == (MB_TIMESPAN)0) {
+        timeoutTicks = (MB_SYSTICK)0;
+    } else {
+        timeoutTicks = MBOS_TimeToTickCount(timeout, p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+        if (MBOS_POSIX_GetDeadline(timeoutTicks, &deadline) != DEF_YES) {
+            *p_error = MB_ERROR_OS_MUTEX_FAILEDPEND;
+            return;
+        }
+    }
+
+    /*  Acquire the mutex object.  */
+    if (pthread_mutex_lock(&(p_mutex->lock)) != 0) {
+        *p_error = MB_ERROR_OS_MUTEX_FAILEDPEND;
+        return;
+    }
+    if (p_mutex->locked == DEF_YES && pthread_equal(p_mutex->owner, pthread_self())) {
+        (void)pthread_mutex_unlock(&(p_mutex->lock));
+        *p_error = MB_ERROR_OS_MUTEX_FAILEDPEND;
+        return;
+    }
+    while (p_mutex->locked == DEF_YES) {
+        if (timeoutTicks == (MB_SYSTICK)0) {
+            rc = pthread_cond_wait(&(p_mutex->cond), &(p_mutex->lock));
+        } else {
+            rc = pthread_cond_timedwait(&(p_mutex->cond), &(p_mutex->lock), &deadline);
+        }
+        if (rc != 0 && p_mutex->locked == DEF_YES) {
+            (void)pthread_mutex_unlock(&(p_mutex->lock));
+            if (rc == ETIMEDOUT) {
+                *p_error = MB_ERROR_TIMEOUT;
+            } else {
+                *p_error = MB_ERROR_OS_MUTEX_FAILEDPEND;
+            }
+            return;
+        }
+    }
+    p_mutex->locked = DEF_YES;
+    p_mutex->owner  = pthread_self();
+    (void)pthread_mutex_unlock(&(p_mutex->lock));
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_MutexPost()
+*
+* Description : Release specified mutex.
+*
+* Argument(s) : (1) p_mutex  Pointer to the mutex object.
+*               (2) p_error  Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_mutex' points to NULL.
+*                                 MB_ERROR_OS_MUTEX_FAILEDPOST     Failed to release the mutex object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Releasing a mutex that is not owned by the calling thread fails.
+*********************************************************************************************************
+*/
+
+void MBOS_MutexPost(
+    MB_MUTEX  *p_mutex,
+    MB_ERROR  *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_mutex' parameter.  */
+    if (p_mutex == (MB_MUTEX*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Release the mutex object.  */
+    if (pthread_mutex_lock(&(p_mutex->lock)) != 0) {
+        *p_error = MB_ERROR_OS_MUTEX_FAILEDPOST;
+        return;
+    }
+    if (p_mutex->locked != DEF_YES || !pthread_equal(p_mutex->owner, pthread_self())) {
+        (void)pthread_mutex_unlock(&(p_mutex->lock));
+        *p_error = MB_ERROR_OS_MUTEX_FAILEDPOST;
+        return;
+    }
+    p_mutex->locked = DEF_NO;
+    (void)pthread_cond_signal(&(p_mutex->cond));
+    (void)pthread_mutex_unlock(&(p_mutex->lock));
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_FlagGroupCreate()
+*
+* Description : Create a flag group object.
+*
+* Argument(s) : (1) p_grp    Pointer to the flag group object.
+*               (2) initial  The initial value of the flag group.
+*               (3) p_error  Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_grp' points to NULL.
+*                                 MB_ERROR_OS_FGRP_FAILEDCREATE    Failed to create the flag group object.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBOS_FlagGroupCreate(
+    MB_FLAGGROUP  *p_grp,
+    MB_FLAGS       initial,
+    MB_ERROR      *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_grp' parameter.  */
+    if (p_grp == (MB_FLAGGROUP*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Create the lock of the flag group.  */
+    if (pthread_mutex_init(&(p_grp->lock), (const pthread_mutexattr_t*)0) != 0) {
+        *p_error = MB_ERROR_OS_FGRP_FAILEDCREATE;
+        return;
+    }
+
+    /*  Create the condition of the flag group.  */
+    if (MBOS_POSIX_CondInit(&(p_grp->cond)) != 0) {
+        (void)pthread_mutex_destroy(&(p_grp->lock));
+        *p_error = MB_ERROR_OS_FGRP_FAILEDCREATE;
+        return;
+    }
+
+    /*  Set the initial value.  */
+    p_grp->flags = initial;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_FlagGroupDispose()
+*
+* Description : Delete a flag group object.
+*
+* Argument(s) : (1) p_grp    Pointer to the flag group object.
+*               (2) p_error  Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_grp' points to NULL.
+*                                 MB_ERROR_OS_FGRP_FAILEDDISPOSE   Failed to dispose the flag group object.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBOS_FlagGroupDispose(
+    MB_FLAGGROUP  *p_grp,
+    MB_ERROR      *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_grp' parameter.  */
+    if (p_grp == (MB_FLAGGROUP*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Delete the flag group.  */
+    if (pthread_cond_destroy(&(p_grp->cond)) != 0) {
+        *p_error = MB_ERROR_OS_FGRP_FAILEDDISPOSE;
+        return;
+    }
+    if (pthread_mutex_destroy(&(p_grp->lock)) != 0) {
+        *p_error = MB_ERROR_OS_FGRP_FAILEDDISPOSE;
+        return;
+    }
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_FlagGroupPend()
+*
+* Description : Wait for certain bits in a flag group to be set (or cleared).
+*
+* Argument(s) : (1) p_grp    Pointer to the flag group object.
+*               (2) p_flags  Pointer to the variable that stores the bit pattern indicating which
+*                            bit(s) to check and receives the flags that caused current task to be
+*                            ready-to-run.
+*               (3) timeout  The timeout value (unit: millisecond).
+*               (4) opt      The options:
+*
+*                                 MB_FLAGGROUP_OPT_CLR_ALL         Check all bits in flags to be cleared (0).
+*                                 MB_FLAGGROUP_OPT_CLR_ANY         Check any bit in flags to be cleared (0).
+*                                 MB_FLAGGROUP_OPT_SET_ALL         Check all bits in flags to be set (1).
+*                                 MB_FLAGGROUP_OPT_SET_ANY         Check any bit in flags to be set (1).
+*
+*                            The caller may also specify whether the flags are comsumed by "adding"
+*                            following option to the 'opt' parameter:
+*
+*                                 MB_FLAGGROUP_OPT_CONSUME
+*
+*               (5) p_error  Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_grp' or 'p_flags' points to NULL.
+*                                 MB_ERROR_INVALIDPARAMETER        'opt' parameter contains invalid option(s).
+*                                 MB_ERROR_OVERFLOW                'timeout' parameter exceeds.
+*                                 MB_ERROR_TIMEOUT                 Timeout limit exceeds.
+*                                 MB_ERROR_OS_FGRP_FAILEDPEND      Failed to pend on the flag group object.
+*                                 MB_ERROR_OS_FGRP_FAILEDRDYFLAGS  Failed to get the flags that make current task
+*                                                                  ready-to-run.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The value of 'timeout' parameter must not be larger than the value returned by
+*                   MBOS_GetMaxTimeValue().
+*               (2) If caller want to wait infinitely, set 'timeout' to 0U.
+*********************************************************************************************************
+*/
+
+void MBOS_FlagGroupPend(
+    MB_FLAGGROUP  *p_grp,
+    MB_FLAGS      *p_flags,
+    MB_TIMESPAN    timeout,
+    MB_OPT         opt,
+    MB_ERROR      *p_error
+) {
+    MB_FLAGS         rdyFlags;
+    MB_SYSTICK       timeoutTicks;
+    struct timespec  deadline;
+    int              rc;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_grp' parameter.  */
+    if (p_grp == (MB_FLAGGROUP*)0) {
+        /*  Error: Null reference.  */
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_flags' parameter.  */
+    if (p_flags == (MB_FLAGS*)0) {
+        /*  Error: Null reference.  */
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'opt' parameter.  */
+    switch (opt) {
+        case MB_FLAGGROUP_OPT_CLR_ALL:
+        case MB_FLAGGROUP_OPT_CLR_ANY:
+        case MB_FLAGGROUP_OPT_SET_ALL:
+        case MB_FLAGGROUP_OPT_SET_ANY:
+        case (MB_FLAGGROUP_OPT_CONSUME | MB_FLAGGROUP_OPT_CLR_ALL):
+        case (MB_FLAGGROUP_OPT_CONSUME | MB_FLAGGROUP_OPT_CLR_ANY):
+        case (MB_FLAGGROUP_OPT_CONSUME | MB_FLAGGROUP_OPT_SET_ALL):
+        case (MB_FLAGGROUP_OPT_CONSUME | MB_FLAGGROUP_OPT_SET_ANY):
+            break;
+        default:
+            /*  Error: Invalid 'opt' parameter.  */
+            *p_error = MB_ERROR_INVALIDPARAMETER;
+            return;
+    }
+#endif
+
+    /*  Convert timespan to system tick count.  */
+    if (timeout == (MB_TIMESPAN)0) {
+        timeoutTicks = (MB_SYSTICK)0;
+    } else {
+        timeoutTicks = MBOS_TimeToTickCount(timeout, p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+        if (MBOS_POSIX_GetDeadline(timeoutTicks, &deadline) != DEF_YES) {
+            *p_error = MB_ERROR_OS_FGRP_FAILEDPEND;
+            return;
+        }
+    }
+
+    /*  Wait for the flag group object.  */
+    if (pthread_mutex_lock(&(p_grp->lock)) != 0) {
+        *p_error = MB_ERROR_OS_FGRP_FAILEDPEND;
+        return;
+    }
+    while (MBOS_POSIX_FlagGroupCheck(p_grp->flags, *p_flags, opt, &rdyFlags) != DEF_YES) {
+        if (timeoutTicks == (MB_SYSTICK)0) {
+            rc = pthread_cond_wait(&(p_grp->cond), &(p_grp->lock));
+        } else {
+            rc = pthread_cond_timedwait(&(p_grp->cond), &(p_grp->lock), &deadline);
+        }
+        if (rc != 0) {
+            if (MBOS_POSIX_FlagGroupCheck(p_grp->flags, *p_flags, opt, &rdyFlags) == DEF_YES) {
+                break;
+            }
+            (void)pthread_mutex_unlock(&(p_grp->lock));
+            if (rc == ETIMEDOUT) {
+                *p_error = MB_ERROR_TIMEOUT;
+            } else {
+                *p_error = MB_ERROR_OS_FGRP_FAILEDPEND;
+            }
+            return;
+        }
+    }
+
+    /*  Consume the flags that makes the task ready.  */
+    if ((opt & MB_FLAGGROUP_OPT_CONSUME) != (MB_OPT)0) {
+        if ((opt & (MB_FLAGGROUP_OPT_SET_ALL | MB_FLAGGROUP_OPT_SET_ANY)) != (MB_OPT)0) {
+            p_grp->flags &= (MB_FLAGS)(~rdyFlags);
+        } else {
+            p_grp->flags |= rdyFlags;
+        }
+    }
+    (void)pthread_mutex_unlock(&(p_grp->lock));
+
+    *p_flags = rdyFlags;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_FlagGroupPost()
+*
+* Description : Set (or clear) certain bits in a flag group.
+*
+* Argument(s) : (1) p_grp    Pointer to the flag group object.
+*               (2) flags    Flags that specifies which bit(s) to be set or cleared.
+*               (3) opt      The options:
+*
+*                                 MB_FLAGGROUP_OPT_SET             Set selected bit(s).
+*                                 MB_FLAGGROUP_OPT_CLR             Clear selected bit(s).
+*
+*               (4) p_error  Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_grp' points to NULL.
+*                                 MB_ERROR_INVALIDPARAMETER        'opt' parameter contains invalid option(s).
+*                                 MB_ERROR_OS_FGRP_FAILEDPOST      Failed to post to the flag group object.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBOS_FlagGroupPost(
+    MB_FLAGGROUP  *p_grp,
+    MB_FLAGS       flags,
+    MB_OPT         opt,
+    MB_ERROR      *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_grp' parameter.  */
+    if (p_grp == (MB_FLAGGROUP*)0) {
+        /*  Error: Null reference.  */
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'opt' parameter.  */
+    switch (opt) {
+        case MB_FLAGGROUP_OPT_SET:
+        case MB_FLAGGROUP_OPT_CLR:
+            break;
+        default:
+            /*  Error: Invalid 'opt' parameter.  */
+            *p_error = MB_ERROR_INVALIDPARAMETER;
+            return;
+    }
+#endif
+
+    /*  Post to the flag group object.  */
+    if (pthread_mutex_lock(&(p_grp->lock)) != 0) {
+        *p_error = MB_ERROR_OS_FGRP_FAILEDPOST;
+        return;
+    }
+    if (opt == MB_FLAGGROUP_OPT_CLR) {
+        p_grp->flags &= (MB_FLAGS)(~flags);
+    } else {
+        p_grp->flags |= flags;
+    }
+    (void)pthread_cond_broadcast(&(p_grp->cond));
+    (void)pthread_mutex_unlock(&(p_grp->lock));
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_TimerCreate()
+*
+* Description : Create a timer object.
+*
+* Argument(s) : (1) p_tmr     Pointer to the timer object.
+*               (2) interval  Interval of the timer (must be larger than 0, unit: millisecond).
+*               (3) mode      Timer mode, with one of following variables:
+*
+*                                 MB_TIMER_MODE_ONESHOT             One-shot mode.
+*                                 MB_TIMER_MODE_PERIODIC            Periodic mode.
+*
+*               (4) cb        Timer callback.
+*               (5) p_cbarg   Timer callback argument that would be passed to the 'p_arg' parameter of the
+*                             timer callback.
+*
+*               (6) p_error   Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_tmr' or 'cb' points to NULL.
+*                                 MB_ERROR_UNDERFLOW               'interval' equals to zero.
+*                                 MB_ERROR_OVERFLOW                'interval' exceeds.
+*                                 MB_ERROR_INVALIDPARAMETER        'mode' contains invalid value.
+*                                 MB_ERROR_OS_TIMER_FAILEDCREATE   Failed to create the timer object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The value of 'interval' parameter must not be larger than the value returned by
+*                   MBOS_GetMaxTimeValue().
+*               (2) The value of 'interval' parameter should at least be 1.
+*               (3) The timer task (a thread shared by all timer objects) is started when the first timer
+*                   object is created.
+*********************************************************************************************************
+*/
+
+void MBOS_TimerCreate(
+    MB_TIMER          *p_tmr,
+    MB_TIMESPAN        interval,
+    MB_TIMERMODE       mode,
+    MB_TIMERCALLBACK   cb,
+    void              *p_cbarg,
+    MB_ERROR          *p_error
+) {
+    MB_SYSTICK  tmrDelay;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_tmr' parameter.  */
+    if (p_tmr == (MB_TIMER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'interval' parameter.  */
+    if (interval == (MB_TIMESPAN)0) {
+        *p_error = MB_ERROR_UNDERFLOW;
+        return;
+    }
+
+    /*  Check 'mode' parameter.  */
+    switch (mode) {
+        case MB_TIMER_MODE_ONESHOT:
+        case MB_TIMER_MODE_PERIODIC:
+            break;
+        default:
+            *p_error = MB_ERROR_INVALIDPARAMETER;
+            return;
+    }
+
+    /*  Check 'cb' parameter.  */
+    if (cb == (MB_TIMERCALLBACK)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Convert timespan to system tick count.  */
+    tmrDelay = MBOS_TimeToTickCount(interval, p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return;
+    }
+
+    /*  Start the timer task.  */
+    if (pthread_once(&g_MBOS_TimerOnce, MBOS_POSIX_TimerServiceInit) != 0 || g_MBOS_TimerReady != DEF_YES) {
+        *p_error = MB_ERROR_OS_TIMER_FAILEDCREATE;
+        return;
+    }
+
+    /*  Save the timer context.  */
+    p_tmr->cb       = cb;
+    p_tmr->cb_arg   = p_cbarg;
+    p_tmr->mode     = mode;
+    p_tmr->interval = tmrDelay;
+    p_tmr->expire   = (CPU_INT64U)0U;
+    p_tmr->active   = DEF_NO;
+    p_tmr->next     = (MB_TIMER*)0;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_TimerDispose()
+*
+* Description : Dispose a timer object.
+*
+* Argument(s) : (1) p_tmr     Pointer to the timer object.
+*               (2) p_error   Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_tmr' points to NULL.
+*                                 MB_ERROR_OS_TIMER_FAILEDDISPOSE  Failed to dispose the timer object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The timer to be disposed would be stopped immediately.
+*********************************************************************************************************
+*/
+
+void MBOS_TimerDispose(
+    MB_TIMER  *p_tmr,
+    MB_ERROR  *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_tmr' parameter.  */
+    if (p_tmr == (MB_TIMER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Delete the timer.  */
+    if (pthread_mutex_lock(&g_MBOS_TimerLock) != 0) {
+        *p_error = MB_ERROR_OS_TIMER_FAILEDDISPOSE;
+        return;
+    }
+    MBOS_POSIX_TimerUnlink(p_tmr);
+    (void)pthread_mutex_unlock(&g_MBOS_TimerLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_TimerStart()
+*
+* Description : Start a timer object.
+*
+* Argument(s) : (1) p_tmr     Pointer to the timer object.
+*               (2) p_error   Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_tmr' points to NULL.
+*                                 MB_ERROR_OS_TIMER_FAILEDSTART    Failed to start the timer object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) If the timer is already started, the timer would be restarted immediately.
+*********************************************************************************************************
+*/
+
+void MBOS_TimerStart(
+    MB_TIMER  *p_tmr,
+    MB_ERROR  *p_error
+) {
+    CPU_INT64U  ticks;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_tmr' parameter.  */
+    if (p_tmr == (MB_TIMER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Get current tick count.  */
+    if (MBOS_POSIX_GetTicks(&ticks) != DEF_YES) {
+        *p_error = MB_ERROR_OS_TIMER_FAILEDSTART;
+        return;
+    }
+
+    /*  Start the timer.  */
+    if (pthread_mutex_lock(&g_MBOS_TimerLock) != 0) {
+        *p_error = MB_ERROR_OS_TIMER_FAILEDSTART;
+        return;
+    }
+    MBOS_POSIX_TimerUnlink(p_tmr);
+    p_tmr->expire    = ticks + (CPU_INT64U)(p_tmr->interval);
+    p_tmr->active    = DEF_YES;
+    p_tmr->next      = g_MBOS_TimerList;
+    g_MBOS_TimerList = p_tmr;
+    (void)pthread_cond_signal(&g_MBOS_TimerCond);
+    (void)pthread_mutex_unlock(&g_MBOS_TimerLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_TimerStop()
+*
+* Description : Stop a timer object.
+*
+* Argument(s) : (1) p_tmr     Pointer to the timer object.
+*               (2) p_error   Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_tmr' points to NULL.
+*                                 MB_ERROR_OS_TIMER_FAILEDSTOP     Failed to stop the timer object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) If the timer is not started yet, the function would return without throwing any error.
+*********************************************************************************************************
+*/
+
+void MBOS_TimerStop(
+    MB_TIMER  *p_tmr,
+    MB_ERROR  *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_tmr' parameter.  */
+    if (p_tmr == (MB_TIMER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Stop the timer.  */
+    if (pthread_mutex_lock(&g_MBOS_TimerLock) != 0) {
+        *p_error = MB_ERROR_OS_TIMER_FAILEDSTOP;
+        return;
+    }
+    MBOS_POSIX_TimerUnlink(p_tmr);
+    (void)pthread_mutex_unlock(&g_MBOS_TimerLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_TimerSetInterval()
+*
+* Description : Change the interval of a timer object.
+*
+* Argument(s) : (1) p_tmr     Pointer to the timer object.
+*               (2) interval  New interval of the timer (must be larger than 0, unit: millisecond).
+*               (3) p_error   Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_tmr' points to NULL.
+*                                 MB_ERROR_UNDERFLOW               'interval' equals to zero.
+*                                 MB_ERROR_OVERFLOW                'interval' exceeds.
+*                                 MB_ERROR_OS_TIMER_FAILEDSET      Failed to set the timer object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The value of 'interval' parameter must not be larger than the value returned by
+*                   MBOS_GetMaxTimeValue().
+*               (2) The new interval takes effect on next MBOS_TimerStart() call, so that a timer object
+*                   can be created once and be re-armed with different intervals.
+*********************************************************************************************************
+*/
+
+void MBOS_TimerSetInterval(
+    MB_TIMER     *p_tmr,
+    MB_TIMESPAN   interval,
+    MB_ERROR     *p_error
+) {
+    MB_SYSTICK  tmrDelay;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_tmr' parameter.  */
+    if (p_tmr == (MB_TIMER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'interval' parameter.  */
+    if (interval == (MB_TIMESPAN)0) {
+        *p_error = MB_ERROR_UNDERFLOW;
+        return;
+    }
+#endif
+
+    /*  Convert timespan to system tick count.  */
+    tmrDelay = MBOS_TimeToTickCount(interval, p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return;
+    }
+
+    /*  Set the timer.  */
+    if (pthread_mutex_lock(&g_MBOS_TimerLock) != 0) {
+        *p_error = MB_ERROR_OS_TIMER_FAILEDSET;
+        return;
+    }
+    p_tmr->interval = tmrDelay;
+    (void)pthread_mutex_unlock(&g_MBOS_TimerLock);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_Delay()
+*
+* Description : Delay specific time.
+*
+* Argument(s) : (1) time      The timespan (unit: millisecond).
+*               (2) p_error   Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                 No error occurred.
+*                                 MB_ERROR_OVERFLOW             'time' parameter exceeds.
+*                                 MB_ERROR_OS_TIME_FAILEDDELAY  OS failed to delay.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The value of 'time' parameter must not be larger than the value returned by
+*                   MBOS_GetMaxTimeValue().
+*               (2) Zero delay time is allowed. The function would return (without throwing any
+*                   error) if the value of 'time' parameter is zero.
+*********************************************************************************************************
+*/
+
+void MBOS_Delay(
+    MB_TIMESPAN   time,
+    MB_ERROR     *p_error
+) {
+    MB_SYSTICK       ticks;
+    struct timespec  deadline;
+    int              rc;
+
+    /*  Fast path for no delay.  */
+    if (time == (MB_TIMESPAN)0U) {
+        *p_error = MB_ERROR_NONE;
+        return;
+    }
+
+    /*  Convert the timespan to tick count.  */
+    ticks = MBOS_TimeToTickCount(
+        time,
+        p_error
+    );
+    if (*p_error != MB_ERROR_NONE) {
+        return;
+    }
+
+    /*  Delay.  */
+    if (MBOS_POSIX_GetDeadline(ticks, &deadline) != DEF_YES) {
+        *p_error = MB_ERROR_OS_TIME_FAILEDDELAY;
+        return;
+    }
+    do {
+        rc = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, (struct timespec*)0);
+    } while (rc == EINTR);
+    if (rc != 0) {
+        *p_error = MB_ERROR_OS_TIME_FAILEDDELAY;
+        return;
+    }
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_POSIX_GetTicks()
+*
+* Description : Get current (non-wrapping) tick count from the monotonic clock.
+*
+* Argument(s) : (1) p_ticks   Pointer to the variable that receives the tick count.
+*
+* Return(s)   : DEF_YES if succeed, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBOS_POSIX_GetTicks(
+    CPU_INT64U         *p_ticks
+) {
+    struct timespec  now;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &now) != 0) {
+        return DEF_NO;
+    }
+
+    /*
+     *  Tick count is calculated through following formula:
+     *
+     *                         ns * OS_CFG_TICK_RATE_HZ
+     *    ticks = Math.floor (--------------------------)
+     *                                  10^9
+     *
+     */
+    *p_ticks  = (CPU_INT64U)now.tv_sec * (CPU_INT64U)OS_CFG_TICK_RATE_HZ;
+    *p_ticks += ((CPU_INT64U)now.tv_nsec * (CPU_INT64U)OS_CFG_TICK_RATE_HZ) / MBOS_POSIX_NSEC_PER_SEC;
+
+    return DEF_YES;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_POSIX_GetDeadline()
+*
+* Description : Get the absolute time (of the monotonic clock) after specific tick count.
+*
+* Argument(s) : (1) ticks        The tick count.
+*               (2) p_deadline   Pointer to the variable that receives the absolute time.
+*
+* Return(s)   : DEF_YES if succeed, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBOS_POSIX_GetDeadline(
+    MB_SYSTICK          ticks,
+    struct timespec    *p_deadline
+) {
+    struct timespec  span;
+
+    if (clock_gettime(CLOCK_MONOTONIC, p_deadline) != 0) {
+        return DEF_NO;
+    }
+
+    MBOS_POSIX_TicksToTimespec((CPU_INT64U)ticks, &span);
+
+    p_deadline->tv_sec  += span.tv_sec;
+    p_deadline->tv_nsec += span.tv_nsec;
+    if ((CPU_INT64U)(p_deadline->tv_nsec) >= MBOS_POSIX_NSEC_PER_SEC) {
+        p_deadline->tv_nsec -= (long)MBOS_POSIX_NSEC_PER_SEC;
+        ++(p_deadline->tv_sec);
+    }
+
+    return DEF_YES;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_POSIX_TicksToTimespec()
+*
+* Description : Convert tick count to time (of the monotonic clock).
+*
+* Argument(s) : (1) ticks     The tick count.
+*               (2) p_ts      Pointer to the variable that receives the time.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The time is rounded up, so that MBOS_POSIX_GetTicks() returns at least 'ticks' at the
+*                   converted (absolute) time.
+*********************************************************************************************************
+*/
+
+static void MBOS_POSIX_TicksToTimespec(
+    CPU_INT64U          ticks,
+    struct timespec    *p_ts
+) {
+    CPU_INT64U  rem;
+
+    rem  = ticks % (CPU_INT64U)OS_CFG_TICK_RATE_HZ;
+    rem *= MBOS_POSIX_NSEC_PER_SEC;
+    rem += (CPU_INT64U)OS_CFG_TICK_RATE_HZ - (CPU_INT64U)1U;
+    rem /= (CPU_INT64U)OS_CFG_TICK_RATE_HZ;
+
+    p_ts->tv_sec  = (time_t)(ticks / (CPU_INT64U)OS_CFG_TICK_RATE_HZ);
+    p_ts->tv_nsec = (long)rem;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_POSIX_CondInit()
+*
+* Description : Initialize a condition variable that times out against the monotonic clock.
+*
+* Argument(s) : (1) p_cond    Pointer to the condition variable.
+*
+* Return(s)   : 0 if succeed, error number if not.
+*********************************************************************************************************
+*/
+
+static int MBOS_POSIX_CondInit(
+    pthread_cond_t     *p_cond
+) {
+    pthread_condattr_t  attr;
+    int                 rc;
+
+    rc = pthread_condattr_init(&attr);
+    if (rc != 0) {
+        return rc;
+    }
+    rc = pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    if (rc == 0) {
+        rc = pthread_cond_init(p_cond, &attr);
+    }
+    (void)pthread_condattr_destroy(&attr);
+
+    return rc;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_POSIX_FlagGroupCheck()
+*
+* Description : Check whether the flags of a flag group satisfy a pend request.
+*
+* Argument(s) : (1) flags     Current flags of the flag group.
+*               (2) mask      The bit(s) to check.
+*               (3) opt       The pend options (see MBOS_FlagGroupPend()).
+*               (4) p_rdy     Pointer to the variable that receives the flags that satisfy the request.
+*
+* Return(s)   : DEF_YES if the request is satisfied, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBOS_POSIX_FlagGroupCheck(
+    MB_FLAGS            flags,
+    MB_FLAGS            mask,
+    MB_OPT              opt,
+    MB_FLAGS           *p_rdy
+) {
+    switch ((MB_OPT)(opt & (MB_OPT)(~MB_FLAGGROUP_OPT_CONSUME))) {
+        case MB_FLAGGROUP_OPT_SET_ALL:
+            *p_rdy = (MB_FLAGS)(flags & mask);
+            return (*p_rdy == mask) ? DEF_YES : DEF_NO;
+        case MB_FLAGGROUP_OPT_SET_ANY:
+            *p_rdy = (MB_FLAGS)(flags & mask);
+            return (*p_rdy != (MB_FLAGS)0) ? DEF_YES : DEF_NO;
+        case MB_FLAGGROUP_OPT_CLR_ALL:
+            *p_rdy = (MB_FLAGS)((~flags) & mask);
+            return (*p_rdy == mask) ? DEF_YES : DEF_NO;
+        case MB_FLAGGROUP_OPT_CLR_ANY:
+            *p_rdy = (MB_FLAGS)((~flags) & mask);
+            return (*p_rdy != (MB_FLAGS)0) ? DEF_YES : DEF_NO;
+        default:
+            *p_rdy = (MB_FLAGS)0;
+            return DEF_NO;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_POSIX_TimerServiceInit()
+*
+* Description : Initialize the timer service and start the timer task.
+*
+* Argument(s) : None.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Called once (through pthread_once()), g_MBOS_TimerReady is set if succeed.
+*********************************************************************************************************
+*/
+
+static void MBOS_POSIX_TimerServiceInit(void) {
+    if (MBOS_POSIX_CondInit(&g_MBOS_TimerCond) != 0) {
+        return;
+    }
+    if (pthread_create(&g_MBOS_TimerThread, (const pthread_attr_t*)0, MBOS_POSIX_TimerTask, (void*)0) != 0) {
+        (void)pthread_cond_destroy(&g_MBOS_TimerCond);
+        return;
+    }
+    (void)pthread_detach(g_MBOS_TimerThread);
+
+    g_MBOS_TimerReady = DEF_YES;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_POSIX_TimerUnlink()
+*
+* Description : Remove a timer object from the active timer list.
+*
+* Argument(s) : (1) p_tmr     Pointer to the timer object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The timer service lock must be held by the caller.
+*               (2) Nothing is done if the timer is not active.
+*********************************************************************************************************
+*/
+
+static void MBOS_POSIX_TimerUnlink(
+    MB_TIMER           *p_tmr
+) {
+    MB_TIMER  **pp_link;
+
+    if (p_tmr->active != DEF_YES) {
+        return;
+    }
+
+    for (pp_link = &g_MBOS_TimerList; *pp_link != (MB_TIMER*)0; pp_link = &((*pp_link)->next)) {
+        if (*pp_link == p_tmr) {
+            *pp_link = p_tmr->next;
+            break;
+        }
+    }
+
+    p_tmr->active = DEF_NO;
+    p_tmr->next   = (MB_TIMER*)0;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_POSIX_TimerGetEarliest()
+*
+* Description : Get the active timer object that expires first.
+*
+* Argument(s) : None.
+*
+* Return(s)   : Pointer to the timer object (NULL if no timer is active).
+*
+* Note(s)     : (1) The timer service lock must be held by the caller.
+*********************************************************************************************************
+*/
+
+static MB_TIMER *MBOS_POSIX_TimerGetEarliest(void) {
+    MB_TIMER  *p_tmr;
+    MB_TIMER  *p_earliest;
+
+    p_earliest = (MB_TIMER*)0;
+    for (p_tmr = g_MBOS_TimerList; p_tmr != (MB_TIMER*)0; p_tmr = p_tmr->next) {
+        if (p_earliest == (MB_TIMER*)0 || p_tmr->expire < p_earliest->expire) {
+            p_earliest = p_tmr;
+        }
+    }
+
+    return p_earliest;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBOS_POSIX_TimerTask()
+*
+* Description : Timer task, invokes the callbacks of expired timers.
+*
+* Argument(s) : (1) p_arg     Not used.
+*
+* Return(s)   : Never returns.
+*
+* Note(s)     : (1) Timer callbacks are invoked inside a critical section (CPU_CRITICAL_ENTER()), so they
+*                   run with "interrupts disabled" like the ISRs of the Modbus core module expect.
+*               (2) The critical section is always entered before the timer service lock is acquired
+*                   (the timer functions are called by the Modbus core module inside critical sections).
+*********************************************************************************************************
+*/
+
+static void *MBOS_POSIX_TimerTask(
+    void               *p_arg
+) {
+    MB_TIMER         *p_tmr;
+    CPU_INT64U        ticks;
+    struct timespec   deadline;
+    CPU_SR_ALLOC();
+
+    (void)p_arg;
+
+    while (DEF_YES) {
+        /*  Wait for a timer to expire.  */
+        (void)pthread_mutex_lock(&g_MBOS_TimerLock);
+        while (DEF_YES) {
+            p_tmr = MBOS_POSIX_TimerGetEarliest();
+            if (p_tmr == (MB_TIMER*)0) {
+                (void)pthread_cond_wait(&g_MBOS_TimerCond, &g_MBOS_TimerLock);
+                continue;
+            }
+            if (MBOS_POSIX_GetTicks(&ticks) == DEF_YES && p_tmr->expire <= ticks) {
+                break;
+            }
+            MBOS_POSIX_TicksToTimespec(p_tmr->expire, &deadline);
+            (void)pthread_cond_timedwait(&g_MBOS_TimerCond, &g_MBOS_TimerLock, &deadline);
+        }
+        (void)pthread_mutex_unlock(&g_MBOS_TimerLock);
+
+        CPU_CRITICAL_ENTER();
+
+        /*  Re-check (the timer may be stopped or restarted meanwhile) and re-arm (or stop) the timer.  */
+        (void)pthread_mutex_lock(&g_MBOS_TimerLock);
+        p_tmr = MBOS_POSIX_TimerGetEarliest();
+        if (p_tmr != (MB_TIMER*)0 && MBOS_POSIX_GetTicks(&ticks) == DEF_YES && p_tmr->expire <= ticks) {
+            if (p_tmr->mode == MB_TIMER_MODE_PERIODIC) {
+                p_tmr->expire += (CPU_INT64U)(p_tmr->interval);
+                if (p_tmr->expire <= ticks) {
+                    p_tmr->expire = ticks + (CPU_INT64U)(p_tmr->interval);
+                }
+            } else {
+                MBOS_POSIX_TimerUnlink(p_tmr);
+            }
+        } else {
+            p_tmr = (MB_TIMER*)0;
+        }
+        (void)pthread_mutex_unlock(&g_MBOS_TimerLock);
+
+        /*  Invoke the timer callback.  */
+        if (p_tmr != (MB_TIMER*)0) {
+            p_tmr->cb((void*)p_tmr, p_tmr->cb_arg);
+        }
+
+        CPU_CRITICAL_EXIT();
+    }
+
+    return (void*)0;
+}
\ No newline at end of file
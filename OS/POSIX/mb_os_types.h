@@ -0,0 +1,85 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                            OS ABSTRACT LAYER
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+*                                               POSIX Port
+*
+* File      : MB_OS_TYPES.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef MB_OS_TYPES_H__
+#define MB_OS_TYPES_H__
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include <mb_os_basetypes.h>
+
+#include <cpu.h>
+
+#include <pthread.h>
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+/*  OS mutex type.  */
+typedef struct {
+    pthread_mutex_t   lock;
+    pthread_cond_t    cond;
+    CPU_BOOLEAN       locked;
+    pthread_t         owner;
+} MB_MUTEX;
+
+/*  OS flags type.  */
+typedef CPU_INT32U    MB_FLAGS;
+
+/*  OS option type.  */
+typedef CPU_INT16U    MB_OPT;
+
+/*  OS system tick type.  */
+typedef CPU_INT32U    MB_SYSTICK;
+
+/*  OS flag group type.  */
+typedef struct {
+    pthread_mutex_t   lock;
+    pthread_cond_t    cond;
+    MB_FLAGS          flags;
+} MB_FLAGGROUP;
+
+/*  OS timer type.  */
+typedef struct MB_TIMER_ {
+    MB_TIMERCALLBACK  cb;
+    void             *cb_arg;
+    MB_TIMERMODE      mode;
+    MB_SYSTICK        interval;
+    CPU_INT64U        expire;
+    CPU_BOOLEAN       active;
+    struct MB_TIMER_ *next;
+} MB_TIMER;
+
+/*  OS timespan type.  */
+typedef CPU_INT32U    MB_TIMESPAN;
+
+
+#endif
\ No newline at end of file
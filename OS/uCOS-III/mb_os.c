@@ -562,6 +562,7 @@ void MBOS_FlagGroupDispose(
 *                                 MB_ERROR_NULLREFERENCE           'p_grp' or 'p_flags' points to NULL.
 *                                 MB_ERROR_INVALIDPARAMETER        'opt' parameter contains invalid option(s).
 *                                 MB_ERROR_OVERFLOW                'timeout' parameter exceeds.
+*                                 MB_ERROR_TIMEOUT                 Timeout limit exceeds.
 *                                 MB_ERROR_OS_FGRP_FAILEDPEND      Failed to pend on the flag group object.
 *                                 MB_ERROR_OS_FGRP_FAILEDRDYFLAGS  Failed to get the flags that make current task 
 *                                                                  ready-to-run.
@@ -638,6 +639,10 @@ void MBOS_FlagGroupPend(
         (CPU_TS*)0,
         &errOS
     );
+    if (errOS == OS_ERR_TIMEOUT) {
+        *p_error = MB_ERROR_TIMEOUT;
+        return;
+    }
     if (errOS != OS_ERR_NONE) {
         *p_error = MB_ERROR_OS_FGRP_FAILEDPEND;
         return;
@@ -813,6 +818,7 @@ void MBOS_TimerCreate(
     /*  Save the timer context.  */
     p_tmr->cb = cb;
     p_tmr->cb_arg = p_cbarg;
+    p_tmr->mode = mode;
 
     /*  Get other several timer creation parameters.  */
     if (mode == MB_TIMER_MODE_PERIODIC) {
@@ -994,6 +1000,87 @@ void MBOS_TimerStop(
 }
 
 
+/*
+*********************************************************************************************************
+*                                    MBOS_TimerSetInterval()
+*
+* Description : Change the interval of a timer object.
+*
+* Argument(s) : (1) p_tmr     Pointer to the timer object.
+*               (2) interval  New interval of the timer (must be larger than 0, unit: millisecond).
+*               (3) p_error   Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_tmr' points to NULL.
+*                                 MB_ERROR_UNDERFLOW               'interval' equals to zero.
+*                                 MB_ERROR_OVERFLOW                'interval' exceeds.
+*                                 MB_ERROR_OS_TIMER_FAILEDSET      Failed to set the timer object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The value of 'interval' parameter must not be larger than the value returned by 
+*                   MBOS_GetMaxTimeValue().
+*               (2) The new interval takes effect on next MBOS_TimerStart() call, so that a timer object 
+*                   can be created once and be re-armed with different intervals.
+*********************************************************************************************************
+*/
+
+void MBOS_TimerSetInterval(
+    MB_TIMER     *p_tmr,
+    MB_TIMESPAN   interval,
+    MB_ERROR     *p_error
+) {
+    OS_TICK  tmrDelay;
+    OS_TICK  tmrPeriod;
+
+    OS_ERR errOS;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_tmr' parameter.  */
+    if (p_tmr == (MB_TIMER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'interval' parameter.  */
+    if (interval == (MB_TIMESPAN)0) {
+        *p_error = MB_ERROR_UNDERFLOW;
+        return;
+    }
+#endif
+
+    /*  Convert timespan to system tick count.  */
+    tmrDelay = (OS_TICK)MBOS_TimeToTickCount(interval, p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return;
+    }
+
+    /*  Keep the timer mode.  */
+    if (p_tmr->mode == MB_TIMER_MODE_PERIODIC) {
+        tmrPeriod = tmrDelay;
+    } else {
+        tmrPeriod = (OS_TICK)0;
+    }
+
+    /*  Set the timer.  */
+    OSTmrSet(
+        &(p_tmr->tmr),
+        tmrDelay,
+        tmrPeriod,
+        MBOS_TimerExpireCallback,
+        (void*)p_tmr,
+        &errOS
+    );
+    if (errOS != OS_ERR_NONE) {
+        *p_error = MB_ERROR_OS_TIMER_FAILEDSET;
+        return;
+    }
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
 /*
 *********************************************************************************************************
 *                                    MBOS_Delay()
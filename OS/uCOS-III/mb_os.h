@@ -335,6 +335,7 @@ void MBOS_FlagGroupDispose(
 *                                 MB_ERROR_NULLREFERENCE           'p_grp' or 'p_flags' points to NULL.
 *                                 MB_ERROR_INVALIDPARAMETER        'opt' parameter contains invalid option(s).
 *                                 MB_ERROR_OVERFLOW                'timeout' parameter exceeds.
+*                                 MB_ERROR_TIMEOUT                 Timeout limit exceeds.
 *                                 MB_ERROR_OS_FGRP_FAILEDPEND      Failed to pend on the flag group object.
 *                                 MB_ERROR_OS_FGRP_FAILEDRDYFLAGS  Failed to get the flags that make current task 
 *                                                                  ready-to-run.
@@ -503,6 +504,38 @@ void MBOS_TimerStop(
 );
 
 
+/*
+*********************************************************************************************************
+*                                    MBOS_TimerSetInterval()
+*
+* Description : Change the interval of a timer object.
+*
+* Argument(s) : (1) p_tmr     Pointer to the timer object.
+*               (2) interval  New interval of the timer (must be larger than 0, unit: millisecond).
+*               (3) p_error   Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                    No error occurred.
+*                                 MB_ERROR_NULLREFERENCE           'p_tmr' points to NULL.
+*                                 MB_ERROR_UNDERFLOW               'interval' equals to zero.
+*                                 MB_ERROR_OVERFLOW                'interval' exceeds.
+*                                 MB_ERROR_OS_TIMER_FAILEDSET      Failed to set the timer object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The value of 'interval' parameter must not be larger than the value returned by 
+*                   MBOS_GetMaxTimeValue().
+*               (2) The new interval takes effect on next MBOS_TimerStart() call, so that a timer object 
+*                   can be created once and be re-armed with different intervals.
+*********************************************************************************************************
+*/
+
+void MBOS_TimerSetInterval(
+    MB_TIMER     *p_tmr,
+    MB_TIMESPAN   interval,
+    MB_ERROR     *p_error
+);
+
+
 /*
 *********************************************************************************************************
 *                                    MBOS_Delay()
@@ -56,6 +56,7 @@ typedef struct {
     OS_TMR            tmr;
     MB_TIMERCALLBACK  cb;
     void             *cb_arg;
+    MB_TIMERMODE      mode;
 } MB_TIMER;
 
 /*  OS flags type.  */
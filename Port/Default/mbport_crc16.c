@@ -46,6 +46,7 @@
 *********************************************************************************************************
 */
 
+#if (MB_CFG_PORT_CRC16_ENGINE != MBPORT_CRC16_ENGINE_NIBBLE) && (MB_CFG_PORT_CRC16_ENGINE != MBPORT_CRC16_ENGINE_HARDWARE)
 static const CPU_INT16U g_CRC16Table[] = {
     0x0000U, 0xC0C1U, 0xC181U, 0x0140U, 0xC301U, 0x03C0U, 0x0280U, 0xC241U, 0xC601U, 0x06C0U, 0x0780U, 0xC741U, 0x0500U, 0xC5C1U, 0xC481U, 0x0440U, 
     0xCC01U, 0x0CC0U, 0x0D80U, 0xCD41U, 0x0F00U, 0xCFC1U, 0xCE81U, 0x0E40U, 0x0A00U, 0xCAC1U, 0xCB81U, 0x0B40U, 0xC901U, 0x09C0U, 0x0880U, 0xC841U, 
@@ -64,6 +65,154 @@ static const CPU_INT16U g_CRC16Table[] = {
     0x8801U, 0x48C0U, 0x4980U, 0x8941U, 0x4B00U, 0x8BC1U, 0x8A81U, 0x4A40U, 0x4E00U, 0x8EC1U, 0x8F81U, 0x4F40U, 0x8D01U, 0x4DC0U, 0x4C80U, 0x8C41U, 
     0x4400U, 0x84C1U, 0x8581U, 0x4540U, 0x8701U, 0x47C0U, 0x4680U, 0x8641U, 0x8201U, 0x42C0U, 0x4380U, 0x8341U, 0x4100U, 0x81C1U, 0x8081U, 0x4040U
 };
+#endif
+
+#if (MB_CFG_PORT_CRC16_ENGINE == MBPORT_CRC16_ENGINE_SLICING4) || (MB_CFG_PORT_CRC16_ENGINE == MBPORT_CRC16_ENGINE_SLICING8)
+/*
+ *  Slicing tables, the item at offset i of the k-th table is the CRC-16 of byte i followed by k zero 
+ *  bytes (the table above is the 0-th table).
+ */
+static const CPU_INT16U g_CRC16TableSlice1[] = {
+    0x0000U, 0x9001U, 0x6001U, 0xF000U, 0xC002U, 0x5003U, 0xA003U, 0x3002U, 0xC007U, 0x5006U, 0xA006U, 0x3007U, 0x0005U, 0x9004U, 0x6004U, 0xF005U, 
+    0xC00DU, 0x500CU, 0xA00CU, 0x300DU, 0x000FU, 0x900EU, 0x600EU, 0xF00FU, 0x000AU, 0x900BU, 0x600BU, 0xF00AU, 0xC008U, 0x5009U, 0xA009U, 0x3008U, 
+    0xC019U, 0x5018U, 0xA018U, 0x3019U, 0x001BU, 0x901AU, 0x601AU, 0xF01BU, 0x001EU, 0x901FU, 0x601FU, 0xF01EU, 0xC01CU, 0x501DU, 0xA01DU, 0x301CU, 
+    0x0014U, 0x9015U, 0x6015U, 0xF014U, 0xC016U, 0x5017U, 0xA017U, 0x3016U, 0xC013U, 0x5012U, 0xA012U, 0x3013U, 0x0011U, 0x9010U, 0x6010U, 0xF011U, 
+    0xC031U, 0x5030U, 0xA030U, 0x3031U, 0x0033U, 0x9032U, 0x6032U, 0xF033U, 0x0036U, 0x9037U, 0x6037U, 0xF036U, 0xC034U, 0x5035U, 0xA035U, 0x3034U, 
+    0x003CU, 0x903DU, 0x603DU, 0xF03CU, 0xC03EU, 0x503FU, 0xA03FU, 0x303EU, 0xC03BU, 0x503AU, 0xA03AU, 0x303BU, 0x0039U, 0x9038U, 0x6038U, 0xF039U, 
+    0x0028U, 0x9029U, 0x6029U, 0xF028U, 0xC02AU, 0x502BU, 0xA02BU, 0x302AU, 0xC02FU, 0x502EU, 0xA02EU, 0x302FU, 0x002DU, 0x902CU, 0x602CU, 0xF02DU, 
+    0xC025U, 0x5024U, 0xA024U, 0x3025U, 0x0027U, 0x9026U, 0x6026U, 0xF027U, 0x0022U, 0x9023U, 0x6023U, 0xF022U, 0xC020U, 0x5021U, 0xA021U, 0x3020U, 
+    0xC061U, 0x5060U, 0xA060U, 0x3061U, 0x0063U, 0x9062U, 0x6062U, 0xF063U, 0x0066U, 0x9067U, 0x6067U, 0xF066U, 0xC064U, 0x5065U, 0xA065U, 0x3064U, 
+    0x006CU, 0x906DU, 0x606DU, 0xF06CU, 0xC06EU, 0x506FU, 0xA06FU, 0x306EU, 0xC06BU, 0x506AU, 0xA06AU, 0x306BU, 0x0069U, 0x9068U, 0x6068U, 0xF069U, 
+    0x0078U, 0x9079U, 0x6079U, 0xF078U, 0xC07AU, 0x507BU, 0xA07BU, 0x307AU, 0xC07FU, 0x507EU, 0xA07EU, 0x307FU, 0x007DU, 0x907CU, 0x607CU, 0xF07DU, 
+    0xC075U, 0x5074U, 0xA074U, 0x3075U, 0x0077U, 0x9076U, 0x6076U, 0xF077U, 0x0072U, 0x9073U, 0x6073U, 0xF072U, 0xC070U, 0x5071U, 0xA071U, 0x3070U, 
+    0x0050U, 0x9051U, 0x6051U, 0xF050U, 0xC052U, 0x5053U, 0xA053U, 0x3052U, 0xC057U, 0x5056U, 0xA056U, 0x3057U, 0x0055U, 0x9054U, 0x6054U, 0xF055U, 
+    0xC05DU, 0x505CU, 0xA05CU, 0x305DU, 0x005FU, 0x905EU, 0x605EU, 0xF05FU, 0x005AU, 0x905BU, 0x605BU, 0xF05AU, 0xC058U, 0x5059U, 0xA059U, 0x3058U, 
+    0xC049U, 0x5048U, 0xA048U, 0x3049U, 0x004BU, 0x904AU, 0x604AU, 0xF04BU, 0x004EU, 0x904FU, 0x604FU, 0xF04EU, 0xC04CU, 0x504DU, 0xA04DU, 0x304CU, 
+    0x0044U, 0x9045U, 0x6045U, 0xF044U, 0xC046U, 0x5047U, 0xA047U, 0x3046U, 0xC043U, 0x5042U, 0xA042U, 0x3043U, 0x0041U, 0x9040U, 0x6040U, 0xF041U
+};
+
+static const CPU_INT16U g_CRC16TableSlice2[] = {
+    0x0000U, 0xC051U, 0xC0A1U, 0x00F0U, 0xC141U, 0x0110U, 0x01E0U, 0xC1B1U, 0xC281U, 0x02D0U, 0x0220U, 0xC271U, 0x03C0U, 0xC391U, 0xC361U, 0x0330U, 
+    0xC501U, 0x0550U, 0x05A0U, 0xC5F1U, 0x0440U, 0xC411U, 0xC4E1U, 0x04B0U, 0x0780U, 0xC7D1U, 0xC721U, 0x0770U, 0xC6C1U, 0x0690U, 0x0660U, 0xC631U, 
+    0xCA01U, 0x0A50U, 0x0AA0U, 0xCAF1U, 0x0B40U, 0xCB11U, 0xCBE1U, 0x0BB0U, 0x0880U, 0xC8D1U, 0xC821U, 0x0870U, 0xC9C1U, 0x0990U, 0x0960U, 0xC931U, 
+    0x0F00U, 0xCF51U, 0xCFA1U, 0x0FF0U, 0xCE41U, 0x0E10U, 0x0EE0U, 0xCEB1U, 0xCD81U, 0x0DD0U, 0x0D20U, 0xCD71U, 0x0CC0U, 0xCC91U, 0xCC61U, 0x0C30U, 
+    0xD401U, 0x1450U, 0x14A0U, 0xD4F1U, 0x1540U, 0xD511U, 0xD5E1U, 0x15B0U, 0x1680U, 0xD6D1U, 0xD621U, 0x1670U, 0xD7C1U, 0x1790U, 0x1760U, 0xD731U, 
+    0x1100U, 0xD151U, 0xD1A1U, 0x11F0U, 0xD041U, 0x1010U, 0x10E0U, 0xD0B1U, 0xD381U, 0x13D0U, 0x1320U, 0xD371U, 0x12C0U, 0xD291U, 0xD261U, 0x1230U, 
+    0x1E00U, 0xDE51U, 0xDEA1U, 0x1EF0U, 0xDF41U, 0x1F10U, 0x1FE0U, 0xDFB1U, 0xDC81U, 0x1CD0U, 0x1C20U, 0xDC71U, 0x1DC0U, 0xDD91U, 0xDD61U, 0x1D30U, 
+    0xDB01U, 0x1B50U, 0x1BA0U, 0xDBF1U, 0x1A40U, 0xDA11U, 0xDAE1U, 0x1AB0U, 0x1980U, 0xD9D1U, 0xD921U, 0x1970U, 0xD8C1U, 0x1890U, 0x1860U, 0xD831U, 
+    0xE801U, 0x2850U, 0x28A0U, 0xE8F1U, 0x2940U, 0xE911U, 0xE9E1U, 0x29B0U, 0x2A80U, 0xEAD1U, 0xEA21U, 0x2A70U, 0xEBC1U, 0x2B90U, 0x2B60U, 0xEB31U, 
+    0x2D00U, 0xED51U, 0xEDA1U, 0x2DF0U, 0xEC41U, 0x2C10U, 0x2CE0U, 0xECB1U, 0xEF81U, 0x2FD0U, 0x2F20U, 0xEF71U, 0x2EC0U, 0xEE91U, 0xEE61U, 0x2E30U, 
+    0x2200U, 0xE251U, 0xE2A1U, 0x22F0U, 0xE341U, 0x2310U, 0x23E0U, 0xE3B1U, 0xE081U, 0x20D0U, 0x2020U, 0xE071U, 0x21C0U, 0xE191U, 0xE161U, 0x2130U, 
+    0xE701U, 0x2750U, 0x27A0U, 0xE7F1U, 0x2640U, 0xE611U, 0xE6E1U, 0x26B0U, 0x2580U, 0xE5D1U, 0xE521U, 0x2570U, 0xE4C1U, 0x2490U, 0x2460U, 0xE431U, 
+    0x3C00U, 0xFC51U, 0xFCA1U, 0x3CF0U, 0xFD41U, 0x3D10U, 0x3DE0U, 0xFDB1U, 0xFE81U, 0x3ED0U, 0x3E20U, 0xFE71U, 0x3FC0U, 0xFF91U, 0xFF61U, 0x3F30U, 
+    0xF901U, 0x3950U, 0x39A0U, 0xF9F1U, 0x3840U, 0xF811U, 0xF8E1U, 0x38B0U, 0x3B80U, 0xFBD1U, 0xFB21U, 0x3B70U, 0xFAC1U, 0x3A90U, 0x3A60U, 0xFA31U, 
+    0xF601U, 0x3650U, 0x36A0U, 0xF6F1U, 0x3740U, 0xF711U, 0xF7E1U, 0x37B0U, 0x3480U, 0xF4D1U, 0xF421U, 0x3470U, 0xF5C1U, 0x3590U, 0x3560U, 0xF531U, 
+    0x3300U, 0xF351U, 0xF3A1U, 0x33F0U, 0xF241U, 0x3210U, 0x32E0U, 0xF2B1U, 0xF181U, 0x31D0U, 0x3120U, 0xF171U, 0x30C0U, 0xF091U, 0xF061U, 0x3030U
+};
+
+static const CPU_INT16U g_CRC16TableSlice3[] = {
+    0x0000U, 0xFC01U, 0xB801U, 0x4400U, 0x3001U, 0xCC00U, 0x8800U, 0x7401U, 0x6002U, 0x9C03U, 0xD803U, 0x2402U, 0x5003U, 0xAC02U, 0xE802U, 0x1403U, 
+    0xC004U, 0x3C05U, 0x7805U, 0x8404U, 0xF005U, 0x0C04U, 0x4804U, 0xB405U, 0xA006U, 0x5C07U, 0x1807U, 0xE406U, 0x9007U, 0x6C06U, 0x2806U, 0xD407U, 
+    0xC00BU, 0x3C0AU, 0x780AU, 0x840BU, 0xF00AU, 0x0C0BU, 0x480BU, 0xB40AU, 0xA009U, 0x5C08U, 0x1808U, 0xE409U, 0x9008U, 0x6C09U, 0x2809U, 0xD408U, 
+    0x000FU, 0xFC0EU, 0xB80EU, 0x440FU, 0x300EU, 0xCC0FU, 0x880FU, 0x740EU, 0x600DU, 0x9C0CU, 0xD80CU, 0x240DU, 0x500CU, 0xAC0DU, 0xE80DU, 0x140CU, 
+    0xC015U, 0x3C14U, 0x7814U, 0x8415U, 0xF014U, 0x0C15U, 0x4815U, 0xB414U, 0xA017U, 0x5C16U, 0x1816U, 0xE417U, 0x9016U, 0x6C17U, 0x2817U, 0xD416U, 
+    0x0011U, 0xFC10U, 0xB810U, 0x4411U, 0x3010U, 0xCC11U, 0x8811U, 0x7410U, 0x6013U, 0x9C12U, 0xD812U, 0x2413U, 0x5012U, 0xAC13U, 0xE813U, 0x1412U, 
+    0x001EU, 0xFC1FU, 0xB81FU, 0x441EU, 0x301FU, 0xCC1EU, 0x881EU, 0x741FU, 0x601CU, 0x9C1DU, 0xD81DU, 0x241CU, 0x501DU, 0xAC1CU, 0xE81CU, 0x141DU, 
+    0xC01AU, 0x3C1BU, 0x781BU, 0x841AU, 0xF01BU, 0x0C1AU, 0x481AU, 0xB41BU, 0xA018U, 0x5C19U, 0x1819U, 0xE418U, 0x9019U, 0x6C18U, 0x2818U, 0xD419U, 
+    0xC029U, 0x3C28U, 0x7828U, 0x8429U, 0xF028U, 0x0C29U, 0x4829U, 0xB428U, 0xA02BU, 0x5C2AU, 0x182AU, 0xE42BU, 0x902AU, 0x6C2BU, 0x282BU, 0xD42AU, 
+    0x002DU, 0xFC2CU, 0xB82CU, 0x442DU, 0x302CU, 0xCC2DU, 0x882DU, 0x742CU, 0x602FU, 0x9C2EU, 0xD82EU, 0x242FU, 0x502EU, 0xAC2FU, 0xE82FU, 0x142EU, 
+    0x0022U, 0xFC23U, 0xB823U, 0x4422U, 0x3023U, 0xCC22U, 0x8822U, 0x7423U, 0x6020U, 0x9C21U, 0xD821U, 0x2420U, 0x5021U, 0xAC20U, 0xE820U, 0x1421U, 
+    0xC026U, 0x3C27U, 0x7827U, 0x8426U, 0xF027U, 0x0C26U, 0x4826U, 0xB427U, 0xA024U, 0x5C25U, 0x1825U, 0xE424U, 0x9025U, 0x6C24U, 0x2824U, 0xD425U, 
+    0x003CU, 0xFC3DU, 0xB83DU, 0x443CU, 0x303DU, 0xCC3CU, 0x883CU, 0x743DU, 0x603EU, 0x9C3FU, 0xD83FU, 0x243EU, 0x503FU, 0xAC3EU, 0xE83EU, 0x143FU, 
+    0xC038U, 0x3C39U, 0x7839U, 0x8438U, 0xF039U, 0x0C38U, 0x4838U, 0xB439U, 0xA03AU, 0x5C3BU, 0x183BU, 0xE43AU, 0x903BU, 0x6C3AU, 0x283AU, 0xD43BU, 
+    0xC037U, 0x3C36U, 0x7836U, 0x8437U, 0xF036U, 0x0C37U, 0x4837U, 0xB436U, 0xA035U, 0x5C34U, 0x1834U, 0xE435U, 0x9034U, 0x6C35U, 0x2835U, 0xD434U, 
+    0x0033U, 0xFC32U, 0xB832U, 0x4433U, 0x3032U, 0xCC33U, 0x8833U, 0x7432U, 0x6031U, 0x9C30U, 0xD830U, 0x2431U, 0x5030U, 0xAC31U, 0xE831U, 0x1430U
+};
+
+#if (MB_CFG_PORT_CRC16_ENGINE == MBPORT_CRC16_ENGINE_SLICING8)
+static const CPU_INT16U g_CRC16TableSlice4[] = {
+    0x0000U, 0xC03DU, 0xC079U, 0x0044U, 0xC0F1U, 0x00CCU, 0x0088U, 0xC0B5U, 0xC1E1U, 0x01DCU, 0x0198U, 0xC1A5U, 0x0110U, 0xC12DU, 0xC169U, 0x0154U, 
+    0xC3C1U, 0x03FCU, 0x03B8U, 0xC385U, 0x0330U, 0xC30DU, 0xC349U, 0x0374U, 0x0220U, 0xC21DU, 0xC259U, 0x0264U, 0xC2D1U, 0x02ECU, 0x02A8U, 0xC295U, 
+    0xC781U, 0x07BCU, 0x07F8U, 0xC7C5U, 0x0770U, 0xC74DU, 0xC709U, 0x0734U, 0x0660U, 0xC65DU, 0xC619U, 0x0624U, 0xC691U, 0x06ACU, 0x06E8U, 0xC6D5U, 
+    0x0440U, 0xC47DU, 0xC439U, 0x0404U, 0xC4B1U, 0x048CU, 0x04C8U, 0xC4F5U, 0xC5A1U, 0x059CU, 0x05D8U, 0xC5E5U, 0x0550U, 0xC56DU, 0xC529U, 0x0514U, 
+    0xCF01U, 0x0F3CU, 0x0F78U, 0xCF45U, 0x0FF0U, 0xCFCDU, 0xCF89U, 0x0FB4U, 0x0EE0U, 0xCEDDU, 0xCE99U, 0x0EA4U, 0xCE11U, 0x0E2CU, 0x0E68U, 0xCE55U, 
+    0x0CC0U, 0xCCFDU, 0xCCB9U, 0x0C84U, 0xCC31U, 0x0C0CU, 0x0C48U, 0xCC75U, 0xCD21U, 0x0D1CU, 0x0D58U, 0xCD65U, 0x0DD0U, 0xCDEDU, 0xCDA9U, 0x0D94U, 
+    0x0880U, 0xC8BDU, 0xC8F9U, 0x08C4U, 0xC871U, 0x084CU, 0x0808U, 0xC835U, 0xC961U, 0x095CU, 0x0918U, 0xC925U, 0x0990U, 0xC9ADU, 0xC9E9U, 0x09D4U, 
+    0xCB41U, 0x0B7CU, 0x0B38U, 0xCB05U, 0x0BB0U, 0xCB8DU, 0xCBC9U, 0x0BF4U, 0x0AA0U, 0xCA9DU, 0xCAD9U, 0x0AE4U, 0xCA51U, 0x0A6CU, 0x0A28U, 0xCA15U, 
+    0xDE01U, 0x1E3CU, 0x1E78U, 0xDE45U, 0x1EF0U, 0xDECDU, 0xDE89U, 0x1EB4U, 0x1FE0U, 0xDFDDU, 0xDF99U, 0x1FA4U, 0xDF11U, 0x1F2CU, 0x1F68U, 0xDF55U, 
+    0x1DC0U, 0xDDFDU, 0xDDB9U, 0x1D84U, 0xDD31U, 0x1D0CU, 0x1D48U, 0xDD75U, 0xDC21U, 0x1C1CU, 0x1C58U, 0xDC65U, 0x1CD0U, 0xDCEDU, 0xDCA9U, 0x1C94U, 
+    0x1980U, 0xD9BDU, 0xD9F9U, 0x19C4U, 0xD971U, 0x194CU, 0x1908U, 0xD935U, 0xD861U, 0x185CU, 0x1818U, 0xD825U, 0x1890U, 0xD8ADU, 0xD8E9U, 0x18D4U, 
+    0xDA41U, 0x1A7CU, 0x1A38U, 0xDA05U, 0x1AB0U, 0xDA8DU, 0xDAC9U, 0x1AF4U, 0x1BA0U, 0xDB9DU, 0xDBD9U, 0x1BE4U, 0xDB51U, 0x1B6CU, 0x1B28U, 0xDB15U, 
+    0x1100U, 0xD13DU, 0xD179U, 0x1144U, 0xD1F1U, 0x11CCU, 0x1188U, 0xD1B5U, 0xD0E1U, 0x10DCU, 0x1098U, 0xD0A5U, 0x1010U, 0xD02DU, 0xD069U, 0x1054U, 
+    0xD2C1U, 0x12FCU, 0x12B8U, 0xD285U, 0x1230U, 0xD20DU, 0xD249U, 0x1274U, 0x1320U, 0xD31DU, 0xD359U, 0x1364U, 0xD3D1U, 0x13ECU, 0x13A8U, 0xD395U, 
+    0xD681U, 0x16BCU, 0x16F8U, 0xD6C5U, 0x1670U, 0xD64DU, 0xD609U, 0x1634U, 0x1760U, 0xD75DU, 0xD719U, 0x1724U, 0xD791U, 0x17ACU, 0x17E8U, 0xD7D5U, 
+    0x1540U, 0xD57DU, 0xD539U, 0x1504U, 0xD5B1U, 0x158CU, 0x15C8U, 0xD5F5U, 0xD4A1U, 0x149CU, 0x14D8U, 0xD4E5U, 0x1450U, 0xD46DU, 0xD429U, 0x1414U
+};
+
+static const CPU_INT16U g_CRC16TableSlice5[] = {
+    0x0000U, 0xD101U, 0xE201U, 0x3300U, 0x8401U, 0x5500U, 0x6600U, 0xB701U, 0x4801U, 0x9900U, 0xAA00U, 0x7B01U, 0xCC00U, 0x1D01U, 0x2E01U, 0xFF00U, 
+    0x9002U, 0x4103U, 0x7203U, 0xA302U, 0x1403U, 0xC502U, 0xF602U, 0x2703U, 0xD803U, 0x0902U, 0x3A02U, 0xEB03U, 0x5C02U, 0x8D03U, 0xBE03U, 0x6F02U, 
+    0x6007U, 0xB106U, 0x8206U, 0x5307U, 0xE406U, 0x3507U, 0x0607U, 0xD706U, 0x2806U, 0xF907U, 0xCA07U, 0x1B06U, 0xAC07U, 0x7D06U, 0x4E06U, 0x9F07U, 
+    0xF005U, 0x2104U, 0x1204U, 0xC305U, 0x7404U, 0xA505U, 0x9605U, 0x4704U, 0xB804U, 0x6905U, 0x5A05U, 0x8B04U, 0x3C05U, 0xED04U, 0xDE04U, 0x0F05U, 
+    0xC00EU, 0x110FU, 0x220FU, 0xF30EU, 0x440FU, 0x950EU, 0xA60EU, 0x770FU, 0x880FU, 0x590EU, 0x6A0EU, 0xBB0FU, 0x0C0EU, 0xDD0FU, 0xEE0FU, 0x3F0EU, 
+    0x500CU, 0x810DU, 0xB20DU, 0x630CU, 0xD40DU, 0x050CU, 0x360CU, 0xE70DU, 0x180DU, 0xC90CU, 0xFA0CU, 0x2B0DU, 0x9C0CU, 0x4D0DU, 0x7E0DU, 0xAF0CU, 
+    0xA009U, 0x7108U, 0x4208U, 0x9309U, 0x2408U, 0xF509U, 0xC609U, 0x1708U, 0xE808U, 0x3909U, 0x0A09U, 0xDB08U, 0x6C09U, 0xBD08U, 0x8E08U, 0x5F09U, 
+    0x300BU, 0xE10AU, 0xD20AU, 0x030BU, 0xB40AU, 0x650BU, 0x560BU, 0x870AU, 0x780AU, 0xA90BU, 0x9A0BU, 0x4B0AU, 0xFC0BU, 0x2D0AU, 0x1E0AU, 0xCF0BU, 
+    0xC01FU, 0x111EU, 0x221EU, 0xF31FU, 0x441EU, 0x951FU, 0xA61FU, 0x771EU, 0x881EU, 0x591FU, 0x6A1FU, 0xBB1EU, 0x0C1FU, 0xDD1EU, 0xEE1EU, 0x3F1FU, 
+    0x501DU, 0x811CU, 0xB21CU, 0x631DU, 0xD41CU, 0x051DU, 0x361DU, 0xE71CU, 0x181CU, 0xC91DU, 0xFA1DU, 0x2B1CU, 0x9C1DU, 0x4D1CU, 0x7E1CU, 0xAF1DU, 
+    0xA018U, 0x7119U, 0x4219U, 0x9318U, 0x2419U, 0xF518U, 0xC618U, 0x1719U, 0xE819U, 0x3918U, 0x0A18U, 0xDB19U, 0x6C18U, 0xBD19U, 0x8E19U, 0x5F18U, 
+    0x301AU, 0xE11BU, 0xD21BU, 0x031AU, 0xB41BU, 0x651AU, 0x561AU, 0x871BU, 0x781BU, 0xA91AU, 0x9A1AU, 0x4B1BU, 0xFC1AU, 0x2D1BU, 0x1E1BU, 0xCF1AU, 
+    0x0011U, 0xD110U, 0xE210U, 0x3311U, 0x8410U, 0x5511U, 0x6611U, 0xB710U, 0x4810U, 0x9911U, 0xAA11U, 0x7B10U, 0xCC11U, 0x1D10U, 0x2E10U, 0xFF11U, 
+    0x9013U, 0x4112U, 0x7212U, 0xA313U, 0x1412U, 0xC513U, 0xF613U, 0x2712U, 0xD812U, 0x0913U, 0x3A13U, 0xEB12U, 0x5C13U, 0x8D12U, 0xBE12U, 0x6F13U, 
+    0x6016U, 0xB117U, 0x8217U, 0x5316U, 0xE417U, 0x3516U, 0x0616U, 0xD717U, 0x2817U, 0xF916U, 0xCA16U, 0x1B17U, 0xAC16U, 0x7D17U, 0x4E17U, 0x9F16U, 
+    0xF014U, 0x2115U, 0x1215U, 0xC314U, 0x7415U, 0xA514U, 0x9614U, 0x4715U, 0xB815U, 0x6914U, 0x5A14U, 0x8B15U, 0x3C14U, 0xED15U, 0xDE15U, 0x0F14U
+};
+
+static const CPU_INT16U g_CRC16TableSlice6[] = {
+    0x0000U, 0xC010U, 0xC023U, 0x0033U, 0xC045U, 0x0055U, 0x0066U, 0xC076U, 0xC089U, 0x0099U, 0x00AAU, 0xC0BAU, 0x00CCU, 0xC0DCU, 0xC0EFU, 0x00FFU, 
+    0xC111U, 0x0101U, 0x0132U, 0xC122U, 0x0154U, 0xC144U, 0xC177U, 0x0167U, 0x0198U, 0xC188U, 0xC1BBU, 0x01ABU, 0xC1DDU, 0x01CDU, 0x01FEU, 0xC1EEU, 
+    0xC221U, 0x0231U, 0x0202U, 0xC212U, 0x0264U, 0xC274U, 0xC247U, 0x0257U, 0x02A8U, 0xC2B8U, 0xC28BU, 0x029BU, 0xC2EDU, 0x02FDU, 0x02CEU, 0xC2DEU, 
+    0x0330U, 0xC320U, 0xC313U, 0x0303U, 0xC375U, 0x0365U, 0x0356U, 0xC346U, 0xC3B9U, 0x03A9U, 0x039AU, 0xC38AU, 0x03FCU, 0xC3ECU, 0xC3DFU, 0x03CFU, 
+    0xC441U, 0x0451U, 0x0462U, 0xC472U, 0x0404U, 0xC414U, 0xC427U, 0x0437U, 0x04C8U, 0xC4D8U, 0xC4EBU, 0x04FBU, 0xC48DU, 0x049DU, 0x04AEU, 0xC4BEU, 
+    0x0550U, 0xC540U, 0xC573U, 0x0563U, 0xC515U, 0x0505U, 0x0536U, 0xC526U, 0xC5D9U, 0x05C9U, 0x05FAU, 0xC5EAU, 0x059CU, 0xC58CU, 0xC5BFU, 0x05AFU, 
+    0x0660U, 0xC670U, 0xC643U, 0x0653U, 0xC625U, 0x0635U, 0x0606U, 0xC616U, 0xC6E9U, 0x06F9U, 0x06CAU, 0xC6DAU, 0x06ACU, 0xC6BCU, 0xC68FU, 0x069FU, 
+    0xC771U, 0x0761U, 0x0752U, 0xC742U, 0x0734U, 0xC724U, 0xC717U, 0x0707U, 0x07F8U, 0xC7E8U, 0xC7DBU, 0x07CBU, 0xC7BDU, 0x07ADU, 0x079EU, 0xC78EU, 
+    0xC881U, 0x0891U, 0x08A2U, 0xC8B2U, 0x08C4U, 0xC8D4U, 0xC8E7U, 0x08F7U, 0x0808U, 0xC818U, 0xC82BU, 0x083BU, 0xC84DU, 0x085DU, 0x086EU, 0xC87EU, 
+    0x0990U, 0xC980U, 0xC9B3U, 0x09A3U, 0xC9D5U, 0x09C5U, 0x09F6U, 0xC9E6U, 0xC919U, 0x0909U, 0x093AU, 0xC92AU, 0x095CU, 0xC94CU, 0xC97FU, 0x096FU, 
+    0x0AA0U, 0xCAB0U, 0xCA83U, 0x0A93U, 0xCAE5U, 0x0AF5U, 0x0AC6U, 0xCAD6U, 0xCA29U, 0x0A39U, 0x0A0AU, 0xCA1AU, 0x0A6CU, 0xCA7CU, 0xCA4FU, 0x0A5FU, 
+    0xCBB1U, 0x0BA1U, 0x0B92U, 0xCB82U, 0x0BF4U, 0xCBE4U, 0xCBD7U, 0x0BC7U, 0x0B38U, 0xCB28U, 0xCB1BU, 0x0B0BU, 0xCB7DU, 0x0B6DU, 0x0B5EU, 0xCB4EU, 
+    0x0CC0U, 0xCCD0U, 0xCCE3U, 0x0CF3U, 0xCC85U, 0x0C95U, 0x0CA6U, 0xCCB6U, 0xCC49U, 0x0C59U, 0x0C6AU, 0xCC7AU, 0x0C0CU, 0xCC1CU, 0xCC2FU, 0x0C3FU, 
+    0xCDD1U, 0x0DC1U, 0x0DF2U, 0xCDE2U, 0x0D94U, 0xCD84U, 0xCDB7U, 0x0DA7U, 0x0D58U, 0xCD48U, 0xCD7BU, 0x0D6BU, 0xCD1DU, 0x0D0DU, 0x0D3EU, 0xCD2EU, 
+    0xCEE1U, 0x0EF1U, 0x0EC2U, 0xCED2U, 0x0EA4U, 0xCEB4U, 0xCE87U, 0x0E97U, 0x0E68U, 0xCE78U, 0xCE4BU, 0x0E5BU, 0xCE2DU, 0x0E3DU, 0x0E0EU, 0xCE1EU, 
+    0x0FF0U, 0xCFE0U, 0xCFD3U, 0x0FC3U, 0xCFB5U, 0x0FA5U, 0x0F96U, 0xCF86U, 0xCF79U, 0x0F69U, 0x0F5AU, 0xCF4AU, 0x0F3CU, 0xCF2CU, 0xCF1FU, 0x0F0FU
+};
+
+static const CPU_INT16U g_CRC16TableSlice7[] = {
+    0x0000U, 0xCCC1U, 0xD981U, 0x1540U, 0xF301U, 0x3FC0U, 0x2A80U, 0xE641U, 0xA601U, 0x6AC0U, 0x7F80U, 0xB341U, 0x5500U, 0x99C1U, 0x8C81U, 0x4040U, 
+    0x0C01U, 0xC0C0U, 0xD580U, 0x1941U, 0xFF00U, 0x33C1U, 0x2681U, 0xEA40U, 0xAA00U, 0x66C1U, 0x7381U, 0xBF40U, 0x5901U, 0x95C0U, 0x8080U, 0x4C41U, 
+    0x1802U, 0xD4C3U, 0xC183U, 0x0D42U, 0xEB03U, 0x27C2U, 0x3282U, 0xFE43U, 0xBE03U, 0x72C2U, 0x6782U, 0xAB43U, 0x4D02U, 0x81C3U, 0x9483U, 0x5842U, 
+    0x1403U, 0xD8C2U, 0xCD82U, 0x0143U, 0xE702U, 0x2BC3U, 0x3E83U, 0xF242U, 0xB202U, 0x7EC3U, 0x6B83U, 0xA742U, 0x4103U, 0x8DC2U, 0x9882U, 0x5443U, 
+    0x3004U, 0xFCC5U, 0xE985U, 0x2544U, 0xC305U, 0x0FC4U, 0x1A84U, 0xD645U, 0x9605U, 0x5AC4U, 0x4F84U, 0x8345U, 0x6504U, 0xA9C5U, 0xBC85U, 0x7044U, 
+    0x3C05U, 0xF0C4U, 0xE584U, 0x2945U, 0xCF04U, 0x03C5U, 0x1685U, 0xDA44U, 0x9A04U, 0x56C5U, 0x4385U, 0x8F44U, 0x6905U, 0xA5C4U, 0xB084U, 0x7C45U, 
+    0x2806U, 0xE4C7U, 0xF187U, 0x3D46U, 0xDB07U, 0x17C6U, 0x0286U, 0xCE47U, 0x8E07U, 0x42C6U, 0x5786U, 0x9B47U, 0x7D06U, 0xB1C7U, 0xA487U, 0x6846U, 
+    0x2407U, 0xE8C6U, 0xFD86U, 0x3147U, 0xD706U, 0x1BC7U, 0x0E87U, 0xC246U, 0x8206U, 0x4EC7U, 0x5B87U, 0x9746U, 0x7107U, 0xBDC6U, 0xA886U, 0x6447U, 
+    0x6008U, 0xACC9U, 0xB989U, 0x7548U, 0x9309U, 0x5FC8U, 0x4A88U, 0x8649U, 0xC609U, 0x0AC8U, 0x1F88U, 0xD349U, 0x3508U, 0xF9C9U, 0xEC89U, 0x2048U, 
+    0x6C09U, 0xA0C8U, 0xB588U, 0x7949U, 0x9F08U, 0x53C9U, 0x4689U, 0x8A48U, 0xCA08U, 0x06C9U, 0x1389U, 0xDF48U, 0x3909U, 0xF5C8U, 0xE088U, 0x2C49U, 
+    0x780AU, 0xB4CBU, 0xA18BU, 0x6D4AU, 0x8B0BU, 0x47CAU, 0x528AU, 0x9E4BU, 0xDE0BU, 0x12CAU, 0x078AU, 0xCB4BU, 0x2D0AU, 0xE1CBU, 0xF48BU, 0x384AU, 
+    0x740BU, 0xB8CAU, 0xAD8AU, 0x614BU, 0x870AU, 0x4BCBU, 0x5E8BU, 0x924AU, 0xD20AU, 0x1ECBU, 0x0B8BU, 0xC74AU, 0x210BU, 0xEDCAU, 0xF88AU, 0x344BU, 
+    0x500CU, 0x9CCDU, 0x898DU, 0x454CU, 0xA30DU, 0x6FCCU, 0x7A8CU, 0xB64DU, 0xF60DU, 0x3ACCU, 0x2F8CU, 0xE34DU, 0x050CU, 0xC9CDU, 0xDC8DU, 0x104CU, 
+    0x5C0DU, 0x90CCU, 0x858CU, 0x494DU, 0xAF0CU, 0x63CDU, 0x768DU, 0xBA4CU, 0xFA0CU, 0x36CDU, 0x238DU, 0xEF4CU, 0x090DU, 0xC5CCU, 0xD08CU, 0x1C4DU, 
+    0x480EU, 0x84CFU, 0x918FU, 0x5D4EU, 0xBB0FU, 0x77CEU, 0x628EU, 0xAE4FU, 0xEE0FU, 0x22CEU, 0x378EU, 0xFB4FU, 0x1D0EU, 0xD1CFU, 0xC48FU, 0x084EU, 
+    0x440FU, 0x88CEU, 0x9D8EU, 0x514FU, 0xB70EU, 0x7BCFU, 0x6E8FU, 0xA24EU, 0xE20EU, 0x2ECFU, 0x3B8FU, 0xF74EU, 0x110FU, 0xDDCEU, 0xC88EU, 0x044FU
+};
+#endif
+#endif
+
+#if (MB_CFG_PORT_CRC16_ENGINE == MBPORT_CRC16_ENGINE_NIBBLE)
+static const CPU_INT16U g_CRC16NibbleTable[] = {
+    0x0000U, 0xCC01U, 0xD801U, 0x1400U, 0xF001U, 0x3C00U, 0x2800U, 0xE401U, 0xA001U, 0x6C00U, 0x7800U, 0xB401U, 0x5000U, 0x9C01U, 0x8801U, 0x4400U
+};
+#endif
 
 
 /*
@@ -83,6 +232,7 @@ void MBPort_CRC16_InitializeTable() {
 }
 
 
+#if (MB_CFG_PORT_CRC16_ENGINE != MBPORT_CRC16_ENGINE_HARDWARE)
 /*
 *********************************************************************************************************
 *                                  MBPort_CRC16_GetTableItem()
@@ -96,7 +246,102 @@ void MBPort_CRC16_InitializeTable() {
 */
 
 CPU_INT16U MBPort_CRC16_GetTableItem(CPU_INT08U offset) {
+#if (MB_CFG_PORT_CRC16_ENGINE == MBPORT_CRC16_ENGINE_NIBBLE)
+    CPU_INT16U item;
+
+    /*  Derive the item from the nibble table.  */
+    item = (CPU_INT16U)offset;
+    item = (CPU_INT16U)((item >> 4) ^ g_CRC16NibbleTable[item & (CPU_INT16U)0x0FU]);
+    item = (CPU_INT16U)((item >> 4) ^ g_CRC16NibbleTable[item & (CPU_INT16U)0x0FU]);
+
+    return item;
+#else
     return g_CRC16Table[(CPU_SIZE_T)offset];
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBPort_CRC16_Compute()
+*
+* Description : Compute the CRC-16 of a block of characters.
+*
+* Argument(s) : p_data  Pointer to the first character.
+*               size    Count of characters.
+*               seed    The initial CRC-16 value (0xFFFF for a new frame, or the value returned by previous 
+*                       call to continue the computation).
+*
+* Return(s)   : The CRC-16 value.
+*
+* Note(s)     : (1) 'p_data' is assumed to be not NULL if 'size' is not zero.
+*               (2) 'p_data' is not guaranteed to be aligned.
+*               (3) The CRC-16 is reflected, with polynomial 0xA001 and no final XOR (as defined by the 
+*                   Modbus over serial line specification).
+*               (4) If MB_CFG_PORT_CRC16_ENGINE is MBPORT_CRC16_ENGINE_HARDWARE, this function is not 
+*                   implemented here and must be provided by the application (e.g. with a CRC peripheral).
+*                   Any implementation must pass MBCRC16_SelfTest().
+*********************************************************************************************************
+*/
+
+CPU_INT16U MBPort_CRC16_Compute(
+    const CPU_INT08U  *p_data,
+    CPU_SIZE_T         size,
+    CPU_INT16U         seed
+) {
+    CPU_INT16U  crc;
+
+    crc = seed;
+
+#if (MB_CFG_PORT_CRC16_ENGINE == MBPORT_CRC16_ENGINE_SLICING8)
+    /*  Process 8 characters per iteration.  */
+    while (size >= (CPU_SIZE_T)8U) {
+        crc ^= (CPU_INT16U)((CPU_INT16U)p_data[0] | ((CPU_INT16U)p_data[1] << 8));
+        crc  = (CPU_INT16U)(
+            g_CRC16TableSlice7[crc & (CPU_INT16U)0xFFU] ^ 
+            g_CRC16TableSlice6[crc >> 8] ^ 
+            g_CRC16TableSlice5[p_data[2]] ^ 
+            g_CRC16TableSlice4[p_data[3]] ^ 
+            g_CRC16TableSlice3[p_data[4]] ^ 
+            g_CRC16TableSlice2[p_data[5]] ^ 
+            g_CRC16TableSlice1[p_data[6]] ^ 
+            g_CRC16Table[p_data[7]]
+        );
+        p_data += 8;
+        size   -= (CPU_SIZE_T)8U;
+    }
+#endif
+
+#if (MB_CFG_PORT_CRC16_ENGINE == MBPORT_CRC16_ENGINE_SLICING4) || (MB_CFG_PORT_CRC16_ENGINE == MBPORT_CRC16_ENGINE_SLICING8)
+    /*  Process 4 characters per iteration.  */
+    while (size >= (CPU_SIZE_T)4U) {
+        crc ^= (CPU_INT16U)((CPU_INT16U)p_data[0] | ((CPU_INT16U)p_data[1] << 8));
+        crc  = (CPU_INT16U)(
+            g_CRC16TableSlice3[crc & (CPU_INT16U)0xFFU] ^ 
+            g_CRC16TableSlice2[crc >> 8] ^ 
+            g_CRC16TableSlice1[p_data[2]] ^ 
+            g_CRC16Table[p_data[3]]
+        );
+        p_data += 4;
+        size   -= (CPU_SIZE_T)4U;
+    }
+#endif
+
+    /*  Process remaining characters one by one.  */
+    while (size != (CPU_SIZE_T)0U) {
+#if (MB_CFG_PORT_CRC16_ENGINE == MBPORT_CRC16_ENGINE_NIBBLE)
+        crc ^= (CPU_INT16U)(*p_data);
+        crc  = (CPU_INT16U)((crc >> 4) ^ g_CRC16NibbleTable[crc & (CPU_INT16U)0x0FU]);
+        crc  = (CPU_INT16U)((crc >> 4) ^ g_CRC16NibbleTable[crc & (CPU_INT16U)0x0FU]);
+#else
+        crc  = (CPU_INT16U)((crc >> 8) ^ g_CRC16Table[(crc ^ (CPU_INT16U)(*p_data)) & (CPU_INT16U)0xFFU]);
+#endif
+        ++p_data;
+        --size;
+    }
+
+    return crc;
 }
+#endif  /*  #if (MB_CFG_PORT_CRC16_ENGINE != MBPORT_CRC16_ENGINE_HARDWARE)  */
 
 #endif  /*  #if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)  */
\ No newline at end of file
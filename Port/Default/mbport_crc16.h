@@ -66,6 +66,7 @@ extern  "C" {
 void MBPort_CRC16_InitializeTable();
 
 
+#if (MB_CFG_PORT_CRC16_ENGINE != MBPORT_CRC16_ENGINE_HARDWARE)
 /*
 *********************************************************************************************************
 *                                  MBPort_CRC16_GetTableItem()
@@ -79,6 +80,37 @@ void MBPort_CRC16_InitializeTable();
 */
 
 CPU_INT16U MBPort_CRC16_GetTableItem(CPU_INT08U offset);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    MBPort_CRC16_Compute()
+*
+* Description : Compute the CRC-16 of a block of characters.
+*
+* Argument(s) : p_data  Pointer to the first character.
+*               size    Count of characters.
+*               seed    The initial CRC-16 value (0xFFFF for a new frame, or the value returned by previous 
+*                       call to continue the computation).
+*
+* Return(s)   : The CRC-16 value.
+*
+* Note(s)     : (1) 'p_data' is assumed to be not NULL if 'size' is not zero.
+*               (2) 'p_data' is not guaranteed to be aligned.
+*               (3) The CRC-16 is reflected, with polynomial 0xA001 and no final XOR (as defined by the 
+*                   Modbus over serial line specification).
+*               (4) If MB_CFG_PORT_CRC16_ENGINE is MBPORT_CRC16_ENGINE_HARDWARE, this function is not 
+*                   implemented here and must be provided by the application (e.g. with a CRC peripheral).
+*                   Any implementation must pass MBCRC16_SelfTest().
+*********************************************************************************************************
+*/
+
+CPU_INT16U MBPort_CRC16_Compute(
+    const CPU_INT08U  *p_data,
+    CPU_SIZE_T         size,
+    CPU_INT16U         seed
+);
 
 
 #ifdef __cplusplus
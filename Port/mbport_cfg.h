@@ -52,6 +52,17 @@
 #define MB_CFG_CORE_ASCIIMODE                                DEF_DISABLED
 #endif
 
+/*  CRC-16 engines.  */
+#define MBPORT_CRC16_ENGINE_TABLE                            0U      /*  Byte-wise, 256-item table (512 bytes).    */
+#define MBPORT_CRC16_ENGINE_SLICING4                         1U      /*  Slicing-by-4, 4 tables (2048 bytes).       */
+#define MBPORT_CRC16_ENGINE_SLICING8                         2U      /*  Slicing-by-8, 8 tables (4096 bytes).       */
+#define MBPORT_CRC16_ENGINE_NIBBLE                           3U      /*  Nibble-wise, 16-item table (32 bytes).     */
+#define MBPORT_CRC16_ENGINE_HARDWARE                         4U      /*  Provided by the application.               */
+
+#ifndef MB_CFG_PORT_CRC16_ENGINE
+#define MB_CFG_PORT_CRC16_ENGINE                             MBPORT_CRC16_ENGINE_TABLE
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -59,6 +70,14 @@
 *********************************************************************************************************
 */
 
+#if (MB_CFG_PORT_CRC16_ENGINE != MBPORT_CRC16_ENGINE_TABLE   ) && \
+    (MB_CFG_PORT_CRC16_ENGINE != MBPORT_CRC16_ENGINE_SLICING4) && \
+    (MB_CFG_PORT_CRC16_ENGINE != MBPORT_CRC16_ENGINE_SLICING8) && \
+    (MB_CFG_PORT_CRC16_ENGINE != MBPORT_CRC16_ENGINE_NIBBLE  ) && \
+    (MB_CFG_PORT_CRC16_ENGINE != MBPORT_CRC16_ENGINE_HARDWARE)
+#    error  "Illegal MB_CFG_PORT_CRC16_ENGINE defined in <app_cfg.h>."
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -52,6 +52,55 @@
 
 #if (MB_CFG_MASTER_EN == DEF_ENABLED)
 
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#if (MB_CFG_MASTER_QUEUE_EN == DEF_ENABLED)
+/*  Queue event flag that is set when a request is submitted.  */
+#define MBMASTER_QUEUEFLAG_SUBMITTED                ((MB_FLAGS)0x01U)
+#endif
+
+/*  Check whether tick count 'a' is before tick count 'b' (wrap-around safe).  */
+#define MBMASTER_TICKBEFORE(a, b)                   (((MB_SYSTICK)((MB_SYSTICK)(a) - (MB_SYSTICK)(b))) > ((MB_SYSTICK)(((MB_SYSTICK)-1) >> 1)))
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)
+static MBMASTER_SLAVEHEALTH *MBMaster_GetHealthSlot(
+    MBMASTER              *p_master,
+    CPU_INT08U             slave
+);
+
+static void MBMaster_UpdateHealth(
+    MBMASTER              *p_master,
+    MBMASTER_SLAVEHEALTH  *p_health,
+    MB_ERROR               error
+);
+#endif
+
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED) && (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+static MB_SYSTICK MBMaster_GetAdaptiveTimeout(
+    MBMASTER              *p_master,
+    MBMASTER_SLAVEHEALTH  *p_health,
+    MB_SYSTICK             ticks_default
+);
+
+static void MBMaster_UpdateLatency(
+    MBMASTER_SLAVEHEALTH  *p_health,
+    MB_SYSTICK             ticks_latency,
+    CPU_BOOLEAN            censored
+);
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                   MBMaster_Initialize()
@@ -105,7 +154,27 @@ void MBMaster_Initialize(
     p_master->bufRxTx = p_buf;
     p_master->bufRxTxSize = buf_size;
     p_master->dlyTurnAround = (MB_TIMESPAN)0U;
+    p_master->turnAroundPending = DEF_NO;
+    p_master->turnAroundEnd = (MB_SYSTICK)0U;
     p_master->busy = DEF_NO;
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+    p_master->retryCnt = (CPU_INT08U)0U;
+    p_master->retryBackoff = (MB_TIMESPAN)0U;
+    p_master->cntRetry = (MB_COUNTERVALUE)0U;
+    p_master->cntGarbled = (MB_COUNTERVALUE)0U;
+#endif
+#if (MB_CFG_MASTER_QUEUE_EN == DEF_ENABLED)
+    p_master->queueFree = (MBMASTER_TRANSACTION*)0;
+    p_master->queueHead = (MBMASTER_TRANSACTION*)0;
+    p_master->queueTail = (MBMASTER_TRANSACTION*)0;
+#endif
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)
+    p_master->healthSlots = (MBMASTER_SLAVEHEALTH*)0;
+    p_master->healthSlotCnt = (CPU_SIZE_T)0U;
+#if (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+    p_master->healthTimeoutK = (CPU_INT08U)0U;
+#endif
+#endif
 
     /*  Exit critical section.  */
     CPU_CRITICAL_EXIT();
@@ -129,6 +198,9 @@ void MBMaster_Initialize(
 *                                             MB_ERROR_NULLREFERENCE           'p_master' is NULL.
 *
 * Return(s)   : None.
+*
+* Note(s)     : (1) The turn around delay is the minimum delay between a broadcast request and the next request, it
+*                   is enforced when the next request is transmitted (see MBMaster_Post()).
 *********************************************************************************************************
 */
 
@@ -209,6 +281,140 @@ MB_TIMESPAN  MBMaster_GetTurnAroundDelay(
 }
 
 
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_SetRetryPolicy()
+*
+* Description : Set the retry policy of a Modbus master.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) retry_cnt             Maximum count of retransmissions of one request (0 to disable retry).
+*               (3) backoff               Delay before the first retransmission after a timeout, doubled for each
+*                                         following one (unit: milliseconds, 0 to retransmit immediately).
+*               (4) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' is NULL.
+*                                             MB_ERROR_OVERFLOW                'backoff' exceeds maximum allowed value.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Only requests of idempotent command-lets (whose 'flags' member contains
+*                   MBMASTER_CMDLET_FLAG_IDEMPOTENT) are retransmitted. The built-in read commands (FC01 to FC04)
+*                   are idempotent, other commands (e.g. FC05, FC06 and FC16) are retransmitted only if the
+*                   application posts them with a copy of the command-let descriptor that is marked idempotent:
+*
+*                       MBMASTER_CMDLET  cmdletWriteRegs;
+*
+*                       cmdletWriteRegs = *MBMASTER_CMDLETDESCRIPTOR_WRITEMULTIPLEREGISTERS;
+*                       cmdletWriteRegs.flags |= MBMASTER_CMDLET_FLAG_IDEMPOTENT;
+*
+*               (2) A request is retransmitted if its response timed out (after the backoff delay), or if a
+*                   garbled (dropped) response frame was received (immediately, since the line is idle once the
+*                   frame ended, instead of waiting for the rest of the timeout). Broadcast requests are never
+*                   retransmitted.
+*               (3) Each retransmission waits for the whole timeout again.
+*********************************************************************************************************
+*/
+
+void MBMaster_SetRetryPolicy(
+    MBMASTER            *p_master,
+    CPU_INT08U           retry_cnt,
+    MB_TIMESPAN          backoff,
+    MB_ERROR            *p_error
+) {
+    CPU_SR_ALLOC();
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_master' parameter.  */
+    if (p_master == (MBMASTER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'backoff' parameter.  */
+    if (backoff > MBOS_GetMaxTimeValue()) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+#endif
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  Set the retry policy.  */
+    p_master->retryCnt = retry_cnt;
+    p_master->retryBackoff = backoff;
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_GetRetryStatistics()
+*
+* Description : Get the retry statistics of a Modbus master.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) p_stats               Pointer to the variable that receives the statistics.
+*               (3) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' or 'p_stats' is NULL.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The statistics count the retransmissions and the garbled response frames of all slaves, the
+*                   counts of each slave are returned by MBMaster_GetSlaveHealth() (if MB_CFG_MASTER_HEALTH_EN is
+*                   enabled and the slave is tracked).
+*********************************************************************************************************
+*/
+
+void MBMaster_GetRetryStatistics(
+    MBMASTER                   *p_master,
+    MBMASTER_RETRY_STATISTICS  *p_stats,
+    MB_ERROR                   *p_error
+) {
+    CPU_SR_ALLOC();
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_master' parameter.  */
+    if (p_master == (MBMASTER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_stats' parameter.  */
+    if (p_stats == (MBMASTER_RETRY_STATISTICS*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  Copy the statistics.  */
+    p_stats->cntRetry = p_master->cntRetry;
+    p_stats->cntGarbled = p_master->cntGarbled;
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                   MBMaster_Post()
@@ -233,6 +439,7 @@ MB_TIMESPAN  MBMaster_GetTurnAroundDelay(
 *                                                                                  (4) 'p_response' is NULL.
 *
 *                                             MB_ERROR_MASTER_STILLBUSY        Master is still busy.
+*                                             MB_ERROR_MASTER_SLAVEOFFLINE     Slave is offline (see MBMaster_HealthInitialize()).
 *                                             MB_ERROR_MASTER_TXBADREQUEST     Bad request parameter.
 *                                             MB_ERROR_MASTER_TXBUFFERLOW      Data buffer is too small.
 *                                             MB_ERROR_MASTER_RXTRUNCATED      Frame data is truncated.
@@ -249,7 +456,7 @@ MB_TIMESPAN  MBMaster_GetTurnAroundDelay(
 *                                             MB_ERROR_OS_FGRP_FAILEDPEND      Failed to pend on a flag group object.
 *                                             MB_ERROR_OS_FGRP_FAILEDPOST      Failed to post to a flag group object.
 *                                             MB_ERROR_OS_MUTEX_FAILEDPEND     Failed to pend on a mutex object.
-*                                             MB_ERROR_OS_TIMER_FAILEDCREATE   Failed to create timer object.
+*                                             MB_ERROR_OS_TIMER_FAILEDSET      Failed to set a timer object.
 *                                             MB_ERROR_OS_TIMER_FAILEDSTART    Failed to start a timer object.
 *                                             MB_ERROR_OS_TIME_FAILEDDELAY     Failed to delay.
 *                                             MB_ERROR_OS_TIME_FAILEDGET       Failed to get system tick count.
@@ -260,6 +467,13 @@ MB_TIMESPAN  MBMaster_GetTurnAroundDelay(
 *               (2) 'p_response' must point to a valid command-let response (MBMASTER_CMDLET_*_RESPONSE) object.
 *               (3) Multi-thread(task)/nesting posting is not allowed. If you do that, a 'MB_ERROR_MASTER_STILLBUSY' error would 
 *                   be thrown.
+*               (4) To share one master between multiple tasks, enable MB_CFG_MASTER_QUEUE_EN and use MBMaster_Submit() 
+*                   instead.
+*               (5) A broadcast request returns as soon as it was transmitted, the turn around delay is waited (if 
+*                   not elapsed yet) before the next request frame is transmitted, so the application can prepare 
+*                   the next request meanwhile.
+*               (6) If MB_CFG_MASTER_RETRY_EN is enabled, idempotent requests may be retransmitted (see
+*                   MBMaster_SetRetryPolicy()), the error code is the one of the last transmission.
 *********************************************************************************************************
 */
 
@@ -280,18 +494,42 @@ void MBMaster_Post(
     CPU_BOOLEAN    frameCanProcess;
 
     struct {
-        CPU_BOOLEAN    clrCriticalSect:1;
         CPU_BOOLEAN    clrBusy:1;
-        CPU_INT08U     __padding:6;
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)
+        CPU_BOOLEAN    updHealth:1;
+        CPU_BOOLEAN    updLatency:1;
+        CPU_BOOLEAN    latencyCensored:1;
+        CPU_INT08U     __padding:4;
+#else
+        CPU_INT08U     __padding:7;
+#endif
     } gc;
 
     MB_TIMESPAN    rxTimeout;
 
     MB_TIMESPAN    dlyTurnAround;
+    MB_TIMESPAN    dlyRemain;
 
     MB_SYSTICK     ticksTimeout;
     MB_SYSTICK     ticksBeforeRX;
     MB_SYSTICK     ticksAfterRX;
+    MB_SYSTICK     ticksNow;
+    MB_SYSTICK     ticksTurnAround;
+
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+    CPU_INT08U     retryLeft;
+    MB_TIMESPAN    dlyRetry;
+    MB_SYSTICK     ticksTimeoutAttempt;
+#endif
+
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)
+    MBMASTER_SLAVEHEALTH  *p_health;
+#endif
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED) && (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+    MB_SYSTICK             ticksTransmitted;
+    MB_SYSTICK             ticksReceived;
+    MB_SYSTICK             ticksLatency;
+#endif
 
 #if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
     /*  Check 'p_master' parameter.  */
@@ -326,9 +564,19 @@ void MBMaster_Post(
 #endif
 
     /*  Initialize local variables.  */
-    gc.clrCriticalSect  = DEF_NO;
     gc.clrBusy          = DEF_NO;
     ticksBeforeRX       = (MB_SYSTICK)0U;
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)
+    gc.updHealth        = DEF_NO;
+    gc.updLatency       = DEF_NO;
+    gc.latencyCensored  = DEF_NO;
+    p_health            = (MBMASTER_SLAVEHEALTH*)0;
+#endif
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED) && (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+    ticksTransmitted    = (MB_SYSTICK)0U;
+    ticksReceived       = (MB_SYSTICK)0U;
+    ticksLatency        = (MB_SYSTICK)0U;
+#endif
 
     /*  No error by default.  */
     *p_error            = MB_ERROR_NONE;
@@ -348,17 +596,76 @@ void MBMaster_Post(
 
     /*  Enter critical section.  */
     CPU_CRITICAL_ENTER();
-    gc.clrCriticalSect = DEF_YES;
 
     /*  Try to acquire the busy lock.  */
     if (p_master->busy) {
+        /*  Exit critical section.  */
+        CPU_CRITICAL_EXIT();
+
         *p_error = MB_ERROR_MASTER_STILLBUSY;
         goto MBMASTER_POST_EXIT;
     }
     p_master->busy = DEF_YES;
     gc.clrBusy = DEF_YES;
 
-    /*  Make the request frame.  */
+    /*  Get the turn around delay.  */
+    dlyTurnAround = p_master->dlyTurnAround;
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)
+    /*  Fail fast if the slave is offline and it's not the time to probe it.  */
+    if (slave != (CPU_INT08U)0U) {
+        p_health = MBMaster_GetHealthSlot(p_master, slave);
+    }
+    if (p_health != (MBMASTER_SLAVEHEALTH*)0) {
+        if (p_health->offline) {
+            ticksNow = MBOS_GetTickCount(p_error);
+            if (*p_error != MB_ERROR_NONE) {
+                goto MBMASTER_POST_EXIT;
+            }
+            if (MBMASTER_TICKBEFORE(ticksNow, p_health->probe)) {
+                CPU_CRITICAL_ENTER();
+                ++(p_health->cntFastFail);
+                CPU_CRITICAL_EXIT();
+
+                *p_error = MB_ERROR_MASTER_SLAVEOFFLINE;
+                goto MBMASTER_POST_EXIT;
+            }
+        }
+    }
+#endif
+
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED) && (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+    /*  Use the timeout learned from the latency of the slave (if any).  */
+    if ((p_health != (MBMASTER_SLAVEHEALTH*)0) && (ticksTimeout != (MB_SYSTICK)0U)) {
+        ticksTimeout = MBMaster_GetAdaptiveTimeout(p_master, p_health, ticksTimeout);
+    }
+    ticksLatency = ticksTimeout;
+#endif
+
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+    /*  Get the retry policy (only idempotent requests to a slave are retransmitted).  */
+    CPU_CRITICAL_ENTER();
+    retryLeft = p_master->retryCnt;
+    dlyRetry = p_master->retryBackoff;
+    CPU_CRITICAL_EXIT();
+    if ((slave == (CPU_INT08U)0U) || ((p_cmdlet->flags & MBMASTER_CMDLET_FLAG_IDEMPOTENT) == (CPU_INT08U)0U)) {
+        retryLeft = (CPU_INT08U)0U;
+    }
+    ticksTimeoutAttempt = ticksTimeout;
+
+MBMASTER_POST_TRANSMIT:
+#endif
+    /*
+     *  Make the request frame.
+     * 
+     *  Note(s):
+     *    (1) The busy lock makes current task the only user of the data
+     *        buffer, so the frame is built (and the response frame is
+     *        handled below) with interrupts enabled.
+     */
     p_cmdlet->cbRequestHandler(
         slave,
         p_request,
@@ -371,9 +678,30 @@ void MBMaster_Post(
         goto MBMASTER_POST_EXIT;
     }
 
-    /*  Exit critical section.  */
-    CPU_CRITICAL_EXIT();
-    gc.clrCriticalSect = DEF_NO;
+    /*  Wait for the end of the turn around of previous broadcast request (see Note #5).  */
+    if (p_master->turnAroundPending) {
+        ticksNow = MBOS_GetTickCount(p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            goto MBMASTER_POST_EXIT;
+        }
+        if (MBMASTER_TICKBEFORE(ticksNow, p_master->turnAroundEnd)) {
+            dlyRemain = MBOS_TickCountToTime(
+                (MB_SYSTICK)(p_master->turnAroundEnd - ticksNow),
+                p_error
+            );
+            if (*p_error != MB_ERROR_NONE) {
+                goto MBMASTER_POST_EXIT;
+            }
+            MBOS_Delay(
+                dlyRemain,
+                p_error
+            );
+            if (*p_error != MB_ERROR_NONE) {
+                goto MBMASTER_POST_EXIT;
+            }
+        }
+        p_master->turnAroundPending = DEF_NO;
+    }
 
     /*  Transmit the request frame.  */
     MB_TransmitFrame(
@@ -385,37 +713,45 @@ void MBMaster_Post(
         goto MBMASTER_POST_EXIT;
     }
 
-    /*  Fast path: Broadcast requests have no response frame.  */
-    if (slave == (CPU_INT08U)0U) {
-        /*  Enter critical section.  */
-        CPU_CRITICAL_ENTER();
-        gc.clrCriticalSect = DEF_YES;
-
-        /*  Get the turn around delay.  */
-        dlyTurnAround = p_master->dlyTurnAround;
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED) && (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+    /*  Get the tick count when the request frame was transmitted.  */
+    if (p_health != (MBMASTER_SLAVEHEALTH*)0) {
+        ticksTransmitted = MBOS_GetTickCount(p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            goto MBMASTER_POST_EXIT;
+        }
+    }
+#endif
 
-        /*  Exit critical section.  */
-        CPU_CRITICAL_EXIT();
-        gc.clrCriticalSect = DEF_NO;
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)
+    /*  The result of the request tells the health of the slave from now on.  */
+    if (p_health != (MBMASTER_SLAVEHEALTH*)0) {
+        gc.updHealth = DEF_YES;
+    }
+#endif
 
+    /*  Fast path: Broadcast requests have no response frame.  */
+    if (slave == (CPU_INT08U)0U) {
         if (dlyTurnAround != (MB_TIMESPAN)0U) {
-            /*  Wait for turn around.  */
-            MBOS_Delay(
+            /*  Record the end of the turn around (instead of waiting for it here).  */
+            ticksNow = MBOS_GetTickCount(p_error);
+            if (*p_error != MB_ERROR_NONE) {
+                goto MBMASTER_POST_EXIT;
+            }
+            ticksTurnAround = MBOS_TimeToTickCount(
                 dlyTurnAround,
                 p_error
             );
-            /*if (*p_error != MB_ERROR_NONE) {
+            if (*p_error != MB_ERROR_NONE) {
                 goto MBMASTER_POST_EXIT;
-            }*/
+            }
+            p_master->turnAroundEnd = (MB_SYSTICK)(ticksNow + ticksTurnAround);
+            p_master->turnAroundPending = DEF_YES;
         }
 
         goto MBMASTER_POST_EXIT;
     }
 
-    /*  Enter critical section.  */
-    CPU_CRITICAL_ENTER();
-    gc.clrCriticalSect = DEF_YES;
-
     while (DEF_YES) {
         if (ticksTimeout != (MB_SYSTICK)0U) {
             /*  Get the system tick count before RX operation.  */
@@ -433,10 +769,6 @@ void MBMaster_Post(
             rxTimeout = (MB_TIMESPAN)0U;
         }
 
-        /*  Exit critical section.  */
-        CPU_CRITICAL_EXIT();
-        gc.clrCriticalSect = DEF_NO;
-
         /*  Receive a response frame.  */
         MB_ReceiveFrame(
             p_master->iface,
@@ -458,9 +790,15 @@ void MBMaster_Post(
                 goto MBMASTER_POST_EXIT;
         }
 
-        /*  Enter critical section.  */
-        CPU_CRITICAL_ENTER();
-        gc.clrCriticalSect = DEF_YES;
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED) && (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+        /*  Get the tick count when the response frame was received.  */
+        if (frameCanProcess && (p_health != (MBMASTER_SLAVEHEALTH*)0)) {
+            ticksReceived = MBOS_GetTickCount(p_error);
+            if (*p_error != MB_ERROR_NONE) {
+                goto MBMASTER_POST_EXIT;
+            }
+        }
+#endif
 
         /*  Try to process the response frame.  */
         if (frameCanProcess) {
@@ -473,6 +811,14 @@ void MBMaster_Post(
                     &(frame),
                     p_error
                 );
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED) && (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+                /*  Measure the latency if the frame is from the slave.  */
+                if (*p_error != MB_ERROR_MASTER_RXINVALIDSLAVE) {
+                    ticksLatency = (MB_SYSTICK)(ticksReceived - ticksTransmitted);
+                    gc.updLatency = DEF_YES;
+                    gc.latencyCensored = DEF_NO;
+                }
+#endif
                 switch (*p_error) {
                     case MB_ERROR_MASTER_RXINVALIDSLAVE:
                         break;
@@ -481,6 +827,24 @@ void MBMaster_Post(
                         goto MBMASTER_POST_EXIT;
                 }
             }
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+            if ((frameFlags & MB_FRAMEFLAGS_DROP) != (MB_FRAMEFLAGS)0) {
+                /*  Count the garbled response frame.  */
+                CPU_CRITICAL_ENTER();
+                ++(p_master->cntGarbled);
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)
+                if (p_health != (MBMASTER_SLAVEHEALTH*)0) {
+                    ++(p_health->cntGarbled);
+                }
+#endif
+                CPU_CRITICAL_EXIT();
+
+                /*  Retransmit immediately, the line is idle since the frame ended.  */
+                if (retryLeft != (CPU_INT08U)0U) {
+                    goto MBMASTER_POST_RETRY;
+                }
+            }
+#endif
         }
 
         if (ticksTimeout != (MB_SYSTICK)0U) {
@@ -495,6 +859,29 @@ void MBMaster_Post(
 
             /*  Throw a timeout error if the elapsed ticks is not lower than the timeout ticks.  */
             if (ticksAfterRX >= ticksTimeout) {
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+                /*  Retransmit after the backoff delay (which doubles for each retransmission).  */
+                if (retryLeft != (CPU_INT08U)0U) {
+                    MBOS_Delay(
+                        dlyRetry,
+                        p_error
+                    );
+                    if (*p_error != MB_ERROR_NONE) {
+                        goto MBMASTER_POST_EXIT;
+                    }
+                    if (dlyRetry > (MB_TIMESPAN)(MBOS_GetMaxTimeValue() >> 1)) {
+                        dlyRetry = MBOS_GetMaxTimeValue();
+                    } else {
+                        dlyRetry = (MB_TIMESPAN)(dlyRetry << 1);
+                    }
+                    goto MBMASTER_POST_RETRY;
+                }
+#endif
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED) && (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+                /*  A timeout counts as a latency of the whole timeout (once the latency was learned).  */
+                gc.updLatency = DEF_YES;
+                gc.latencyCensored = DEF_YES;
+#endif
                 *p_error = MB_ERROR_TIMEOUT;
                 goto MBMASTER_POST_EXIT;
             }
@@ -504,18 +891,1119 @@ void MBMaster_Post(
         }
     }
 
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+MBMASTER_POST_RETRY:
+    /*  Count the retransmission.  */
+    --retryLeft;
+    CPU_CRITICAL_ENTER();
+    ++(p_master->cntRetry);
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)
+    if (p_health != (MBMASTER_SLAVEHEALTH*)0) {
+        ++(p_health->cntRetry);
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+
+    /*  Give the retransmission the whole timeout.  */
+    ticksTimeout = ticksTimeoutAttempt;
+    goto MBMASTER_POST_TRANSMIT;
+#endif
+
 MBMASTER_POST_EXIT:
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)
+    /*  Update the health of the slave (if needed).  */
+    if (gc.updHealth) {
+        MBMaster_UpdateHealth(p_master, p_health, *p_error);
+#if (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+        if (gc.updLatency) {
+            MBMaster_UpdateLatency(p_health, ticksLatency, gc.latencyCensored);
+        }
+#endif
+        gc.updHealth = DEF_NO;
+        gc.updLatency = DEF_NO;
+        gc.latencyCensored = DEF_NO;
+    }
+#endif
+
     /*  Release the busy lock (if needed).  */
     if (gc.clrBusy) {
+        CPU_CRITICAL_ENTER();
         p_master->busy = DEF_NO;
+        CPU_CRITICAL_EXIT();
         gc.clrBusy = DEF_NO;
     }
+}
 
-    /*  Clean up the critical section (if needed).  */
-    if (gc.clrCriticalSect) {
-        CPU_CRITICAL_EXIT();
-        gc.clrCriticalSect = DEF_NO;
+
+#if (MB_CFG_MASTER_QUEUE_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_QueueInitialize()
+*
+* Description : Initialize the transaction queue of a Modbus master.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) p_slots               Pointer to the first element of the transaction slot storage.
+*               (3) slot_cnt              Count of elements of the transaction slot storage.
+*               (4) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' is NULL or 'p_slots' is NULL while 
+*                                                                              'slot_cnt' is not zero.
+*                                             MB_ERROR_OS_FGRP_FAILEDCREATE    Failed to create a flag group object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The master must be initialized (by MBMaster_Initialize()) before calling this function.
+*               (2) At most 'slot_cnt' requests can be queued at the same time, the slot storage must not be 
+*                   accessed by the application until MBMaster_QueueDispose() is called.
+*********************************************************************************************************
+*/
+
+void MBMaster_QueueInitialize(
+    MBMASTER              *p_master,
+    MBMASTER_TRANSACTION  *p_slots,
+    CPU_SIZE_T             slot_cnt,
+    MB_ERROR              *p_error
+) {
+    CPU_SR_ALLOC();
+
+    CPU_SIZE_T  cursor;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_master' parameter.  */
+    if (p_master == (MBMASTER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
     }
-}
+
+    /*  Check 'p_slots' parameter.  */
+    if ((p_slots == (MBMASTER_TRANSACTION*)0) && (slot_cnt != (CPU_SIZE_T)0U)) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Create the queue event flags.  */
+    MBOS_FlagGroupCreate(
+        &(p_master->queueEvent),
+        (MB_FLAGS)0U,
+        p_error
+    );
+    if (*p_error != MB_ERROR_NONE) {
+        return;
+    }
+
+    /*  Link all slots to the free list.  */
+    for (cursor = (CPU_SIZE_T)0U; cursor < slot_cnt; ++cursor) {
+        if (cursor + (CPU_SIZE_T)1U < slot_cnt) {
+            p_slots[cursor].next = &(p_slots[cursor + (CPU_SIZE_T)1U]);
+        } else {
+            p_slots[cursor].next = (MBMASTER_TRANSACTION*)0;
+        }
+    }
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  Initialize the queue.  */
+    if (slot_cnt != (CPU_SIZE_T)0U) {
+        p_master->queueFree = &(p_slots[0]);
+    } else {
+        p_master->queueFree = (MBMASTER_TRANSACTION*)0;
+    }
+    p_master->queueHead = (MBMASTER_TRANSACTION*)0;
+    p_master->queueTail = (MBMASTER_TRANSACTION*)0;
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_QueueDispose()
+*
+* Description : Dispose the transaction queue of a Modbus master.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' is NULL.
+*                                             MB_ERROR_OS_FGRP_FAILEDDISPOSE   Failed to dispose a flag group object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The task that services the queue must be stopped before calling this function, requests 
+*                   that are still queued are dropped without calling their completion callbacks.
+*********************************************************************************************************
+*/
+
+void MBMaster_QueueDispose(
+    MBMASTER              *p_master,
+    MB_ERROR              *p_error
+) {
+    CPU_SR_ALLOC();
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_master' parameter.  */
+    if (p_master == (MBMASTER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  Drop all slots (so that no request can be submitted any more).  */
+    p_master->queueFree = (MBMASTER_TRANSACTION*)0;
+    p_master->queueHead = (MBMASTER_TRANSACTION*)0;
+    p_master->queueTail = (MBMASTER_TRANSACTION*)0;
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    /*  Dispose the queue event flags.  */
+    MBOS_FlagGroupDispose(
+        &(p_master->queueEvent),
+        p_error
+    );
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_Submit()
+*
+* Description : Submit a Modbus request to the transaction queue of a Modbus master.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) slave                 Slave address.
+*               (3) p_cmdlet              Pointer to the command-let object.
+*               (4) p_request             Pointer to the request object.
+*               (5) p_response            Pointer to the response object.
+*               (6) p_responsearg         'p_arg' parameter passed to response callbacks.
+*               (7) timeout               Timeout for receiving the response frame from the slave (unit: milliseconds, 0 to wait infinitely).
+*               (8) cb_complete           Completion callback (NULL if not used).
+*               (9) p_completearg         'p_arg' parameter passed to the completion callback.
+*               (10) p_error              Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           One of following conditions occurred:
+*
+*                                                                                  (1) 'p_master' is NULL.
+*                                                                                  (2) 'p_cmdlet' is NULL.
+*                                                                                  (3) 'p_request' is NULL.
+*                                                                                  (4) 'p_response' is NULL.
+*
+*                                             MB_ERROR_OVERFLOW                'timeout' parameter exceeds maximum allowed value.
+*                                             MB_ERROR_MASTER_QUEUEFULL        No free transaction slot.
+*                                             MB_ERROR_OS_FGRP_FAILEDPOST      Failed to post to a flag group object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) This function doesn't wait for the request to be done, so it can be called by multiple 
+*                   tasks at the same time. Requests are executed in the order they are submitted.
+*               (2) The request object, the response object and the response callback argument must be kept 
+*                   valid until the completion callback is called.
+*               (3) The completion callback is called (by the task that services the queue) with the error code 
+*                   that MBMaster_Post() returned for the request. The transaction slot is released before the 
+*                   callback is called, so the callback may submit another request.
+*               (4) If 'MB_ERROR_OS_FGRP_FAILEDPOST' error is thrown, the request is still queued and would be 
+*                   executed once the servicing task wakes up.
+*********************************************************************************************************
+*/
+
+void MBMaster_Submit(
+    MBMASTER              *p_master,
+    CPU_INT08U             slave,
+    MBMASTER_CMDLET       *p_cmdlet,
+    void                  *p_request,
+    void                  *p_response,
+    void                  *p_responsearg,
+    MB_TIMESPAN            timeout,
+    MBMASTER_COMPLETE_CB   cb_complete,
+    void                  *p_completearg,
+    MB_ERROR              *p_error
+) {
+    CPU_SR_ALLOC();
+
+    MBMASTER_TRANSACTION  *p_trans;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_master' parameter.  */
+    if (p_master == (MBMASTER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_cmdlet' parameter.  */
+    if (p_cmdlet == (MBMASTER_CMDLET*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_request' parameter.  */
+    if (p_request == (void*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_response' parameter.  */
+    if (p_response == (void*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'timeout' parameter.  */
+    if (timeout > MBOS_GetMaxTimeValue()) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+#endif
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  Take a free slot.  */
+    p_trans = p_master->queueFree;
+    if (p_trans == (MBMASTER_TRANSACTION*)0) {
+        /*  Exit critical section.  */
+        CPU_CRITICAL_EXIT();
+
+        *p_error = MB_ERROR_MASTER_QUEUEFULL;
+        return;
+    }
+    p_master->queueFree = p_trans->next;
+
+    /*  Fill the slot.  */
+    p_trans->next          = (MBMASTER_TRANSACTION*)0;
+    p_trans->slave         = slave;
+    p_trans->cmdlet        = p_cmdlet;
+    p_trans->request       = p_request;
+    p_trans->response      = p_response;
+    p_trans->responseArg   = p_responsearg;
+    p_trans->timeout       = timeout;
+    p_trans->cbComplete    = cb_complete;
+    p_trans->cbCompleteArg = p_completearg;
+
+    /*  Append the slot to the tail of the queue.  */
+    if (p_master->queueTail != (MBMASTER_TRANSACTION*)0) {
+        p_master->queueTail->next = p_trans;
+    } else {
+        p_master->queueHead = p_trans;
+    }
+    p_master->queueTail = p_trans;
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    /*  Wake up the servicing task.  */
+    MBOS_FlagGroupPost(
+        &(p_master->queueEvent),
+        MBMASTER_QUEUEFLAG_SUBMITTED,
+        MB_FLAGGROUP_OPT_SET,
+        p_error
+    );
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_ServiceQueue()
+*
+* Description : Wait for a queued request of a Modbus master and execute it.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) timeout               Timeout of waiting for a queued request (unit: milliseconds, 0 to wait infinitely).
+*               (3) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' is NULL.
+*                                             MB_ERROR_OVERFLOW                'timeout' parameter exceeds maximum allowed value.
+*                                             MB_ERROR_TIMEOUT                 No request was queued before the timeout limit exceeds.
+*                                             MB_ERROR_OS_FGRP_FAILEDPEND      Failed to pend on a flag group object.
+*                                             MB_ERROR_OS_FGRP_FAILEDRDYFLAGS  Failed to get the flags that make current task 
+*                                                                              ready-to-run.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) One request is executed per call, the error of the request itself is reported to its 
+*                   completion callback (not to 'p_error').
+*               (2) Only one task is allowed to service the queue of a master, typically:
+*
+*                       while (DEF_YES) {
+*                           MBMaster_ServiceQueue(&master, (MB_TIMESPAN)0U, &error);
+*                       }
+*
+*               (3) MBMaster_Post() must not be called on a master whose queue is being serviced, otherwise 
+*                   queued requests may fail with a 'MB_ERROR_MASTER_STILLBUSY' error.
+*********************************************************************************************************
+*/
+
+void MBMaster_ServiceQueue(
+    MBMASTER              *p_master,
+    MB_TIMESPAN            timeout,
+    MB_ERROR              *p_error
+) {
+    CPU_SR_ALLOC();
+
+    MBMASTER_TRANSACTION  *p_trans;
+    MB_FLAGS               flags;
+
+    CPU_INT08U             slave;
+    void                  *p_request;
+    void                  *p_response;
+    MBMASTER_COMPLETE_CB   cbComplete;
+    void                  *p_completearg;
+    MB_ERROR               postError;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_master' parameter.  */
+    if (p_master == (MBMASTER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'timeout' parameter.  */
+    if (timeout > MBOS_GetMaxTimeValue()) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+#endif
+
+    while (DEF_YES) {
+        /*  Enter critical section.  */
+        CPU_CRITICAL_ENTER();
+
+        /*  Take the slot at the head of the queue.  */
+        p_trans = p_master->queueHead;
+        if (p_trans != (MBMASTER_TRANSACTION*)0) {
+            p_master->queueHead = p_trans->next;
+            if (p_master->queueHead == (MBMASTER_TRANSACTION*)0) {
+                p_master->queueTail = (MBMASTER_TRANSACTION*)0;
+            }
+        }
+
+        /*  Exit critical section.  */
+        CPU_CRITICAL_EXIT();
+
+        if (p_trans != (MBMASTER_TRANSACTION*)0) {
+            break;
+        }
+
+        /*
+         *  Wait for a request to be submitted.
+         * 
+         *  Note(s):
+         *    (1) The flag is set after the slot is queued, so a request that
+         *        is submitted after the queue was seen empty always wakes this
+         *        task up. The flag may also be left over by a request that was
+         *        taken already, in which case the queue is just checked again.
+         */
+        flags = MBMASTER_QUEUEFLAG_SUBMITTED;
+        MBOS_FlagGroupPend(
+            &(p_master->queueEvent),
+            &flags,
+            timeout,
+            (MB_OPT)(MB_FLAGGROUP_OPT_SET_ANY | MB_FLAGGROUP_OPT_CONSUME),
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+    }
+
+    /*  Execute the request.  */
+    MBMaster_Post(
+        p_master,
+        p_trans->slave,
+        p_trans->cmdlet,
+        p_trans->request,
+        p_trans->response,
+        p_trans->responseArg,
+        p_trans->timeout,
+        &postError
+    );
+
+    /*  Save the completion information before the slot is released.  */
+    slave         = p_trans->slave;
+    p_request     = p_trans->request;
+    p_response    = p_trans->response;
+    cbComplete    = p_trans->cbComplete;
+    p_completearg = p_trans->cbCompleteArg;
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  Release the slot.  */
+    p_trans->next = p_master->queueFree;
+    p_master->queueFree = p_trans;
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    /*  Notify the submitter.  */
+    if (cbComplete != (MBMASTER_COMPLETE_CB)0) {
+        cbComplete(
+            slave,
+            p_request,
+            p_response,
+            postError,
+            p_completearg
+        );
+    }
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+#endif  /*  #if (MB_CFG_MASTER_QUEUE_EN == DEF_ENABLED)  */
+
+
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_HealthInitialize()
+*
+* Description : Initialize the slave health tracking of a Modbus master.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) p_slots               Pointer to the first element of the slave health slot storage.
+*               (3) slot_cnt              Count of elements of the slave health slot storage.
+*               (4) threshold             Count of consecutive timeouts that takes a slave offline.
+*               (5) backoff_min           Delay before probing a slave that just went offline (unit: milliseconds).
+*               (6) backoff_max           Maximum delay between two probes of an offline slave (unit: milliseconds).
+*               (7) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' is NULL or 'p_slots' is NULL while 
+*                                                                              'slot_cnt' is not zero.
+*                                             MB_ERROR_UNDERFLOW               'threshold' or 'backoff_min' equals to zero.
+*                                             MB_ERROR_INVALIDPARAMETER        'backoff_min' is greater than 'backoff_max'.
+*                                             MB_ERROR_OVERFLOW                'backoff_max' exceeds maximum allowed value.
+*                                             MB_ERROR_MASTER_STILLBUSY        Master is still busy.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The master must be initialized (by MBMaster_Initialize()) before calling this function.
+*               (2) Each slave that is posted to takes one slot (on its first request), slaves that are posted to
+*                   after all slots are taken are not tracked.
+*               (3) A slave goes offline after 'threshold' consecutive requests to it timed out. Requests to an 
+*                   offline slave fail immediately with a 'MB_ERROR_MASTER_SLAVEOFFLINE' error, except one probe 
+*                   request per backoff delay, which doubles (up to 'backoff_max') each time a probe times out. 
+*                   The slave goes online again as soon as it responds.
+*********************************************************************************************************
+*/
+
+void MBMaster_HealthInitialize(
+    MBMASTER              *p_master,
+    MBMASTER_SLAVEHEALTH  *p_slots,
+    CPU_SIZE_T             slot_cnt,
+    CPU_INT16U             threshold,
+    MB_TIMESPAN            backoff_min,
+    MB_TIMESPAN            backoff_max,
+    MB_ERROR              *p_error
+) {
+    CPU_SR_ALLOC();
+
+    CPU_SIZE_T  cursor;
+    MB_SYSTICK  ticksMin;
+    MB_SYSTICK  ticksMax;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_master' parameter.  */
+    if (p_master == (MBMASTER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_slots' parameter.  */
+    if ((p_slots == (MBMASTER_SLAVEHEALTH*)0) && (slot_cnt != (CPU_SIZE_T)0U)) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'threshold' parameter.  */
+    if (threshold == (CPU_INT16U)0U) {
+        *p_error = MB_ERROR_UNDERFLOW;
+        return;
+    }
+
+    /*  Check 'backoff_min' parameter.  */
+    if (backoff_min == (MB_TIMESPAN)0U) {
+        *p_error = MB_ERROR_UNDERFLOW;
+        return;
+    }
+    if (backoff_min > backoff_max) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+
+    /*  Check 'backoff_max' parameter.  */
+    if (backoff_max > MBOS_GetMaxTimeValue()) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+#endif
+
+    /*  Convert the backoff delays to ticks.  */
+    ticksMin = MBOS_TimeToTickCount(backoff_min, p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return;
+    }
+    ticksMax = MBOS_TimeToTickCount(backoff_max, p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return;
+    }
+
+    /*  Release all slots.  */
+    for (cursor = (CPU_SIZE_T)0U; cursor < slot_cnt; ++cursor) {
+        p_slots[cursor].slave = (CPU_INT08U)0U;
+    }
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  The slots can't be changed while a request is in progress.  */
+    if (p_master->busy) {
+        /*  Exit critical section.  */
+        CPU_CRITICAL_EXIT();
+
+        *p_error = MB_ERROR_MASTER_STILLBUSY;
+        return;
+    }
+
+    /*  Attach the slots.  */
+    p_master->healthSlots = p_slots;
+    p_master->healthSlotCnt = slot_cnt;
+    p_master->healthThreshold = threshold;
+    p_master->healthBackoffMin = ticksMin;
+    p_master->healthBackoffMax = ticksMax;
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_GetSlaveHealth()
+*
+* Description : Get the health statistics of a slave.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) slave                 Slave address.
+*               (3) p_stats               Pointer to the variable that receives the statistics.
+*               (4) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' or 'p_stats' is NULL.
+*                                             MB_ERROR_INVALIDPARAMETER        The slave is not tracked.
+*                                             MB_ERROR_OS_TIME_FAILEDGET       Failed to convert the backoff delay.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBMaster_GetSlaveHealth(
+    MBMASTER                         *p_master,
+    CPU_INT08U                        slave,
+    MBMASTER_SLAVEHEALTH_STATISTICS  *p_stats,
+    MB_ERROR                         *p_error
+) {
+    CPU_SR_ALLOC();
+
+    CPU_SIZE_T  cursor;
+    MB_SYSTICK  ticksBackoff;
+#if (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+    MB_SYSTICK  ticksMean;
+    MB_SYSTICK  ticksDev;
+#endif
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_master' parameter.  */
+    if (p_master == (MBMASTER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_stats' parameter.  */
+    if (p_stats == (MBMASTER_SLAVEHEALTH_STATISTICS*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Broadcast requests are not tracked.  */
+    if (slave == (CPU_INT08U)0U) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  Find the slot of the slave.  */
+    for (cursor = (CPU_SIZE_T)0U; cursor < p_master->healthSlotCnt; ++cursor) {
+        if (p_master->healthSlots[cursor].slave == slave) {
+            break;
+        }
+    }
+    if (cursor >= p_master->healthSlotCnt) {
+        /*  Exit critical section.  */
+        CPU_CRITICAL_EXIT();
+
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+
+    /*  Copy the statistics.  */
+    p_stats->offline = p_master->healthSlots[cursor].offline;
+    p_stats->cntTimeoutConsecutive = p_master->healthSlots[cursor].cntTimeoutConsecutive;
+    p_stats->cntTimeout = p_master->healthSlots[cursor].cntTimeout;
+    p_stats->cntFastFail = p_master->healthSlots[cursor].cntFastFail;
+    p_stats->cntOffline = p_master->healthSlots[cursor].cntOffline;
+    ticksBackoff = p_master->healthSlots[cursor].backoff;
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+    p_stats->cntRetry = p_master->healthSlots[cursor].cntRetry;
+    p_stats->cntGarbled = p_master->healthSlots[cursor].cntGarbled;
+#endif
+#if (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+    ticksMean = (MB_SYSTICK)(p_master->healthSlots[cursor].latencyMean8 >> 3);
+    ticksDev = (MB_SYSTICK)(p_master->healthSlots[cursor].latencyDev4 >> 2);
+#endif
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    /*  Convert the backoff delay.  */
+    if (ticksBackoff != (MB_SYSTICK)0U) {
+        p_stats->backoff = MBOS_TickCountToTime(ticksBackoff, p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+    } else {
+        p_stats->backoff = (MB_TIMESPAN)0U;
+    }
+
+#if (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+    /*  Convert the latency.  */
+    if (ticksMean != (MB_SYSTICK)0U) {
+        p_stats->latencyMean = MBOS_TickCountToTime(ticksMean, p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+    } else {
+        p_stats->latencyMean = (MB_TIMESPAN)0U;
+    }
+    if (ticksDev != (MB_SYSTICK)0U) {
+        p_stats->latencyDev = MBOS_TickCountToTime(ticksDev, p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+    } else {
+        p_stats->latencyDev = (MB_TIMESPAN)0U;
+    }
+#endif
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+#if (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_HealthSetAdaptiveTimeout()
+*
+* Description : Set the adaptive response timeout of a Modbus master.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) k                     Count of latency deviations added to the mean latency (0 to disable the 
+*                                         adaptive timeout).
+*               (3) timeout_min           Minimum timeout (unit: milliseconds).
+*               (4) timeout_max           Maximum timeout (unit: milliseconds).
+*               (5) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' is NULL.
+*                                             MB_ERROR_UNDERFLOW               'timeout_min' equals to zero.
+*                                             MB_ERROR_INVALIDPARAMETER        'timeout_min' is greater than 'timeout_max'.
+*                                             MB_ERROR_OVERFLOW                'timeout_max' exceeds maximum allowed value.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The master keeps the exponentially weighted moving average (gain 1/8) and mean deviation (gain 
+*                   1/4) of the latency of each tracked slave, measured from the end of the transmission of a 
+*                   request to the reception of its response (a timeout counts as a latency of the timeout).
+*               (2) Once a slave has a latency sample, the timeout of requests to it is (mean + k * deviation) 
+*                   bounded to ['timeout_min', 'timeout_max'], instead of the 'timeout' parameter of 
+*                   MBMaster_Post() (which is still used if it is zero, i.e. to wait infinitely).
+*********************************************************************************************************
+*/
+
+void MBMaster_HealthSetAdaptiveTimeout(
+    MBMASTER              *p_master,
+    CPU_INT08U             k,
+    MB_TIMESPAN            timeout_min,
+    MB_TIMESPAN            timeout_max,
+    MB_ERROR              *p_error
+) {
+    CPU_SR_ALLOC();
+
+    MB_SYSTICK  ticksMin;
+    MB_SYSTICK  ticksMax;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_master' parameter.  */
+    if (p_master == (MBMASTER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'timeout_min' parameter.  */
+    if (timeout_min == (MB_TIMESPAN)0U) {
+        *p_error = MB_ERROR_UNDERFLOW;
+        return;
+    }
+    if (timeout_min > timeout_max) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+
+    /*  Check 'timeout_max' parameter.  */
+    if (timeout_max > MBOS_GetMaxTimeValue()) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+#endif
+
+    /*  Convert the bounds to ticks.  */
+    ticksMin = MBOS_TimeToTickCount(timeout_min, p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return;
+    }
+    ticksMax = MBOS_TimeToTickCount(timeout_max, p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return;
+    }
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  Set the adaptive timeout.  */
+    p_master->healthTimeoutK = k;
+    p_master->healthTimeoutMin = ticksMin;
+    p_master->healthTimeoutMax = ticksMax;
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_GetHealthSlot()
+*
+* Description : Get the health slot of a slave (and take a free slot if the slave has no slot).
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) slave                 Slave address (not the broadcast address).
+*
+* Return(s)   : Pointer to the slot (NULL if all slots are taken).
+*
+* Note(s)     : (1) The busy lock must be held by the caller.
+*********************************************************************************************************
+*/
+
+static MBMASTER_SLAVEHEALTH *MBMaster_GetHealthSlot(
+    MBMASTER              *p_master,
+    CPU_INT08U             slave
+) {
+    CPU_SR_ALLOC();
+
+    CPU_SIZE_T             cursor;
+    MBMASTER_SLAVEHEALTH  *p_free;
+
+    p_free = (MBMASTER_SLAVEHEALTH*)0;
+
+    /*  Find the slot of the slave (or the first free slot).  */
+    for (cursor = (CPU_SIZE_T)0U; cursor < p_master->healthSlotCnt; ++cursor) {
+        if (p_master->healthSlots[cursor].slave == slave) {
+            return &(p_master->healthSlots[cursor]);
+        }
+        if (
+            (p_master->healthSlots[cursor].slave == (CPU_INT08U)0U) && 
+            (p_free == (MBMASTER_SLAVEHEALTH*)0)
+        ) {
+            p_free = &(p_master->healthSlots[cursor]);
+        }
+    }
+    if (p_free == (MBMASTER_SLAVEHEALTH*)0) {
+        return (MBMASTER_SLAVEHEALTH*)0;
+    }
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  Take the free slot.  */
+    p_free->offline = DEF_NO;
+    p_free->cntTimeoutConsecutive = (CPU_INT16U)0U;
+    p_free->backoff = (MB_SYSTICK)0U;
+    p_free->probe = (MB_SYSTICK)0U;
+    p_free->cntTimeout = (MB_COUNTERVALUE)0U;
+    p_free->cntFastFail = (MB_COUNTERVALUE)0U;
+    p_free->cntOffline = (MB_COUNTERVALUE)0U;
+#if (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+    p_free->latencyValid = DEF_NO;
+    p_free->latencyMean8 = (MB_SYSTICK)0U;
+    p_free->latencyDev4 = (MB_SYSTICK)0U;
+#endif
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+    p_free->cntRetry = (MB_COUNTERVALUE)0U;
+    p_free->cntGarbled = (MB_COUNTERVALUE)0U;
+#endif
+    p_free->slave = slave;
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    return p_free;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_UpdateHealth()
+*
+* Description : Update the health of a slave with the result of a request transmitted to it.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) p_health              Pointer to the health slot of the slave.
+*               (3) error                 Error code of the request.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The busy lock must be held by the caller.
+*               (2) Any response (even an invalid one) means the slave is online, errors that are not related to
+*                   the slave (e.g. device errors) don't change its health.
+*********************************************************************************************************
+*/
+
+static void MBMaster_UpdateHealth(
+    MBMASTER              *p_master,
+    MBMASTER_SLAVEHEALTH  *p_health,
+    MB_ERROR               error
+) {
+    CPU_SR_ALLOC();
+
+    MB_SYSTICK  ticksNow;
+    MB_ERROR    errorTick;
+
+    switch (error) {
+        case MB_ERROR_TIMEOUT:
+            break;
+        case MB_ERROR_NONE:
+        case MB_ERROR_MASTER_RXTRUNCATED:
+        case MB_ERROR_MASTER_RXINVALIDFNCODE:
+        case MB_ERROR_MASTER_RXINVALIDFORMAT:
+        case MB_ERROR_MASTER_CALLBACKFAILED:
+            /*  The slave responded.  */
+            CPU_CRITICAL_ENTER();
+            p_health->offline = DEF_NO;
+            p_health->cntTimeoutConsecutive = (CPU_INT16U)0U;
+            p_health->backoff = (MB_SYSTICK)0U;
+            CPU_CRITICAL_EXIT();
+            return;
+        default:
+            return;
+    }
+
+    /*  Get current tick count (to schedule the next probe).  */
+    ticksNow = MBOS_GetTickCount(&(errorTick));
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  Count the timeout.  */
+    ++(p_health->cntTimeout);
+    if (p_health->cntTimeoutConsecutive != (CPU_INT16U)0xFFFFU) {
+        ++(p_health->cntTimeoutConsecutive);
+    }
+
+    if (errorTick == MB_ERROR_NONE) {
+        if (p_health->offline) {
+            /*  The probe failed, double the backoff delay.  */
+            if (p_health->backoff > (MB_SYSTICK)(p_master->healthBackoffMax >> 1)) {
+                p_health->backoff = p_master->healthBackoffMax;
+            } else {
+                p_health->backoff <<= 1;
+            }
+            p_health->probe = (MB_SYSTICK)(ticksNow + p_health->backoff);
+        } else if (p_health->cntTimeoutConsecutive >= p_master->healthThreshold) {
+            /*  Take the slave offline.  */
+            p_health->offline = DEF_YES;
+            ++(p_health->cntOffline);
+            p_health->backoff = p_master->healthBackoffMin;
+            p_health->probe = (MB_SYSTICK)(ticksNow + p_health->backoff);
+        }
+    }
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+}
+
+
+#if (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_GetAdaptiveTimeout()
+*
+* Description : Get the timeout (in ticks) of a request to a slave.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) p_health              Pointer to the health slot of the slave.
+*               (3) ticks_default         The timeout used if the adaptive timeout is disabled (or the slave has no
+*                                         latency sample yet).
+*
+* Return(s)   : The timeout.
+*
+* Note(s)     : (1) A timed out request only tells that the latency is longer than the timeout, so the learned
+*                   timeout would grow slowly if the slave became slower. Like the retransmission timer of TCP, the
+*                   timeout is doubled on each consecutive timeout (until the maximum is reached).
+*********************************************************************************************************
+*/
+
+static MB_SYSTICK MBMaster_GetAdaptiveTimeout(
+    MBMASTER              *p_master,
+    MBMASTER_SLAVEHEALTH  *p_health,
+    MB_SYSTICK             ticks_default
+) {
+    CPU_SR_ALLOC();
+
+    MB_SYSTICK  ticksTimeout;
+    CPU_INT16U  cntDouble;
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    if ((p_master->healthTimeoutK == (CPU_INT08U)0U) || (!(p_health->latencyValid))) {
+        /*  Exit critical section.  */
+        CPU_CRITICAL_EXIT();
+
+        return ticks_default;
+    }
+
+    /*  Timeout = mean + k * deviation, bounded to [min, max].  */
+    ticksTimeout = (MB_SYSTICK)((p_health->latencyMean8 >> 3) + (MB_SYSTICK)(p_master->healthTimeoutK) * (p_health->latencyDev4 >> 2));
+    if (ticksTimeout < p_master->healthTimeoutMin) {
+        ticksTimeout = p_master->healthTimeoutMin;
+    }
+
+    /*  Double the timeout on each consecutive timeout (see Note #1).  */
+    for (cntDouble = p_health->cntTimeoutConsecutive; cntDouble != (CPU_INT16U)0U; --cntDouble) {
+        if (ticksTimeout >= p_master->healthTimeoutMax) {
+            break;
+        }
+        ticksTimeout = (MB_SYSTICK)(ticksTimeout << 1);
+    }
+    if (ticksTimeout > p_master->healthTimeoutMax) {
+        ticksTimeout = p_master->healthTimeoutMax;
+    }
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    return ticksTimeout;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_UpdateLatency()
+*
+* Description : Update the latency statistics of a slave with a latency sample.
+*
+* Argument(s) : (1) p_health              Pointer to the health slot of the slave.
+*               (2) ticks_latency         The latency sample (unit: ticks).
+*               (3) censored              DEF_YES if the request timed out ('ticks_latency' is the timeout, the real
+*                                         latency is only known to be longer).
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The mean is kept multiplied by 8 and the deviation is kept multiplied by 4, so that the 1/8 and
+*                   1/4 gains are done with integer arithmetic without losing precision.
+*               (2) A censored sample is dropped until the slave has responded once. Otherwise the timeouts of an
+*                   absent slave would seed the statistics with the timeout of the caller, and the adaptive timeout
+*                   (doubled on each consecutive timeout) would replace it before any latency was learned.
+*********************************************************************************************************
+*/
+
+static void MBMaster_UpdateLatency(
+    MBMASTER_SLAVEHEALTH  *p_health,
+    MB_SYSTICK             ticks_latency,
+    CPU_BOOLEAN            censored
+) {
+    CPU_SR_ALLOC();
+
+    MB_SYSTICK  ticksMean;
+    MB_SYSTICK  ticksDiff;
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    if (!(p_health->latencyValid)) {
+        if (censored) {
+            /*  No latency was learned yet, drop the sample (see Note #2). Exit critical section.  */
+            CPU_CRITICAL_EXIT();
+
+            return;
+        }
+
+        /*  The first sample: mean = sample, deviation = sample / 2.  */
+        p_health->latencyMean8 = (MB_SYSTICK)(ticks_latency << 3);
+        p_health->latencyDev4 = (MB_SYSTICK)(ticks_latency << 1);
+        p_health->latencyValid = DEF_YES;
+    } else {
+        /*  mean += (sample - mean) / 8.  */
+        ticksMean = (MB_SYSTICK)(p_health->latencyMean8 >> 3);
+        if (ticks_latency >= ticksMean) {
+            ticksDiff = (MB_SYSTICK)(ticks_latency - ticksMean);
+            p_health->latencyMean8 += ticksDiff;
+        } else {
+            ticksDiff = (MB_SYSTICK)(ticksMean - ticks_latency);
+            p_health->latencyMean8 -= ticksDiff;
+        }
+
+        /*  deviation += (|sample - mean| - deviation) / 4.  */
+        p_health->latencyDev4 -= (MB_SYSTICK)(p_health->latencyDev4 >> 2);
+        p_health->latencyDev4 += ticksDiff;
+    }
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+}
+
+#endif
+
+#endif  /*  #if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)  */
 
 #endif  /*  #if (MB_CFG_MASTER_EN == DEF_ENABLED)  */
\ No newline at end of file
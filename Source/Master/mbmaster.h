@@ -66,15 +66,124 @@ extern  "C" {
 *********************************************************************************************************
 */
 
+typedef void (*MBMASTER_COMPLETE_CB)(
+    CPU_INT08U     slave,
+    void          *p_request,
+    void          *p_response,
+    MB_ERROR       error,
+    void          *p_arg
+);
+
+#if (MB_CFG_MASTER_QUEUE_EN == DEF_ENABLED)
+typedef struct mbmaster_transaction {
+    struct mbmaster_transaction   *next;
+
+    CPU_INT08U                     slave;
+    MBMASTER_CMDLET               *cmdlet;
+    void                          *request;
+    void                          *response;
+    void                          *responseArg;
+    MB_TIMESPAN                    timeout;
+
+    MBMASTER_COMPLETE_CB           cbComplete;
+    void                          *cbCompleteArg;
+} MBMASTER_TRANSACTION;
+#endif
+
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)
+typedef struct {
+    CPU_INT08U              slave;
+    CPU_BOOLEAN             offline;
+    CPU_INT16U              cntTimeoutConsecutive;
+
+    MB_SYSTICK              backoff;
+    MB_SYSTICK              probe;
+
+    MB_COUNTERVALUE         cntTimeout;
+    MB_COUNTERVALUE         cntFastFail;
+    MB_COUNTERVALUE         cntOffline;
+
+#if (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+    CPU_BOOLEAN             latencyValid;
+    MB_SYSTICK              latencyMean8;
+    MB_SYSTICK              latencyDev4;
+#endif
+
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+    MB_COUNTERVALUE         cntRetry;
+    MB_COUNTERVALUE         cntGarbled;
+#endif
+} MBMASTER_SLAVEHEALTH;
+
 typedef struct {
-    MB_IFINDEX          iface;
+    CPU_BOOLEAN             offline;
+    CPU_INT16U              cntTimeoutConsecutive;
+    MB_TIMESPAN             backoff;
+
+    MB_COUNTERVALUE         cntTimeout;
+    MB_COUNTERVALUE         cntFastFail;
+    MB_COUNTERVALUE         cntOffline;
+
+#if (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+    MB_TIMESPAN             latencyMean;
+    MB_TIMESPAN             latencyDev;
+#endif
+
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+    MB_COUNTERVALUE         cntRetry;
+    MB_COUNTERVALUE         cntGarbled;
+#endif
+} MBMASTER_SLAVEHEALTH_STATISTICS;
+#endif
+
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+typedef struct {
+    MB_COUNTERVALUE         cntRetry;
+    MB_COUNTERVALUE         cntGarbled;
+} MBMASTER_RETRY_STATISTICS;
+#endif
+
+typedef struct {
+    MB_IFINDEX              iface;
+
+    CPU_INT08U             *bufRxTx;
+    CPU_SIZE_T              bufRxTxSize;
+
+    MB_TIMESPAN             dlyTurnAround;
+    CPU_BOOLEAN             turnAroundPending;
+    MB_SYSTICK              turnAroundEnd;
+
+    CPU_BOOLEAN             busy;
 
-    CPU_INT08U         *bufRxTx;
-    CPU_SIZE_T          bufRxTxSize;
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+    CPU_INT08U              retryCnt;
+    MB_TIMESPAN             retryBackoff;
 
-    MB_TIMESPAN         dlyTurnAround;
+    MB_COUNTERVALUE         cntRetry;
+    MB_COUNTERVALUE         cntGarbled;
+#endif
+
+#if (MB_CFG_MASTER_QUEUE_EN == DEF_ENABLED)
+    MBMASTER_TRANSACTION   *queueFree;
+    MBMASTER_TRANSACTION   *queueHead;
+    MBMASTER_TRANSACTION   *queueTail;
+
+    MB_FLAGGROUP            queueEvent;
+#endif
 
-    CPU_BOOLEAN         busy;
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)
+    MBMASTER_SLAVEHEALTH   *healthSlots;
+    CPU_SIZE_T              healthSlotCnt;
+    CPU_INT16U              healthThreshold;
+    MB_SYSTICK              healthBackoffMin;
+    MB_SYSTICK              healthBackoffMax;
+
+#if (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+    CPU_INT08U              healthTimeoutK;
+    MB_SYSTICK              healthTimeoutMin;
+    MB_SYSTICK              healthTimeoutMax;
+#endif
+#endif
 } MBMASTER;
 
 
@@ -129,6 +238,9 @@ void MBMaster_Initialize(
 *                                             MB_ERROR_NULLREFERENCE           'p_master' is NULL.
 *
 * Return(s)   : None.
+*
+* Note(s)     : (1) The turn around delay is the minimum delay between a broadcast request and the next request, it
+*                   is enforced when the next request is transmitted (see MBMaster_Post()).
 *********************************************************************************************************
 */
 
@@ -161,6 +273,82 @@ MB_TIMESPAN  MBMaster_GetTurnAroundDelay(
 );
 
 
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_SetRetryPolicy()
+*
+* Description : Set the retry policy of a Modbus master.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) retry_cnt             Maximum count of retransmissions of one request (0 to disable retry).
+*               (3) backoff               Delay before the first retransmission after a timeout, doubled for each
+*                                         following one (unit: milliseconds, 0 to retransmit immediately).
+*               (4) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' is NULL.
+*                                             MB_ERROR_OVERFLOW                'backoff' exceeds maximum allowed value.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Only requests of idempotent command-lets (whose 'flags' member contains
+*                   MBMASTER_CMDLET_FLAG_IDEMPOTENT) are retransmitted. The built-in read commands (FC01 to FC04)
+*                   are idempotent, other commands (e.g. FC05, FC06 and FC16) are retransmitted only if the
+*                   application posts them with a copy of the command-let descriptor that is marked idempotent:
+*
+*                       MBMASTER_CMDLET  cmdletWriteRegs;
+*
+*                       cmdletWriteRegs = *MBMASTER_CMDLETDESCRIPTOR_WRITEMULTIPLEREGISTERS;
+*                       cmdletWriteRegs.flags |= MBMASTER_CMDLET_FLAG_IDEMPOTENT;
+*
+*               (2) A request is retransmitted if its response timed out (after the backoff delay), or if a
+*                   garbled (dropped) response frame was received (immediately, since the line is idle once the
+*                   frame ended, instead of waiting for the rest of the timeout). Broadcast requests are never
+*                   retransmitted.
+*               (3) Each retransmission waits for the whole timeout again.
+*********************************************************************************************************
+*/
+
+void MBMaster_SetRetryPolicy(
+    MBMASTER            *p_master,
+    CPU_INT08U           retry_cnt,
+    MB_TIMESPAN          backoff,
+    MB_ERROR            *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_GetRetryStatistics()
+*
+* Description : Get the retry statistics of a Modbus master.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) p_stats               Pointer to the variable that receives the statistics.
+*               (3) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' or 'p_stats' is NULL.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The statistics count the retransmissions and the garbled response frames of all slaves, the
+*                   counts of each slave are returned by MBMaster_GetSlaveHealth() (if MB_CFG_MASTER_HEALTH_EN is
+*                   enabled and the slave is tracked).
+*********************************************************************************************************
+*/
+
+void MBMaster_GetRetryStatistics(
+    MBMASTER                   *p_master,
+    MBMASTER_RETRY_STATISTICS  *p_stats,
+    MB_ERROR                   *p_error
+);
+
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                   MBMaster_Post()
@@ -185,6 +373,7 @@ MB_TIMESPAN  MBMaster_GetTurnAroundDelay(
 *                                                                                  (4) 'p_response' is NULL.
 *
 *                                             MB_ERROR_MASTER_STILLBUSY        Master is still busy.
+*                                             MB_ERROR_MASTER_SLAVEOFFLINE     Slave is offline (see MBMaster_HealthInitialize()).
 *                                             MB_ERROR_MASTER_TXBADREQUEST     Bad request parameter.
 *                                             MB_ERROR_MASTER_TXBUFFERLOW      Data buffer is too small.
 *                                             MB_ERROR_MASTER_RXTRUNCATED      Frame data is truncated.
@@ -201,7 +390,7 @@ MB_TIMESPAN  MBMaster_GetTurnAroundDelay(
 *                                             MB_ERROR_OS_FGRP_FAILEDPEND      Failed to pend on a flag group object.
 *                                             MB_ERROR_OS_FGRP_FAILEDPOST      Failed to post to a flag group object.
 *                                             MB_ERROR_OS_MUTEX_FAILEDPEND     Failed to pend on a mutex object.
-*                                             MB_ERROR_OS_TIMER_FAILEDCREATE   Failed to create timer object.
+*                                             MB_ERROR_OS_TIMER_FAILEDSET      Failed to set a timer object.
 *                                             MB_ERROR_OS_TIMER_FAILEDSTART    Failed to start a timer object.
 *                                             MB_ERROR_OS_TIME_FAILEDDELAY     Failed to delay.
 *                                             MB_ERROR_OS_TIME_FAILEDGET       Failed to get system tick count.
@@ -212,6 +401,13 @@ MB_TIMESPAN  MBMaster_GetTurnAroundDelay(
 *               (2) 'p_response' must point to a valid command-let response (MBMASTER_CMDLET_*_RESPONSE) object.
 *               (3) Multi-thread(task)/nesting posting is not allowed. If you do that, a 'MB_ERROR_MASTER_STILLBUSY' error would 
 *                   be thrown.
+*               (4) To share one master between multiple tasks, enable MB_CFG_MASTER_QUEUE_EN and use MBMaster_Submit() 
+*                   instead.
+*               (5) A broadcast request returns as soon as it was transmitted, the turn around delay is waited (if 
+*                   not elapsed yet) before the next request frame is transmitted, so the application can prepare 
+*                   the next request meanwhile.
+*               (6) If MB_CFG_MASTER_RETRY_EN is enabled, idempotent requests may be retransmitted (see
+*                   MBMaster_SetRetryPolicy()), the error code is the one of the last transmission.
 *********************************************************************************************************
 */
 
@@ -227,6 +423,285 @@ void MBMaster_Post(
 );
 
 
+#if (MB_CFG_MASTER_QUEUE_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_QueueInitialize()
+*
+* Description : Initialize the transaction queue of a Modbus master.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) p_slots               Pointer to the first element of the transaction slot storage.
+*               (3) slot_cnt              Count of elements of the transaction slot storage.
+*               (4) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' is NULL or 'p_slots' is NULL while 
+*                                                                              'slot_cnt' is not zero.
+*                                             MB_ERROR_OS_FGRP_FAILEDCREATE    Failed to create a flag group object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The master must be initialized (by MBMaster_Initialize()) before calling this function.
+*               (2) At most 'slot_cnt' requests can be queued at the same time, the slot storage must not be 
+*                   accessed by the application until MBMaster_QueueDispose() is called.
+*********************************************************************************************************
+*/
+
+void MBMaster_QueueInitialize(
+    MBMASTER              *p_master,
+    MBMASTER_TRANSACTION  *p_slots,
+    CPU_SIZE_T             slot_cnt,
+    MB_ERROR              *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_QueueDispose()
+*
+* Description : Dispose the transaction queue of a Modbus master.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' is NULL.
+*                                             MB_ERROR_OS_FGRP_FAILEDDISPOSE   Failed to dispose a flag group object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The task that services the queue must be stopped before calling this function, requests 
+*                   that are still queued are dropped without calling their completion callbacks.
+*********************************************************************************************************
+*/
+
+void MBMaster_QueueDispose(
+    MBMASTER              *p_master,
+    MB_ERROR              *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_Submit()
+*
+* Description : Submit a Modbus request to the transaction queue of a Modbus master.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) slave                 Slave address.
+*               (3) p_cmdlet              Pointer to the command-let object.
+*               (4) p_request             Pointer to the request object.
+*               (5) p_response            Pointer to the response object.
+*               (6) p_responsearg         'p_arg' parameter passed to response callbacks.
+*               (7) timeout               Timeout for receiving the response frame from the slave (unit: milliseconds, 0 to wait infinitely).
+*               (8) cb_complete           Completion callback (NULL if not used).
+*               (9) p_completearg         'p_arg' parameter passed to the completion callback.
+*               (10) p_error              Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           One of following conditions occurred:
+*
+*                                                                                  (1) 'p_master' is NULL.
+*                                                                                  (2) 'p_cmdlet' is NULL.
+*                                                                                  (3) 'p_request' is NULL.
+*                                                                                  (4) 'p_response' is NULL.
+*
+*                                             MB_ERROR_OVERFLOW                'timeout' parameter exceeds maximum allowed value.
+*                                             MB_ERROR_MASTER_QUEUEFULL        No free transaction slot.
+*                                             MB_ERROR_OS_FGRP_FAILEDPOST      Failed to post to a flag group object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) This function doesn't wait for the request to be done, so it can be called by multiple 
+*                   tasks at the same time. Requests are executed in the order they are submitted.
+*               (2) The request object, the response object and the response callback argument must be kept 
+*                   valid until the completion callback is called.
+*               (3) The completion callback is called (by the task that services the queue) with the error code 
+*                   that MBMaster_Post() returned for the request. The transaction slot is released before the 
+*                   callback is called, so the callback may submit another request.
+*********************************************************************************************************
+*/
+
+void MBMaster_Submit(
+    MBMASTER              *p_master,
+    CPU_INT08U             slave,
+    MBMASTER_CMDLET       *p_cmdlet,
+    void                  *p_request,
+    void                  *p_response,
+    void                  *p_responsearg,
+    MB_TIMESPAN            timeout,
+    MBMASTER_COMPLETE_CB   cb_complete,
+    void                  *p_completearg,
+    MB_ERROR              *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_ServiceQueue()
+*
+* Description : Wait for a queued request of a Modbus master and execute it.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) timeout               Timeout of waiting for a queued request (unit: milliseconds, 0 to wait infinitely).
+*               (3) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' is NULL.
+*                                             MB_ERROR_OVERFLOW                'timeout' parameter exceeds maximum allowed value.
+*                                             MB_ERROR_TIMEOUT                 No request was queued before the timeout limit exceeds.
+*                                             MB_ERROR_OS_FGRP_FAILEDPEND      Failed to pend on a flag group object.
+*                                             MB_ERROR_OS_FGRP_FAILEDRDYFLAGS  Failed to get the flags that make current task 
+*                                                                              ready-to-run.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) One request is executed per call, the error of the request itself is reported to its 
+*                   completion callback (not to 'p_error').
+*               (2) Only one task is allowed to service the queue of a master, typically:
+*
+*                       while (DEF_YES) {
+*                           MBMaster_ServiceQueue(&master, (MB_TIMESPAN)0U, &error);
+*                       }
+*
+*               (3) MBMaster_Post() must not be called on a master whose queue is being serviced, otherwise 
+*                   queued requests may fail with a 'MB_ERROR_MASTER_STILLBUSY' error.
+*********************************************************************************************************
+*/
+
+void MBMaster_ServiceQueue(
+    MBMASTER              *p_master,
+    MB_TIMESPAN            timeout,
+    MB_ERROR              *p_error
+);
+
+#endif  /*  #if (MB_CFG_MASTER_QUEUE_EN == DEF_ENABLED)  */
+
+
+#if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_HealthInitialize()
+*
+* Description : Initialize the slave health tracking of a Modbus master.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) p_slots               Pointer to the first element of the slave health slot storage.
+*               (3) slot_cnt              Count of elements of the slave health slot storage.
+*               (4) threshold             Count of consecutive timeouts that takes a slave offline.
+*               (5) backoff_min           Delay before probing a slave that just went offline (unit: milliseconds).
+*               (6) backoff_max           Maximum delay between two probes of an offline slave (unit: milliseconds).
+*               (7) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' is NULL or 'p_slots' is NULL while 
+*                                                                              'slot_cnt' is not zero.
+*                                             MB_ERROR_UNDERFLOW               'threshold' or 'backoff_min' equals to zero.
+*                                             MB_ERROR_INVALIDPARAMETER        'backoff_min' is greater than 'backoff_max'.
+*                                             MB_ERROR_OVERFLOW                'backoff_max' exceeds maximum allowed value.
+*                                             MB_ERROR_MASTER_STILLBUSY        Master is still busy.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The master must be initialized (by MBMaster_Initialize()) before calling this function.
+*               (2) Each slave that is posted to takes one slot (on its first request), slaves that are posted to
+*                   after all slots are taken are not tracked.
+*               (3) A slave goes offline after 'threshold' consecutive requests to it timed out. Requests to an 
+*                   offline slave fail immediately with a 'MB_ERROR_MASTER_SLAVEOFFLINE' error, except one probe 
+*                   request per backoff delay, which doubles (up to 'backoff_max') each time a probe times out. 
+*                   The slave goes online again as soon as it responds.
+*********************************************************************************************************
+*/
+
+void MBMaster_HealthInitialize(
+    MBMASTER              *p_master,
+    MBMASTER_SLAVEHEALTH  *p_slots,
+    CPU_SIZE_T             slot_cnt,
+    CPU_INT16U             threshold,
+    MB_TIMESPAN            backoff_min,
+    MB_TIMESPAN            backoff_max,
+    MB_ERROR              *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_GetSlaveHealth()
+*
+* Description : Get the health statistics of a slave.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) slave                 Slave address.
+*               (3) p_stats               Pointer to the variable that receives the statistics.
+*               (4) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' or 'p_stats' is NULL.
+*                                             MB_ERROR_INVALIDPARAMETER        The slave is not tracked.
+*                                             MB_ERROR_OS_TIME_FAILEDGET       Failed to convert the backoff delay.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBMaster_GetSlaveHealth(
+    MBMASTER                         *p_master,
+    CPU_INT08U                        slave,
+    MBMASTER_SLAVEHEALTH_STATISTICS  *p_stats,
+    MB_ERROR                         *p_error
+);
+
+
+#if (MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                   MBMaster_HealthSetAdaptiveTimeout()
+*
+* Description : Set the adaptive response timeout of a Modbus master.
+*
+* Argument(s) : (1) p_master              Pointer to the master object.
+*               (2) k                     Count of latency deviations added to the mean latency (0 to disable the 
+*                                         adaptive timeout).
+*               (3) timeout_min           Minimum timeout (unit: milliseconds).
+*               (4) timeout_max           Maximum timeout (unit: milliseconds).
+*               (5) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           'p_master' is NULL.
+*                                             MB_ERROR_UNDERFLOW               'timeout_min' equals to zero.
+*                                             MB_ERROR_INVALIDPARAMETER        'timeout_min' is greater than 'timeout_max'.
+*                                             MB_ERROR_OVERFLOW                'timeout_max' exceeds maximum allowed value.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The master keeps the exponentially weighted moving average (gain 1/8) and mean deviation (gain 
+*                   1/4) of the latency of each tracked slave, measured from the end of the transmission of a 
+*                   request to the reception of its response (a timeout counts as a latency of the timeout).
+*               (2) Once a slave has a latency sample, the timeout of requests to it is (mean + k * deviation) 
+*                   bounded to ['timeout_min', 'timeout_max'], instead of the 'timeout' parameter of 
+*                   MBMaster_Post() (which is still used if it is zero, i.e. to wait infinitely).
+*               (3) The timeout is doubled on each consecutive timeout of the slave (up to 'timeout_max'), so a
+*                   slave that became slower is not taken offline before the mean catches up.
+*********************************************************************************************************
+*/
+
+void MBMaster_HealthSetAdaptiveTimeout(
+    MBMASTER              *p_master,
+    CPU_INT08U             k,
+    MB_TIMESPAN            timeout_min,
+    MB_TIMESPAN            timeout_max,
+    MB_ERROR              *p_error
+);
+
+#endif
+
+#endif  /*  #if (MB_CFG_MASTER_HEALTH_EN == DEF_ENABLED)  */
+
+
 #ifdef __cplusplus
 }
 #endif
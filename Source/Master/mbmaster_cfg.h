@@ -88,6 +88,42 @@
 #define MB_CFG_MASTER_BUILTIN_CMDLET_RWMULTIPLEREGS          DEF_DISABLED
 #endif
 
+#ifndef MB_CFG_MASTER_BLOCKRESPONSE_EN
+#define MB_CFG_MASTER_BLOCKRESPONSE_EN                       DEF_DISABLED
+#endif
+
+#ifndef MB_CFG_MASTER_QUEUE_EN
+#define MB_CFG_MASTER_QUEUE_EN                               DEF_DISABLED
+#endif
+
+#ifndef MB_CFG_MASTER_HEALTH_EN
+#define MB_CFG_MASTER_HEALTH_EN                              DEF_DISABLED
+#endif
+
+#ifndef MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN
+#define MB_CFG_MASTER_HEALTH_ADAPTIVETIMEOUT_EN              DEF_DISABLED
+#endif
+
+#ifndef MB_CFG_MASTER_SCHED_EN
+#define MB_CFG_MASTER_SCHED_EN                               DEF_DISABLED
+#endif
+
+#ifndef MB_CFG_MASTER_SCHED_COALESCE_EN
+#define MB_CFG_MASTER_SCHED_COALESCE_EN                      DEF_DISABLED
+#endif
+
+#ifndef MB_CFG_MASTER_SCHED_COALESCE_MAX
+#define MB_CFG_MASTER_SCHED_COALESCE_MAX                               8U
+#endif
+
+#ifndef MB_CFG_MASTER_GROUP_EN
+#define MB_CFG_MASTER_GROUP_EN                               DEF_DISABLED
+#endif
+
+#ifndef MB_CFG_MASTER_RETRY_EN
+#define MB_CFG_MASTER_RETRY_EN                               DEF_DISABLED
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -95,6 +131,10 @@
 *********************************************************************************************************
 */
 
+#if (MB_CFG_MASTER_GROUP_EN == DEF_ENABLED) && (MB_CFG_MASTER_QUEUE_EN != DEF_ENABLED)
+#error  "MB_CFG_MASTER_GROUP_EN requires MB_CFG_MASTER_QUEUE_EN to be enabled."
+#endif
+
 
 /*
 *********************************************************************************************************
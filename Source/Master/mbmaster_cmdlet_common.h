@@ -29,6 +29,8 @@
 *********************************************************************************************************
 */
 
+#include <mbmaster_cfg.h>
+
 #include <mb_types.h>
 
 #include <cpu.h>
@@ -41,6 +43,18 @@ extern  "C" {
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+/*  Command-let flag: the request can be retransmitted safely (see MBMaster_SetRetryPolicy()).  */
+#define MBMASTER_CMDLET_FLAG_IDEMPOTENT            ((CPU_INT08U)0x01U)
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          TYPE DEFINITIONS
@@ -70,6 +84,14 @@ typedef void (*MBMASTER_COILVALUE_END_CB)(
     MB_ERROR      *p_error
 );
 
+typedef void (*MBMASTER_COILVALUE_BLOCK_CB)(
+    CPU_INT16U         coilStartAddress,
+    CPU_INT16U         coilQuantity,
+    const CPU_INT08U  *p_coilValues,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
 typedef void (*MBMASTER_COILWRITTEN_CB)(
     CPU_INT16U     coilAddress,
     CPU_BOOLEAN    coilValue,
@@ -101,6 +123,14 @@ typedef void (*MBMASTER_DISCRETEINPUTVALUE_END_CB)(
     MB_ERROR      *p_error
 );
 
+typedef void (*MBMASTER_DISCRETEINPUTVALUE_BLOCK_CB)(
+    CPU_INT16U         dciStartAddress,
+    CPU_INT16U         dciQuantity,
+    const CPU_INT08U  *p_dciValues,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
 typedef void (*MBMASTER_HREGVALUE_START_CB)(
     void          *p_arg,
     MB_ERROR      *p_error
@@ -118,6 +148,14 @@ typedef void (*MBMASTER_HREGVALUE_END_CB)(
     MB_ERROR      *p_error
 );
 
+typedef void (*MBMASTER_HREGVALUE_BLOCK_CB)(
+    CPU_INT16U         hregStartAddress,
+    CPU_INT16U         hregQuantity,
+    const CPU_INT16U  *p_hregValues,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
 typedef void (*MBMASTER_HREGWRITTEN_CB)(
     CPU_INT16U     hregAddress,
     CPU_INT16U     hregValue,
@@ -157,6 +195,14 @@ typedef void (*MBMASTER_IREGVALUE_END_CB)(
     MB_ERROR      *p_error
 );
 
+typedef void (*MBMASTER_IREGVALUE_BLOCK_CB)(
+    CPU_INT16U         iregStartAddress,
+    CPU_INT16U         iregQuantity,
+    const CPU_INT16U  *p_iregValues,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
 typedef void (*MBMASTER_CMDLET_REQUESTHANDLER)(
     CPU_INT08U   slave,
     void        *p_request,
@@ -178,6 +224,9 @@ typedef void (*MBMASTER_CMDLET_RESPONSEHANDLER)(
 typedef struct {
     MBMASTER_CMDLET_REQUESTHANDLER    cbRequestHandler;
     MBMASTER_CMDLET_RESPONSEHANDLER   cbResponseHandler;
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+    CPU_INT08U                        flags;
+#endif
 } MBMASTER_CMDLET;
 
 
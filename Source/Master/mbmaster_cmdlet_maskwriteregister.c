@@ -111,7 +111,7 @@ MBMASTER_CMDLET  g_MBMaster_CmdLet_FC16 = {
 *
 * Return(s)   : None.
 *
-* Note(s)     : (1) Interrupts are assumed to be disabled when calling this function.
+* Note(s)     : (1) Interrupts are enabled when calling this function (the master data buffer is protected by the busy lock).
 *               (2) 'p_request' must points to a 'MBMASTER_CMDLET_MASKWRITEREGISTER_REQUEST' object.
 *********************************************************************************************************
 */
@@ -254,7 +254,7 @@ static void MBMaster_CmdLet_FC16_ReqHdl(
 *
 * Return(s)   : None.
 *
-* Note(s)     : (1) Interrupts are assumed to be disabled when calling this function.
+* Note(s)     : (1) Interrupts are enabled when calling this function (the master data buffer is protected by the busy lock).
 *               (2) 'p_request' must point to a 'MBMASTER_CMDLET_MASKWRITEREGISTER_REQUEST' object.
 *               (3) 'p_response' must point to a 'MBMASTER_CMDLET_MASKWRITEREGISTER_RESPONSE' object.
 *********************************************************************************************************
@@ -67,6 +67,14 @@ typedef struct {
     MBMASTER_COILVALUE_END_CB       cbCoilValueEnd;
 } MBMASTER_CMDLET_READCOILS_RESPONSE;
 
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+typedef struct {
+    MBMASTER_EXCEPTION_CB           cbException;
+
+    MBMASTER_COILVALUE_BLOCK_CB     cbCoilValueBlock;
+} MBMASTER_CMDLET_READCOILS_BLOCKRESPONSE;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -76,10 +84,17 @@ typedef struct {
 
 #ifndef MBMASTER_CMDLET_READCOILS_SOURCE
 extern MBMASTER_CMDLET                                   g_MBMaster_CmdLet_FC01;
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+extern MBMASTER_CMDLET                                   g_MBMaster_CmdLet_FC01_Block;
+#endif
 #endif
 
 #define MBMASTER_CMDLETDESCRIPTOR_READCOILS          (&(g_MBMaster_CmdLet_FC01))
 
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+#define MBMASTER_CMDLETDESCRIPTOR_READCOILS_BLOCK    (&(g_MBMaster_CmdLet_FC01_Block))
+#endif
+
 
 #ifdef __cplusplus
 }
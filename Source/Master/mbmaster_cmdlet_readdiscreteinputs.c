@@ -73,6 +73,17 @@ static void MBMaster_CmdLet_FC02_ResHdl(
     MB_ERROR    *p_error
 );
 
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+static void MBMaster_CmdLet_FC02_BlockResHdl(
+    CPU_INT08U   slave,
+    void        *p_request,
+    void        *p_response,
+    void        *p_responsearg,
+    MB_FRAME    *p_frame,
+    MB_ERROR    *p_error
+);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -82,9 +93,22 @@ static void MBMaster_CmdLet_FC02_ResHdl(
 
 MBMASTER_CMDLET  g_MBMaster_CmdLet_FC02 = {
     .cbRequestHandler = MBMaster_CmdLet_FC02_ReqHdl,
-    .cbResponseHandler = MBMaster_CmdLet_FC02_ResHdl
+    .cbResponseHandler = MBMaster_CmdLet_FC02_ResHdl,
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+    .flags = MBMASTER_CMDLET_FLAG_IDEMPOTENT
+#endif
 };
 
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+MBMASTER_CMDLET  g_MBMaster_CmdLet_FC02_Block = {
+    .cbRequestHandler = MBMaster_CmdLet_FC02_ReqHdl,
+    .cbResponseHandler = MBMaster_CmdLet_FC02_BlockResHdl,
+#if (MB_CFG_MASTER_RETRY_EN == DEF_ENABLED)
+    .flags = MBMASTER_CMDLET_FLAG_IDEMPOTENT
+#endif
+};
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -111,7 +135,7 @@ MBMASTER_CMDLET  g_MBMaster_CmdLet_FC02 = {
 *
 * Return(s)   : None.
 *
-* Note(s)     : (1) Interrupts are assumed to be disabled when calling this function.
+* Note(s)     : (1) Interrupts are enabled when calling this function (the master data buffer is protected by the busy lock).
 *               (2) 'p_request' must points to a 'MBMASTER_CMDLET_READDISCRETEINPUTS_REQUEST' object.
 *********************************************************************************************************
 */
@@ -246,7 +270,7 @@ static void MBMaster_CmdLet_FC02_ReqHdl(
 *
 * Return(s)   : None.
 *
-* Note(s)     : (1) Interrupts are assumed to be disabled when calling this function.
+* Note(s)     : (1) Interrupts are enabled when calling this function (the master data buffer is protected by the busy lock).
 *               (2) 'p_request' must point to a 'MBMASTER_CMDLET_READDISCRETEINPUTS_REQUEST' object.
 *               (3) 'p_response' must point to a 'MBMASTER_CMDLET_READDISCRETEINPUTS_RESPONSE' object.
 *********************************************************************************************************
@@ -474,4 +498,199 @@ static void MBMaster_CmdLet_FC02_ResHdl(
     }
 }
 
+
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                  MBMaster_CmdLet_FC02_BlockResHdl()
+*
+* Description : Handle response frame of "Read Discrete Inputs (0x02)" command (and pass all values in one callback).
+*
+* Argument(s) : (1) slave                 Slave address.
+*               (2) p_request             Pointer to the request object.
+*               (2) p_response            Pointer to the response object.
+*               (3) p_responsearg         'p_arg' parameter passed to response callbacks.
+*               (4) p_frame               Pointer to the variable that receives the request frame.
+*               (5) p_error               Pointer to the variable that receives error code from this function:
+*
+*                                             MB_ERROR_NONE                    No error occurred.
+*                                             MB_ERROR_NULLREFERENCE           One of following conditions occurred:
+*
+*                                                                                  (1) 'p_request' is NULL.
+*                                                                                  (2) 'p_response' is NULL.
+*                                                                                  (3) 'p_frame' is NULL.
+*
+*                                             MB_ERROR_MASTER_RXINVALIDSLAVE   Frame is not from the expected slave.
+*                                             MB_ERROR_MASTER_RXTRUNCATED      Frame data is truncated.
+*                                             MB_ERROR_MASTER_RXINVALIDFORMAT  Frame data contains invalid format (or value).
+*                                             MB_ERROR_MASTER_CALLBACKFAILED   Error occurred while calling external callbacks.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are enabled when calling this function (the master data buffer is protected by the busy lock).
+*               (2) 'p_request' must point to a 'MBMASTER_CMDLET_READDISCRETEINPUTS_REQUEST' object.
+*               (3) 'p_response' must point to a 'MBMASTER_CMDLET_READDISCRETEINPUTS_BLOCKRESPONSE' object.
+*               (4) The callback receives the packed discrete input status bytes (the first discrete input
+*                   is in the least significant bit of the first byte), which are in the master data buffer and
+*                   are only valid until the callback returns.
+*********************************************************************************************************
+*/
+
+static void MBMaster_CmdLet_FC02_BlockResHdl(
+    CPU_INT08U   slave,
+    void        *p_request,
+    void        *p_response,
+    void        *p_responsearg,
+    MB_FRAME    *p_frame,
+    MB_ERROR    *p_error
+) {
+    MB_BUFFERFETCHER                                    fetcher;
+
+    MBMASTER_CMDLET_READDISCRETEINPUTS_REQUEST         *request;
+    MBMASTER_CMDLET_READDISCRETEINPUTS_BLOCKRESPONSE   *response;
+
+    CPU_INT16U                                          byteCountExpected;
+    CPU_INT08U                                          byteCountActual;
+
+    CPU_INT08U                                         *discreteInputValues;
+
+    CPU_INT08U                                          ec;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_request' parameter.  */
+    if (p_request == (void*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_response' parameter.  */
+    if (p_response == (void*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_frame' parameter.  */
+    if (p_frame == (MB_FRAME*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Check whether the response frame is coming from the expected slave.  */
+    if (slave != p_frame->address) {
+        *p_error = MB_ERROR_MASTER_RXINVALIDSLAVE;
+        return;
+    }
+
+    /*  No error by default.  */
+    *p_error = MB_ERROR_NONE;
+
+    /*  Type cast.  */
+    request  = (MBMASTER_CMDLET_READDISCRETEINPUTS_REQUEST*)p_request;
+    response = (MBMASTER_CMDLET_READDISCRETEINPUTS_BLOCKRESPONSE*)p_response;
+
+    /*  Initialize the fetcher.  */
+    MBBufFetcher_Initialize(
+        &(fetcher),
+        p_frame->data,
+        p_frame->dataLength,
+        p_error
+    );
+    if (*p_error != MB_ERROR_NONE) {
+        return;
+    }
+
+    if (p_frame->functionCode == MB_FNCODE_READDISCRETEINPUTS) {
+        /*  Get the expected byte count.  */
+        byteCountExpected = request->discreteInputQuantity;
+        --(byteCountExpected);
+        byteCountExpected /= (CPU_INT16U)8U;
+        ++(byteCountExpected);
+
+        /*  Read the actual byte count.  */
+        byteCountActual = MBBufFetcher_ReadUInt8(
+            &(fetcher),
+            p_error
+        );
+        switch (*p_error) {
+            case MB_ERROR_NONE:
+                break;
+            case MB_ERROR_BUFFETCHER_BUFFEREND:
+                *p_error = MB_ERROR_MASTER_RXTRUNCATED;
+            default:
+                return;
+        }
+
+        /*  Check whether the actual byte count is equal to the expected value.  */
+        if (byteCountExpected != (CPU_INT16U)byteCountActual) {
+            *p_error = MB_ERROR_MASTER_RXINVALIDFORMAT;
+            return;
+        }
+
+        /*  Get all discrete input status bytes (without copying them).  */
+        discreteInputValues = MBBufFetcher_ReadBlock(
+            &(fetcher),
+            (CPU_SIZE_T)byteCountActual,
+            p_error
+        );
+        switch (*p_error) {
+            case MB_ERROR_NONE:
+                break;
+            case MB_ERROR_BUFFETCHER_BUFFEREND:
+                *p_error = MB_ERROR_MASTER_RXTRUNCATED;
+            default:
+                return;
+        }
+
+        /*  Clear the unused bits of the last status byte.  */
+        if ((request->discreteInputQuantity & (CPU_INT16U)0x0007U) != (CPU_INT16U)0U) {
+            discreteInputValues[byteCountActual - (CPU_INT08U)1U] &= (CPU_INT08U)(((CPU_INT08U)1U << (CPU_INT08U)(request->discreteInputQuantity & (CPU_INT16U)0x0007U)) - (CPU_INT08U)1U);
+        }
+
+        /*  Invoke the callback.  */
+        if (response->cbDiscreteInputValueBlock != (MBMASTER_DISCRETEINPUTVALUE_BLOCK_CB)0) {
+            response->cbDiscreteInputValueBlock(
+                request->discreteInputStartAddress,
+                request->discreteInputQuantity,
+                (const CPU_INT08U*)discreteInputValues,
+                p_responsearg,
+                p_error
+            );
+            if (*p_error != MB_ERROR_NONE) {
+                *p_error = MB_ERROR_MASTER_CALLBACKFAILED;
+                return;
+            }
+        }
+    } else if (p_frame->functionCode == (CPU_INT08U)(MB_FNCODE_READDISCRETEINPUTS + (CPU_INT08U)0x80U)) {
+        /*  Read the exception code.  */
+        ec = MBBufFetcher_ReadUInt8(
+            &(fetcher),
+            p_error
+        );
+        switch (*p_error) {
+            case MB_ERROR_NONE:
+                break;
+            case MB_ERROR_BUFFETCHER_BUFFEREND:
+                *p_error = MB_ERROR_MASTER_RXTRUNCATED;
+            default:
+                return;
+        }
+
+        /*  Notify upper application the exception code.  */
+        if (response->cbException != (MBMASTER_EXCEPTION_CB)0) {
+            response->cbException(ec, p_responsearg, p_error);
+            if (*p_error != MB_ERROR_NONE) {
+                *p_error = MB_ERROR_MASTER_CALLBACKFAILED;
+                return;
+            }
+        }
+    } else {
+        *p_error = MB_ERROR_MASTER_RXINVALIDFNCODE;
+        return;
+    }
+}
+
+#endif
+
 #endif  /*  #if (MB_CFG_MASTER_EN == DEF_ENABLED) && (MB_CFG_MASTER_BUILTIN_CMDLET_READDISCRETEINPUTS_EN == DEF_ENABLED)  */
\ No newline at end of file
@@ -67,6 +67,14 @@ typedef struct {
     MBMASTER_DISCRETEINPUTVALUE_END_CB           cbDiscreteInputValueEnd;
 } MBMASTER_CMDLET_READDISCRETEINPUTS_RESPONSE;
 
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+typedef struct {
+    MBMASTER_EXCEPTION_CB                        cbException;
+
+    MBMASTER_DISCRETEINPUTVALUE_BLOCK_CB         cbDiscreteInputValueBlock;
+} MBMASTER_CMDLET_READDISCRETEINPUTS_BLOCKRESPONSE;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -76,10 +84,17 @@ typedef struct {
 
 #ifndef MBMASTER_CMDLET_READDISCRETEINPUTS_SOURCE
 extern MBMASTER_CMDLET                                       g_MBMaster_CmdLet_FC02;
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+extern MBMASTER_CMDLET                                       g_MBMaster_CmdLet_FC02_Block;
+#endif
 #endif
 
 #define MBMASTER_CMDLETDESCRIPTOR_READDISCRETEINPUTS     (&(g_MBMaster_CmdLet_FC02))
 
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+#define MBMASTER_CMDLETDESCRIPTOR_READDISCRETEINPUTS_BLOCK (&(g_MBMaster_CmdLet_FC02_Block))
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -67,6 +67,14 @@ typedef struct {
     MBMASTER_HREGVALUE_END_CB         cbHRegValueEnd;
 } MBMASTER_CMDLET_READHOLDINGREGISTERS_RESPONSE;
 
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+typedef struct {
+    MBMASTER_EXCEPTION_CB             cbException;
+
+    MBMASTER_HREGVALUE_BLOCK_CB       cbHRegValueBlock;
+} MBMASTER_CMDLET_READHOLDINGREGISTERS_BLOCKRESPONSE;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -76,10 +84,17 @@ typedef struct {
 
 #ifndef MBMASTER_CMDLET_READHREGS_SOURCE
 extern MBMASTER_CMDLET                                       g_MBMaster_CmdLet_FC03;
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+extern MBMASTER_CMDLET                                       g_MBMaster_CmdLet_FC03_Block;
+#endif
 #endif
 
 #define MBMASTER_CMDLETDESCRIPTOR_READHOLDINGREGISTERS   (&(g_MBMaster_CmdLet_FC03))
 
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+#define MBMASTER_CMDLETDESCRIPTOR_READHOLDINGREGISTERS_BLOCK (&(g_MBMaster_CmdLet_FC03_Block))
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -67,6 +67,14 @@ typedef struct {
     MBMASTER_IREGVALUE_END_CB         cbIRegValueEnd;
 } MBMASTER_CMDLET_READINPUTREGISTERS_RESPONSE;
 
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+typedef struct {
+    MBMASTER_EXCEPTION_CB             cbException;
+
+    MBMASTER_IREGVALUE_BLOCK_CB       cbIRegValueBlock;
+} MBMASTER_CMDLET_READINPUTREGISTERS_BLOCKRESPONSE;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -76,10 +84,17 @@ typedef struct {
 
 #ifndef MBMASTER_CMDLET_READIREGS_SOURCE
 extern MBMASTER_CMDLET                                       g_MBMaster_CmdLet_FC04;
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+extern MBMASTER_CMDLET                                       g_MBMaster_CmdLet_FC04_Block;
+#endif
 #endif
 
 #define MBMASTER_CMDLETDESCRIPTOR_READINPUTREGISTERS     (&(g_MBMaster_CmdLet_FC04))
 
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+#define MBMASTER_CMDLETDESCRIPTOR_READINPUTREGISTERS_BLOCK (&(g_MBMaster_CmdLet_FC04_Block))
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -70,6 +70,14 @@ typedef struct {
     MBMASTER_HREGVALUE_END_CB         cbHRegValueEnd;
 } MBMASTER_CMDLET_RWMULTIPLEREGISTERS_RESPONSE;
 
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+typedef struct {
+    MBMASTER_EXCEPTION_CB             cbException;
+
+    MBMASTER_HREGVALUE_BLOCK_CB       cbHRegValueBlock;
+} MBMASTER_CMDLET_RWMULTIPLEREGISTERS_BLOCKRESPONSE;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -79,10 +87,17 @@ typedef struct {
 
 #ifndef MBMASTER_CMDLET_RWHREGS_SOURCE
 extern MBMASTER_CMDLET                                      g_MBMaster_CmdLet_FC17;
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+extern MBMASTER_CMDLET                                      g_MBMaster_CmdLet_FC17_Block;
+#endif
 #endif
 
 #define MBMASTER_CMDLETDESCRIPTOR_RWMULTIPLEREGISTERS   (&(g_MBMaster_CmdLet_FC17))
 
+#if (MB_CFG_MASTER_BLOCKRESPONSE_EN == DEF_ENABLED)
+#define MBMASTER_CMDLETDESCRIPTOR_RWMULTIPLEREGISTERS_BLOCK (&(g_MBMaster_CmdLet_FC17_Block))
+#endif
+
 
 #ifdef __cplusplus
 }
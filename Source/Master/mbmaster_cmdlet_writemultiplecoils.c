@@ -111,7 +111,7 @@ MBMASTER_CMDLET  g_MBMaster_CmdLet_FC0F = {
 *
 * Return(s)   : None.
 *
-* Note(s)     : (1) Interrupts are assumed to be disabled when calling this function.
+* Note(s)     : (1) Interrupts are enabled when calling this function (the master data buffer is protected by the busy lock).
 *               (2) 'p_request' must points to a 'MBMASTER_CMDLET_WRITEMULTIPLECOILS_REQUEST' object.
 *********************************************************************************************************
 */
@@ -221,9 +221,9 @@ static void MBMaster_CmdLet_FC0F_ReqHdl(
         byteCount /= (CPU_INT16U)8U;
         ++(byteCount);
     }
-    MBBufEmitter_WriteUInt16BE(
+    MBBufEmitter_WriteUInt8(
         &(emitter),
-        byteCount,
+        (CPU_INT08U)byteCount,
         p_error
     );
     switch (*p_error) {
@@ -254,6 +254,7 @@ static void MBMaster_CmdLet_FC0F_ReqHdl(
     if (*(coilValuePtr)) {                \
         coilStatusByte |= duffBitMask;    \
     }                                     \
+    duffBitMask <<= (CPU_INT08U)1U;       \
     ++(coilValuePtr);                     \
     --(coilQuantity);                     \
 }
@@ -337,7 +338,7 @@ static void MBMaster_CmdLet_FC0F_ReqHdl(
 *
 * Return(s)   : None.
 *
-* Note(s)     : (1) Interrupts are assumed to be disabled when calling this function.
+* Note(s)     : (1) Interrupts are enabled when calling this function (the master data buffer is protected by the busy lock).
 *               (2) 'p_request' must point to a 'MBMASTER_CMDLET_WRITEMULTIPLECOILS_REQUEST' object.
 *               (3) 'p_response' must point to a 'MBMASTER_CMDLET_WRITEMULTIPLECOILS_RESPONSE' object.
 *********************************************************************************************************
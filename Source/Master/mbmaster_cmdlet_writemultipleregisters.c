@@ -111,7 +111,7 @@ MBMASTER_CMDLET  g_MBMaster_CmdLet_FC10 = {
 *
 * Return(s)   : None.
 *
-* Note(s)     : (1) Interrupts are assumed to be disabled when calling this function.
+* Note(s)     : (1) Interrupts are enabled when calling this function (the master data buffer is protected by the busy lock).
 *               (2) 'p_request' must points to a 'MBMASTER_CMDLET_WRITEMULTIPLEREGISTERS_REQUEST' object.
 *********************************************************************************************************
 */
@@ -211,7 +211,7 @@ static void MBMaster_CmdLet_FC10_ReqHdl(
     /*  Write the byte count.  */
     MBBufEmitter_WriteUInt8(
         &(emitter),
-        (CPU_INT08U)((request->hregQuantity) <<= (CPU_INT16U)1U),
+        (CPU_INT08U)((request->hregQuantity) << 1U),
         p_error
     );
     switch (*p_error) {
@@ -288,7 +288,7 @@ static void MBMaster_CmdLet_FC10_ReqHdl(
 *
 * Return(s)   : None.
 *
-* Note(s)     : (1) Interrupts are assumed to be disabled when calling this function.
+* Note(s)     : (1) Interrupts are enabled when calling this function (the master data buffer is protected by the busy lock).
 *               (2) 'p_request' must point to a 'MBMASTER_CMDLET_WRITEMULTIPLEREGISTERS_REQUEST' object.
 *               (3) 'p_response' must point to a 'MBMASTER_CMDLET_WRITEMULTIPLEREGISTERS_RESPONSE' object.
 *********************************************************************************************************
@@ -0,0 +1,629 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                             MASTER MODULE
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+* File      : MBMASTER_GROUP.C
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define MB_SOURCE
+#define MBMASTER_SOURCE
+#define MBMASTER_GROUP_SOURCE
+
+#include <mbmaster_group.h>
+#include <mbmaster_cfg.h>
+#include <mbmaster.h>
+
+#include <mb_os_types.h>
+#include <mb_os.h>
+
+#include <mb_constants.h>
+#include <mb_types.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+
+#if (MB_CFG_MASTER_EN == DEF_ENABLED) && (MB_CFG_MASTER_GROUP_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/*  Batch event flag that is set when the last pending transaction is done.  */
+#define MBMASTER_GROUP_FLAG_DONE                  ((MB_FLAGS)0x01U)
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void MBMaster_Group_Complete(
+    CPU_INT08U                 slave,
+    void                      *p_request,
+    void                      *p_response,
+    MB_ERROR                   error,
+    void                      *p_arg
+);
+
+static void MBMaster_Group_Release(
+    MBMASTER_GROUP_BATCH      *p_batch,
+    MB_ERROR                   error,
+    MB_ERROR                  *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Group_Initialize()
+*
+* Description : Initialize a multi-port master group.
+*
+* Argument(s) : (1) p_group         Pointer to the group.
+*               (2) pp_ports        Pointer to the first element of the array of master objects (one per port).
+*               (3) port_cnt        Count of ports.
+*               (4) p_routes        Pointer to the first element of the routing table (indexed by device number).
+*               (5) route_cnt       Count of devices.
+*               (6) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_group' is NULL, or 'pp_ports' (or one of its
+*                                                                      elements) is NULL while 'port_cnt' is not zero,
+*                                                                      or 'p_routes' is NULL while 'route_cnt' is not
+*                                                                      zero.
+*                                       MB_ERROR_INVALIDPARAMETER      A route refers to a port that doesn't exist.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Each master must be initialized and have its transaction queue initialized (see
+*                   MBMaster_QueueInitialize()). Each port is serviced by its own task, typically:
+*
+*                       while (DEF_YES) {
+*                           MBMaster_ServiceQueue(group.ports[port], (MB_TIMESPAN)0U, &error);
+*                       }
+*
+*               (2) The port array and the routing table must be kept valid while the group is used.
+*********************************************************************************************************
+*/
+
+void MBMaster_Group_Initialize(
+    MBMASTER_GROUP          *p_group,
+    MBMASTER               **pp_ports,
+    CPU_SIZE_T               port_cnt,
+    MBMASTER_GROUP_ROUTE    *p_routes,
+    CPU_SIZE_T               route_cnt,
+    MB_ERROR                *p_error
+) {
+    CPU_SIZE_T  idx;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_group' parameter.  */
+    if (p_group == (MBMASTER_GROUP*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'pp_ports' parameter.  */
+    if ((pp_ports == (MBMASTER**)0) && (port_cnt != (CPU_SIZE_T)0U)) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+    for (idx = (CPU_SIZE_T)0U; idx < port_cnt; ++idx) {
+        if (pp_ports[idx] == (MBMASTER*)0) {
+            *p_error = MB_ERROR_NULLREFERENCE;
+            return;
+        }
+    }
+
+    /*  Check 'p_routes' parameter.  */
+    if ((p_routes == (MBMASTER_GROUP_ROUTE*)0) && (route_cnt != (CPU_SIZE_T)0U)) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Check the routing table.  */
+    for (idx = (CPU_SIZE_T)0U; idx < route_cnt; ++idx) {
+        if ((CPU_SIZE_T)(p_routes[idx].port) >= port_cnt) {
+            *p_error = MB_ERROR_INVALIDPARAMETER;
+            return;
+        }
+    }
+
+    /*  Initialize all members.  */
+    p_group->ports    = pp_ports;
+    p_group->portCnt  = port_cnt;
+    p_group->routes   = p_routes;
+    p_group->routeCnt = route_cnt;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Group_BatchInitialize()
+*
+* Description : Initialize a transaction batch (with no pending transaction).
+*
+* Argument(s) : (1) p_batch         Pointer to the batch.
+*               (2) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_batch' is NULL.
+*                                       MB_ERROR_OS_FGRP_FAILEDCREATE  Failed to create a flag group object.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBMaster_Group_BatchInitialize(
+    MBMASTER_GROUP_BATCH    *p_batch,
+    MB_ERROR                *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_batch' parameter.  */
+    if (p_batch == (MBMASTER_GROUP_BATCH*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Create the batch event.  */
+    MBOS_FlagGroupCreate(
+        &(p_batch->event),
+        (MB_FLAGS)0U,
+        p_error
+    );
+    if (*p_error != MB_ERROR_NONE) {
+        return;
+    }
+
+    /*  Initialize all members.  */
+    p_batch->cntPending = (CPU_SIZE_T)0U;
+    p_batch->cntFail    = (CPU_SIZE_T)0U;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Group_BatchDispose()
+*
+* Description : Dispose a transaction batch.
+*
+* Argument(s) : (1) p_batch         Pointer to the batch.
+*               (2) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                   No error occurred.
+*                                       MB_ERROR_NULLREFERENCE          'p_batch' is NULL.
+*                                       MB_ERROR_OS_FGRP_FAILEDDISPOSE  Failed to dispose a flag group object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The batch must have no pending transaction (see MBMaster_Group_Gather()).
+*********************************************************************************************************
+*/
+
+void MBMaster_Group_BatchDispose(
+    MBMASTER_GROUP_BATCH    *p_batch,
+    MB_ERROR                *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_batch' parameter.  */
+    if (p_batch == (MBMASTER_GROUP_BATCH*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Dispose the batch event.  */
+    MBOS_FlagGroupDispose(
+        &(p_batch->event),
+        p_error
+    );
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Group_Submit()
+*
+* Description : Submit a Modbus request to the port that hosts a device and add it to a batch.
+*
+* Argument(s) : (1) p_group         Pointer to the group.
+*               (2) p_batch         Pointer to the batch.
+*               (3) p_trans         Pointer to the transaction object (receives the result of the request).
+*               (4) device          Device number (index of the routing table).
+*               (5) p_cmdlet        Pointer to the command-let object.
+*               (6) p_request       Pointer to the request object.
+*               (7) p_response      Pointer to the response object.
+*               (8) p_responsearg   'p_arg' parameter passed to response callbacks.
+*               (9) timeout         Timeout for receiving the response frame from the slave (unit: milliseconds,
+*                                   0 to wait infinitely).
+*               (10) p_error        Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_group', 'p_batch', 'p_trans', 'p_cmdlet',
+*                                                                      'p_request' or 'p_response' is NULL.
+*                                       MB_ERROR_INVALIDPARAMETER      'device' is out of range.
+*                                       MB_ERROR_OVERFLOW              'timeout' parameter exceeds maximum allowed value.
+*                                       MB_ERROR_MASTER_QUEUEFULL      No free transaction slot on the port.
+*                                       MB_ERROR_OS_FGRP_FAILEDPOST    Failed to post to a flag group object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The request is executed by the task that services the port, so requests to devices on
+*                   different ports are executed concurrently.
+*               (2) The transaction object, the request object, the response object and the response callback
+*                   argument must be kept valid until the batch is gathered. The error code of the request is
+*                   stored in the 'error' member of the transaction object.
+*********************************************************************************************************
+*/
+
+void MBMaster_Group_Submit(
+    MBMASTER_GROUP              *p_group,
+    MBMASTER_GROUP_BATCH        *p_batch,
+    MBMASTER_GROUP_TRANSACTION  *p_trans,
+    CPU_SIZE_T                   device,
+    MBMASTER_CMDLET             *p_cmdlet,
+    void                        *p_request,
+    void                        *p_response,
+    void                        *p_responsearg,
+    MB_TIMESPAN                  timeout,
+    MB_ERROR                    *p_error
+) {
+    CPU_SR_ALLOC();
+
+    MBMASTER_GROUP_ROUTE  *p_route;
+    MB_ERROR               releaseError;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_group' parameter.  */
+    if (p_group == (MBMASTER_GROUP*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_batch' parameter.  */
+    if (p_batch == (MBMASTER_GROUP_BATCH*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_trans' parameter.  */
+    if (p_trans == (MBMASTER_GROUP_TRANSACTION*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Look up the route of the device.  */
+    if (device >= p_group->routeCnt) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+    p_route = &(p_group->routes[device]);
+
+    /*  Initialize the transaction.  */
+    p_trans->batch = p_batch;
+    p_trans->error = MB_ERROR_NONE;
+
+    /*  Count the transaction as pending before it can be completed.  */
+    CPU_CRITICAL_ENTER();
+    ++(p_batch->cntPending);
+    CPU_CRITICAL_EXIT();
+
+    /*  Submit the request to the port.  */
+    MBMaster_Submit(
+        p_group->ports[p_route->port],
+        p_route->slave,
+        p_cmdlet,
+        p_request,
+        p_response,
+        p_responsearg,
+        timeout,
+        MBMaster_Group_Complete,
+        (void*)p_trans,
+        p_error
+    );
+    if (*p_error != MB_ERROR_NONE) {
+        switch (*p_error) {
+            case MB_ERROR_OS_FGRP_FAILEDPOST:
+                /*  The request was queued (but the port task may not be woken up yet).  */
+                break;
+            default:
+                /*  The request was not queued, so it will never be completed.  */
+                MBMaster_Group_Release(p_batch, MB_ERROR_NONE, &releaseError);
+                break;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Group_Gather()
+*
+* Description : Wait for all transactions of a batch to be done.
+*
+* Argument(s) : (1) p_batch         Pointer to the batch.
+*               (2) timeout         Timeout (unit: milliseconds, 0 to wait infinitely).
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                    No error occurred.
+*                                       MB_ERROR_NULLREFERENCE           'p_batch' is NULL.
+*                                       MB_ERROR_OVERFLOW                'timeout' parameter exceeds maximum allowed value.
+*                                       MB_ERROR_TIMEOUT                 Some transactions were still pending before the
+*                                                                        timeout limit exceeds.
+*                                       MB_ERROR_OS_FGRP_FAILEDPEND      Failed to pend on a flag group object.
+*                                       MB_ERROR_OS_FGRP_FAILEDRDYFLAGS  Failed to get the flags that make current task
+*                                                                        ready-to-run.
+*                                       MB_ERROR_OS_TIME_FAILEDGET       Failed to get system tick count.
+*
+* Return(s)   : Count of transactions that failed (0 if all transactions succeeded).
+*
+* Note(s)     : (1) On success the failure count of the batch is reset, so the batch can be reused for the next
+*                   scan. On timeout the batch keeps its pending transactions and can be gathered again.
+*               (2) Only one task is allowed to gather a batch.
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  MBMaster_Group_Gather(
+    MBMASTER_GROUP_BATCH    *p_batch,
+    MB_TIMESPAN              timeout,
+    MB_ERROR                *p_error
+) {
+    CPU_SR_ALLOC();
+
+    MB_FLAGS     flags;
+    CPU_SIZE_T   cntPending;
+    CPU_SIZE_T   cntFail;
+
+    MB_TIMESPAN  pendTimeout;
+    MB_SYSTICK   ticksTimeout;
+    MB_SYSTICK   ticksBeforePend;
+    MB_SYSTICK   ticksAfterPend;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_batch' parameter.  */
+    if (p_batch == (MBMASTER_GROUP_BATCH*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return (CPU_SIZE_T)0U;
+    }
+
+    /*  Check 'timeout' parameter.  */
+    if (timeout > MBOS_GetMaxTimeValue()) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return (CPU_SIZE_T)0U;
+    }
+#endif
+
+    /*  Convert timeout to ticks.  */
+    if (timeout != (MB_TIMESPAN)0U) {
+        ticksTimeout = MBOS_TimeToTickCount(
+            timeout,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            return (CPU_SIZE_T)0U;
+        }
+    } else {
+        ticksTimeout = (MB_SYSTICK)0U;
+    }
+    ticksBeforePend = (MB_SYSTICK)0U;
+
+    while (DEF_YES) {
+        /*  Enter critical section.  */
+        CPU_CRITICAL_ENTER();
+
+        /*  Take the failure count if no transaction is pending.  */
+        cntPending = p_batch->cntPending;
+        cntFail    = p_batch->cntFail;
+        if (cntPending == (CPU_SIZE_T)0U) {
+            p_batch->cntFail = (CPU_SIZE_T)0U;
+        }
+
+        /*  Exit critical section.  */
+        CPU_CRITICAL_EXIT();
+
+        if (cntPending == (CPU_SIZE_T)0U) {
+            break;
+        }
+
+        if (ticksTimeout != (MB_SYSTICK)0U) {
+            /*  Get the system tick count before pending.  */
+            ticksBeforePend = MBOS_GetTickCount(p_error);
+            if (*p_error != MB_ERROR_NONE) {
+                return (CPU_SIZE_T)0U;
+            }
+
+            /*  Convert remaining timeout ticks to timespan.  */
+            pendTimeout = MBOS_TickCountToTime(ticksTimeout, p_error);
+            if (*p_error != MB_ERROR_NONE) {
+                return (CPU_SIZE_T)0U;
+            }
+        } else {
+            pendTimeout = (MB_TIMESPAN)0U;
+        }
+
+        /*
+         *  Wait for the last pending transaction to be done.
+         *
+         *  Note(s):
+         *    (1) The flag may be left over by a previous gathering of the
+         *        batch, in which case the pending count is just checked
+         *        again.
+         */
+        flags = MBMASTER_GROUP_FLAG_DONE;
+        MBOS_FlagGroupPend(
+            &(p_batch->event),
+            &flags,
+            pendTimeout,
+            (MB_OPT)(MB_FLAGGROUP_OPT_SET_ANY | MB_FLAGGROUP_OPT_CONSUME),
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            return (CPU_SIZE_T)0U;
+        }
+
+        if (ticksTimeout != (MB_SYSTICK)0U) {
+            /*  Get the ticks elapsed during pending.  */
+            ticksAfterPend = MBOS_GetTickCount(p_error);
+            if (*p_error != MB_ERROR_NONE) {
+                return (CPU_SIZE_T)0U;
+            }
+            ticksAfterPend -= ticksBeforePend;
+
+            /*  Cost the elapsed ticks (and check the pending count once more if timed out).  */
+            if (ticksAfterPend >= ticksTimeout) {
+                CPU_CRITICAL_ENTER();
+                cntPending = p_batch->cntPending;
+                cntFail    = p_batch->cntFail;
+                if (cntPending == (CPU_SIZE_T)0U) {
+                    p_batch->cntFail = (CPU_SIZE_T)0U;
+                }
+                CPU_CRITICAL_EXIT();
+
+                if (cntPending == (CPU_SIZE_T)0U) {
+                    break;
+                }
+
+                *p_error = MB_ERROR_TIMEOUT;
+                return (CPU_SIZE_T)0U;
+            }
+            ticksTimeout -= ticksAfterPend;
+        }
+    }
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+
+    return cntFail;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Group_Complete()
+*
+* Description : Completion callback of the requests submitted by MBMaster_Group_Submit().
+*
+* Argument(s) : (1) slave           Slave address.
+*               (2) p_request       Pointer to the request object.
+*               (3) p_response      Pointer to the response object.
+*               (4) error           Error code of the request.
+*               (5) p_arg           Pointer to the transaction object.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBMaster_Group_Complete(
+    CPU_INT08U                 slave,
+    void                      *p_request,
+    void                      *p_response,
+    MB_ERROR                   error,
+    void                      *p_arg
+) {
+    MBMASTER_GROUP_TRANSACTION  *p_trans;
+    MB_ERROR                     releaseError;
+
+    (void)slave;
+    (void)p_request;
+    (void)p_response;
+
+    /*  Store the result of the request.  */
+    p_trans = (MBMASTER_GROUP_TRANSACTION*)p_arg;
+    p_trans->error = error;
+
+    /*  Release the transaction from its batch (no one to report the error to here).  */
+    MBMaster_Group_Release(p_trans->batch, error, &releaseError);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Group_Release()
+*
+* Description : Remove a done (or cancelled) transaction from the pending transactions of a batch.
+*
+* Argument(s) : (1) p_batch         Pointer to the batch.
+*               (2) error           Error code of the transaction (MB_ERROR_NONE if it succeeded or was
+*                                   cancelled).
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_OS_FGRP_FAILEDPOST    Failed to post to a flag group object.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBMaster_Group_Release(
+    MBMASTER_GROUP_BATCH      *p_batch,
+    MB_ERROR                   error,
+    MB_ERROR                  *p_error
+) {
+    CPU_SR_ALLOC();
+
+    CPU_BOOLEAN  done;
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  Count the failure and the completion.  */
+    if (error != MB_ERROR_NONE) {
+        ++(p_batch->cntFail);
+    }
+    --(p_batch->cntPending);
+    if (p_batch->cntPending == (CPU_SIZE_T)0U) {
+        done = DEF_YES;
+    } else {
+        done = DEF_NO;
+    }
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    /*  Wake up the gathering task if it was the last pending transaction.  */
+    if (done) {
+        MBOS_FlagGroupPost(
+            &(p_batch->event),
+            MBMASTER_GROUP_FLAG_DONE,
+            MB_FLAGGROUP_OPT_SET,
+            p_error
+        );
+    } else {
+        *p_error = MB_ERROR_NONE;
+    }
+}
+
+#endif  /*  #if (MB_CFG_MASTER_EN == DEF_ENABLED) && (MB_CFG_MASTER_GROUP_EN == DEF_ENABLED)  */
\ No newline at end of file
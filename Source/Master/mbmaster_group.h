@@ -0,0 +1,274 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                             MASTER MODULE
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+* File      : MBMASTER_GROUP.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef MBMASTER_GROUP_H__
+#define MBMASTER_GROUP_H__
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include <mbmaster_cfg.h>
+#include <mbmaster.h>
+
+#include <mbmaster_cmdlet_common.h>
+
+#include <mb_os_types.h>
+
+#include <mb_types.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+
+#if (MB_CFG_MASTER_EN == DEF_ENABLED) && (MB_CFG_MASTER_GROUP_EN == DEF_ENABLED)
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+typedef struct {
+    CPU_INT08U              port;
+    CPU_INT08U              slave;
+} MBMASTER_GROUP_ROUTE;
+
+typedef struct {
+    MB_FLAGGROUP            event;
+
+    CPU_SIZE_T              cntPending;
+    CPU_SIZE_T              cntFail;
+} MBMASTER_GROUP_BATCH;
+
+typedef struct {
+    MBMASTER_GROUP_BATCH   *batch;
+
+    MB_ERROR                error;
+} MBMASTER_GROUP_TRANSACTION;
+
+typedef struct {
+    MBMASTER              **ports;
+    CPU_SIZE_T              portCnt;
+
+    MBMASTER_GROUP_ROUTE   *routes;
+    CPU_SIZE_T              routeCnt;
+} MBMASTER_GROUP;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Group_Initialize()
+*
+* Description : Initialize a multi-port master group.
+*
+* Argument(s) : (1) p_group         Pointer to the group.
+*               (2) pp_ports        Pointer to the first element of the array of master objects (one per port).
+*               (3) port_cnt        Count of ports.
+*               (4) p_routes        Pointer to the first element of the routing table (indexed by device number).
+*               (5) route_cnt       Count of devices.
+*               (6) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_group' is NULL, or 'pp_ports' (or one of its
+*                                                                      elements) is NULL while 'port_cnt' is not zero,
+*                                                                      or 'p_routes' is NULL while 'route_cnt' is not
+*                                                                      zero.
+*                                       MB_ERROR_INVALIDPARAMETER      A route refers to a port that doesn't exist.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Each master must be initialized and have its transaction queue initialized (see
+*                   MBMaster_QueueInitialize()). Each port is serviced by its own task, typically:
+*
+*                       while (DEF_YES) {
+*                           MBMaster_ServiceQueue(group.ports[port], (MB_TIMESPAN)0U, &error);
+*                       }
+*
+*               (2) The port array and the routing table must be kept valid while the group is used.
+*********************************************************************************************************
+*/
+
+void MBMaster_Group_Initialize(
+    MBMASTER_GROUP          *p_group,
+    MBMASTER               **pp_ports,
+    CPU_SIZE_T               port_cnt,
+    MBMASTER_GROUP_ROUTE    *p_routes,
+    CPU_SIZE_T               route_cnt,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Group_BatchInitialize()
+*
+* Description : Initialize a transaction batch (with no pending transaction).
+*
+* Argument(s) : (1) p_batch         Pointer to the batch.
+*               (2) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_batch' is NULL.
+*                                       MB_ERROR_OS_FGRP_FAILEDCREATE  Failed to create a flag group object.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBMaster_Group_BatchInitialize(
+    MBMASTER_GROUP_BATCH    *p_batch,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Group_BatchDispose()
+*
+* Description : Dispose a transaction batch.
+*
+* Argument(s) : (1) p_batch         Pointer to the batch.
+*               (2) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                   No error occurred.
+*                                       MB_ERROR_NULLREFERENCE          'p_batch' is NULL.
+*                                       MB_ERROR_OS_FGRP_FAILEDDISPOSE  Failed to dispose a flag group object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The batch must have no pending transaction (see MBMaster_Group_Gather()).
+*********************************************************************************************************
+*/
+
+void MBMaster_Group_BatchDispose(
+    MBMASTER_GROUP_BATCH    *p_batch,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Group_Submit()
+*
+* Description : Submit a Modbus request to the port that hosts a device and add it to a batch.
+*
+* Argument(s) : (1) p_group         Pointer to the group.
+*               (2) p_batch         Pointer to the batch.
+*               (3) p_trans         Pointer to the transaction object (receives the result of the request).
+*               (4) device          Device number (index of the routing table).
+*               (5) p_cmdlet        Pointer to the command-let object.
+*               (6) p_request       Pointer to the request object.
+*               (7) p_response      Pointer to the response object.
+*               (8) p_responsearg   'p_arg' parameter passed to response callbacks.
+*               (9) timeout         Timeout for receiving the response frame from the slave (unit: milliseconds,
+*                                   0 to wait infinitely).
+*               (10) p_error        Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_group', 'p_batch', 'p_trans', 'p_cmdlet',
+*                                                                      'p_request' or 'p_response' is NULL.
+*                                       MB_ERROR_INVALIDPARAMETER      'device' is out of range.
+*                                       MB_ERROR_OVERFLOW              'timeout' parameter exceeds maximum allowed value.
+*                                       MB_ERROR_MASTER_QUEUEFULL      No free transaction slot on the port.
+*                                       MB_ERROR_OS_FGRP_FAILEDPOST    Failed to post to a flag group object.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The request is executed by the task that services the port, so requests to devices on
+*                   different ports are executed concurrently.
+*               (2) The transaction object, the request object, the response object and the response callback
+*                   argument must be kept valid until the batch is gathered. The error code of the request is
+*                   stored in the 'error' member of the transaction object.
+*********************************************************************************************************
+*/
+
+void MBMaster_Group_Submit(
+    MBMASTER_GROUP              *p_group,
+    MBMASTER_GROUP_BATCH        *p_batch,
+    MBMASTER_GROUP_TRANSACTION  *p_trans,
+    CPU_SIZE_T                   device,
+    MBMASTER_CMDLET             *p_cmdlet,
+    void                        *p_request,
+    void                        *p_response,
+    void                        *p_responsearg,
+    MB_TIMESPAN                  timeout,
+    MB_ERROR                    *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Group_Gather()
+*
+* Description : Wait for all transactions of a batch to be done.
+*
+* Argument(s) : (1) p_batch         Pointer to the batch.
+*               (2) timeout         Timeout (unit: milliseconds, 0 to wait infinitely).
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                    No error occurred.
+*                                       MB_ERROR_NULLREFERENCE           'p_batch' is NULL.
+*                                       MB_ERROR_OVERFLOW                'timeout' parameter exceeds maximum allowed value.
+*                                       MB_ERROR_TIMEOUT                 Some transactions were still pending before the
+*                                                                        timeout limit exceeds.
+*                                       MB_ERROR_OS_FGRP_FAILEDPEND      Failed to pend on a flag group object.
+*                                       MB_ERROR_OS_FGRP_FAILEDRDYFLAGS  Failed to get the flags that make current task
+*                                                                        ready-to-run.
+*                                       MB_ERROR_OS_TIME_FAILEDGET       Failed to get system tick count.
+*
+* Return(s)   : Count of transactions that failed (0 if all transactions succeeded).
+*
+* Note(s)     : (1) On success the failure count of the batch is reset, so the batch can be reused for the next
+*                   scan. On timeout the batch keeps its pending transactions and can be gathered again.
+*               (2) Only one task is allowed to gather a batch.
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  MBMaster_Group_Gather(
+    MBMASTER_GROUP_BATCH    *p_batch,
+    MB_TIMESPAN              timeout,
+    MB_ERROR                *p_error
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /*  #if (MB_CFG_MASTER_EN == DEF_ENABLED) && (MB_CFG_MASTER_GROUP_EN == DEF_ENABLED)  */
+
+#endif
\ No newline at end of file
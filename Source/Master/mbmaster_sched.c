@@ -0,0 +1,1478 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                             MASTER MODULE
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+* File      : MBMASTER_SCHED.C
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define MB_SOURCE
+#define MBMASTER_SOURCE
+#define MBMASTER_SCHED_SOURCE
+
+#include <mbmaster_sched.h>
+#include <mbmaster_cfg.h>
+#include <mbmaster.h>
+
+#include <mb_os_types.h>
+#include <mb_os.h>
+
+#include <mb_constants.h>
+#include <mb_types.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+
+#if (MB_CFG_MASTER_EN == DEF_ENABLED) && (MB_CFG_MASTER_SCHED_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/*  Check whether tick count 'a' is earlier than tick count 'b' (with wrap-around).  */
+#define MBMASTER_SCHED_TICKBEFORE(a, b)  \
+    (((MB_SYSTICK)((MB_SYSTICK)(a) - (MB_SYSTICK)(b))) > (MB_SYSTICK)(((MB_SYSTICK)~(MB_SYSTICK)0U) >> 1))
+
+#if (MB_CFG_MASTER_SCHED_COALESCE_EN == DEF_ENABLED)
+/*  Kinds of read requests that can be coalesced.  */
+#define MBMASTER_SCHED_KIND_NONE                  ((CPU_INT08U)0U)
+#define MBMASTER_SCHED_KIND_COILS                 ((CPU_INT08U)1U)
+#define MBMASTER_SCHED_KIND_DISCRETEINPUTS        ((CPU_INT08U)2U)
+#define MBMASTER_SCHED_KIND_HOLDINGREGS           ((CPU_INT08U)3U)
+#define MBMASTER_SCHED_KIND_INPUTREGS             ((CPU_INT08U)4U)
+
+/*  Protocol limits of the quantity of one read request.  */
+#define MBMASTER_SCHED_MAXBITS                    ((CPU_INT32U)0x07D0U)
+#define MBMASTER_SCHED_MAXREGS                    ((CPU_INT32U)0x007DU)
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+#if (MB_CFG_MASTER_SCHED_COALESCE_EN == DEF_ENABLED)
+typedef void (*MBMASTER_SCHED_NOTIFY_CB)(
+    void          *p_arg,
+    MB_ERROR      *p_error
+);
+
+typedef struct {
+    CPU_INT08U              kind;
+
+    CPU_INT16U              start;
+    CPU_INT32U              end;
+
+    MBMASTER_SCHED_ITEM    *items[MB_CFG_MASTER_SCHED_COALESCE_MAX];
+    CPU_INT16U              itemStart[MB_CFG_MASTER_SCHED_COALESCE_MAX];
+    CPU_INT32U              itemEnd[MB_CFG_MASTER_SCHED_COALESCE_MAX];
+    CPU_SIZE_T              itemCnt;
+} MBMASTER_SCHED_COALESCE;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void MBMaster_Sched_Account(
+    MBMASTER_SCHED_ITEM       *p_item,
+    MB_SYSTICK                 ticks_start,
+    MB_SYSTICK                 ticks_end,
+    MB_ERROR                   error
+);
+
+#if (MB_CFG_MASTER_SCHED_COALESCE_EN == DEF_ENABLED)
+static CPU_INT08U MBMaster_Sched_GetReadRange(
+    MBMASTER_SCHED_ITEM       *p_item,
+    CPU_INT16U                *p_start,
+    CPU_INT16U                *p_quantity
+);
+
+static void MBMaster_Sched_Coalesce(
+    MBMASTER_SCHED            *p_sched,
+    MBMASTER_SCHED_ITEM       *p_first,
+    MB_SYSTICK                 ticks_now,
+    MBMASTER_SCHED_COALESCE   *p_coalesce
+);
+
+static void MBMaster_Sched_PostCoalesced(
+    MBMASTER_SCHED            *p_sched,
+    MBMASTER_SCHED_COALESCE   *p_coalesce,
+    MB_TIMESPAN                timeout,
+    MB_ERROR                  *p_error
+);
+
+static MBMASTER_SCHED_NOTIFY_CB MBMaster_Sched_GetNotifyCallback(
+    CPU_INT08U                 kind,
+    void                      *p_response,
+    CPU_BOOLEAN                end
+);
+
+static void MBMaster_Sched_DemuxException(
+    CPU_INT08U                 ec,
+    void                      *p_arg,
+    MB_ERROR                  *p_error
+);
+
+static void MBMaster_Sched_DemuxStart(
+    void                      *p_arg,
+    MB_ERROR                  *p_error
+);
+
+static void MBMaster_Sched_DemuxEnd(
+    void                      *p_arg,
+    MB_ERROR                  *p_error
+);
+
+static void MBMaster_Sched_DemuxBit(
+    CPU_INT16U                 address,
+    CPU_BOOLEAN                value,
+    void                      *p_arg,
+    MB_ERROR                  *p_error
+);
+
+static void MBMaster_Sched_DemuxReg(
+    CPU_INT16U                 address,
+    CPU_INT16U                 value,
+    void                      *p_arg,
+    MB_ERROR                  *p_error
+);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_Initialize()
+*
+* Description : Initialize a polling scheduler (with no poll item).
+*
+* Argument(s) : (1) p_sched         Pointer to the scheduler.
+*               (2) p_master        Pointer to the master object that the poll items are posted to.
+*               (3) p_items         Pointer to the first element of the poll item storage.
+*               (4) capacity        Count of elements of the poll item storage.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    'p_sched' or 'p_master' is NULL, or 'p_items' is
+*                                                                 NULL while 'capacity' is not zero.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBMaster_Sched_Initialize(
+    MBMASTER_SCHED          *p_sched,
+    MBMASTER                *p_master,
+    MBMASTER_SCHED_ITEM     *p_items,
+    CPU_SIZE_T               capacity,
+    MB_ERROR                *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_sched' parameter.  */
+    if (p_sched == (MBMASTER_SCHED*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_master' parameter.  */
+    if (p_master == (MBMASTER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_items' parameter.  */
+    if ((p_items == (MBMASTER_SCHED_ITEM*)0) && (capacity != (CPU_SIZE_T)0U)) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Initialize the scheduler.  */
+    p_sched->master        = p_master;
+    p_sched->items         = p_items;
+    p_sched->itemCnt       = (CPU_SIZE_T)0U;
+    p_sched->itemCapacity  = capacity;
+#if (MB_CFG_MASTER_SCHED_COALESCE_EN == DEF_ENABLED)
+    p_sched->coalesceGap   = (CPU_INT16U)0U;
+#endif
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_AddItem()
+*
+* Description : Add a poll item to a scheduler.
+*
+* Argument(s) : (1) p_sched         Pointer to the scheduler.
+*               (2) slave           Slave address.
+*               (3) p_cmdlet        Pointer to the command-let object.
+*               (4) p_request       Pointer to the request object.
+*               (5) p_response      Pointer to the response object.
+*               (6) p_responsearg   'p_arg' parameter passed to response callbacks.
+*               (7) timeout         Timeout for receiving the response frame from the slave (unit: milliseconds,
+*                                   0 to wait infinitely).
+*               (8) period          Poll period (unit: milliseconds).
+*               (9) priority        Priority (lower value is more urgent) of the item when the deadlines of
+*                                   multiple items are the same.
+*               (10) cb_complete    Completion callback (NULL if not used).
+*               (11) p_completearg  'p_arg' parameter passed to the completion callback.
+*               (12) p_error        Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_sched', 'p_cmdlet', 'p_request' or 'p_response'
+*                                                                      is NULL.
+*                                       MB_ERROR_INVALIDPARAMETER      'slave' is the broadcast address.
+*                                       MB_ERROR_UNDERFLOW             'period' equals to zero.
+*                                       MB_ERROR_OVERFLOW              'period' or 'timeout' exceeds maximum allowed value.
+*                                       MB_ERROR_MASTER_SCHEDFULL      The poll item storage is full.
+*                                       MB_ERROR_OS_TIME_FAILEDGET     Failed to get system tick count.
+*
+* Return(s)   : Index of the item (used by MBMaster_Sched_GetStatistics()).
+*
+* Note(s)     : (1) The item is due immediately, then once per 'period'.
+*               (2) Items can't be added while the scheduler is running.
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  MBMaster_Sched_AddItem(
+    MBMASTER_SCHED          *p_sched,
+    CPU_INT08U               slave,
+    MBMASTER_CMDLET         *p_cmdlet,
+    void                    *p_request,
+    void                    *p_response,
+    void                    *p_responsearg,
+    MB_TIMESPAN              timeout,
+    MB_TIMESPAN              period,
+    CPU_INT08U               priority,
+    MBMASTER_COMPLETE_CB     cb_complete,
+    void                    *p_completearg,
+    MB_ERROR                *p_error
+) {
+    MBMASTER_SCHED_ITEM  *p_item;
+    MB_SYSTICK            ticksPeriod;
+    MB_SYSTICK            ticksNow;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_sched' parameter.  */
+    if (p_sched == (MBMASTER_SCHED*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return (CPU_SIZE_T)0U;
+    }
+
+    /*  Check 'p_cmdlet' parameter.  */
+    if (p_cmdlet == (MBMASTER_CMDLET*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return (CPU_SIZE_T)0U;
+    }
+
+    /*  Check 'p_request' parameter.  */
+    if (p_request == (void*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return (CPU_SIZE_T)0U;
+    }
+
+    /*  Check 'p_response' parameter.  */
+    if (p_response == (void*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return (CPU_SIZE_T)0U;
+    }
+
+    /*  Check 'slave' parameter.  */
+    if (slave == (CPU_INT08U)0U) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return (CPU_SIZE_T)0U;
+    }
+
+    /*  Check 'timeout' parameter.  */
+    if (timeout > MBOS_GetMaxTimeValue()) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return (CPU_SIZE_T)0U;
+    }
+#endif
+
+    /*  Check 'period' parameter.  */
+    if (period == (MB_TIMESPAN)0U) {
+        *p_error = MB_ERROR_UNDERFLOW;
+        return (CPU_SIZE_T)0U;
+    }
+    if (period > MBOS_GetMaxTimeValue()) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return (CPU_SIZE_T)0U;
+    }
+
+    /*  Check whether there is a free item.  */
+    if (p_sched->itemCnt >= p_sched->itemCapacity) {
+        *p_error = MB_ERROR_MASTER_SCHEDFULL;
+        return (CPU_SIZE_T)0U;
+    }
+
+    /*  Convert the period to ticks (at least 1 tick).  */
+    ticksPeriod = MBOS_TimeToTickCount(period, p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return (CPU_SIZE_T)0U;
+    }
+    if (ticksPeriod == (MB_SYSTICK)0U) {
+        ticksPeriod = (MB_SYSTICK)1U;
+    }
+
+    /*  The first poll is released right now.  */
+    ticksNow = MBOS_GetTickCount(p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return (CPU_SIZE_T)0U;
+    }
+
+    /*  Fill the item.  */
+    p_item = &(p_sched->items[p_sched->itemCnt]);
+    p_item->slave          = slave;
+    p_item->cmdlet         = p_cmdlet;
+    p_item->request        = p_request;
+    p_item->response       = p_response;
+    p_item->responseArg    = p_responsearg;
+    p_item->timeout        = timeout;
+    p_item->period         = ticksPeriod;
+    p_item->priority       = priority;
+    p_item->release        = ticksNow;
+    p_item->cbComplete     = cb_complete;
+    p_item->cbCompleteArg  = p_completearg;
+    p_item->cntPoll        = (MB_COUNTERVALUE)0U;
+    p_item->cntFail        = (MB_COUNTERVALUE)0U;
+    p_item->cntOverrun     = (MB_COUNTERVALUE)0U;
+    p_item->jitterLast     = (MB_SYSTICK)0U;
+    p_item->jitterMax      = (MB_SYSTICK)0U;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+
+    return (p_sched->itemCnt)++;
+}
+
+
+#if (MB_CFG_MASTER_SCHED_COALESCE_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_SetCoalesceGap()
+*
+* Description : Set the gap-fill threshold of read coalescing of a scheduler.
+*
+* Argument(s) : (1) p_sched         Pointer to the scheduler.
+*               (2) gap             Maximum count of unrequested registers (or bits) that may be read between
+*                                   two merged items (0 to merge adjacent or overlapping items only).
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_sched' is NULL.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Filling a gap makes the slave return the registers (or bits) in the gap, so the gap must
+*                   only contain readable addresses (otherwise the slave replies an exception to the merged
+*                   request and all merged items fail).
+*********************************************************************************************************
+*/
+
+void MBMaster_Sched_SetCoalesceGap(
+    MBMASTER_SCHED          *p_sched,
+    CPU_INT16U               gap,
+    MB_ERROR                *p_error
+) {
+    CPU_SR_ALLOC();
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_sched' parameter.  */
+    if (p_sched == (MBMASTER_SCHED*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  Set the threshold.  */
+    p_sched->coalesceGap = gap;
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_Run()
+*
+* Description : Poll the most urgent due item of a scheduler (or wait until the next item is due).
+*
+* Argument(s) : (1) p_sched         Pointer to the scheduler.
+*               (2) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_sched' is NULL.
+*                                       MB_ERROR_OS_TIME_FAILEDDELAY   Failed to delay.
+*                                       MB_ERROR_OS_TIME_FAILEDGET     Failed to get system tick count.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Due items are polled earliest-deadline-first, the deadline of an item is its next release
+*                   (i.e. the end of its current period). If no item is due, the calling task sleeps until the
+*                   earliest release, so the line is kept busy whenever any item is due.
+*               (2) The error of a poll itself is counted in the statistics of the item and is passed to its
+*                   completion callback (not to 'p_error').
+*               (3) Only one task is allowed to run a scheduler and the master must not be posted to by other
+*                   tasks, typically:
+*
+*                       while (DEF_YES) {
+*                           MBMaster_Sched_Run(&sched, &error);
+*                       }
+*
+*               (4) If MB_CFG_MASTER_SCHED_COALESCE_EN is enabled, due items that read coils, discrete inputs,
+*                   holding registers or input registers (with built-in commands) of the same slave are merged
+*                   into one request (up to 2000 bits or 125 registers, and the size of the master data buffer)
+*                   if the gaps between them don't exceed the gap-fill threshold. The values in the response are
+*                   passed to the response callbacks of each item whose range contains them.
+*********************************************************************************************************
+*/
+
+void MBMaster_Sched_Run(
+    MBMASTER_SCHED          *p_sched,
+    MB_ERROR                *p_error
+) {
+    CPU_SIZE_T                cursor;
+    MBMASTER_SCHED_ITEM      *p_item;
+    MBMASTER_SCHED_ITEM      *p_best;
+    MB_SYSTICK                deadline;
+    MB_SYSTICK                bestDeadline;
+    MB_SYSTICK                ticksNow;
+    MB_SYSTICK                ticksWait;
+    MB_SYSTICK                ticksEnd;
+    MB_TIMESPAN               dly;
+    MB_ERROR                  postError;
+#if (MB_CFG_MASTER_SCHED_COALESCE_EN == DEF_ENABLED)
+    MBMASTER_SCHED_COALESCE   coalesce;
+#endif
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_sched' parameter.  */
+    if (p_sched == (MBMASTER_SCHED*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Nothing to do if there is no item.  */
+    if (p_sched->itemCnt == (CPU_SIZE_T)0U) {
+        *p_error = MB_ERROR_NONE;
+        return;
+    }
+
+    /*  Get current tick count.  */
+    ticksNow = MBOS_GetTickCount(p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return;
+    }
+
+    /*
+     *  Find the due item with the earliest deadline.
+     *
+     *  Note(s):
+     *    (1) A linear scan is used, its cost (even with hundreds of items)
+     *        is negligible compared to the time of one transaction.
+     *    (2) Meanwhile, the time to the earliest release is tracked so
+     *        that the task can sleep if no item is due.
+     */
+    p_best       = (MBMASTER_SCHED_ITEM*)0;
+    bestDeadline = (MB_SYSTICK)0U;
+    ticksWait    = (MB_SYSTICK)(((MB_SYSTICK)~(MB_SYSTICK)0U) >> 1);
+    for (cursor = (CPU_SIZE_T)0U; cursor < p_sched->itemCnt; ++cursor) {
+        p_item = &(p_sched->items[cursor]);
+
+        if (MBMASTER_SCHED_TICKBEFORE(ticksNow, p_item->release)) {
+            /*  Not due yet.  */
+            if ((MB_SYSTICK)(p_item->release - ticksNow) < ticksWait) {
+                ticksWait = (MB_SYSTICK)(p_item->release - ticksNow);
+            }
+            continue;
+        }
+
+        deadline = (MB_SYSTICK)(p_item->release + p_item->period);
+        if (p_best == (MBMASTER_SCHED_ITEM*)0) {
+            p_best       = p_item;
+            bestDeadline = deadline;
+        } else if (MBMASTER_SCHED_TICKBEFORE(deadline, bestDeadline)) {
+            p_best       = p_item;
+            bestDeadline = deadline;
+        } else if ((deadline == bestDeadline) && (p_item->priority < p_best->priority)) {
+            p_best       = p_item;
+        }
+    }
+
+    /*  Sleep until the earliest release if no item is due.  */
+    if (p_best == (MBMASTER_SCHED_ITEM*)0) {
+        dly = MBOS_TickCountToTime(ticksWait, p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+        if (dly > MBOS_GetMaxTimeValue()) {
+            dly = MBOS_GetMaxTimeValue();
+        }
+
+        MBOS_Delay(
+            dly,
+            p_error
+        );
+        return;
+    }
+#if (MB_CFG_MASTER_SCHED_COALESCE_EN == DEF_ENABLED)
+    /*  Merge the due reads of the same slave (if possible).  */
+    MBMaster_Sched_Coalesce(
+        p_sched,
+        p_best,
+        ticksNow,
+        &(coalesce)
+    );
+    if (coalesce.itemCnt > (CPU_SIZE_T)1U) {
+        /*  Poll all merged items with one request.  */
+        MBMaster_Sched_PostCoalesced(
+            p_sched,
+            &(coalesce),
+            p_best->timeout,
+            &postError
+        );
+
+        /*  Get the completion tick count.  */
+        ticksEnd = MBOS_GetTickCount(p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+
+        /*  Account all merged items before notifying the application.  */
+        for (cursor = (CPU_SIZE_T)0U; cursor < coalesce.itemCnt; ++cursor) {
+            MBMaster_Sched_Account(
+                coalesce.items[cursor],
+                ticksNow,
+                ticksEnd,
+                postError
+            );
+        }
+        for (cursor = (CPU_SIZE_T)0U; cursor < coalesce.itemCnt; ++cursor) {
+            p_item = coalesce.items[cursor];
+            if (p_item->cbComplete != (MBMASTER_COMPLETE_CB)0) {
+                p_item->cbComplete(
+                    p_item->slave,
+                    p_item->request,
+                    p_item->response,
+                    postError,
+                    p_item->cbCompleteArg
+                );
+            }
+        }
+
+        return;
+    }
+#endif
+
+    p_item = p_best;
+
+    /*  Poll the item.  */
+    MBMaster_Post(
+        p_sched->master,
+        p_item->slave,
+        p_item->cmdlet,
+        p_item->request,
+        p_item->response,
+        p_item->responseArg,
+        p_item->timeout,
+        &postError
+    );
+
+    /*  Get the completion tick count.  */
+    ticksEnd = MBOS_GetTickCount(p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return;
+    }
+
+    /*  Account the item.  */
+    MBMaster_Sched_Account(
+        p_item,
+        ticksNow,
+        ticksEnd,
+        postError
+    );
+
+    /*  Notify the application.  */
+    if (p_item->cbComplete != (MBMASTER_COMPLETE_CB)0) {
+        p_item->cbComplete(
+            p_item->slave,
+            p_item->request,
+            p_item->response,
+            postError,
+            p_item->cbCompleteArg
+        );
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_GetStatistics()
+*
+* Description : Get the statistics of a poll item.
+*
+* Argument(s) : (1) p_sched         Pointer to the scheduler.
+*               (2) index           Index of the item (returned by MBMaster_Sched_AddItem()).
+*               (3) p_stats         Pointer to the variable that receives the statistics.
+*               (4) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_sched' or 'p_stats' is NULL.
+*                                       MB_ERROR_INVALIDPARAMETER      'index' is out of range.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The jitter is the delay between the release of a poll and the time it was posted.
+*               (2) An overrun is counted when a poll completes after its deadline, the releases that were
+*                   missed are skipped (instead of being polled back-to-back).
+*********************************************************************************************************
+*/
+
+void MBMaster_Sched_GetStatistics(
+    MBMASTER_SCHED             *p_sched,
+    CPU_SIZE_T                  index,
+    MBMASTER_SCHED_STATISTICS  *p_stats,
+    MB_ERROR                   *p_error
+) {
+    CPU_SR_ALLOC();
+
+    MBMASTER_SCHED_ITEM  *p_item;
+    MB_SYSTICK            ticksJitterLast;
+    MB_SYSTICK            ticksJitterMax;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_sched' parameter.  */
+    if (p_sched == (MBMASTER_SCHED*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_stats' parameter.  */
+    if (p_stats == (MBMASTER_SCHED_STATISTICS*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Check 'index' parameter.  */
+    if (index >= p_sched->itemCnt) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+    p_item = &(p_sched->items[index]);
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  Copy the statistics.  */
+    p_stats->cntPoll     = p_item->cntPoll;
+    p_stats->cntFail     = p_item->cntFail;
+    p_stats->cntOverrun  = p_item->cntOverrun;
+    ticksJitterLast      = p_item->jitterLast;
+    ticksJitterMax       = p_item->jitterMax;
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    /*  Convert the jitters to time.  */
+    p_stats->jitterLast = (MB_TIMESPAN)0U;
+    p_stats->jitterMax  = (MB_TIMESPAN)0U;
+    if (ticksJitterLast != (MB_SYSTICK)0U) {
+        p_stats->jitterLast = MBOS_TickCountToTime(ticksJitterLast, p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+    }
+    if (ticksJitterMax != (MB_SYSTICK)0U) {
+        p_stats->jitterMax = MBOS_TickCountToTime(ticksJitterMax, p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+    }
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_Account()
+*
+* Description : Update the statistics of a polled item and release its next poll.
+*
+* Argument(s) : (1) p_item          Pointer to the item.
+*               (2) ticks_start     Tick count when the poll was posted.
+*               (3) ticks_end       Tick count when the poll completed.
+*               (4) error           Error code of the poll.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBMaster_Sched_Account(
+    MBMASTER_SCHED_ITEM       *p_item,
+    MB_SYSTICK                 ticks_start,
+    MB_SYSTICK                 ticks_end,
+    MB_ERROR                   error
+) {
+    CPU_SR_ALLOC();
+
+    MB_SYSTICK  deadline;
+    MB_SYSTICK  ticksJitter;
+
+    /*  Get the deadline and the release jitter.  */
+    deadline    = (MB_SYSTICK)(p_item->release + p_item->period);
+    ticksJitter = (MB_SYSTICK)(ticks_start - p_item->release);
+
+    /*  Enter critical section.  */
+    CPU_CRITICAL_ENTER();
+
+    /*  Update the statistics.  */
+    ++(p_item->cntPoll);
+    if (error != MB_ERROR_NONE) {
+        ++(p_item->cntFail);
+    }
+    if (MBMASTER_SCHED_TICKBEFORE(deadline, ticks_end)) {
+        ++(p_item->cntOverrun);
+    }
+    p_item->jitterLast = ticksJitter;
+    if (ticksJitter > p_item->jitterMax) {
+        p_item->jitterMax = ticksJitter;
+    }
+
+    /*  Exit critical section.  */
+    CPU_CRITICAL_EXIT();
+
+    /*  Release the next poll (skip the releases that were missed, but keep the phase).  */
+    p_item->release = deadline;
+    if (!MBMASTER_SCHED_TICKBEFORE(ticks_end, p_item->release)) {
+        p_item->release += (MB_SYSTICK)(((MB_SYSTICK)(ticks_end - p_item->release) / p_item->period) * p_item->period);
+    }
+}
+
+
+#if (MB_CFG_MASTER_SCHED_COALESCE_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_GetReadRange()
+*
+* Description : Get the kind and the address range of the read request of an item.
+*
+* Argument(s) : (1) p_item          Pointer to the item.
+*               (2) p_start         Pointer to the variable that receives the start address.
+*               (3) p_quantity      Pointer to the variable that receives the quantity.
+*
+* Return(s)   : The kind (MBMASTER_SCHED_KIND_NONE if the item can't be coalesced).
+*********************************************************************************************************
+*/
+
+static CPU_INT08U MBMaster_Sched_GetReadRange(
+    MBMASTER_SCHED_ITEM       *p_item,
+    CPU_INT16U                *p_start,
+    CPU_INT16U                *p_quantity
+) {
+    CPU_INT08U  kind;
+
+    kind = MBMASTER_SCHED_KIND_NONE;
+
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READCOILS_EN == DEF_ENABLED)
+    if (p_item->cmdlet == MBMASTER_CMDLETDESCRIPTOR_READCOILS) {
+        *p_start    = ((MBMASTER_CMDLET_READCOILS_REQUEST*)(p_item->request))->coilStartAddress;
+        *p_quantity = ((MBMASTER_CMDLET_READCOILS_REQUEST*)(p_item->request))->coilQuantity;
+        kind        = MBMASTER_SCHED_KIND_COILS;
+    }
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READDISCRETEINPUTS_EN == DEF_ENABLED)
+    if (p_item->cmdlet == MBMASTER_CMDLETDESCRIPTOR_READDISCRETEINPUTS) {
+        *p_start    = ((MBMASTER_CMDLET_READDISCRETEINPUTS_REQUEST*)(p_item->request))->discreteInputStartAddress;
+        *p_quantity = ((MBMASTER_CMDLET_READDISCRETEINPUTS_REQUEST*)(p_item->request))->discreteInputQuantity;
+        kind        = MBMASTER_SCHED_KIND_DISCRETEINPUTS;
+    }
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READHOLDREGS_EN == DEF_ENABLED)
+    if (p_item->cmdlet == MBMASTER_CMDLETDESCRIPTOR_READHOLDINGREGISTERS) {
+        *p_start    = ((MBMASTER_CMDLET_READHOLDINGREGISTERS_REQUEST*)(p_item->request))->hregStartAddress;
+        *p_quantity = ((MBMASTER_CMDLET_READHOLDINGREGISTERS_REQUEST*)(p_item->request))->hregQuantity;
+        kind        = MBMASTER_SCHED_KIND_HOLDINGREGS;
+    }
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READINPUTREGS_EN == DEF_ENABLED)
+    if (p_item->cmdlet == MBMASTER_CMDLETDESCRIPTOR_READINPUTREGISTERS) {
+        *p_start    = ((MBMASTER_CMDLET_READINPUTREGISTERS_REQUEST*)(p_item->request))->iregStartAddress;
+        *p_quantity = ((MBMASTER_CMDLET_READINPUTREGISTERS_REQUEST*)(p_item->request))->iregQuantity;
+        kind        = MBMASTER_SCHED_KIND_INPUTREGS;
+    }
+#endif
+
+    /*  Requests with no item (which are bad requests) are not coalesced.  */
+    if ((kind != MBMASTER_SCHED_KIND_NONE) && (*p_quantity == (CPU_INT16U)0U)) {
+        kind = MBMASTER_SCHED_KIND_NONE;
+    }
+
+    return kind;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_Coalesce()
+*
+* Description : Collect the due items that can be merged with an item into one read request.
+*
+* Argument(s) : (1) p_sched         Pointer to the scheduler.
+*               (2) p_first         Pointer to the item (which is always the first merged item).
+*               (3) ticks_now       Current tick count.
+*               (4) p_coalesce      Pointer to the variable that receives the merged items.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Only one item is collected if the item is not a coalescable read request.
+*********************************************************************************************************
+*/
+
+static void MBMaster_Sched_Coalesce(
+    MBMASTER_SCHED            *p_sched,
+    MBMASTER_SCHED_ITEM       *p_first,
+    MB_SYSTICK                 ticks_now,
+    MBMASTER_SCHED_COALESCE   *p_coalesce
+) {
+    CPU_SIZE_T             cursor;
+    CPU_SIZE_T             merged;
+    MBMASTER_SCHED_ITEM   *p_item;
+    CPU_INT16U             itemStart;
+    CPU_INT16U             itemQuantity;
+    CPU_INT32U             itemEnd;
+    CPU_INT32U             spanStart;
+    CPU_INT32U             spanEnd;
+    CPU_INT32U             limit;
+    CPU_INT32U             gap;
+    CPU_INT32U             bufSize;
+    CPU_BOOLEAN            grown;
+
+    /*  The first item is always polled.  */
+    itemStart    = (CPU_INT16U)0U;
+    itemQuantity = (CPU_INT16U)0U;
+    p_coalesce->kind = MBMaster_Sched_GetReadRange(p_first, &itemStart, &itemQuantity);
+    p_coalesce->start = itemStart;
+    p_coalesce->end = (CPU_INT32U)itemStart + (CPU_INT32U)itemQuantity;
+    p_coalesce->items[0] = p_first;
+    p_coalesce->itemStart[0] = itemStart;
+    p_coalesce->itemEnd[0] = p_coalesce->end;
+    p_coalesce->itemCnt = (CPU_SIZE_T)1U;
+    if (p_coalesce->kind == MBMASTER_SCHED_KIND_NONE) {
+        return;
+    }
+
+    /*  Get the quantity limit (the response, with its byte count, must fit the master data buffer).  */
+    bufSize = (CPU_INT32U)(p_sched->master->bufRxTxSize);
+    if (bufSize > (CPU_INT32U)0x0100U) {
+        bufSize = (CPU_INT32U)0x0100U;
+    }
+    if (bufSize == (CPU_INT32U)0U) {
+        return;
+    }
+    if ((p_coalesce->kind == MBMASTER_SCHED_KIND_COILS) || (p_coalesce->kind == MBMASTER_SCHED_KIND_DISCRETEINPUTS)) {
+        limit = (bufSize - (CPU_INT32U)1U) << 3;
+        if (limit > MBMASTER_SCHED_MAXBITS) {
+            limit = MBMASTER_SCHED_MAXBITS;
+        }
+    } else {
+        limit = (bufSize - (CPU_INT32U)1U) >> 1;
+        if (limit > MBMASTER_SCHED_MAXREGS) {
+            limit = MBMASTER_SCHED_MAXREGS;
+        }
+    }
+
+    /*  Grow the merged range until no more item can be merged.  */
+    do {
+        grown = DEF_NO;
+
+        for (cursor = (CPU_SIZE_T)0U; cursor < p_sched->itemCnt; ++cursor) {
+            if (p_coalesce->itemCnt >= (CPU_SIZE_T)MB_CFG_MASTER_SCHED_COALESCE_MAX) {
+                return;
+            }
+            p_item = &(p_sched->items[cursor]);
+
+            /*  Only due reads of the same kind on the same slave can be merged.  */
+            if (p_item->slave != p_first->slave) {
+                continue;
+            }
+            if (MBMASTER_SCHED_TICKBEFORE(ticks_now, p_item->release)) {
+                continue;
+            }
+            if (MBMaster_Sched_GetReadRange(p_item, &itemStart, &itemQuantity) != p_coalesce->kind) {
+                continue;
+            }
+
+            /*  Skip merged items.  */
+            for (merged = (CPU_SIZE_T)0U; merged < p_coalesce->itemCnt; ++merged) {
+                if (p_coalesce->items[merged] == p_item) {
+                    break;
+                }
+            }
+            if (merged < p_coalesce->itemCnt) {
+                continue;
+            }
+
+            /*  Check the gap between the item and the merged range.  */
+            itemEnd = (CPU_INT32U)itemStart + (CPU_INT32U)itemQuantity;
+            if ((CPU_INT32U)itemStart > p_coalesce->end) {
+                gap = (CPU_INT32U)itemStart - p_coalesce->end;
+            } else if (itemEnd < (CPU_INT32U)(p_coalesce->start)) {
+                gap = (CPU_INT32U)(p_coalesce->start) - itemEnd;
+            } else {
+                gap = (CPU_INT32U)0U;
+            }
+            if (gap > (CPU_INT32U)(p_sched->coalesceGap)) {
+                continue;
+            }
+
+            /*  Check the quantity of the merged range.  */
+            spanStart = (CPU_INT32U)(p_coalesce->start);
+            if ((CPU_INT32U)itemStart < spanStart) {
+                spanStart = (CPU_INT32U)itemStart;
+            }
+            spanEnd = p_coalesce->end;
+            if (itemEnd > spanEnd) {
+                spanEnd = itemEnd;
+            }
+            if (spanEnd - spanStart > limit) {
+                continue;
+            }
+
+            /*  Merge the item.  */
+            p_coalesce->start = (CPU_INT16U)spanStart;
+            p_coalesce->end = spanEnd;
+            p_coalesce->items[p_coalesce->itemCnt] = p_item;
+            p_coalesce->itemStart[p_coalesce->itemCnt] = itemStart;
+            p_coalesce->itemEnd[p_coalesce->itemCnt] = itemEnd;
+            ++(p_coalesce->itemCnt);
+            grown = DEF_YES;
+        }
+    } while (grown);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_PostCoalesced()
+*
+* Description : Post the merged read request of coalesced items.
+*
+* Argument(s) : (1) p_sched         Pointer to the scheduler.
+*               (2) p_coalesce      Pointer to the merged items.
+*               (3) timeout         Timeout for receiving the response frame from the slave.
+*               (4) p_error         Pointer to the variable that receives error code from this function
+*                                   (see MBMaster_Post()).
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The response is demultiplexed to the items by MBMaster_Sched_Demux*() callbacks, which
+*                   receive 'p_coalesce' as their 'p_arg' parameter.
+*********************************************************************************************************
+*/
+
+static void MBMaster_Sched_PostCoalesced(
+    MBMASTER_SCHED            *p_sched,
+    MBMASTER_SCHED_COALESCE   *p_coalesce,
+    MB_TIMESPAN                timeout,
+    MB_ERROR                  *p_error
+) {
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READCOILS_EN == DEF_ENABLED)
+    MBMASTER_CMDLET_READCOILS_REQUEST               reqCoils;
+    MBMASTER_CMDLET_READCOILS_RESPONSE              resCoils;
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READDISCRETEINPUTS_EN == DEF_ENABLED)
+    MBMASTER_CMDLET_READDISCRETEINPUTS_REQUEST      reqDiscreteInputs;
+    MBMASTER_CMDLET_READDISCRETEINPUTS_RESPONSE     resDiscreteInputs;
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READHOLDREGS_EN == DEF_ENABLED)
+    MBMASTER_CMDLET_READHOLDINGREGISTERS_REQUEST    reqHoldingRegs;
+    MBMASTER_CMDLET_READHOLDINGREGISTERS_RESPONSE   resHoldingRegs;
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READINPUTREGS_EN == DEF_ENABLED)
+    MBMASTER_CMDLET_READINPUTREGISTERS_REQUEST      reqInputRegs;
+    MBMASTER_CMDLET_READINPUTREGISTERS_RESPONSE     resInputRegs;
+#endif
+
+    MBMASTER_CMDLET                                *cmdlet;
+    void                                           *request;
+    void                                           *response;
+    CPU_INT16U                                      quantity;
+
+    /*  Get the quantity of the merged range.  */
+    quantity = (CPU_INT16U)(p_coalesce->end - (CPU_INT32U)(p_coalesce->start));
+
+    /*  Make the merged request.  */
+    switch (p_coalesce->kind) {
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READCOILS_EN == DEF_ENABLED)
+        case MBMASTER_SCHED_KIND_COILS:
+            reqCoils.coilStartAddress             = p_coalesce->start;
+            reqCoils.coilQuantity                 = quantity;
+            resCoils.cbException                  = MBMaster_Sched_DemuxException;
+            resCoils.cbCoilValueStart             = MBMaster_Sched_DemuxStart;
+            resCoils.cbCoilValueUpdate            = MBMaster_Sched_DemuxBit;
+            resCoils.cbCoilValueEnd               = MBMaster_Sched_DemuxEnd;
+            cmdlet   = MBMASTER_CMDLETDESCRIPTOR_READCOILS;
+            request  = (void*)&(reqCoils);
+            response = (void*)&(resCoils);
+            break;
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READDISCRETEINPUTS_EN == DEF_ENABLED)
+        case MBMASTER_SCHED_KIND_DISCRETEINPUTS:
+            reqDiscreteInputs.discreteInputStartAddress   = p_coalesce->start;
+            reqDiscreteInputs.discreteInputQuantity       = quantity;
+            resDiscreteInputs.cbException                 = MBMaster_Sched_DemuxException;
+            resDiscreteInputs.cbDiscreteInputValueStart   = MBMaster_Sched_DemuxStart;
+            resDiscreteInputs.cbDiscreteInputValueUpdate  = MBMaster_Sched_DemuxBit;
+            resDiscreteInputs.cbDiscreteInputValueEnd     = MBMaster_Sched_DemuxEnd;
+            cmdlet   = MBMASTER_CMDLETDESCRIPTOR_READDISCRETEINPUTS;
+            request  = (void*)&(reqDiscreteInputs);
+            response = (void*)&(resDiscreteInputs);
+            break;
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READHOLDREGS_EN == DEF_ENABLED)
+        case MBMASTER_SCHED_KIND_HOLDINGREGS:
+            reqHoldingRegs.hregStartAddress       = p_coalesce->start;
+            reqHoldingRegs.hregQuantity           = quantity;
+            resHoldingRegs.cbException            = MBMaster_Sched_DemuxException;
+            resHoldingRegs.cbHRegValueStart       = MBMaster_Sched_DemuxStart;
+            resHoldingRegs.cbHRegValueUpdate      = MBMaster_Sched_DemuxReg;
+            resHoldingRegs.cbHRegValueEnd         = MBMaster_Sched_DemuxEnd;
+            cmdlet   = MBMASTER_CMDLETDESCRIPTOR_READHOLDINGREGISTERS;
+            request  = (void*)&(reqHoldingRegs);
+            response = (void*)&(resHoldingRegs);
+            break;
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READINPUTREGS_EN == DEF_ENABLED)
+        case MBMASTER_SCHED_KIND_INPUTREGS:
+            reqInputRegs.iregStartAddress         = p_coalesce->start;
+            reqInputRegs.iregQuantity             = quantity;
+            resInputRegs.cbException              = MBMaster_Sched_DemuxException;
+            resInputRegs.cbIRegValueStart         = MBMaster_Sched_DemuxStart;
+            resInputRegs.cbIRegValueUpdate        = MBMaster_Sched_DemuxReg;
+            resInputRegs.cbIRegValueEnd           = MBMaster_Sched_DemuxEnd;
+            cmdlet   = MBMASTER_CMDLETDESCRIPTOR_READINPUTREGISTERS;
+            request  = (void*)&(reqInputRegs);
+            response = (void*)&(resInputRegs);
+            break;
+#endif
+        default:
+            *p_error = MB_ERROR_INVALIDPARAMETER;
+            return;
+    }
+
+    /*  Post the merged request.  */
+    MBMaster_Post(
+        p_sched->master,
+        p_coalesce->items[0]->slave,
+        cmdlet,
+        request,
+        response,
+        (void*)p_coalesce,
+        timeout,
+        p_error
+    );
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_GetNotifyCallback()
+*
+* Description : Get the start (or end) callback of the response object of an item.
+*
+* Argument(s) : (1) kind            Kind of the read request.
+*               (2) p_response      Pointer to the response object.
+*               (3) end             DEF_YES to get the end callback, DEF_NO to get the start callback.
+*
+* Return(s)   : The callback (NULL if not set).
+*********************************************************************************************************
+*/
+
+static MBMASTER_SCHED_NOTIFY_CB MBMaster_Sched_GetNotifyCallback(
+    CPU_INT08U                 kind,
+    void                      *p_response,
+    CPU_BOOLEAN                end
+) {
+    switch (kind) {
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READCOILS_EN == DEF_ENABLED)
+        case MBMASTER_SCHED_KIND_COILS:
+            if (end) {
+                return (MBMASTER_SCHED_NOTIFY_CB)(((MBMASTER_CMDLET_READCOILS_RESPONSE*)p_response)->cbCoilValueEnd);
+            }
+            return (MBMASTER_SCHED_NOTIFY_CB)(((MBMASTER_CMDLET_READCOILS_RESPONSE*)p_response)->cbCoilValueStart);
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READDISCRETEINPUTS_EN == DEF_ENABLED)
+        case MBMASTER_SCHED_KIND_DISCRETEINPUTS:
+            if (end) {
+                return (MBMASTER_SCHED_NOTIFY_CB)(((MBMASTER_CMDLET_READDISCRETEINPUTS_RESPONSE*)p_response)->cbDiscreteInputValueEnd);
+            }
+            return (MBMASTER_SCHED_NOTIFY_CB)(((MBMASTER_CMDLET_READDISCRETEINPUTS_RESPONSE*)p_response)->cbDiscreteInputValueStart);
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READHOLDREGS_EN == DEF_ENABLED)
+        case MBMASTER_SCHED_KIND_HOLDINGREGS:
+            if (end) {
+                return (MBMASTER_SCHED_NOTIFY_CB)(((MBMASTER_CMDLET_READHOLDINGREGISTERS_RESPONSE*)p_response)->cbHRegValueEnd);
+            }
+            return (MBMASTER_SCHED_NOTIFY_CB)(((MBMASTER_CMDLET_READHOLDINGREGISTERS_RESPONSE*)p_response)->cbHRegValueStart);
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READINPUTREGS_EN == DEF_ENABLED)
+        case MBMASTER_SCHED_KIND_INPUTREGS:
+            if (end) {
+                return (MBMASTER_SCHED_NOTIFY_CB)(((MBMASTER_CMDLET_READINPUTREGISTERS_RESPONSE*)p_response)->cbIRegValueEnd);
+            }
+            return (MBMASTER_SCHED_NOTIFY_CB)(((MBMASTER_CMDLET_READINPUTREGISTERS_RESPONSE*)p_response)->cbIRegValueStart);
+#endif
+        default:
+            return (MBMASTER_SCHED_NOTIFY_CB)0;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_DemuxException()
+*
+* Description : Pass the exception code of a merged request to all merged items.
+*
+* Argument(s) : (1) ec              The exception code.
+*               (2) p_arg           Pointer to the merged items (MBMASTER_SCHED_COALESCE).
+*               (3) p_error         Pointer to the variable that receives error code from this function.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBMaster_Sched_DemuxException(
+    CPU_INT08U                 ec,
+    void                      *p_arg,
+    MB_ERROR                  *p_error
+) {
+    MBMASTER_SCHED_COALESCE   *p_coalesce;
+    MBMASTER_SCHED_ITEM       *p_item;
+    MBMASTER_EXCEPTION_CB      cb;
+    CPU_SIZE_T                 cursor;
+
+    p_coalesce = (MBMASTER_SCHED_COALESCE*)p_arg;
+
+    /*  No error by default.  */
+    *p_error = MB_ERROR_NONE;
+
+    for (cursor = (CPU_SIZE_T)0U; cursor < p_coalesce->itemCnt; ++cursor) {
+        p_item = p_coalesce->items[cursor];
+
+        /*  Get the exception callback of the item.  */
+        switch (p_coalesce->kind) {
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READCOILS_EN == DEF_ENABLED)
+            case MBMASTER_SCHED_KIND_COILS:
+                cb = ((MBMASTER_CMDLET_READCOILS_RESPONSE*)(p_item->response))->cbException;
+                break;
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READDISCRETEINPUTS_EN == DEF_ENABLED)
+            case MBMASTER_SCHED_KIND_DISCRETEINPUTS:
+                cb = ((MBMASTER_CMDLET_READDISCRETEINPUTS_RESPONSE*)(p_item->response))->cbException;
+                break;
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READHOLDREGS_EN == DEF_ENABLED)
+            case MBMASTER_SCHED_KIND_HOLDINGREGS:
+                cb = ((MBMASTER_CMDLET_READHOLDINGREGISTERS_RESPONSE*)(p_item->response))->cbException;
+                break;
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READINPUTREGS_EN == DEF_ENABLED)
+            case MBMASTER_SCHED_KIND_INPUTREGS:
+                cb = ((MBMASTER_CMDLET_READINPUTREGISTERS_RESPONSE*)(p_item->response))->cbException;
+                break;
+#endif
+            default:
+                cb = (MBMASTER_EXCEPTION_CB)0;
+                break;
+        }
+
+        /*  Invoke the callback.  */
+        if (cb != (MBMASTER_EXCEPTION_CB)0) {
+            cb(ec, p_item->responseArg, p_error);
+            if (*p_error != MB_ERROR_NONE) {
+                return;
+            }
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_DemuxStart()
+*
+* Description : Notify all merged items that the values are going to be transferred.
+*
+* Argument(s) : (1) p_arg           Pointer to the merged items (MBMASTER_SCHED_COALESCE).
+*               (2) p_error         Pointer to the variable that receives error code from this function.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBMaster_Sched_DemuxStart(
+    void                      *p_arg,
+    MB_ERROR                  *p_error
+) {
+    MBMASTER_SCHED_COALESCE   *p_coalesce;
+    MBMASTER_SCHED_NOTIFY_CB   cb;
+    CPU_SIZE_T                 cursor;
+
+    p_coalesce = (MBMASTER_SCHED_COALESCE*)p_arg;
+
+    /*  No error by default.  */
+    *p_error = MB_ERROR_NONE;
+
+    for (cursor = (CPU_SIZE_T)0U; cursor < p_coalesce->itemCnt; ++cursor) {
+        cb = MBMaster_Sched_GetNotifyCallback(
+            p_coalesce->kind,
+            p_coalesce->items[cursor]->response,
+            DEF_NO
+        );
+        if (cb != (MBMASTER_SCHED_NOTIFY_CB)0) {
+            cb(p_coalesce->items[cursor]->responseArg, p_error);
+            if (*p_error != MB_ERROR_NONE) {
+                return;
+            }
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_DemuxEnd()
+*
+* Description : Notify all merged items that all values have been transferred.
+*
+* Argument(s) : (1) p_arg           Pointer to the merged items (MBMASTER_SCHED_COALESCE).
+*               (2) p_error         Pointer to the variable that receives error code from this function.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBMaster_Sched_DemuxEnd(
+    void                      *p_arg,
+    MB_ERROR                  *p_error
+) {
+    MBMASTER_SCHED_COALESCE   *p_coalesce;
+    MBMASTER_SCHED_NOTIFY_CB   cb;
+    CPU_SIZE_T                 cursor;
+
+    p_coalesce = (MBMASTER_SCHED_COALESCE*)p_arg;
+
+    /*  No error by default.  */
+    *p_error = MB_ERROR_NONE;
+
+    for (cursor = (CPU_SIZE_T)0U; cursor < p_coalesce->itemCnt; ++cursor) {
+        cb = MBMaster_Sched_GetNotifyCallback(
+            p_coalesce->kind,
+            p_coalesce->items[cursor]->response,
+            DEF_YES
+        );
+        if (cb != (MBMASTER_SCHED_NOTIFY_CB)0) {
+            cb(p_coalesce->items[cursor]->responseArg, p_error);
+            if (*p_error != MB_ERROR_NONE) {
+                return;
+            }
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_DemuxBit()
+*
+* Description : Pass the value of a coil (or discrete input) to the merged items that requested it.
+*
+* Argument(s) : (1) address         Address of the coil (or discrete input).
+*               (2) value           Value of the coil (or discrete input).
+*               (3) p_arg           Pointer to the merged items (MBMASTER_SCHED_COALESCE).
+*               (4) p_error         Pointer to the variable that receives error code from this function.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBMaster_Sched_DemuxBit(
+    CPU_INT16U                 address,
+    CPU_BOOLEAN                value,
+    void                      *p_arg,
+    MB_ERROR                  *p_error
+) {
+    MBMASTER_SCHED_COALESCE   *p_coalesce;
+    MBMASTER_SCHED_ITEM       *p_item;
+    CPU_SIZE_T                 cursor;
+
+    p_coalesce = (MBMASTER_SCHED_COALESCE*)p_arg;
+
+    /*  No error by default.  */
+    *p_error = MB_ERROR_NONE;
+
+    for (cursor = (CPU_SIZE_T)0U; cursor < p_coalesce->itemCnt; ++cursor) {
+        /*  Skip the items that didn't request the address (i.e. gap-filled addresses).  */
+        if ((address < p_coalesce->itemStart[cursor]) || ((CPU_INT32U)address >= p_coalesce->itemEnd[cursor])) {
+            continue;
+        }
+        p_item = p_coalesce->items[cursor];
+
+        switch (p_coalesce->kind) {
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READCOILS_EN == DEF_ENABLED)
+            case MBMASTER_SCHED_KIND_COILS:
+                if (((MBMASTER_CMDLET_READCOILS_RESPONSE*)(p_item->response))->cbCoilValueUpdate != (MBMASTER_COILVALUE_UPDATE_CB)0) {
+                    ((MBMASTER_CMDLET_READCOILS_RESPONSE*)(p_item->response))->cbCoilValueUpdate(
+                        address,
+                        value,
+                        p_item->responseArg,
+                        p_error
+                    );
+                }
+                break;
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READDISCRETEINPUTS_EN == DEF_ENABLED)
+            case MBMASTER_SCHED_KIND_DISCRETEINPUTS:
+                if (((MBMASTER_CMDLET_READDISCRETEINPUTS_RESPONSE*)(p_item->response))->cbDiscreteInputValueUpdate != (MBMASTER_DISCRETEINPUTVALUE_UPDATE_CB)0) {
+                    ((MBMASTER_CMDLET_READDISCRETEINPUTS_RESPONSE*)(p_item->response))->cbDiscreteInputValueUpdate(
+                        address,
+                        value,
+                        p_item->responseArg,
+                        p_error
+                    );
+                }
+                break;
+#endif
+            default:
+                break;
+        }
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_DemuxReg()
+*
+* Description : Pass the value of a register to the merged items that requested it.
+*
+* Argument(s) : (1) address         Address of the register.
+*               (2) value           Value of the register.
+*               (3) p_arg           Pointer to the merged items (MBMASTER_SCHED_COALESCE).
+*               (4) p_error         Pointer to the variable that receives error code from this function.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBMaster_Sched_DemuxReg(
+    CPU_INT16U                 address,
+    CPU_INT16U                 value,
+    void                      *p_arg,
+    MB_ERROR                  *p_error
+) {
+    MBMASTER_SCHED_COALESCE   *p_coalesce;
+    MBMASTER_SCHED_ITEM       *p_item;
+    CPU_SIZE_T                 cursor;
+
+    p_coalesce = (MBMASTER_SCHED_COALESCE*)p_arg;
+
+    /*  No error by default.  */
+    *p_error = MB_ERROR_NONE;
+
+    for (cursor = (CPU_SIZE_T)0U; cursor < p_coalesce->itemCnt; ++cursor) {
+        /*  Skip the items that didn't request the address (i.e. gap-filled addresses).  */
+        if ((address < p_coalesce->itemStart[cursor]) || ((CPU_INT32U)address >= p_coalesce->itemEnd[cursor])) {
+            continue;
+        }
+        p_item = p_coalesce->items[cursor];
+
+        switch (p_coalesce->kind) {
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READHOLDREGS_EN == DEF_ENABLED)
+            case MBMASTER_SCHED_KIND_HOLDINGREGS:
+                if (((MBMASTER_CMDLET_READHOLDINGREGISTERS_RESPONSE*)(p_item->response))->cbHRegValueUpdate != (MBMASTER_HREGVALUE_UPDATE_CB)0) {
+                    ((MBMASTER_CMDLET_READHOLDINGREGISTERS_RESPONSE*)(p_item->response))->cbHRegValueUpdate(
+                        address,
+                        value,
+                        p_item->responseArg,
+                        p_error
+                    );
+                }
+                break;
+#endif
+#if (MB_CFG_MASTER_BUILTIN_CMDLET_READINPUTREGS_EN == DEF_ENABLED)
+            case MBMASTER_SCHED_KIND_INPUTREGS:
+                if (((MBMASTER_CMDLET_READINPUTREGISTERS_RESPONSE*)(p_item->response))->cbIRegValueUpdate != (MBMASTER_IREGVALUE_UPDATE_CB)0) {
+                    ((MBMASTER_CMDLET_READINPUTREGISTERS_RESPONSE*)(p_item->response))->cbIRegValueUpdate(
+                        address,
+                        value,
+                        p_item->responseArg,
+                        p_error
+                    );
+                }
+                break;
+#endif
+            default:
+                break;
+        }
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+    }
+}
+
+#endif  /*  #if (MB_CFG_MASTER_SCHED_COALESCE_EN == DEF_ENABLED)  */
+
+#endif  /*  #if (MB_CFG_MASTER_EN == DEF_ENABLED) && (MB_CFG_MASTER_SCHED_EN == DEF_ENABLED)  */
\ No newline at end of file
@@ -0,0 +1,303 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                             MASTER MODULE
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+* File      : MBMASTER_SCHED.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef MBMASTER_SCHED_H__
+#define MBMASTER_SCHED_H__
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include <mbmaster_cfg.h>
+#include <mbmaster.h>
+
+#include <mbmaster_cmdlet_common.h>
+
+#include <mb_os_types.h>
+
+#include <mb_types.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+
+#if (MB_CFG_MASTER_EN == DEF_ENABLED) && (MB_CFG_MASTER_SCHED_EN == DEF_ENABLED)
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+typedef struct {
+    MB_COUNTERVALUE         cntPoll;
+    MB_COUNTERVALUE         cntFail;
+    MB_COUNTERVALUE         cntOverrun;
+
+    MB_TIMESPAN             jitterLast;
+    MB_TIMESPAN             jitterMax;
+} MBMASTER_SCHED_STATISTICS;
+
+typedef struct {
+    CPU_INT08U              slave;
+    MBMASTER_CMDLET        *cmdlet;
+    void                   *request;
+    void                   *response;
+    void                   *responseArg;
+    MB_TIMESPAN             timeout;
+
+    MB_SYSTICK              period;
+    CPU_INT08U              priority;
+    MB_SYSTICK              release;
+
+    MBMASTER_COMPLETE_CB    cbComplete;
+    void                   *cbCompleteArg;
+
+    MB_COUNTERVALUE         cntPoll;
+    MB_COUNTERVALUE         cntFail;
+    MB_COUNTERVALUE         cntOverrun;
+
+    MB_SYSTICK              jitterLast;
+    MB_SYSTICK              jitterMax;
+} MBMASTER_SCHED_ITEM;
+
+typedef struct {
+    MBMASTER               *master;
+
+    MBMASTER_SCHED_ITEM    *items;
+    CPU_SIZE_T              itemCnt;
+    CPU_SIZE_T              itemCapacity;
+
+#if (MB_CFG_MASTER_SCHED_COALESCE_EN == DEF_ENABLED)
+    CPU_INT16U              coalesceGap;
+#endif
+} MBMASTER_SCHED;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_Initialize()
+*
+* Description : Initialize a polling scheduler (with no poll item).
+*
+* Argument(s) : (1) p_sched         Pointer to the scheduler.
+*               (2) p_master        Pointer to the master object that the poll items are posted to.
+*               (3) p_items         Pointer to the first element of the poll item storage.
+*               (4) capacity        Count of elements of the poll item storage.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    'p_sched' or 'p_master' is NULL, or 'p_items' is
+*                                                                 NULL while 'capacity' is not zero.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBMaster_Sched_Initialize(
+    MBMASTER_SCHED          *p_sched,
+    MBMASTER                *p_master,
+    MBMASTER_SCHED_ITEM     *p_items,
+    CPU_SIZE_T               capacity,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_AddItem()
+*
+* Description : Add a poll item to a scheduler.
+*
+* Argument(s) : (1) p_sched         Pointer to the scheduler.
+*               (2) slave           Slave address.
+*               (3) p_cmdlet        Pointer to the command-let object.
+*               (4) p_request       Pointer to the request object.
+*               (5) p_response      Pointer to the response object.
+*               (6) p_responsearg   'p_arg' parameter passed to response callbacks.
+*               (7) timeout         Timeout for receiving the response frame from the slave (unit: milliseconds,
+*                                   0 to wait infinitely).
+*               (8) period          Poll period (unit: milliseconds).
+*               (9) priority        Priority (lower value is more urgent) of the item when the deadlines of
+*                                   multiple items are the same.
+*               (10) cb_complete    Completion callback (NULL if not used).
+*               (11) p_completearg  'p_arg' parameter passed to the completion callback.
+*               (12) p_error        Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_sched', 'p_cmdlet', 'p_request' or 'p_response'
+*                                                                      is NULL.
+*                                       MB_ERROR_INVALIDPARAMETER      'slave' is the broadcast address.
+*                                       MB_ERROR_UNDERFLOW             'period' equals to zero.
+*                                       MB_ERROR_OVERFLOW              'period' or 'timeout' exceeds maximum allowed value.
+*                                       MB_ERROR_MASTER_SCHEDFULL      The poll item storage is full.
+*                                       MB_ERROR_OS_TIME_FAILEDGET     Failed to get system tick count.
+*
+* Return(s)   : Index of the item (used by MBMaster_Sched_GetStatistics()).
+*
+* Note(s)     : (1) The item is due immediately, then once per 'period'.
+*               (2) Items can't be added while the scheduler is running.
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  MBMaster_Sched_AddItem(
+    MBMASTER_SCHED          *p_sched,
+    CPU_INT08U               slave,
+    MBMASTER_CMDLET         *p_cmdlet,
+    void                    *p_request,
+    void                    *p_response,
+    void                    *p_responsearg,
+    MB_TIMESPAN              timeout,
+    MB_TIMESPAN              period,
+    CPU_INT08U               priority,
+    MBMASTER_COMPLETE_CB     cb_complete,
+    void                    *p_completearg,
+    MB_ERROR                *p_error
+);
+
+
+#if (MB_CFG_MASTER_SCHED_COALESCE_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_SetCoalesceGap()
+*
+* Description : Set the gap-fill threshold of read coalescing of a scheduler.
+*
+* Argument(s) : (1) p_sched         Pointer to the scheduler.
+*               (2) gap             Maximum count of unrequested registers (or bits) that may be read between
+*                                   two merged items (0 to merge adjacent or overlapping items only).
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_sched' is NULL.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Filling a gap makes the slave return the registers (or bits) in the gap, so the gap must
+*                   only contain readable addresses (otherwise the slave replies an exception to the merged
+*                   request and all merged items fail).
+*********************************************************************************************************
+*/
+
+void MBMaster_Sched_SetCoalesceGap(
+    MBMASTER_SCHED          *p_sched,
+    CPU_INT16U               gap,
+    MB_ERROR                *p_error
+);
+
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_Run()
+*
+* Description : Poll the most urgent due item of a scheduler (or wait until the next item is due).
+*
+* Argument(s) : (1) p_sched         Pointer to the scheduler.
+*               (2) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_sched' is NULL.
+*                                       MB_ERROR_OS_TIME_FAILEDDELAY   Failed to delay.
+*                                       MB_ERROR_OS_TIME_FAILEDGET     Failed to get system tick count.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Due items are polled earliest-deadline-first, the deadline of an item is its next release
+*                   (i.e. the end of its current period). If no item is due, the calling task sleeps until the
+*                   earliest release, so the line is kept busy whenever any item is due.
+*               (2) The error of a poll itself is counted in the statistics of the item and is passed to its
+*                   completion callback (not to 'p_error').
+*               (3) Only one task is allowed to run a scheduler and the master must not be posted to by other
+*                   tasks, typically:
+*
+*                       while (DEF_YES) {
+*                           MBMaster_Sched_Run(&sched, &error);
+*                       }
+*               (4) If MB_CFG_MASTER_SCHED_COALESCE_EN is enabled, due items that read coils, discrete inputs,
+*                   holding registers or input registers (with built-in commands) of the same slave are merged
+*                   into one request (up to 2000 bits or 125 registers, and the size of the master data buffer)
+*                   if the gaps between them don't exceed the gap-fill threshold. The values in the response are
+*                   passed to the response callbacks of each item whose range contains them.
+*********************************************************************************************************
+*/
+
+void MBMaster_Sched_Run(
+    MBMASTER_SCHED          *p_sched,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBMaster_Sched_GetStatistics()
+*
+* Description : Get the statistics of a poll item.
+*
+* Argument(s) : (1) p_sched         Pointer to the scheduler.
+*               (2) index           Index of the item (returned by MBMaster_Sched_AddItem()).
+*               (3) p_stats         Pointer to the variable that receives the statistics.
+*               (4) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_sched' or 'p_stats' is NULL.
+*                                       MB_ERROR_INVALIDPARAMETER      'index' is out of range.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The jitter is the delay between the release of a poll and the time it was posted.
+*               (2) An overrun is counted when a poll completes after its deadline, the releases that were
+*                   missed are skipped (instead of being polled back-to-back).
+*********************************************************************************************************
+*/
+
+void MBMaster_Sched_GetStatistics(
+    MBMASTER_SCHED             *p_sched,
+    CPU_SIZE_T                  index,
+    MBMASTER_SCHED_STATISTICS  *p_stats,
+    MB_ERROR                   *p_error
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /*  #if (MB_CFG_MASTER_EN == DEF_ENABLED) && (MB_CFG_MASTER_SCHED_EN == DEF_ENABLED)  */
+
+#endif
\ No newline at end of file
@@ -163,6 +163,58 @@ void MBSlave_Initialize(
 }
 
 
+#if (MB_CFG_SLAVE_INPLACERESPONSE_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                    MBSlave_InitializeInPlace()
+*
+* Description : Initialize a Modbus slave that uses one single buffer for both RX and TX.
+*
+* Argument(s) : (1) p_slave         Pointer to the slave object.
+*               (2) p_slavectable   Pointer to the command table of the slave.
+*               (3) ifnbr           Modbus device interface ID of the slave.
+*               (4) p_buf           Pointer to the first element of the RX/TX buffer.
+*               (5) buf_size        Size of the RX/TX buffer.
+*               (6) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    One of following error occurred:
+*
+*                                                                     (1) 'p_slave' is NULL.
+*                                                                     (2) 'p_slavectable' is NULL.
+*                                                                     (3) 'p_buf' is NULL while 'buf_size' is not zero.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The response data is built over the request data that was already consumed, so all 
+*                   command implementations in 'p_slavectable' must support in-place response (see 
+*                   MBSLAVE_CMDLET_FUNC). All built-in command implementations support it.
+*********************************************************************************************************
+*/
+
+void MBSlave_InitializeInPlace(
+    MBSLAVE             *p_slave,
+    MBSLAVE_CMDTABLE    *p_slavectable,
+    MB_IFINDEX           ifnbr,
+    CPU_INT08U          *p_buf,
+    CPU_SIZE_T           buf_size,
+    MB_ERROR            *p_error
+) {
+    /*  Share the buffer between the request and the response.  */
+    MBSlave_Initialize(
+        p_slave,
+        p_slavectable,
+        ifnbr,
+        p_buf,
+        buf_size,
+        p_buf,
+        buf_size,
+        p_error
+    );
+}
+#endif
+
+
 #if (MB_CFG_SLAVE_LISTENONLY_EN == DEF_ENABLED)
 /*
 *********************************************************************************************************
@@ -847,7 +899,7 @@ MBSLAVE_CLRCOUNTERVAL_EXIT:
 *                                       MB_ERROR_OS_FGRP_FAILEDPEND              Failed to pend on a flag group object.
 *                                       MB_ERROR_OS_FGRP_FAILEDPOST              Failed to post to a flag group object.
 *                                       MB_ERROR_OS_MUTEX_FAILEDPEND             Failed to pend on a mutex object.
-*                                       MB_ERROR_OS_TIMER_FAILEDCREATE           Failed to create timer object.
+*                                       MB_ERROR_OS_TIMER_FAILEDSET              Failed to set a timer object.
 *                                       MB_ERROR_OS_TIMER_FAILEDSTART            Failed to start a timer object.
 *                                       MB_ERROR_OS_TIME_FAILEDDELAY             Failed to delay.
 *
@@ -140,6 +140,26 @@
 #define MB_CFG_SLAVE_SLAVENORESPONSECOUNTER_EN               DEF_DISABLED
 #endif
 
+#ifndef MB_CFG_SLAVE_INPLACERESPONSE_EN
+#define MB_CFG_SLAVE_INPLACERESPONSE_EN                      DEF_DISABLED
+#endif
+
+#ifndef MB_CFG_SLAVE_REGRANGECALLBACK_EN
+#define MB_CFG_SLAVE_REGRANGECALLBACK_EN                     DEF_DISABLED
+#endif
+
+#ifndef MB_CFG_SLAVE_BITRANGECALLBACK_EN
+#define MB_CFG_SLAVE_BITRANGECALLBACK_EN                     DEF_DISABLED
+#endif
+
+#ifndef MB_CFG_SLAVE_DATAMODEL_EN
+#define MB_CFG_SLAVE_DATAMODEL_EN                            DEF_DISABLED
+#endif
+
+#ifndef MB_CFG_SLAVE_REGMAP_EN
+#define MB_CFG_SLAVE_REGMAP_EN                               DEF_DISABLED
+#endif
+
 
 /*
 *********************************************************************************************************
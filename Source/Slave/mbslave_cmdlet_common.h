@@ -51,7 +51,14 @@ extern  "C" {
 *********************************************************************************************************
 */
 
-/*  Command implementation type.  */
+/*
+ *  Command implementation type.
+ *
+ *  Note(s): (1) 'p_response_buffer' may point to the same buffer as 'p_request_data' (see 
+ *               MBSlave_InitializeInPlace()). To support this, a command implementation must not write 
+ *               the n-th byte of the response data before it has read the n-th byte of the request data 
+ *               (and must not read the request data again after the response data overwrote it).
+ */
 typedef void (*MBSLAVE_CMDLET_FUNC)(
     CPU_INT08U                                 request_fncode,
     CPU_INT08U                                *p_request_data,
@@ -127,6 +134,106 @@ typedef void (*MBSLAVE_WRITEHOLDINGREGISTER_CB)(
     MB_ERROR    *p_error
 );
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+/*
+ *  Register range callback types (optional, used in preference to the per-register callbacks if not NULL).
+ *
+ *  Note(s): (1) 'p_values' points to 'quantity' big-endian 16-bit values (2 * 'quantity' bytes, not aligned), 
+ *               see MBUtil_CopyUInt16ToBE() and MBUtil_CopyUInt16FromBE().
+ *           (2) The address range was already validated with the range validation callback (if not NULL) or with 
+ *               the per-register validation callback (the start and end address only).
+ *           (3) The range validation callbacks are optional, if not NULL, they are called once per address range 
+ *               instead of calling the per-register validation callback with the start and end address.
+ */
+typedef CPU_BOOLEAN (*MBSLAVE_VALIDATEINPUTREGISTERS_CB)(
+    CPU_INT16U        address, 
+    CPU_INT16U        quantity,
+    void             *p_arg, 
+    MB_ERROR         *p_error
+);
+
+typedef CPU_BOOLEAN (*MBSLAVE_VALIDATEHOLDINGREGISTERS_CB)(
+    CPU_INT16U        address, 
+    CPU_INT16U        quantity,
+    void             *p_arg, 
+    MB_ERROR         *p_error
+);
+
+typedef void (*MBSLAVE_READINPUTREGISTERS_CB)(
+    CPU_INT16U        address, 
+    CPU_INT16U        quantity,
+    CPU_INT08U       *p_values,
+    void             *p_arg, 
+    MB_ERROR         *p_error
+);
+
+typedef void (*MBSLAVE_READHOLDINGREGISTERS_CB)(
+    CPU_INT16U        address, 
+    CPU_INT16U        quantity,
+    CPU_INT08U       *p_values,
+    void             *p_arg, 
+    MB_ERROR         *p_error
+);
+
+typedef void (*MBSLAVE_WRITEHOLDINGREGISTERS_CB)(
+    CPU_INT16U        address, 
+    CPU_INT16U        quantity,
+    const CPU_INT08U *p_values,
+    void             *p_arg, 
+    MB_ERROR         *p_error
+);
+#endif
+
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+/*
+ *  Bit range callback types (optional, used in preference to the per-bit callbacks if not NULL).
+ *
+ *  Note(s): (1) 'p_bits' points to 'quantity' packed bits (LSB of the first byte is the bit at 'address'), 
+ *               see MBUtil_ExtractBits() and MBUtil_InsertBits().
+ *           (2) The address range was already validated with the range validation callback (if not NULL) or with 
+ *               the per-bit validation callback (the start and end address only).
+ *           (3) The range validation callbacks are optional, if not NULL, they are called once per address range 
+ *               instead of calling the per-bit validation callback with the start and end address.
+ */
+typedef CPU_BOOLEAN (*MBSLAVE_VALIDATECOILS_CB)(
+    CPU_INT16U        address, 
+    CPU_INT16U        quantity,
+    void             *p_arg, 
+    MB_ERROR         *p_error
+);
+
+typedef CPU_BOOLEAN (*MBSLAVE_VALIDATEDISCRETEINPUTS_CB)(
+    CPU_INT16U        address, 
+    CPU_INT16U        quantity,
+    void             *p_arg, 
+    MB_ERROR         *p_error
+);
+
+typedef void (*MBSLAVE_READCOILS_CB)(
+    CPU_INT16U        address, 
+    CPU_INT16U        quantity,
+    CPU_INT08U       *p_bits,
+    void             *p_arg, 
+    MB_ERROR         *p_error
+);
+
+typedef void (*MBSLAVE_READDISCRETEINPUTS_CB)(
+    CPU_INT16U        address, 
+    CPU_INT16U        quantity,
+    CPU_INT08U       *p_bits,
+    void             *p_arg, 
+    MB_ERROR         *p_error
+);
+
+typedef void (*MBSLAVE_WRITECOILS_CB)(
+    CPU_INT16U        address, 
+    CPU_INT16U        quantity,
+    const CPU_INT08U *p_bits,
+    void             *p_arg, 
+    MB_ERROR         *p_error
+);
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -78,6 +78,7 @@
 *
 * Note(s)     : (1) This function is NOT thread(task)-safe.
 *               (2) The 'p_cmdlet_ctx' pointer MUST point to a MBSLAVE_MASKWRITEHOLDINGREGISTER_CTX object.
+*               (3) In-place response is supported ('p_response_buffer' may be the same as 'p_request_data').
 *********************************************************************************************************
 */
 
@@ -78,6 +78,7 @@
 *
 * Note(s)     : (1) This function is NOT thread(task)-safe.
 *               (2) The 'p_cmdlet_ctx' pointer MUST point to a MBSLAVE_READCOILS_CTX object.
+*               (3) In-place response is supported ('p_response_buffer' may be the same as 'p_request_data').
 *********************************************************************************************************
 */
 
@@ -102,6 +103,9 @@ void MBSlave_CmdLet_ReadCoils(
     CPU_INT16U               coilCurrentAddress;
     CPU_INT16U               coilQuantity;
     CPU_BOOLEAN              coilStatus;
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+    CPU_INT08U              *coilBits;
+#endif
 
     CPU_INT16U               outByteCount;
 
@@ -208,6 +212,31 @@ void MBSlave_CmdLet_ReadCoils(
         goto MBSLAVE_RDCOILS_CATCH_INVALIDVALUE;
     }
 
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Validate the whole address range at once (if supported).  */
+    if (cmdlet_ctx->cbValidateCoils != (MBSLAVE_VALIDATECOILS_CB)0) {
+        if ((CPU_INT32U)coilStartAddress + (CPU_INT32U)coilQuantity > (CPU_INT32U)0x10000UL) {
+            /*  An overflow error detected.  */
+            goto MBSLAVE_RDCOILS_CATCH_INVALIDADDR;
+        }
+        validity = cmdlet_ctx->cbValidateCoils(
+            coilStartAddress,
+            coilQuantity,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+        if (!validity) {
+            goto MBSLAVE_RDCOILS_CATCH_INVALIDADDR;
+        }
+
+        goto MBSLAVE_RDCOILS_VALIDATED;
+    }
+#endif
+
     /*  Validate the start address.  */
     validity = cmdlet_ctx->cbValidateCoil(
         coilStartAddress, 
@@ -241,6 +270,9 @@ void MBSlave_CmdLet_ReadCoils(
         goto MBSLAVE_RDCOILS_CATCH_INVALIDADDR;
     }
 
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_RDCOILS_VALIDATED:
+#endif
     /*  Write the count of output bytes.  */
     outByteCount = coilQuantity;
     --(outByteCount);
@@ -258,6 +290,44 @@ void MBSlave_CmdLet_ReadCoils(
         return;
     }
 
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Read all bits at once (if supported).  */
+    if (cmdlet_ctx->cbReadCoils != (MBSLAVE_READCOILS_CB)0) {
+        coilBits = MBBufEmitter_WriteBlock(
+            &(emitter),
+            (CPU_SIZE_T)outByteCount,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            if (*p_error == MB_ERROR_BUFEMITTER_BUFFEREND) {
+                *p_error = MB_ERROR_SLAVE_RESPONSETRUNCATED;
+            }
+            return;
+        }
+
+        cmdlet_ctx->cbReadCoils(
+            coilStartAddress,
+            coilQuantity,
+            coilBits,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+
+        /*  Pad the remaining bits of the last byte with zeros.  */
+        if ((coilQuantity & (CPU_INT16U)7U) != (CPU_INT16U)0U) {
+            coilBits[outByteCount - (CPU_INT16U)1U] &= (CPU_INT08U)(
+                ((CPU_INT08U)1U << (coilQuantity & (CPU_INT16U)7U)) - (CPU_INT08U)1U
+            );
+        }
+
+        goto MBSLAVE_RDCOILS_SUCCEED;
+    }
+#endif
+
     /*  Process the request.  */
     coilCurrentAddress = coilStartAddress;
     while (coilQuantity != (CPU_INT16U)0U) {
@@ -331,6 +401,9 @@ void MBSlave_CmdLet_ReadCoils(
         }
     }
 
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_RDCOILS_SUCCEED:
+#endif
     /*  Write the function code.  */
     *p_response_fncode = request_fncode;
 
@@ -54,9 +54,13 @@ extern  "C" {
 
 /*  Command-specific context type.  */
 typedef struct {
-    MBSLAVE_READCOIL_CB      cbReadCoil;
-    MBSLAVE_VALIDATECOIL_CB  cbValidateCoil;
-    void                    *cbArg;
+    MBSLAVE_READCOIL_CB       cbReadCoil;
+    MBSLAVE_VALIDATECOIL_CB   cbValidateCoil;
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+    MBSLAVE_VALIDATECOILS_CB  cbValidateCoils;
+    MBSLAVE_READCOILS_CB      cbReadCoils;
+#endif
+    void                     *cbArg;
 } MBSLAVE_READCOILS_CTX;
 
 
@@ -99,6 +103,7 @@ typedef struct {
 *
 * Note(s)     : (1) This function is NOT thread(task)-safe.
 *               (2) The 'p_cmdlet_ctx' pointer MUST point to a MBSLAVE_READCOILS_CTX object.
+*               (3) In-place response is supported ('p_response_buffer' may be the same as 'p_request_data').
 *********************************************************************************************************
 */
 
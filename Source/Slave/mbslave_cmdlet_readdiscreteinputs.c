@@ -78,6 +78,7 @@
 *
 * Note(s)     : (1) This function is NOT thread(task)-safe.
 *               (2) The 'p_cmdlet_ctx' pointer MUST point to a MBSLAVE_READDISCRETEINPUTS_CTX object.
+*               (3) In-place response is supported ('p_response_buffer' may be the same as 'p_request_data').
 *********************************************************************************************************
 */
 
@@ -102,6 +103,9 @@ void MBSlave_CmdLet_ReadDiscreteInputs(
     CPU_INT16U                       dciCurrentAddress;
     CPU_INT16U                       dciQuantity;
     CPU_BOOLEAN                      dciStatus;
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+    CPU_INT08U                      *dciBits;
+#endif
 
     CPU_INT16U                       outByteCount;
 
@@ -208,6 +212,31 @@ void MBSlave_CmdLet_ReadDiscreteInputs(
         goto MBSLAVE_RDDCTINPUT_CATCH_INVALIDVALUE;
     }
 
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Validate the whole address range at once (if supported).  */
+    if (cmdlet_ctx->cbValidateDiscreteInputs != (MBSLAVE_VALIDATEDISCRETEINPUTS_CB)0) {
+        if ((CPU_INT32U)dciStartAddress + (CPU_INT32U)dciQuantity > (CPU_INT32U)0x10000UL) {
+            /*  An overflow error detected.  */
+            goto MBSLAVE_RDDCTINPUT_CATCH_INVALIDADDR;
+        }
+        validity = cmdlet_ctx->cbValidateDiscreteInputs(
+            dciStartAddress,
+            dciQuantity,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+        if (!validity) {
+            goto MBSLAVE_RDDCTINPUT_CATCH_INVALIDADDR;
+        }
+
+        goto MBSLAVE_RDDCTINPUT_VALIDATED;
+    }
+#endif
+
     /*  Validate the start address.  */
     validity = cmdlet_ctx->cbValidateDiscreteInput(
         dciStartAddress, 
@@ -241,6 +270,9 @@ void MBSlave_CmdLet_ReadDiscreteInputs(
         goto MBSLAVE_RDDCTINPUT_CATCH_INVALIDADDR;
     }
 
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_RDDCTINPUT_VALIDATED:
+#endif
     /*  Write the count of output bytes.  */
     outByteCount = dciQuantity;
     --(outByteCount);
@@ -258,6 +290,44 @@ void MBSlave_CmdLet_ReadDiscreteInputs(
         return;
     }
 
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Read all bits at once (if supported).  */
+    if (cmdlet_ctx->cbReadDiscreteInputs != (MBSLAVE_READDISCRETEINPUTS_CB)0) {
+        dciBits = MBBufEmitter_WriteBlock(
+            &(emitter),
+            (CPU_SIZE_T)outByteCount,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            if (*p_error == MB_ERROR_BUFEMITTER_BUFFEREND) {
+                *p_error = MB_ERROR_SLAVE_RESPONSETRUNCATED;
+            }
+            return;
+        }
+
+        cmdlet_ctx->cbReadDiscreteInputs(
+            dciStartAddress,
+            dciQuantity,
+            dciBits,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+
+        /*  Pad the remaining bits of the last byte with zeros.  */
+        if ((dciQuantity & (CPU_INT16U)7U) != (CPU_INT16U)0U) {
+            dciBits[outByteCount - (CPU_INT16U)1U] &= (CPU_INT08U)(
+                ((CPU_INT08U)1U << (dciQuantity & (CPU_INT16U)7U)) - (CPU_INT08U)1U
+            );
+        }
+
+        goto MBSLAVE_RDDCTINPUT_SUCCEED;
+    }
+#endif
+
     /*  Process the request.  */
     dciCurrentAddress = dciStartAddress;
     while (dciQuantity != (CPU_INT16U)0U) {
@@ -331,6 +401,9 @@ void MBSlave_CmdLet_ReadDiscreteInputs(
         }
     }
 
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_RDDCTINPUT_SUCCEED:
+#endif
     /*  Write the function code.  */
     *p_response_fncode = request_fncode;
 
@@ -54,9 +54,13 @@ extern  "C" {
 
 /*  Command-specific context type.  */
 typedef struct {
-    MBSLAVE_READDISCRETEINPUT_CB      cbReadDiscreteInput;
-    MBSLAVE_VALIDATEDISCRETEINPUT_CB  cbValidateDiscreteInput;
-    void                             *cbArg;
+    MBSLAVE_READDISCRETEINPUT_CB       cbReadDiscreteInput;
+    MBSLAVE_VALIDATEDISCRETEINPUT_CB   cbValidateDiscreteInput;
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+    MBSLAVE_VALIDATEDISCRETEINPUTS_CB  cbValidateDiscreteInputs;
+    MBSLAVE_READDISCRETEINPUTS_CB      cbReadDiscreteInputs;
+#endif
+    void                              *cbArg;
 } MBSLAVE_READDISCRETEINPUTS_CTX;
 
 
@@ -99,6 +103,7 @@ typedef struct {
 *
 * Note(s)     : (1) This function is NOT thread(task)-safe.
 *               (2) The 'p_cmdlet_ctx' pointer MUST point to a MBSLAVE_READDISCRETEINPUTS_CTX object.
+*               (3) In-place response is supported ('p_response_buffer' may be the same as 'p_request_data').
 *********************************************************************************************************
 */
 
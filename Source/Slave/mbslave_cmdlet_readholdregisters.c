@@ -78,6 +78,7 @@
 *
 * Note(s)     : (1) This function is NOT thread(task)-safe.
 *               (2) The 'p_cmdlet_ctx' pointer MUST point to a MBSLAVE_READHOLDINGREGISTERS_CTX object.
+*               (3) In-place response is supported ('p_response_buffer' may be the same as 'p_request_data').
 *********************************************************************************************************
 */
 
@@ -102,6 +103,9 @@ void MBSlave_CmdLet_ReadHoldingRegisters(
     CPU_INT16U                        hregCurrentAddress;
     CPU_INT16U                        hregQuantity;
     CPU_INT16U                        hregValue;
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    CPU_INT08U                       *hregValues;
+#endif
 
     CPU_INT08U                        ec;
 
@@ -202,6 +206,31 @@ void MBSlave_CmdLet_ReadHoldingRegisters(
         goto MBSLAVE_RDHREG_CATCH_INVALIDVALUE;
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Validate the whole address range at once (if supported).  */
+    if (cmdlet_ctx->cbValidateHoldingRegs != (MBSLAVE_VALIDATEHOLDINGREGISTERS_CB)0) {
+        if ((CPU_INT32U)hregStartAddress + (CPU_INT32U)hregQuantity > (CPU_INT32U)0x10000UL) {
+            /*  An overflow error detected.  */
+            goto MBSLAVE_RDHREG_CATCH_INVALIDADDR;
+        }
+        validity = cmdlet_ctx->cbValidateHoldingRegs(
+            hregStartAddress,
+            hregQuantity,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+        if (!validity) {
+            goto MBSLAVE_RDHREG_CATCH_INVALIDADDR;
+        }
+
+        goto MBSLAVE_RDHREG_VALIDATED;
+    }
+#endif
+
     /*  Validate the start address.  */
     validity = cmdlet_ctx->cbValidateHoldingReg(
         hregStartAddress, 
@@ -235,6 +264,9 @@ void MBSlave_CmdLet_ReadHoldingRegisters(
         goto MBSLAVE_RDHREG_CATCH_INVALIDADDR;
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_RDHREG_VALIDATED:
+#endif
     /*  Write the count of output bytes.  */
     MBBufEmitter_WriteUInt8(
         &(emitter),
@@ -248,6 +280,37 @@ void MBSlave_CmdLet_ReadHoldingRegisters(
         return;
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Read all registers at once (if supported).  */
+    if (cmdlet_ctx->cbReadHoldingRegs != (MBSLAVE_READHOLDINGREGISTERS_CB)0) {
+        hregValues = MBBufEmitter_WriteBlock(
+            &(emitter),
+            (CPU_SIZE_T)((CPU_SIZE_T)hregQuantity << 1U),
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            if (*p_error == MB_ERROR_BUFEMITTER_BUFFEREND) {
+                *p_error = MB_ERROR_SLAVE_RESPONSETRUNCATED;
+            }
+            return;
+        }
+
+        cmdlet_ctx->cbReadHoldingRegs(
+            hregStartAddress,
+            hregQuantity,
+            hregValues,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+
+        goto MBSLAVE_RDHREG_SUCCEED;
+    }
+#endif
+
     /*  Process the request.  */
     hregCurrentAddress = hregStartAddress;
     while (hregQuantity != (CPU_INT16U)0U) {
@@ -282,6 +345,9 @@ void MBSlave_CmdLet_ReadHoldingRegisters(
         ++(hregCurrentAddress);
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_RDHREG_SUCCEED:
+#endif
     /*  Write the function code.  */
     *p_response_fncode = request_fncode;
 
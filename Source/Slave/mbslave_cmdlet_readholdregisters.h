@@ -53,9 +53,13 @@ extern  "C" {
 
 /*  Command-specific context type.  */
 typedef struct {
-    MBSLAVE_READHOLDINGREGISTER_CB      cbReadHoldingReg;
-    MBSLAVE_VALIDATEHOLDINGREGISTER_CB  cbValidateHoldingReg;
-    void                               *cbArg;
+    MBSLAVE_READHOLDINGREGISTER_CB       cbReadHoldingReg;
+    MBSLAVE_VALIDATEHOLDINGREGISTER_CB   cbValidateHoldingReg;
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    MBSLAVE_VALIDATEHOLDINGREGISTERS_CB  cbValidateHoldingRegs;
+    MBSLAVE_READHOLDINGREGISTERS_CB      cbReadHoldingRegs;
+#endif
+    void                                *cbArg;
 } MBSLAVE_READHOLDINGREGISTERS_CTX;
 
 
@@ -98,6 +102,7 @@ typedef struct {
 *
 * Note(s)     : (1) This function is NOT thread(task)-safe.
 *               (2) The 'p_cmdlet_ctx' pointer MUST point to a MBSLAVE_READHOLDINGREGISTERS_CTX object.
+*               (3) In-place response is supported ('p_response_buffer' may be the same as 'p_request_data').
 *********************************************************************************************************
 */
 
@@ -78,6 +78,7 @@
 *
 * Note(s)     : (1) This function is NOT thread(task)-safe.
 *               (2) The 'p_cmdlet_ctx' pointer MUST point to a MBSLAVE_READINPUTREGISTERS_CTX object.
+*               (3) In-place response is supported ('p_response_buffer' may be the same as 'p_request_data').
 *********************************************************************************************************
 */
 
@@ -102,6 +103,9 @@ void MBSlave_CmdLet_ReadInputRegisters(
     CPU_INT16U                        iregCurrentAddress;
     CPU_INT16U                        iregQuantity;
     CPU_INT16U                        iregValue;
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    CPU_INT08U                       *iregValues;
+#endif
 
     CPU_INT08U                        ec;
 
@@ -202,6 +206,31 @@ void MBSlave_CmdLet_ReadInputRegisters(
         goto MBSLAVE_RDIREG_CATCH_INVALIDVALUE;
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Validate the whole address range at once (if supported).  */
+    if (cmdlet_ctx->cbValidateInputRegs != (MBSLAVE_VALIDATEINPUTREGISTERS_CB)0) {
+        if ((CPU_INT32U)iregStartAddress + (CPU_INT32U)iregQuantity > (CPU_INT32U)0x10000UL) {
+            /*  An overflow error detected.  */
+            goto MBSLAVE_RDIREG_CATCH_INVALIDADDR;
+        }
+        validity = cmdlet_ctx->cbValidateInputRegs(
+            iregStartAddress,
+            iregQuantity,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+        if (!validity) {
+            goto MBSLAVE_RDIREG_CATCH_INVALIDADDR;
+        }
+
+        goto MBSLAVE_RDIREG_VALIDATED;
+    }
+#endif
+
     /*  Validate the start address.  */
     validity = cmdlet_ctx->cbValidateInputReg(
         iregStartAddress, 
@@ -235,6 +264,9 @@ void MBSlave_CmdLet_ReadInputRegisters(
         goto MBSLAVE_RDIREG_CATCH_INVALIDADDR;
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_RDIREG_VALIDATED:
+#endif
     /*  Write the count of output bytes.  */
     MBBufEmitter_WriteUInt8(
         &(emitter),
@@ -248,6 +280,37 @@ void MBSlave_CmdLet_ReadInputRegisters(
         return;
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Read all registers at once (if supported).  */
+    if (cmdlet_ctx->cbReadInputRegs != (MBSLAVE_READINPUTREGISTERS_CB)0) {
+        iregValues = MBBufEmitter_WriteBlock(
+            &(emitter),
+            (CPU_SIZE_T)((CPU_SIZE_T)iregQuantity << 1U),
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            if (*p_error == MB_ERROR_BUFEMITTER_BUFFEREND) {
+                *p_error = MB_ERROR_SLAVE_RESPONSETRUNCATED;
+            }
+            return;
+        }
+
+        cmdlet_ctx->cbReadInputRegs(
+            iregStartAddress,
+            iregQuantity,
+            iregValues,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+
+        goto MBSLAVE_RDIREG_SUCCEED;
+    }
+#endif
+
     /*  Process the request.  */
     iregCurrentAddress = iregStartAddress;
     while (iregQuantity != (CPU_INT16U)0U) {
@@ -282,6 +345,9 @@ void MBSlave_CmdLet_ReadInputRegisters(
         ++(iregCurrentAddress);
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_RDIREG_SUCCEED:
+#endif
     /*  Write the function code.  */
     *p_response_fncode = request_fncode;
 
@@ -52,9 +52,13 @@ extern  "C" {
 
 /*  Command-specific context type.  */
 typedef struct {
-    MBSLAVE_READINPUTREGISTER_CB      cbReadInputReg;
-    MBSLAVE_VALIDATEINPUTREGISTER_CB  cbValidateInputReg;
-    void                             *cbArg;
+    MBSLAVE_READINPUTREGISTER_CB       cbReadInputReg;
+    MBSLAVE_VALIDATEINPUTREGISTER_CB   cbValidateInputReg;
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    MBSLAVE_VALIDATEINPUTREGISTERS_CB  cbValidateInputRegs;
+    MBSLAVE_READINPUTREGISTERS_CB      cbReadInputRegs;
+#endif
+    void                              *cbArg;
 } MBSLAVE_READINPUTREGISTERS_CTX;
 
 
@@ -97,6 +101,7 @@ typedef struct {
 *
 * Note(s)     : (1) This function is NOT thread(task)-safe.
 *               (2) The 'p_cmdlet_ctx' pointer MUST point to a MBSLAVE_READINPUTREGISTERS_CTX object.
+*               (3) In-place response is supported ('p_response_buffer' may be the same as 'p_request_data').
 *********************************************************************************************************
 */
 
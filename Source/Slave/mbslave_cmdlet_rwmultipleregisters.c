@@ -78,6 +78,7 @@
 *
 * Note(s)     : (1) This function is NOT thread(task)-safe.
 *               (2) The 'p_cmdlet_ctx' pointer MUST point to a MBSLAVE_RWMULTIPLEREGISTERS_CTX object.
+*               (3) In-place response is supported ('p_response_buffer' may be the same as 'p_request_data').
 *********************************************************************************************************
 */
 
@@ -104,6 +105,9 @@ void MBSlave_CmdLet_ReadWriteMultipleRegisters(
     CPU_INT16U                        hregReadQuantity;
     CPU_INT16U                        hregWriteQuantity;
     CPU_INT16U                        hregValue;
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    CPU_INT08U                       *hregValues;
+#endif
 
     CPU_INT08U                        inWriteByteCount;
 
@@ -242,6 +246,31 @@ void MBSlave_CmdLet_ReadWriteMultipleRegisters(
         goto MBSLAVE_RWHREG_CATCH_INVALIDVALUE;
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Validate the whole read address range at once (if supported).  */
+    if (cmdlet_ctx->cbValidateHoldingRegs != (MBSLAVE_VALIDATEHOLDINGREGISTERS_CB)0) {
+        if ((CPU_INT32U)hregReadStartAddress + (CPU_INT32U)hregReadQuantity > (CPU_INT32U)0x10000UL) {
+            /*  An overflow error detected.  */
+            goto MBSLAVE_RWHREG_CATCH_INVALIDADDR;
+        }
+        validity = cmdlet_ctx->cbValidateHoldingRegs(
+            hregReadStartAddress,
+            hregReadQuantity,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+        if (!validity) {
+            goto MBSLAVE_RWHREG_CATCH_INVALIDADDR;
+        }
+
+        goto MBSLAVE_RWHREG_READVALIDATED;
+    }
+#endif
+
     /*  Validate the read start address.  */
     validity = cmdlet_ctx->cbValidateHoldingReg(
         hregReadStartAddress, 
@@ -276,11 +305,39 @@ void MBSlave_CmdLet_ReadWriteMultipleRegisters(
     }
 
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_RWHREG_READVALIDATED:
+#endif
     /*  Validate the write register quantity.  */
     if (hregWriteQuantity == (CPU_INT16U)0x0000U || hregWriteQuantity > (CPU_INT16U)0x0079U) {
         goto MBSLAVE_RWHREG_CATCH_INVALIDVALUE;
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Validate the whole write address range at once (if supported).  */
+    if (cmdlet_ctx->cbValidateHoldingRegs != (MBSLAVE_VALIDATEHOLDINGREGISTERS_CB)0) {
+        if ((CPU_INT32U)hregWriteStartAddress + (CPU_INT32U)hregWriteQuantity > (CPU_INT32U)0x10000UL) {
+            /*  An overflow error detected.  */
+            goto MBSLAVE_RWHREG_CATCH_INVALIDADDR;
+        }
+        validity = cmdlet_ctx->cbValidateHoldingRegs(
+            hregWriteStartAddress,
+            hregWriteQuantity,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+        if (!validity) {
+            goto MBSLAVE_RWHREG_CATCH_INVALIDADDR;
+        }
+
+        goto MBSLAVE_RWHREG_WRITEVALIDATED;
+    }
+#endif
+
     /*  Validate the write start address.  */
     validity = cmdlet_ctx->cbValidateHoldingReg(
         hregWriteStartAddress, 
@@ -314,6 +371,9 @@ void MBSlave_CmdLet_ReadWriteMultipleRegisters(
         goto MBSLAVE_RWHREG_CATCH_INVALIDADDR;
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_RWHREG_WRITEVALIDATED:
+#endif
     /*  Validate the write byte count.  */
     if (inWriteByteCount != (CPU_INT08U)(hregWriteQuantity << ((CPU_INT16U)1U))) {
         goto MBSLAVE_RWHREG_CATCH_INVALIDVALUE;
@@ -332,6 +392,37 @@ void MBSlave_CmdLet_ReadWriteMultipleRegisters(
         return;
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Write all registers at once (if supported).  */
+    if (cmdlet_ctx->cbWriteHoldingRegs != (MBSLAVE_WRITEHOLDINGREGISTERS_CB)0) {
+        hregValues = MBBufFetcher_ReadBlock(
+            &(fetcher),
+            (CPU_SIZE_T)inWriteByteCount,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            if (*p_error == MB_ERROR_BUFFETCHER_BUFFEREND) {
+                *p_error = MB_ERROR_SLAVE_REQUESTTRUNCATED;
+            }
+            return;
+        }
+
+        cmdlet_ctx->cbWriteHoldingRegs(
+            hregWriteStartAddress,
+            hregWriteQuantity,
+            hregValues,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+
+        goto MBSLAVE_RWHREG_READ;
+    }
+#endif
+
     /*  Process the write request.  */
     hregCurrentAddress = hregWriteStartAddress;
     while (hregWriteQuantity != (CPU_INT16U)0U) {
@@ -366,6 +457,38 @@ void MBSlave_CmdLet_ReadWriteMultipleRegisters(
         ++(hregCurrentAddress);
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_RWHREG_READ:
+    /*  Read all registers at once (if supported).  */
+    if (cmdlet_ctx->cbReadHoldingRegs != (MBSLAVE_READHOLDINGREGISTERS_CB)0) {
+        hregValues = MBBufEmitter_WriteBlock(
+            &(emitter),
+            (CPU_SIZE_T)((CPU_SIZE_T)hregReadQuantity << 1U),
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            if (*p_error == MB_ERROR_BUFEMITTER_BUFFEREND) {
+                *p_error = MB_ERROR_SLAVE_RESPONSETRUNCATED;
+            }
+            return;
+        }
+
+        cmdlet_ctx->cbReadHoldingRegs(
+            hregReadStartAddress,
+            hregReadQuantity,
+            hregValues,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+
+        goto MBSLAVE_RWHREG_SUCCEED;
+    }
+#endif
+
     /*  Process the read request.  */
     hregCurrentAddress = hregReadStartAddress;
     while (hregReadQuantity != (CPU_INT16U)0U) {
@@ -400,6 +523,9 @@ void MBSlave_CmdLet_ReadWriteMultipleRegisters(
         ++(hregCurrentAddress);
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_RWHREG_SUCCEED:
+#endif
     /*  Write the function code.  */
     *p_response_fncode = request_fncode;
 
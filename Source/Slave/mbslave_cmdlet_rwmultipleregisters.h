@@ -54,10 +54,15 @@ extern  "C" {
 
 /*  Command-specific context type.  */
 typedef struct {
-    MBSLAVE_READHOLDINGREGISTER_CB      cbReadHoldingReg;
-    MBSLAVE_WRITEHOLDINGREGISTER_CB     cbWriteHoldingReg;
-    MBSLAVE_VALIDATEHOLDINGREGISTER_CB  cbValidateHoldingReg;
-    void                               *cbArg;
+    MBSLAVE_READHOLDINGREGISTER_CB       cbReadHoldingReg;
+    MBSLAVE_WRITEHOLDINGREGISTER_CB      cbWriteHoldingReg;
+    MBSLAVE_VALIDATEHOLDINGREGISTER_CB   cbValidateHoldingReg;
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    MBSLAVE_VALIDATEHOLDINGREGISTERS_CB  cbValidateHoldingRegs;
+    MBSLAVE_READHOLDINGREGISTERS_CB      cbReadHoldingRegs;
+    MBSLAVE_WRITEHOLDINGREGISTERS_CB     cbWriteHoldingRegs;
+#endif
+    void                                *cbArg;
 } MBSLAVE_RWMULTIPLEREGISTERS_CTX;
 
 
@@ -100,6 +105,7 @@ typedef struct {
 *
 * Note(s)     : (1) This function is NOT thread(task)-safe.
 *               (2) The 'p_cmdlet_ctx' pointer MUST point to a MBSLAVE_RWMULTIPLEREGISTERS_CTX object.
+*               (3) In-place response is supported ('p_response_buffer' may be the same as 'p_request_data').
 *********************************************************************************************************
 */
 
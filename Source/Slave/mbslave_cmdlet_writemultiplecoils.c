@@ -78,6 +78,7 @@
 *
 * Note(s)     : (1) This function is NOT thread(task)-safe.
 *               (2) The 'p_cmdlet_ctx' pointer MUST point to a MBSLAVE_WRITEMULTIPLECOILS_CTX object.
+*               (3) In-place response is supported ('p_response_buffer' may be the same as 'p_request_data').
 *********************************************************************************************************
 */
 
@@ -102,6 +103,9 @@ void MBSlave_CmdLet_WriteMultipleCoils(
     CPU_INT16U                       coilCurrentAddress;
     CPU_INT16U                       coilQuantity;
     CPU_BOOLEAN                      coilStatus;
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+    CPU_INT08U                      *coilBits;
+#endif
 
     CPU_INT16U                       inByteCount;
     CPU_INT16U                       inByteCountReal;
@@ -221,6 +225,31 @@ void MBSlave_CmdLet_WriteMultipleCoils(
         goto MBSLAVE_WRCOILS_CATCH_INVALIDVALUE;
     }
 
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Validate the whole address range at once (if supported).  */
+    if (cmdlet_ctx->cbValidateCoils != (MBSLAVE_VALIDATECOILS_CB)0) {
+        if ((CPU_INT32U)coilStartAddress + (CPU_INT32U)coilQuantity > (CPU_INT32U)0x10000UL) {
+            /*  An overflow error detected.  */
+            goto MBSLAVE_WRCOILS_CATCH_INVALIDADDR;
+        }
+        validity = cmdlet_ctx->cbValidateCoils(
+            coilStartAddress,
+            coilQuantity,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+        if (!validity) {
+            goto MBSLAVE_WRCOILS_CATCH_INVALIDADDR;
+        }
+
+        goto MBSLAVE_WRCOILS_VALIDATED;
+    }
+#endif
+
     /*  Validate the start address.  */
     validity = cmdlet_ctx->cbValidateCoil(
         coilStartAddress, 
@@ -254,6 +283,9 @@ void MBSlave_CmdLet_WriteMultipleCoils(
         goto MBSLAVE_WRCOILS_CATCH_INVALIDADDR;
     }
 
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_WRCOILS_VALIDATED:
+#endif
     /*  Validate the byte count.  */
     inByteCountReal = coilQuantity;
     --(inByteCountReal);
@@ -289,6 +321,37 @@ void MBSlave_CmdLet_WriteMultipleCoils(
         return;
     }
 
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Write all bits at once (if supported).  */
+    if (cmdlet_ctx->cbWriteCoils != (MBSLAVE_WRITECOILS_CB)0) {
+        coilBits = MBBufFetcher_ReadBlock(
+            &(fetcher),
+            (CPU_SIZE_T)inByteCount,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            if (*p_error == MB_ERROR_BUFFETCHER_BUFFEREND) {
+                *p_error = MB_ERROR_SLAVE_REQUESTTRUNCATED;
+            }
+            return;
+        }
+
+        cmdlet_ctx->cbWriteCoils(
+            coilStartAddress,
+            coilQuantity,
+            coilBits,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+
+        goto MBSLAVE_WRCOILS_SUCCEED;
+    }
+#endif
+
     /*  Process the request.  */
     coilCurrentAddress = coilStartAddress;
     while (coilQuantity != (CPU_INT16U)0U) {
@@ -361,6 +424,9 @@ void MBSlave_CmdLet_WriteMultipleCoils(
 #undef MBSLAVE_WRCOILS_DUFFUNIT
     }
 
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_WRCOILS_SUCCEED:
+#endif
     /*  Write the function code.  */
     *p_response_fncode = request_fncode;
 
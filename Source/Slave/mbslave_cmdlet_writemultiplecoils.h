@@ -56,6 +56,10 @@ extern  "C" {
 typedef struct {
     MBSLAVE_WRITECOIL_CB      cbWriteCoil;
     MBSLAVE_VALIDATECOIL_CB   cbValidateCoil;
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+    MBSLAVE_VALIDATECOILS_CB  cbValidateCoils;
+    MBSLAVE_WRITECOILS_CB     cbWriteCoils;
+#endif
     void                     *cbArg;
 } MBSLAVE_WRITEMULTIPLECOILS_CTX;
 
@@ -99,6 +103,7 @@ typedef struct {
 *
 * Note(s)     : (1) This function is NOT thread(task)-safe.
 *               (2) The 'p_cmdlet_ctx' pointer MUST point to a MBSLAVE_WRITEMULTIPLECOILS_CTX object.
+*               (3) In-place response is supported ('p_response_buffer' may be the same as 'p_request_data').
 *********************************************************************************************************
 */
 
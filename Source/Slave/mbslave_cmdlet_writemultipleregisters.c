@@ -78,6 +78,7 @@
 *
 * Note(s)     : (1) This function is NOT thread(task)-safe.
 *               (2) The 'p_cmdlet_ctx' pointer MUST point to a MBSLAVE_WRITEMULTIPLEREGISTERS_CTX; object.
+*               (3) In-place response is supported ('p_response_buffer' may be the same as 'p_request_data').
 *********************************************************************************************************
 */
 
@@ -102,6 +103,9 @@ void MBSlave_CmdLet_WriteMultipleRegisters(
     CPU_INT16U                          hregCurrentAddress;
     CPU_INT16U                          hregQuantity;
     CPU_INT16U                          hregValue;
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    CPU_INT08U                         *hregValues;
+#endif
 
     CPU_INT08U                          inByteCount;
 
@@ -216,6 +220,31 @@ void MBSlave_CmdLet_WriteMultipleRegisters(
         goto MBSLAVE_WRHREG_CATCH_INVALIDVALUE;
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Validate the whole address range at once (if supported).  */
+    if (cmdlet_ctx->cbValidateHoldingRegs != (MBSLAVE_VALIDATEHOLDINGREGISTERS_CB)0) {
+        if ((CPU_INT32U)hregStartAddress + (CPU_INT32U)hregQuantity > (CPU_INT32U)0x10000UL) {
+            /*  An overflow error detected.  */
+            goto MBSLAVE_WRHREG_CATCH_INVALIDADDR;
+        }
+        validity = cmdlet_ctx->cbValidateHoldingRegs(
+            hregStartAddress,
+            hregQuantity,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+        if (!validity) {
+            goto MBSLAVE_WRHREG_CATCH_INVALIDADDR;
+        }
+
+        goto MBSLAVE_WRHREG_VALIDATED;
+    }
+#endif
+
     /*  Validate the start address.  */
     validity = cmdlet_ctx->cbValidateHoldingReg(
         hregStartAddress, 
@@ -249,6 +278,9 @@ void MBSlave_CmdLet_WriteMultipleRegisters(
         goto MBSLAVE_WRHREG_CATCH_INVALIDADDR;
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_WRHREG_VALIDATED:
+#endif
     /*  Validate the byte count.  */
     if (inByteCount != (CPU_INT08U)(hregQuantity << ((CPU_INT16U)1U))) {
         goto MBSLAVE_WRHREG_CATCH_INVALIDVALUE;
@@ -280,6 +312,37 @@ void MBSlave_CmdLet_WriteMultipleRegisters(
         return;
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+    /*  Write all registers at once (if supported).  */
+    if (cmdlet_ctx->cbWriteHoldingRegs != (MBSLAVE_WRITEHOLDINGREGISTERS_CB)0) {
+        hregValues = MBBufFetcher_ReadBlock(
+            &(fetcher),
+            (CPU_SIZE_T)inByteCount,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            if (*p_error == MB_ERROR_BUFFETCHER_BUFFEREND) {
+                *p_error = MB_ERROR_SLAVE_REQUESTTRUNCATED;
+            }
+            return;
+        }
+
+        cmdlet_ctx->cbWriteHoldingRegs(
+            hregStartAddress,
+            hregQuantity,
+            hregValues,
+            cmdlet_ctx->cbArg,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            *p_error = MB_ERROR_SLAVE_CALLBACKFAILED;
+            return;
+        }
+
+        goto MBSLAVE_WRHREG_SUCCEED;
+    }
+#endif
+
     /*  Process the request.  */
     hregCurrentAddress = hregStartAddress;
     while (hregQuantity != (CPU_INT16U)0U) {
@@ -314,6 +377,9 @@ void MBSlave_CmdLet_WriteMultipleRegisters(
         ++(hregCurrentAddress);
     }
 
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+MBSLAVE_WRHREG_SUCCEED:
+#endif
     /*  Write the function code.  */
     *p_response_fncode = request_fncode;
 
@@ -0,0 +1,1497 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                              SLAVE MODULE
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+* File      : MBSLAVE_DATAMODEL.C
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define MB_SOURCE
+#define MBSLAVE_SOURCE
+#define MBSLAVE_DATAMODEL_SOURCE
+
+#include <mbslave_datamodel.h>
+#include <mbslave_cmdtable.h>
+#include <mbslave_cfg.h>
+
+#include <mb_constants.h>
+#include <mb_types.h>
+#include <mb_utilities.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+
+#if (MB_CFG_SLAVE_EN == DEF_ENABLED) && (MB_CFG_SLAVE_DATAMODEL_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                            LOCAL MACROS
+*********************************************************************************************************
+*/
+
+/*  Check whether an item is within an area.  */
+#define MBSLAVE_DATAMODEL_INAREA(address, start, count) \
+    (((CPU_INT16U)((address) - (start))) < (count))
+
+/*  Check whether a range of items is within an area.  */
+#define MBSLAVE_DATAMODEL_RANGEINAREA(address, quantity, start, count) \
+    (MBSLAVE_DATAMODEL_INAREA(address, start, count) && \
+     ((quantity) <= (CPU_INT16U)((count) - (CPU_INT16U)((address) - (start)))))
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBSlave_DataModel_ValidateCoil(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static CPU_BOOLEAN MBSlave_DataModel_ReadCoil(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static void MBSlave_DataModel_WriteCoil(
+    CPU_INT16U         address,
+    CPU_BOOLEAN        value,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static CPU_BOOLEAN MBSlave_DataModel_ValidateDiscreteInput(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static CPU_BOOLEAN MBSlave_DataModel_ReadDiscreteInput(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static CPU_BOOLEAN MBSlave_DataModel_ValidateHoldingReg(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static CPU_INT16U MBSlave_DataModel_ReadHoldingReg(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static void MBSlave_DataModel_WriteHoldingReg(
+    CPU_INT16U         address,
+    CPU_INT16U         value,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static CPU_BOOLEAN MBSlave_DataModel_ValidateInputReg(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static CPU_INT16U MBSlave_DataModel_ReadInputReg(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+static CPU_BOOLEAN MBSlave_DataModel_ValidateCoils(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static CPU_BOOLEAN MBSlave_DataModel_ValidateDiscreteInputs(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static void MBSlave_DataModel_ReadCoils(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    CPU_INT08U        *p_bits,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static void MBSlave_DataModel_WriteCoils(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    const CPU_INT08U  *p_bits,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static void MBSlave_DataModel_ReadDiscreteInputs(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    CPU_INT08U        *p_bits,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+#endif
+
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+static CPU_BOOLEAN MBSlave_DataModel_ValidateHoldingRegs(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static CPU_BOOLEAN MBSlave_DataModel_ValidateInputRegs(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static void MBSlave_DataModel_ReadHoldingRegs(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    CPU_INT08U        *p_values,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static void MBSlave_DataModel_WriteHoldingRegs(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    const CPU_INT08U  *p_values,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+
+static void MBSlave_DataModel_ReadInputRegs(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    CPU_INT08U        *p_values,
+    void              *p_arg,
+    MB_ERROR          *p_error
+);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_DataModel_Initialize()
+*
+* Description : Initialize a flat-array slave data model (with no coils, discrete inputs and registers).
+*
+* Argument(s) : (1) p_model         Pointer to the data model.
+*               (2) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    'p_model' is NULL.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBSlave_DataModel_Initialize(
+    MBSLAVE_DATAMODEL   *p_model,
+    MB_ERROR            *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_model' parameter.  */
+    if (p_model == (MBSLAVE_DATAMODEL*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Initialize all areas.  */
+    p_model->coils                = (CPU_INT08U*)0;
+    p_model->coilStart            = (CPU_INT16U)0U;
+    p_model->coilCount            = (CPU_INT16U)0U;
+    p_model->discreteInputs       = (CPU_INT08U*)0;
+    p_model->discreteInputStart   = (CPU_INT16U)0U;
+    p_model->discreteInputCount   = (CPU_INT16U)0U;
+    p_model->holdingRegs          = (CPU_INT16U*)0;
+    p_model->holdingRegStart      = (CPU_INT16U)0U;
+    p_model->holdingRegCount      = (CPU_INT16U)0U;
+    p_model->inputRegs            = (CPU_INT16U*)0;
+    p_model->inputRegStart        = (CPU_INT16U)0U;
+    p_model->inputRegCount        = (CPU_INT16U)0U;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_DataModel_SetCoils()
+*
+* Description : Set the coil area of a data model.
+*
+* Argument(s) : (1) p_model         Pointer to the data model.
+*               (2) p_bits          Pointer to the first element of the coil bitmap ((('count' + 7) / 8) bytes).
+*               (3) start           Address of the first coil.
+*               (4) count           Count of coils.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    'p_model' is NULL or 'p_bits' is NULL while
+*                                                                 'count' is not zero.
+*                                       MB_ERROR_OVERFLOW         The area exceeds the address space.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The coil at address ('start' + n) is bit (n % 8) of byte (n / 8) of the bitmap.
+*********************************************************************************************************
+*/
+
+void MBSlave_DataModel_SetCoils(
+    MBSLAVE_DATAMODEL   *p_model,
+    CPU_INT08U          *p_bits,
+    CPU_INT16U           start,
+    CPU_INT16U           count,
+    MB_ERROR            *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_model' parameter.  */
+    if (p_model == (MBSLAVE_DATAMODEL*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_bits' parameter.  */
+    if ((p_bits == (CPU_INT08U*)0) && (count != (CPU_INT16U)0U)) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Check the area.  */
+    if ((CPU_INT32U)start + (CPU_INT32U)count > (CPU_INT32U)0x10000UL) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+
+    /*  Set the area.  */
+    p_model->coils      = p_bits;
+    p_model->coilStart  = start;
+    p_model->coilCount  = count;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_DataModel_SetDiscreteInputs()
+*
+* Description : Set the discrete input area of a data model.
+*
+* Argument(s) : (1) p_model         Pointer to the data model.
+*               (2) p_bits          Pointer to the first element of the discrete input bitmap ((('count' + 7) / 8) bytes).
+*               (3) start           Address of the first discrete input.
+*               (4) count           Count of discrete inputs.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    'p_model' is NULL or 'p_bits' is NULL while
+*                                                                 'count' is not zero.
+*                                       MB_ERROR_OVERFLOW         The area exceeds the address space.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The discrete input at address ('start' + n) is bit (n % 8) of byte (n / 8) of the bitmap.
+*********************************************************************************************************
+*/
+
+void MBSlave_DataModel_SetDiscreteInputs(
+    MBSLAVE_DATAMODEL   *p_model,
+    CPU_INT08U          *p_bits,
+    CPU_INT16U           start,
+    CPU_INT16U           count,
+    MB_ERROR            *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_model' parameter.  */
+    if (p_model == (MBSLAVE_DATAMODEL*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_bits' parameter.  */
+    if ((p_bits == (CPU_INT08U*)0) && (count != (CPU_INT16U)0U)) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Check the area.  */
+    if ((CPU_INT32U)start + (CPU_INT32U)count > (CPU_INT32U)0x10000UL) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+
+    /*  Set the area.  */
+    p_model->discreteInputs      = p_bits;
+    p_model->discreteInputStart  = start;
+    p_model->discreteInputCount  = count;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_DataModel_SetHoldingRegisters()
+*
+* Description : Set the holding register area of a data model.
+*
+* Argument(s) : (1) p_model         Pointer to the data model.
+*               (2) p_regs          Pointer to the first element of the holding register array.
+*               (3) start           Address of the first holding register.
+*               (4) count           Count of holding registers.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    'p_model' is NULL or 'p_regs' is NULL while
+*                                                                 'count' is not zero.
+*                                       MB_ERROR_OVERFLOW         The area exceeds the address space.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBSlave_DataModel_SetHoldingRegisters(
+    MBSLAVE_DATAMODEL   *p_model,
+    CPU_INT16U          *p_regs,
+    CPU_INT16U           start,
+    CPU_INT16U           count,
+    MB_ERROR            *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_model' parameter.  */
+    if (p_model == (MBSLAVE_DATAMODEL*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_regs' parameter.  */
+    if ((p_regs == (CPU_INT16U*)0) && (count != (CPU_INT16U)0U)) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Check the area.  */
+    if ((CPU_INT32U)start + (CPU_INT32U)count > (CPU_INT32U)0x10000UL) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+
+    /*  Set the area.  */
+    p_model->holdingRegs      = p_regs;
+    p_model->holdingRegStart  = start;
+    p_model->holdingRegCount  = count;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_DataModel_SetInputRegisters()
+*
+* Description : Set the input register area of a data model.
+*
+* Argument(s) : (1) p_model         Pointer to the data model.
+*               (2) p_regs          Pointer to the first element of the input register array.
+*               (3) start           Address of the first input register.
+*               (4) count           Count of input registers.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    'p_model' is NULL or 'p_regs' is NULL while
+*                                                                 'count' is not zero.
+*                                       MB_ERROR_OVERFLOW         The area exceeds the address space.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBSlave_DataModel_SetInputRegisters(
+    MBSLAVE_DATAMODEL   *p_model,
+    CPU_INT16U          *p_regs,
+    CPU_INT16U           start,
+    CPU_INT16U           count,
+    MB_ERROR            *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_model' parameter.  */
+    if (p_model == (MBSLAVE_DATAMODEL*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_regs' parameter.  */
+    if ((p_regs == (CPU_INT16U*)0) && (count != (CPU_INT16U)0U)) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Check the area.  */
+    if ((CPU_INT32U)start + (CPU_INT32U)count > (CPU_INT32U)0x10000UL) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+
+    /*  Set the area.  */
+    p_model->inputRegs      = p_regs;
+    p_model->inputRegStart  = start;
+    p_model->inputRegCount  = count;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_DataModel_Register()
+*
+* Description : Add all enabled built-in commands that are backed by a data model to a command table.
+*
+* Argument(s) : (1) p_model         Pointer to the data model.
+*               (2) p_table         Pointer to the command table.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                       No error occurred.
+*                                       MB_ERROR_NULLREFERENCE              'p_model' or 'p_table' is NULL.
+*                                       MB_ERROR_SLAVE_FUNCTIONCODEEXISTED  Fucntion code already exists.
+*                                       MB_ERROR_SLAVE_NOFREETABLEITEM      Table is full.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Commands of areas with no item are not added (so that the slave replies an 'Illegal
+*                   Function (0x01)' exception), areas must be set before calling this function.
+*               (2) Read commands are not allowed for broadcast requests, all commands are not allowed in
+*                   listen-only mode.
+*               (3) The register/bit range callbacks are used if MB_CFG_SLAVE_REGRANGECALLBACK_EN and
+*                   MB_CFG_SLAVE_BITRANGECALLBACK_EN are enabled, so that each request is served with one
+*                   range check and one block copy.
+*               (4) Commands are called by MBSlave_Poll() with interrupts disabled, so the application
+*                   could access the arrays atomically by disabling interrupts (CPU_CRITICAL_ENTER()) too.
+*********************************************************************************************************
+*/
+
+void MBSlave_DataModel_Register(
+    MBSLAVE_DATAMODEL   *p_model,
+    MBSLAVE_CMDTABLE    *p_table,
+    MB_ERROR            *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_model' parameter.  */
+    if (p_model == (MBSLAVE_DATAMODEL*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_table' parameter.  */
+    if (p_table == (MBSLAVE_CMDTABLE*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  No error by default.  */
+    *p_error = MB_ERROR_NONE;
+
+    /*
+     *  Coil commands.
+     */
+
+    if (p_model->coilCount != (CPU_INT16U)0U) {
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_READCOILS == DEF_ENABLED)
+        /*  Add "Read Coils (0x01)".  */
+        p_model->ctxReadCoils.cbReadCoil                  = MBSlave_DataModel_ReadCoil;
+        p_model->ctxReadCoils.cbValidateCoil              = MBSlave_DataModel_ValidateCoil;
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+        p_model->ctxReadCoils.cbValidateCoils             = MBSlave_DataModel_ValidateCoils;
+        p_model->ctxReadCoils.cbReadCoils                 = MBSlave_DataModel_ReadCoils;
+#endif
+        p_model->ctxReadCoils.cbArg                       = (void*)p_model;
+        MBSlave_CmdTable_Add(
+            p_table,
+            MB_FNCODE_READCOILS,
+            MBSlave_CmdLet_ReadCoils,
+            (void*)&(p_model->ctxReadCoils),
+            DEF_YES,
+            DEF_YES,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+#endif
+
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_WRITESINGLECOIL == DEF_ENABLED)
+        /*  Add "Write Single Coil (0x05)".  */
+        p_model->ctxWriteSingleCoil.cbWriteCoil           = MBSlave_DataModel_WriteCoil;
+        p_model->ctxWriteSingleCoil.cbValidateCoil        = MBSlave_DataModel_ValidateCoil;
+        p_model->ctxWriteSingleCoil.cbArg                 = (void*)p_model;
+        MBSlave_CmdTable_Add(
+            p_table,
+            MB_FNCODE_WRITESINGLECOIL,
+            MBSlave_CmdLet_WriteSingleCoil,
+            (void*)&(p_model->ctxWriteSingleCoil),
+            DEF_NO,
+            DEF_YES,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+#endif
+
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_WRITEMULTIPLECOILS == DEF_ENABLED)
+        /*  Add "Write Multiple Coils (0x0F)".  */
+        p_model->ctxWriteMultipleCoils.cbWriteCoil        = MBSlave_DataModel_WriteCoil;
+        p_model->ctxWriteMultipleCoils.cbValidateCoil     = MBSlave_DataModel_ValidateCoil;
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+        p_model->ctxWriteMultipleCoils.cbValidateCoils    = MBSlave_DataModel_ValidateCoils;
+        p_model->ctxWriteMultipleCoils.cbWriteCoils       = MBSlave_DataModel_WriteCoils;
+#endif
+        p_model->ctxWriteMultipleCoils.cbArg              = (void*)p_model;
+        MBSlave_CmdTable_Add(
+            p_table,
+            MB_FNCODE_WRITEMULTIPLECOILS,
+            MBSlave_CmdLet_WriteMultipleCoils,
+            (void*)&(p_model->ctxWriteMultipleCoils),
+            DEF_NO,
+            DEF_YES,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+#endif
+    }
+
+    /*
+     *  Discrete input commands.
+     */
+
+    if (p_model->discreteInputCount != (CPU_INT16U)0U) {
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_READDISCRETEINPUTS == DEF_ENABLED)
+        /*  Add "Read Discrete Inputs (0x02)".  */
+        p_model->ctxReadDiscreteInputs.cbReadDiscreteInput      = MBSlave_DataModel_ReadDiscreteInput;
+        p_model->ctxReadDiscreteInputs.cbValidateDiscreteInput  = MBSlave_DataModel_ValidateDiscreteInput;
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+        p_model->ctxReadDiscreteInputs.cbValidateDiscreteInputs = MBSlave_DataModel_ValidateDiscreteInputs;
+        p_model->ctxReadDiscreteInputs.cbReadDiscreteInputs     = MBSlave_DataModel_ReadDiscreteInputs;
+#endif
+        p_model->ctxReadDiscreteInputs.cbArg                    = (void*)p_model;
+        MBSlave_CmdTable_Add(
+            p_table,
+            MB_FNCODE_READDISCRETEINPUTS,
+            MBSlave_CmdLet_ReadDiscreteInputs,
+            (void*)&(p_model->ctxReadDiscreteInputs),
+            DEF_YES,
+            DEF_YES,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+#endif
+    }
+
+    /*
+     *  Holding register commands.
+     */
+
+    if (p_model->holdingRegCount != (CPU_INT16U)0U) {
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_READHOLDINGREGS == DEF_ENABLED)
+        /*  Add "Read Holding Registers (0x03)".  */
+        p_model->ctxReadHoldingRegs.cbReadHoldingReg            = MBSlave_DataModel_ReadHoldingReg;
+        p_model->ctxReadHoldingRegs.cbValidateHoldingReg        = MBSlave_DataModel_ValidateHoldingReg;
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+        p_model->ctxReadHoldingRegs.cbValidateHoldingRegs       = MBSlave_DataModel_ValidateHoldingRegs;
+        p_model->ctxReadHoldingRegs.cbReadHoldingRegs           = MBSlave_DataModel_ReadHoldingRegs;
+#endif
+        p_model->ctxReadHoldingRegs.cbArg                       = (void*)p_model;
+        MBSlave_CmdTable_Add(
+            p_table,
+            MB_FNCODE_READHOLDINGREGISTERS,
+            MBSlave_CmdLet_ReadHoldingRegisters,
+            (void*)&(p_model->ctxReadHoldingRegs),
+            DEF_YES,
+            DEF_YES,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+#endif
+
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_WRITESINGLEREG == DEF_ENABLED)
+        /*  Add "Write Single Register (0x06)".  */
+        p_model->ctxWriteSingleReg.cbWriteHoldingReg            = MBSlave_DataModel_WriteHoldingReg;
+        p_model->ctxWriteSingleReg.cbValidateHoldingReg         = MBSlave_DataModel_ValidateHoldingReg;
+        p_model->ctxWriteSingleReg.cbArg                        = (void*)p_model;
+        MBSlave_CmdTable_Add(
+            p_table,
+            MB_FNCODE_WRITESINGLEREGISTER,
+            MBSlave_CmdLet_WriteSingleRegister,
+            (void*)&(p_model->ctxWriteSingleReg),
+            DEF_NO,
+            DEF_YES,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+#endif
+
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_WRITEMULTIPLEREGS == DEF_ENABLED)
+        /*  Add "Write Multiple Registers (0x10)".  */
+        p_model->ctxWriteMultipleRegs.cbWriteHoldingReg         = MBSlave_DataModel_WriteHoldingReg;
+        p_model->ctxWriteMultipleRegs.cbValidateHoldingReg      = MBSlave_DataModel_ValidateHoldingReg;
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+        p_model->ctxWriteMultipleRegs.cbValidateHoldingRegs     = MBSlave_DataModel_ValidateHoldingRegs;
+        p_model->ctxWriteMultipleRegs.cbWriteHoldingRegs        = MBSlave_DataModel_WriteHoldingRegs;
+#endif
+        p_model->ctxWriteMultipleRegs.cbArg                     = (void*)p_model;
+        MBSlave_CmdTable_Add(
+            p_table,
+            MB_FNCODE_WRITEMULTIPLEREGISTERS,
+            MBSlave_CmdLet_WriteMultipleRegisters,
+            (void*)&(p_model->ctxWriteMultipleRegs),
+            DEF_NO,
+            DEF_YES,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+#endif
+
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_MASKWRITEREG == DEF_ENABLED)
+        /*  Add "Mask Write Register (0x16)".  */
+        p_model->ctxMaskWriteReg.cbReadHoldingReg               = MBSlave_DataModel_ReadHoldingReg;
+        p_model->ctxMaskWriteReg.cbWriteHoldingReg              = MBSlave_DataModel_WriteHoldingReg;
+        p_model->ctxMaskWriteReg.cbValidateHoldingReg           = MBSlave_DataModel_ValidateHoldingReg;
+        p_model->ctxMaskWriteReg.cbArg                          = (void*)p_model;
+        MBSlave_CmdTable_Add(
+            p_table,
+            MB_FNCODE_MASKWRITEREGISTER,
+            MBSlave_CmdLet_MaskWriteRegister,
+            (void*)&(p_model->ctxMaskWriteReg),
+            DEF_NO,
+            DEF_YES,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+#endif
+
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_READWRITEMULTIPLEREGS == DEF_ENABLED)
+        /*  Add "Read/Write Multiple Registers (0x17)".  */
+        p_model->ctxReadWriteMultipleRegs.cbReadHoldingReg      = MBSlave_DataModel_ReadHoldingReg;
+        p_model->ctxReadWriteMultipleRegs.cbWriteHoldingReg     = MBSlave_DataModel_WriteHoldingReg;
+        p_model->ctxReadWriteMultipleRegs.cbValidateHoldingReg  = MBSlave_DataModel_ValidateHoldingReg;
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+        p_model->ctxReadWriteMultipleRegs.cbValidateHoldingRegs = MBSlave_DataModel_ValidateHoldingRegs;
+        p_model->ctxReadWriteMultipleRegs.cbReadHoldingRegs     = MBSlave_DataModel_ReadHoldingRegs;
+        p_model->ctxReadWriteMultipleRegs.cbWriteHoldingRegs    = MBSlave_DataModel_WriteHoldingRegs;
+#endif
+        p_model->ctxReadWriteMultipleRegs.cbArg                 = (void*)p_model;
+        MBSlave_CmdTable_Add(
+            p_table,
+            MB_FNCODE_READWRITEMULTIPLEREGISTERS,
+            MBSlave_CmdLet_ReadWriteMultipleRegisters,
+            (void*)&(p_model->ctxReadWriteMultipleRegs),
+            DEF_YES,
+            DEF_YES,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+#endif
+    }
+
+    /*
+     *  Input register commands.
+     */
+
+    if (p_model->inputRegCount != (CPU_INT16U)0U) {
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_READINPUTREGS == DEF_ENABLED)
+        /*  Add "Read Input Registers (0x04)".  */
+        p_model->ctxReadInputRegs.cbReadInputReg                = MBSlave_DataModel_ReadInputReg;
+        p_model->ctxReadInputRegs.cbValidateInputReg            = MBSlave_DataModel_ValidateInputReg;
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+        p_model->ctxReadInputRegs.cbValidateInputRegs           = MBSlave_DataModel_ValidateInputRegs;
+        p_model->ctxReadInputRegs.cbReadInputRegs               = MBSlave_DataModel_ReadInputRegs;
+#endif
+        p_model->ctxReadInputRegs.cbArg                         = (void*)p_model;
+        MBSlave_CmdTable_Add(
+            p_table,
+            MB_FNCODE_READINPUTREGISTERS,
+            MBSlave_CmdLet_ReadInputRegisters,
+            (void*)&(p_model->ctxReadInputRegs),
+            DEF_YES,
+            DEF_YES,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            return;
+        }
+#endif
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ValidateCoil()
+*
+* Description : Validate the address of a coil (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the coil.
+*               (2) p_arg           Pointer to the data model.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : DEF_YES if the coil exists, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBSlave_DataModel_ValidateCoil(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    *p_error = MB_ERROR_NONE;
+
+    return (CPU_BOOLEAN)(MBSLAVE_DATAMODEL_INAREA(address, p_model->coilStart, p_model->coilCount) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ReadCoil()
+*
+* Description : Read the status of a coil (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the coil (validated).
+*               (2) p_arg           Pointer to the data model.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : The coil status.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBSlave_DataModel_ReadCoil(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+    CPU_INT16U          offset;
+
+    offset   = (CPU_INT16U)(address - p_model->coilStart);
+    *p_error = MB_ERROR_NONE;
+
+    return (CPU_BOOLEAN)((p_model->coils[offset >> 3] & (CPU_INT08U)(1U << (offset & 7U))) != (CPU_INT08U)0U ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_WriteCoil()
+*
+* Description : Write the status of a coil (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the coil (validated).
+*               (2) value           New coil status.
+*               (3) p_arg           Pointer to the data model.
+*               (4) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBSlave_DataModel_WriteCoil(
+    CPU_INT16U         address,
+    CPU_BOOLEAN        value,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+    CPU_INT16U          offset;
+
+    offset = (CPU_INT16U)(address - p_model->coilStart);
+    if (value) {
+        p_model->coils[offset >> 3] |= (CPU_INT08U)(1U << (offset & 7U));
+    } else {
+        p_model->coils[offset >> 3] &= (CPU_INT08U)~(CPU_INT08U)(1U << (offset & 7U));
+    }
+
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ValidateDiscreteInput()
+*
+* Description : Validate the address of a discrete input (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the discrete input.
+*               (2) p_arg           Pointer to the data model.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : DEF_YES if the discrete input exists, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBSlave_DataModel_ValidateDiscreteInput(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    *p_error = MB_ERROR_NONE;
+
+    return (CPU_BOOLEAN)(MBSLAVE_DATAMODEL_INAREA(address, p_model->discreteInputStart, p_model->discreteInputCount) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ReadDiscreteInput()
+*
+* Description : Read the status of a discrete input (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the discrete input (validated).
+*               (2) p_arg           Pointer to the data model.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : The discrete input status.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBSlave_DataModel_ReadDiscreteInput(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+    CPU_INT16U          offset;
+
+    offset   = (CPU_INT16U)(address - p_model->discreteInputStart);
+    *p_error = MB_ERROR_NONE;
+
+    return (CPU_BOOLEAN)((p_model->discreteInputs[offset >> 3] & (CPU_INT08U)(1U << (offset & 7U))) != (CPU_INT08U)0U ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ValidateHoldingReg()
+*
+* Description : Validate the address of a holding register (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the holding register.
+*               (2) p_arg           Pointer to the data model.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : DEF_YES if the holding register exists, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBSlave_DataModel_ValidateHoldingReg(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    *p_error = MB_ERROR_NONE;
+
+    return (CPU_BOOLEAN)(MBSLAVE_DATAMODEL_INAREA(address, p_model->holdingRegStart, p_model->holdingRegCount) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ReadHoldingReg()
+*
+* Description : Read the value of a holding register (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the holding register (validated).
+*               (2) p_arg           Pointer to the data model.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : The register value.
+*********************************************************************************************************
+*/
+
+static CPU_INT16U MBSlave_DataModel_ReadHoldingReg(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    *p_error = MB_ERROR_NONE;
+
+    return p_model->holdingRegs[(CPU_INT16U)(address - p_model->holdingRegStart)];
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_WriteHoldingReg()
+*
+* Description : Write the value of a holding register (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the holding register (validated).
+*               (2) value           New register value.
+*               (3) p_arg           Pointer to the data model.
+*               (4) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBSlave_DataModel_WriteHoldingReg(
+    CPU_INT16U         address,
+    CPU_INT16U         value,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    p_model->holdingRegs[(CPU_INT16U)(address - p_model->holdingRegStart)] = value;
+
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ValidateInputReg()
+*
+* Description : Validate the address of an input register (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the input register.
+*               (2) p_arg           Pointer to the data model.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : DEF_YES if the input register exists, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBSlave_DataModel_ValidateInputReg(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    *p_error = MB_ERROR_NONE;
+
+    return (CPU_BOOLEAN)(MBSLAVE_DATAMODEL_INAREA(address, p_model->inputRegStart, p_model->inputRegCount) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ReadInputReg()
+*
+* Description : Read the value of an input register (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the input register (validated).
+*               (2) p_arg           Pointer to the data model.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : The register value.
+*********************************************************************************************************
+*/
+
+static CPU_INT16U MBSlave_DataModel_ReadInputReg(
+    CPU_INT16U         address,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    *p_error = MB_ERROR_NONE;
+
+    return p_model->inputRegs[(CPU_INT16U)(address - p_model->inputRegStart)];
+}
+
+
+#if (MB_CFG_SLAVE_BITRANGECALLBACK_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ValidateCoils()
+*
+* Description : Validate the address range of coils (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first coil.
+*               (2) quantity        Quantity of coils.
+*               (3) p_arg           Pointer to the data model.
+*               (4) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : DEF_YES if all coils exist, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBSlave_DataModel_ValidateCoils(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    *p_error = MB_ERROR_NONE;
+
+    return (CPU_BOOLEAN)(MBSLAVE_DATAMODEL_RANGEINAREA(address, quantity, p_model->coilStart, p_model->coilCount) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ValidateDiscreteInputs()
+*
+* Description : Validate the address range of discrete inputs (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first discrete input.
+*               (2) quantity        Quantity of discrete inputs.
+*               (3) p_arg           Pointer to the data model.
+*               (4) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : DEF_YES if all discrete inputs exist, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBSlave_DataModel_ValidateDiscreteInputs(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    *p_error = MB_ERROR_NONE;
+
+    return (CPU_BOOLEAN)(MBSLAVE_DATAMODEL_RANGEINAREA(address, quantity, p_model->discreteInputStart, p_model->discreteInputCount) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ReadCoils()
+*
+* Description : Read the status of a range of coils (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first coil.
+*               (2) quantity        Quantity of coils.
+*               (3) p_bits          Pointer to the first element of the packed coil status buffer.
+*               (4) p_arg           Pointer to the data model.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_OVERFLOW         The range exceeds the coil area.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBSlave_DataModel_ReadCoils(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    CPU_INT08U        *p_bits,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    /*  Check the range.  */
+    if (!MBSLAVE_DATAMODEL_RANGEINAREA(address, quantity, p_model->coilStart, p_model->coilCount)) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+
+    /*  Copy the bits.  */
+    MBUtil_ExtractBits(
+        p_bits,
+        p_model->coils,
+        (CPU_SIZE_T)(CPU_INT16U)(address - p_model->coilStart),
+        (CPU_SIZE_T)quantity
+    );
+
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_WriteCoils()
+*
+* Description : Write the status of a range of coils (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first coil.
+*               (2) quantity        Quantity of coils.
+*               (3) p_bits          Pointer to the first element of the packed coil status buffer.
+*               (4) p_arg           Pointer to the data model.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_OVERFLOW         The range exceeds the coil area.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBSlave_DataModel_WriteCoils(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    const CPU_INT08U  *p_bits,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    /*  Check the range.  */
+    if (!MBSLAVE_DATAMODEL_RANGEINAREA(address, quantity, p_model->coilStart, p_model->coilCount)) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+
+    /*  Copy the bits.  */
+    MBUtil_InsertBits(
+        p_model->coils,
+        (CPU_SIZE_T)(CPU_INT16U)(address - p_model->coilStart),
+        p_bits,
+        (CPU_SIZE_T)quantity
+    );
+
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ReadDiscreteInputs()
+*
+* Description : Read the status of a range of discrete inputs (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first discrete input.
+*               (2) quantity        Quantity of discrete inputs.
+*               (3) p_bits          Pointer to the first element of the packed discrete input status buffer.
+*               (4) p_arg           Pointer to the data model.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_OVERFLOW         The range exceeds the discrete input area.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBSlave_DataModel_ReadDiscreteInputs(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    CPU_INT08U        *p_bits,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    /*  Check the range.  */
+    if (!MBSLAVE_DATAMODEL_RANGEINAREA(address, quantity, p_model->discreteInputStart, p_model->discreteInputCount)) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+
+    /*  Copy the bits.  */
+    MBUtil_ExtractBits(
+        p_bits,
+        p_model->discreteInputs,
+        (CPU_SIZE_T)(CPU_INT16U)(address - p_model->discreteInputStart),
+        (CPU_SIZE_T)quantity
+    );
+
+    *p_error = MB_ERROR_NONE;
+}
+#endif
+
+
+#if (MB_CFG_SLAVE_REGRANGECALLBACK_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ValidateHoldingRegs()
+*
+* Description : Validate the address range of holding registers (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first holding register.
+*               (2) quantity        Quantity of holding registers.
+*               (3) p_arg           Pointer to the data model.
+*               (4) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : DEF_YES if all holding registers exist, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBSlave_DataModel_ValidateHoldingRegs(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    *p_error = MB_ERROR_NONE;
+
+    return (CPU_BOOLEAN)(MBSLAVE_DATAMODEL_RANGEINAREA(address, quantity, p_model->holdingRegStart, p_model->holdingRegCount) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ValidateInputRegs()
+*
+* Description : Validate the address range of input registers (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first input register.
+*               (2) quantity        Quantity of input registers.
+*               (3) p_arg           Pointer to the data model.
+*               (4) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : DEF_YES if all input registers exist, DEF_NO if not.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBSlave_DataModel_ValidateInputRegs(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    *p_error = MB_ERROR_NONE;
+
+    return (CPU_BOOLEAN)(MBSLAVE_DATAMODEL_RANGEINAREA(address, quantity, p_model->inputRegStart, p_model->inputRegCount) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ReadHoldingRegs()
+*
+* Description : Read the values of a range of holding registers (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first holding register.
+*               (2) quantity        Quantity of holding registers.
+*               (3) p_values        Pointer to the first element of the big-endian register value buffer.
+*               (4) p_arg           Pointer to the data model.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_OVERFLOW         The range exceeds the holding register area.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBSlave_DataModel_ReadHoldingRegs(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    CPU_INT08U        *p_values,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    /*  Check the range.  */
+    if (!MBSLAVE_DATAMODEL_RANGEINAREA(address, quantity, p_model->holdingRegStart, p_model->holdingRegCount)) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+
+    /*  Copy the values.  */
+    MBUtil_CopyUInt16ToBE(
+        p_values,
+        &(p_model->holdingRegs[(CPU_INT16U)(address - p_model->holdingRegStart)]),
+        (CPU_SIZE_T)quantity
+    );
+
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_WriteHoldingRegs()
+*
+* Description : Write the values of a range of holding registers (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first holding register.
+*               (2) quantity        Quantity of holding registers.
+*               (3) p_values        Pointer to the first element of the big-endian register value buffer.
+*               (4) p_arg           Pointer to the data model.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_OVERFLOW         The range exceeds the holding register area.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBSlave_DataModel_WriteHoldingRegs(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    const CPU_INT08U  *p_values,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    /*  Check the range.  */
+    if (!MBSLAVE_DATAMODEL_RANGEINAREA(address, quantity, p_model->holdingRegStart, p_model->holdingRegCount)) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+
+    /*  Copy the values.  */
+    MBUtil_CopyUInt16FromBE(
+        &(p_model->holdingRegs[(CPU_INT16U)(address - p_model->holdingRegStart)]),
+        p_values,
+        (CPU_SIZE_T)quantity
+    );
+
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MBSlave_DataModel_ReadInputRegs()
+*
+* Description : Read the values of a range of input registers (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first input register.
+*               (2) quantity        Quantity of input registers.
+*               (3) p_values        Pointer to the first element of the big-endian register value buffer.
+*               (4) p_arg           Pointer to the data model.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_OVERFLOW         The range exceeds the input register area.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBSlave_DataModel_ReadInputRegs(
+    CPU_INT16U         address,
+    CPU_INT16U         quantity,
+    CPU_INT08U        *p_values,
+    void              *p_arg,
+    MB_ERROR          *p_error
+) {
+    MBSLAVE_DATAMODEL  *p_model = (MBSLAVE_DATAMODEL*)p_arg;
+
+    /*  Check the range.  */
+    if (!MBSLAVE_DATAMODEL_RANGEINAREA(address, quantity, p_model->inputRegStart, p_model->inputRegCount)) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+
+    /*  Copy the values.  */
+    MBUtil_CopyUInt16ToBE(
+        p_values,
+        &(p_model->inputRegs[(CPU_INT16U)(address - p_model->inputRegStart)]),
+        (CPU_SIZE_T)quantity
+    );
+
+    *p_error = MB_ERROR_NONE;
+}
+#endif
+
+#endif  /*  #if (MB_CFG_SLAVE_EN == DEF_ENABLED) && (MB_CFG_SLAVE_DATAMODEL_EN == DEF_ENABLED)  */
\ No newline at end of file
@@ -0,0 +1,312 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                              SLAVE MODULE
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+* File      : MBSLAVE_DATAMODEL.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef MBSLAVE_DATAMODEL_H__
+#define MBSLAVE_DATAMODEL_H__
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include <mbslave_cmdlet_common.h>
+#include <mbslave_cmdlet_maskwriteregister.h>
+#include <mbslave_cmdlet_readcoils.h>
+#include <mbslave_cmdlet_readdiscreteinputs.h>
+#include <mbslave_cmdlet_readholdregisters.h>
+#include <mbslave_cmdlet_readinputregisters.h>
+#include <mbslave_cmdlet_rwmultipleregisters.h>
+#include <mbslave_cmdlet_writemultiplecoils.h>
+#include <mbslave_cmdlet_writemultipleregisters.h>
+#include <mbslave_cmdlet_writesinglecoil.h>
+#include <mbslave_cmdlet_writesingleregister.h>
+
+#include <mbslave_cmdtable.h>
+
+#include <mbslave_cfg.h>
+
+#include <mb_types.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+
+#if (MB_CFG_SLAVE_EN == DEF_ENABLED) && (MB_CFG_SLAVE_DATAMODEL_EN == DEF_ENABLED)
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+typedef struct {
+    CPU_INT08U                               *coils;
+    CPU_INT16U                                coilStart;
+    CPU_INT16U                                coilCount;
+
+    CPU_INT08U                               *discreteInputs;
+    CPU_INT16U                                discreteInputStart;
+    CPU_INT16U                                discreteInputCount;
+
+    CPU_INT16U                               *holdingRegs;
+    CPU_INT16U                                holdingRegStart;
+    CPU_INT16U                                holdingRegCount;
+
+    CPU_INT16U                               *inputRegs;
+    CPU_INT16U                                inputRegStart;
+    CPU_INT16U                                inputRegCount;
+
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_READCOILS == DEF_ENABLED)
+    MBSLAVE_READCOILS_CTX                     ctxReadCoils;
+#endif
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_READDISCRETEINPUTS == DEF_ENABLED)
+    MBSLAVE_READDISCRETEINPUTS_CTX            ctxReadDiscreteInputs;
+#endif
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_READHOLDINGREGS == DEF_ENABLED)
+    MBSLAVE_READHOLDINGREGISTERS_CTX          ctxReadHoldingRegs;
+#endif
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_READINPUTREGS == DEF_ENABLED)
+    MBSLAVE_READINPUTREGISTERS_CTX            ctxReadInputRegs;
+#endif
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_WRITESINGLECOIL == DEF_ENABLED)
+    MBSLAVE_WRITESINGLECOIL_CTX               ctxWriteSingleCoil;
+#endif
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_WRITESINGLEREG == DEF_ENABLED)
+    MBSLAVE_WRITESINGLEHOLDINGREGISTER_CTX    ctxWriteSingleReg;
+#endif
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_WRITEMULTIPLECOILS == DEF_ENABLED)
+    MBSLAVE_WRITEMULTIPLECOILS_CTX            ctxWriteMultipleCoils;
+#endif
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_WRITEMULTIPLEREGS == DEF_ENABLED)
+    MBSLAVE_WRITEMULTIPLEREGISTERS_CTX        ctxWriteMultipleRegs;
+#endif
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_MASKWRITEREG == DEF_ENABLED)
+    MBSLAVE_MASKWRITEHOLDINGREGISTER_CTX      ctxMaskWriteReg;
+#endif
+#if (MB_CFG_SLAVE_BUILTIN_CMDLET_READWRITEMULTIPLEREGS == DEF_ENABLED)
+    MBSLAVE_RWMULTIPLEREGISTERS_CTX           ctxReadWriteMultipleRegs;
+#endif
+} MBSLAVE_DATAMODEL;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_DataModel_Initialize()
+*
+* Description : Initialize a flat-array slave data model (with no coils, discrete inputs and registers).
+*
+* Argument(s) : (1) p_model         Pointer to the data model.
+*               (2) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    'p_model' is NULL.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBSlave_DataModel_Initialize(
+    MBSLAVE_DATAMODEL   *p_model,
+    MB_ERROR            *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_DataModel_SetCoils()
+*
+* Description : Set the coil area of a data model.
+*
+* Argument(s) : (1) p_model         Pointer to the data model.
+*               (2) p_bits          Pointer to the first element of the coil bitmap ((('count' + 7) / 8) bytes).
+*               (3) start           Address of the first coil.
+*               (4) count           Count of coils.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    'p_model' is NULL or 'p_bits' is NULL while
+*                                                                 'count' is not zero.
+*                                       MB_ERROR_OVERFLOW         The area exceeds the address space.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The coil at address ('start' + n) is bit (n % 8) of byte (n / 8) of the bitmap.
+*********************************************************************************************************
+*/
+
+void MBSlave_DataModel_SetCoils(
+    MBSLAVE_DATAMODEL   *p_model,
+    CPU_INT08U          *p_bits,
+    CPU_INT16U           start,
+    CPU_INT16U           count,
+    MB_ERROR            *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_DataModel_SetDiscreteInputs()
+*
+* Description : Set the discrete input area of a data model.
+*
+* Argument(s) : (1) p_model         Pointer to the data model.
+*               (2) p_bits          Pointer to the first element of the discrete input bitmap ((('count' + 7) / 8) bytes).
+*               (3) start           Address of the first discrete input.
+*               (4) count           Count of discrete inputs.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    'p_model' is NULL or 'p_bits' is NULL while
+*                                                                 'count' is not zero.
+*                                       MB_ERROR_OVERFLOW         The area exceeds the address space.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) The discrete input at address ('start' + n) is bit (n % 8) of byte (n / 8) of the bitmap.
+*********************************************************************************************************
+*/
+
+void MBSlave_DataModel_SetDiscreteInputs(
+    MBSLAVE_DATAMODEL   *p_model,
+    CPU_INT08U          *p_bits,
+    CPU_INT16U           start,
+    CPU_INT16U           count,
+    MB_ERROR            *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_DataModel_SetHoldingRegisters()
+*
+* Description : Set the holding register area of a data model.
+*
+* Argument(s) : (1) p_model         Pointer to the data model.
+*               (2) p_regs          Pointer to the first element of the holding register array.
+*               (3) start           Address of the first holding register.
+*               (4) count           Count of holding registers.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    'p_model' is NULL or 'p_regs' is NULL while
+*                                                                 'count' is not zero.
+*                                       MB_ERROR_OVERFLOW         The area exceeds the address space.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBSlave_DataModel_SetHoldingRegisters(
+    MBSLAVE_DATAMODEL   *p_model,
+    CPU_INT16U          *p_regs,
+    CPU_INT16U           start,
+    CPU_INT16U           count,
+    MB_ERROR            *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_DataModel_SetInputRegisters()
+*
+* Description : Set the input register area of a data model.
+*
+* Argument(s) : (1) p_model         Pointer to the data model.
+*               (2) p_regs          Pointer to the first element of the input register array.
+*               (3) start           Address of the first input register.
+*               (4) count           Count of input registers.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    'p_model' is NULL or 'p_regs' is NULL while
+*                                                                 'count' is not zero.
+*                                       MB_ERROR_OVERFLOW         The area exceeds the address space.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBSlave_DataModel_SetInputRegisters(
+    MBSLAVE_DATAMODEL   *p_model,
+    CPU_INT16U          *p_regs,
+    CPU_INT16U           start,
+    CPU_INT16U           count,
+    MB_ERROR            *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_DataModel_Register()
+*
+* Description : Add all enabled built-in commands that are backed by a data model to a command table.
+*
+* Argument(s) : (1) p_model         Pointer to the data model.
+*               (2) p_table         Pointer to the command table.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                       No error occurred.
+*                                       MB_ERROR_NULLREFERENCE              'p_model' or 'p_table' is NULL.
+*                                       MB_ERROR_SLAVE_FUNCTIONCODEEXISTED  Fucntion code already exists.
+*                                       MB_ERROR_SLAVE_NOFREETABLEITEM      Table is full.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Commands of areas with no item are not added (so that the slave replies an 'Illegal
+*                   Function (0x01)' exception), areas must be set before calling this function.
+*               (2) Read commands are not allowed for broadcast requests, all commands are not allowed in
+*                   listen-only mode.
+*               (3) The register/bit range callbacks are used if MB_CFG_SLAVE_REGRANGECALLBACK_EN and
+*                   MB_CFG_SLAVE_BITRANGECALLBACK_EN are enabled, so that each request is served with one
+*                   range check and one block copy.
+*               (4) Commands are called by MBSlave_Poll() with interrupts disabled, so the application
+*                   could access the arrays atomically by disabling interrupts (CPU_CRITICAL_ENTER()) too.
+*********************************************************************************************************
+*/
+
+void MBSlave_DataModel_Register(
+    MBSLAVE_DATAMODEL   *p_model,
+    MBSLAVE_CMDTABLE    *p_table,
+    MB_ERROR            *p_error
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /*  #if (MB_CFG_SLAVE_EN == DEF_ENABLED) && (MB_CFG_SLAVE_DATAMODEL_EN == DEF_ENABLED)  */
+
+#endif
\ No newline at end of file
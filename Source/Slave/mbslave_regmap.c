@@ -0,0 +1,1124 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                              SLAVE MODULE
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+* File      : MBSLAVE_REGMAP.C
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define MB_SOURCE
+#define MBSLAVE_SOURCE
+#define MBSLAVE_REGMAP_SOURCE
+
+#include <mbslave_regmap.h>
+#include <mbslave_cfg.h>
+
+#include <mb_constants.h>
+#include <mb_types.h>
+#include <mb_utilities.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+
+#if (MB_CFG_SLAVE_EN == DEF_ENABLED) && (MB_CFG_SLAVE_REGMAP_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/*  Size of the bounce buffer used for bit runs that don't start at a byte boundary.  */
+#define MBSLAVE_REGMAP_BITCHUNK_SIZE              ((CPU_SIZE_T)4U)
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void MBSlave_RegMap_Insert(
+    MBSLAVE_REGMAP                *p_map,
+    const MBSLAVE_REGMAP_WINDOW   *p_window,
+    MB_ERROR                      *p_error
+);
+
+static CPU_SIZE_T MBSlave_RegMap_Find(
+    MBSLAVE_REGMAP                *p_map,
+    CPU_INT16U                     address
+);
+
+static CPU_BOOLEAN MBSlave_RegMap_Walk(
+    MBSLAVE_REGMAP                *p_map,
+    CPU_INT16U                     address,
+    CPU_INT16U                     quantity,
+    CPU_INT08U                    *p_dst,
+    const CPU_INT08U              *p_src,
+    CPU_BOOLEAN                    writable,
+    MB_ERROR                      *p_error
+);
+
+static void MBSlave_RegMap_ReadWindow(
+    MBSLAVE_REGMAP                *p_map,
+    const MBSLAVE_REGMAP_WINDOW   *p_window,
+    CPU_INT16U                     offset,
+    CPU_INT16U                     quantity,
+    CPU_INT08U                    *p_values,
+    MB_ERROR                      *p_error
+);
+
+static void MBSlave_RegMap_WriteWindow(
+    MBSLAVE_REGMAP                *p_map,
+    const MBSLAVE_REGMAP_WINDOW   *p_window,
+    CPU_INT16U                     offset,
+    CPU_INT16U                     quantity,
+    const CPU_INT08U              *p_values,
+    MB_ERROR                      *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_Initialize()
+*
+* Description : Initialize a sparse register (or bit) map.
+*
+* Argument(s) : (1) p_map           Pointer to the map.
+*               (2) p_windows       Pointer to the first element of the window storage.
+*               (3) capacity        Count of elements of the window storage.
+*               (4) bit_mapped      DEF_YES if the map holds coils or discrete inputs, DEF_NO if the map holds
+*                                   holding registers or input registers.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    'p_map' is NULL or 'p_windows' is NULL while
+*                                                                 'capacity' is not zero.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_Initialize(
+    MBSLAVE_REGMAP          *p_map,
+    MBSLAVE_REGMAP_WINDOW   *p_windows,
+    CPU_SIZE_T               capacity,
+    CPU_BOOLEAN              bit_mapped,
+    MB_ERROR                *p_error
+) {
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_map' parameter.  */
+    if (p_map == (MBSLAVE_REGMAP*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_windows' parameter.  */
+    if (p_windows == (MBSLAVE_REGMAP_WINDOW*)0 && capacity != (CPU_SIZE_T)0U) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Initialize the map.  */
+    p_map->windows         = p_windows;
+    p_map->windowCnt       = (CPU_SIZE_T)0U;
+    p_map->windowCapacity  = capacity;
+    p_map->windowLastHit   = (CPU_SIZE_T)0U;
+    p_map->bitMapped       = bit_mapped;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_AddArray()
+*
+* Description : Add a window backed by an array to a map.
+*
+* Argument(s) : (1) p_map           Pointer to the map.
+*               (2) start           Address of the first item of the window.
+*               (3) count           Count of items of the window.
+*               (4) p_data          Pointer to the first element of the backing array ('count' CPU_INT16U
+*                                   elements for register maps, (('count' + 7) / 8) CPU_INT08U elements for
+*                                   bit maps, bit n is bit (n % 8) of byte (n / 8)).
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                       No error occurred.
+*                                       MB_ERROR_NULLREFERENCE              'p_map' or 'p_data' is NULL.
+*                                       MB_ERROR_INVALIDPARAMETER           'count' is zero.
+*                                       MB_ERROR_OVERFLOW                   The window exceeds the address space.
+*                                       MB_ERROR_SLAVE_NOFREETABLEITEM      The window storage is full.
+*                                       MB_ERROR_SLAVE_REGMAPOVERLAPPED     The window overlaps another window.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Windows can be added in any order, the map keeps them sorted by address.
+*               (2) Windows can't be added while the map is being used by a slave.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_AddArray(
+    MBSLAVE_REGMAP          *p_map,
+    CPU_INT16U               start,
+    CPU_INT16U               count,
+    void                    *p_data,
+    MB_ERROR                *p_error
+) {
+    MBSLAVE_REGMAP_WINDOW  window;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_map' parameter.  */
+    if (p_map == (MBSLAVE_REGMAP*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'p_data' parameter.  */
+    if (p_data == (void*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Prepare the window.  */
+    window.start    = start;
+    window.count    = count;
+    window.data     = p_data;
+    window.cbRead   = (MBSLAVE_REGMAP_READ_CB)0;
+    window.cbWrite  = (MBSLAVE_REGMAP_WRITE_CB)0;
+    window.cbArg    = (void*)0;
+
+    /*  Insert the window.  */
+    MBSlave_RegMap_Insert(p_map, &(window), p_error);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_AddHandler()
+*
+* Description : Add a window served by handlers to a map.
+*
+* Argument(s) : (1) p_map           Pointer to the map.
+*               (2) start           Address of the first item of the window.
+*               (3) count           Count of items of the window.
+*               (4) cb_read         The read handler.
+*               (5) cb_write        The write handler (NULL if the window is read-only).
+*               (6) p_arg           'p_arg' parameter passed to the handlers.
+*               (7) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                       No error occurred.
+*                                       MB_ERROR_NULLREFERENCE              'p_map' or 'cb_read' is NULL.
+*                                       MB_ERROR_INVALIDPARAMETER           'count' is zero.
+*                                       MB_ERROR_OVERFLOW                   The window exceeds the address space.
+*                                       MB_ERROR_SLAVE_NOFREETABLEITEM      The window storage is full.
+*                                       MB_ERROR_SLAVE_REGMAPOVERLAPPED     The window overlaps another window.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Windows can be added in any order, the map keeps them sorted by address.
+*               (2) Windows can't be added while the map is being used by a slave.
+*               (3) Writing to a read-only window makes the command fail with MB_ERROR_SLAVE_CALLBACKFAILED, so
+*                   read-only windows should be kept in maps that are only used by read commands.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_AddHandler(
+    MBSLAVE_REGMAP          *p_map,
+    CPU_INT16U               start,
+    CPU_INT16U               count,
+    MBSLAVE_REGMAP_READ_CB   cb_read,
+    MBSLAVE_REGMAP_WRITE_CB  cb_write,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    MBSLAVE_REGMAP_WINDOW  window;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_map' parameter.  */
+    if (p_map == (MBSLAVE_REGMAP*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+
+    /*  Check 'cb_read' parameter.  */
+    if (cb_read == (MBSLAVE_REGMAP_READ_CB)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return;
+    }
+#endif
+
+    /*  Prepare the window.  */
+    window.start    = start;
+    window.count    = count;
+    window.data     = (void*)0;
+    window.cbRead   = cb_read;
+    window.cbWrite  = cb_write;
+    window.cbArg    = p_arg;
+
+    /*  Insert the window.  */
+    MBSlave_RegMap_Insert(p_map, &(window), p_error);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_Validate()
+*
+* Description : Validate the address of an item (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the item.
+*               (2) p_arg           Pointer to the map.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : DEF_YES if the item is mapped, DEF_NO if not.
+*
+* Note(s)     : (1) This function can be used as any per-item validation callback (cbValidateCoil,
+*                   cbValidateDiscreteInput, cbValidateHoldingReg and cbValidateInputReg).
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN MBSlave_RegMap_Validate(
+    CPU_INT16U               address,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    MBSLAVE_REGMAP  *p_map = (MBSLAVE_REGMAP*)p_arg;
+
+    *p_error = MB_ERROR_NONE;
+
+    return (CPU_BOOLEAN)(MBSlave_RegMap_Find(p_map, address) != p_map->windowCnt ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_ValidateRange()
+*
+* Description : Validate the address range of items (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first item.
+*               (2) quantity        Quantity of items.
+*               (3) p_arg           Pointer to the map.
+*               (4) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : DEF_YES if all items are mapped, DEF_NO if not.
+*
+* Note(s)     : (1) This function can be used as any range validation callback (cbValidateCoils,
+*                   cbValidateDiscreteInputs, cbValidateHoldingRegs and cbValidateInputRegs).
+*               (2) The range may span several adjacent windows, but not a hole between windows.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN MBSlave_RegMap_ValidateRange(
+    CPU_INT16U               address,
+    CPU_INT16U               quantity,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    return MBSlave_RegMap_Walk(
+        (MBSLAVE_REGMAP*)p_arg,
+        address,
+        quantity,
+        (CPU_INT08U*)0,
+        (const CPU_INT08U*)0,
+        DEF_NO,
+        p_error
+    );
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_ReadReg()
+*
+* Description : Read the value of a register (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the register.
+*               (2) p_arg           Pointer to the register map.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    The register is not mapped.
+*                                       (Other)                      Error returned by the read handler.
+*
+* Return(s)   : The register value.
+*********************************************************************************************************
+*/
+
+CPU_INT16U MBSlave_RegMap_ReadReg(
+    CPU_INT16U               address,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    MBSLAVE_REGMAP         *p_map = (MBSLAVE_REGMAP*)p_arg;
+    MBSLAVE_REGMAP_WINDOW  *p_window;
+    CPU_SIZE_T              idx;
+    CPU_INT08U              value[2];
+
+    /*  Find the window.  */
+    idx = MBSlave_RegMap_Find(p_map, address);
+    if (idx == p_map->windowCnt) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return (CPU_INT16U)0U;
+    }
+    p_window = &(p_map->windows[idx]);
+
+    /*  Read from the backing array directly.  */
+    if (p_window->data != (void*)0) {
+        *p_error = MB_ERROR_NONE;
+        return ((CPU_INT16U*)(p_window->data))[(CPU_INT16U)(address - p_window->start)];
+    }
+
+    /*  Read from the handler.  */
+    *p_error = MB_ERROR_NONE;
+    p_window->cbRead(address, (CPU_INT16U)1U, value, p_window->cbArg, p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return (CPU_INT16U)0U;
+    }
+
+    return (CPU_INT16U)(((CPU_INT16U)value[0] << 8U) | (CPU_INT16U)value[1]);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_WriteReg()
+*
+* Description : Write the value of a register (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the register.
+*               (2) value           New register value.
+*               (3) p_arg           Pointer to the register map.
+*               (4) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    The register is not mapped or is read-only.
+*                                       (Other)                      Error returned by the write handler.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_WriteReg(
+    CPU_INT16U               address,
+    CPU_INT16U               value,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    MBSLAVE_REGMAP         *p_map = (MBSLAVE_REGMAP*)p_arg;
+    MBSLAVE_REGMAP_WINDOW  *p_window;
+    CPU_SIZE_T              idx;
+    CPU_INT08U              valueBE[2];
+
+    /*  Find the window.  */
+    idx = MBSlave_RegMap_Find(p_map, address);
+    if (idx == p_map->windowCnt) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+    p_window = &(p_map->windows[idx]);
+
+    /*  Write to the backing array directly.  */
+    if (p_window->data != (void*)0) {
+        ((CPU_INT16U*)(p_window->data))[(CPU_INT16U)(address - p_window->start)] = value;
+        *p_error = MB_ERROR_NONE;
+        return;
+    }
+
+    /*  Write to the handler.  */
+    valueBE[0] = (CPU_INT08U)(value >> 8U);
+    valueBE[1] = (CPU_INT08U)(value & (CPU_INT16U)0x00FFU);
+    MBSlave_RegMap_WriteWindow(
+        p_map,
+        p_window,
+        (CPU_INT16U)(address - p_window->start),
+        (CPU_INT16U)1U,
+        valueBE,
+        p_error
+    );
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_ReadRegs()
+*
+* Description : Read the values of a range of registers (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first register.
+*               (2) quantity        Quantity of registers.
+*               (3) p_values        Pointer to the first element of the big-endian register value buffer.
+*               (4) p_arg           Pointer to the register map.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    One of the registers is not mapped.
+*                                       (Other)                      Error returned by a read handler.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Each window is read with one block copy (or one handler call).
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_ReadRegs(
+    CPU_INT16U               address,
+    CPU_INT16U               quantity,
+    CPU_INT08U              *p_values,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    if (!MBSlave_RegMap_Walk((MBSLAVE_REGMAP*)p_arg, address, quantity, p_values, (const CPU_INT08U*)0, DEF_NO, p_error)) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_WriteRegs()
+*
+* Description : Write the values of a range of registers (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first register.
+*               (2) quantity        Quantity of registers.
+*               (3) p_values        Pointer to the first element of the big-endian register value buffer.
+*               (4) p_arg           Pointer to the register map.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    One of the registers is not mapped or is
+*                                                                    read-only.
+*                                       (Other)                      Error returned by a write handler.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Each window is written with one block copy (or one handler call).
+*               (2) Nothing is written if any register of the range is not mapped or read-only, but the
+*                   windows before a window whose write handler fails stay written.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_WriteRegs(
+    CPU_INT16U               address,
+    CPU_INT16U               quantity,
+    const CPU_INT08U        *p_values,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    MBSLAVE_REGMAP  *p_map = (MBSLAVE_REGMAP*)p_arg;
+
+    /*  Validate the whole range first, so that nothing is written if any item is not mapped or read-only.  */
+    if (!MBSlave_RegMap_Walk(p_map, address, quantity, (CPU_INT08U*)0, (const CPU_INT08U*)0, DEF_YES, p_error)) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+
+    /*  Write the registers.  */
+    (void)MBSlave_RegMap_Walk(p_map, address, quantity, (CPU_INT08U*)0, p_values, DEF_YES, p_error);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_ReadBit()
+*
+* Description : Read the status of a coil or a discrete input (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the bit.
+*               (2) p_arg           Pointer to the bit map.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    The bit is not mapped.
+*                                       (Other)                      Error returned by the read handler.
+*
+* Return(s)   : The bit status.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN MBSlave_RegMap_ReadBit(
+    CPU_INT16U               address,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    MBSLAVE_REGMAP         *p_map = (MBSLAVE_REGMAP*)p_arg;
+    MBSLAVE_REGMAP_WINDOW  *p_window;
+    CPU_SIZE_T              idx;
+    CPU_INT16U              offset;
+    CPU_INT08U              value;
+
+    /*  Find the window.  */
+    idx = MBSlave_RegMap_Find(p_map, address);
+    if (idx == p_map->windowCnt) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return DEF_NO;
+    }
+    p_window = &(p_map->windows[idx]);
+    offset   = (CPU_INT16U)(address - p_window->start);
+
+    /*  Read from the backing array directly.  */
+    if (p_window->data != (void*)0) {
+        value = ((CPU_INT08U*)(p_window->data))[offset >> 3U];
+        *p_error = MB_ERROR_NONE;
+        return (CPU_BOOLEAN)((value & (CPU_INT08U)(1U << (offset & 7U))) != (CPU_INT08U)0U ? DEF_YES : DEF_NO);
+    }
+
+    /*  Read from the handler.  */
+    value = (CPU_INT08U)0U;
+    *p_error = MB_ERROR_NONE;
+    p_window->cbRead(address, (CPU_INT16U)1U, &(value), p_window->cbArg, p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return DEF_NO;
+    }
+
+    return (CPU_BOOLEAN)((value & (CPU_INT08U)0x01U) != (CPU_INT08U)0U ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_WriteBit()
+*
+* Description : Write the status of a coil (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the bit.
+*               (2) value           New bit status.
+*               (3) p_arg           Pointer to the bit map.
+*               (4) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    The bit is not mapped or is read-only.
+*                                       (Other)                      Error returned by the write handler.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_WriteBit(
+    CPU_INT16U               address,
+    CPU_BOOLEAN              value,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    MBSLAVE_REGMAP         *p_map = (MBSLAVE_REGMAP*)p_arg;
+    MBSLAVE_REGMAP_WINDOW  *p_window;
+    CPU_SIZE_T              idx;
+    CPU_INT16U              offset;
+    CPU_INT08U              bit;
+
+    /*  Find the window.  */
+    idx = MBSlave_RegMap_Find(p_map, address);
+    if (idx == p_map->windowCnt) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+    p_window = &(p_map->windows[idx]);
+    offset   = (CPU_INT16U)(address - p_window->start);
+
+    /*  Write to the backing array directly.  */
+    if (p_window->data != (void*)0) {
+        if (value) {
+            ((CPU_INT08U*)(p_window->data))[offset >> 3U] |= (CPU_INT08U)(1U << (offset & 7U));
+        } else {
+            ((CPU_INT08U*)(p_window->data))[offset >> 3U] &= (CPU_INT08U)~(CPU_INT08U)(1U << (offset & 7U));
+        }
+        *p_error = MB_ERROR_NONE;
+        return;
+    }
+
+    /*  Write to the handler.  */
+    bit = (CPU_INT08U)(value ? 0x01U : 0x00U);
+    MBSlave_RegMap_WriteWindow(p_map, p_window, offset, (CPU_INT16U)1U, &(bit), p_error);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_ReadBits()
+*
+* Description : Read the status of a range of coils or discrete inputs (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first bit.
+*               (2) quantity        Quantity of bits.
+*               (3) p_bits          Pointer to the first element of the packed bit buffer.
+*               (4) p_arg           Pointer to the bit map.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    One of the bits is not mapped.
+*                                       (Other)                      Error returned by a read handler.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Each window is read with one block copy (or one handler call) if it starts at a byte
+*                   boundary of the packed bit buffer.
+*               (2) The unused bits of the last byte of the packed bit buffer are undefined.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_ReadBits(
+    CPU_INT16U               address,
+    CPU_INT16U               quantity,
+    CPU_INT08U              *p_bits,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    if (!MBSlave_RegMap_Walk((MBSLAVE_REGMAP*)p_arg, address, quantity, p_bits, (const CPU_INT08U*)0, DEF_NO, p_error)) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_WriteBits()
+*
+* Description : Write the status of a range of coils (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first bit.
+*               (2) quantity        Quantity of bits.
+*               (3) p_bits          Pointer to the first element of the packed bit buffer.
+*               (4) p_arg           Pointer to the bit map.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    One of the bits is not mapped or is
+*                                                                    read-only.
+*                                       (Other)                      Error returned by a write handler.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Each window is written with one block copy (or one handler call) if it starts at a byte
+*                   boundary of the packed bit buffer.
+*               (2) Nothing is written if any bit of the range is not mapped or read-only, but the windows
+*                   before a window whose write handler fails stay written.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_WriteBits(
+    CPU_INT16U               address,
+    CPU_INT16U               quantity,
+    const CPU_INT08U        *p_bits,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+) {
+    MBSLAVE_REGMAP  *p_map = (MBSLAVE_REGMAP*)p_arg;
+
+    /*  Validate the whole range first, so that nothing is written if any item is not mapped or read-only.  */
+    if (!MBSlave_RegMap_Walk(p_map, address, quantity, (CPU_INT08U*)0, (const CPU_INT08U*)0, DEF_YES, p_error)) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+
+    /*  Write the bits.  */
+    (void)MBSlave_RegMap_Walk(p_map, address, quantity, (CPU_INT08U*)0, p_bits, DEF_YES, p_error);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_Insert()
+*
+* Description : Insert a window to a map (keeping the windows sorted by address).
+*
+* Argument(s) : (1) p_map           Pointer to the map.
+*               (2) p_window        Pointer to the window.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                       No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER           The window has no item.
+*                                       MB_ERROR_OVERFLOW                   The window exceeds the address space.
+*                                       MB_ERROR_SLAVE_NOFREETABLEITEM      The window storage is full.
+*                                       MB_ERROR_SLAVE_REGMAPOVERLAPPED     The window overlaps another window.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBSlave_RegMap_Insert(
+    MBSLAVE_REGMAP                *p_map,
+    const MBSLAVE_REGMAP_WINDOW   *p_window,
+    MB_ERROR                      *p_error
+) {
+    CPU_SIZE_T  low;
+    CPU_SIZE_T  high;
+    CPU_SIZE_T  mid;
+
+    /*  Check the window.  */
+    if (p_window->count == (CPU_INT16U)0U) {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return;
+    }
+    if ((CPU_INT32U)p_window->start + (CPU_INT32U)p_window->count > (CPU_INT32U)0x10000UL) {
+        *p_error = MB_ERROR_OVERFLOW;
+        return;
+    }
+    if (p_map->windowCnt >= p_map->windowCapacity) {
+        *p_error = MB_ERROR_SLAVE_NOFREETABLEITEM;
+        return;
+    }
+
+    /*  Find the first window that starts after the new window.  */
+    low  = (CPU_SIZE_T)0U;
+    high = p_map->windowCnt;
+    while (low < high) {
+        mid = low + ((high - low) >> 1U);
+        if (p_map->windows[mid].start <= p_window->start) {
+            low = mid + (CPU_SIZE_T)1U;
+        } else {
+            high = mid;
+        }
+    }
+
+    /*  Check the previous window and the next window.  */
+    if (low != (CPU_SIZE_T)0U) {
+        if ((CPU_INT32U)p_map->windows[low - 1U].start + (CPU_INT32U)p_map->windows[low - 1U].count > (CPU_INT32U)p_window->start) {
+            *p_error = MB_ERROR_SLAVE_REGMAPOVERLAPPED;
+            return;
+        }
+    }
+    if (low != p_map->windowCnt) {
+        if ((CPU_INT32U)p_window->start + (CPU_INT32U)p_window->count > (CPU_INT32U)p_map->windows[low].start) {
+            *p_error = MB_ERROR_SLAVE_REGMAPOVERLAPPED;
+            return;
+        }
+    }
+
+    /*  Move following windows and insert the new window.  */
+    for (high = p_map->windowCnt; high > low; --high) {
+        p_map->windows[high] = p_map->windows[high - 1U];
+    }
+    p_map->windows[low] = *p_window;
+    ++(p_map->windowCnt);
+    p_map->windowLastHit = (CPU_SIZE_T)0U;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_Find()
+*
+* Description : Find the window that contains an item.
+*
+* Argument(s) : (1) p_map           Pointer to the map.
+*               (2) address         Address of the item.
+*
+* Return(s)   : Index of the window, or the count of windows if the item is not mapped.
+*
+* Note(s)     : (1) The last hit window is checked first, so sequential accesses to the same window are
+*                   resolved without searching.
+*********************************************************************************************************
+*/
+
+static CPU_SIZE_T MBSlave_RegMap_Find(
+    MBSLAVE_REGMAP                *p_map,
+    CPU_INT16U                     address
+) {
+    MBSLAVE_REGMAP_WINDOW  *p_windows = p_map->windows;
+    CPU_SIZE_T              low;
+    CPU_SIZE_T              high;
+    CPU_SIZE_T              mid;
+
+    /*  Try the last hit window.  */
+    low = p_map->windowLastHit;
+    if (low < p_map->windowCnt && (CPU_INT16U)(address - p_windows[low].start) < p_windows[low].count) {
+        return low;
+    }
+
+    /*  Find the last window that starts at (or before) the address.  */
+    low  = (CPU_SIZE_T)0U;
+    high = p_map->windowCnt;
+    while (low < high) {
+        mid = low + ((high - low) >> 1U);
+        if (p_windows[mid].start <= address) {
+            low = mid + (CPU_SIZE_T)1U;
+        } else {
+            high = mid;
+        }
+    }
+    if (low == (CPU_SIZE_T)0U) {
+        return p_map->windowCnt;
+    }
+    --(low);
+
+    /*  Check whether the window contains the address.  */
+    if ((CPU_INT16U)(address - p_windows[low].start) >= p_windows[low].count) {
+        return p_map->windowCnt;
+    }
+
+    p_map->windowLastHit = low;
+
+    return low;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_Walk()
+*
+* Description : Walk through (and optionally transfer) a range of items.
+*
+* Argument(s) : (1) address         Address of the first item.
+*               (2) quantity        Quantity of items.
+*               (3) p_dst           Pointer to the first element of the buffer that receives the items
+*                                   (NULL if not reading).
+*               (4) p_src           Pointer to the first element of the buffer that contains the items
+*                                   (NULL if not writing).
+*               (5) writable        DEF_YES if all items must also be writable.
+*               (6) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       (Other)                      Error returned by a window transfer.
+*
+* Return(s)   : DEF_YES if all items are mapped (and writable if 'writable' is DEF_YES), DEF_NO if not.
+*
+* Note(s)     : (1) The range is resolved with one binary search, following windows must be adjacent.
+*               (2) The windows are checked before they are transferred, so with 'writable' set, no window
+*                   is written if a read-only window is found (but the windows before a window whose handler
+*                   fails are written).
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MBSlave_RegMap_Walk(
+    MBSLAVE_REGMAP                *p_map,
+    CPU_INT16U                     address,
+    CPU_INT16U                     quantity,
+    CPU_INT08U                    *p_dst,
+    const CPU_INT08U              *p_src,
+    CPU_BOOLEAN                    writable,
+    MB_ERROR                      *p_error
+) {
+    MBSLAVE_REGMAP_WINDOW  *p_window;
+    CPU_SIZE_T              idx;
+    CPU_SIZE_T              done;
+    CPU_INT16U              offset;
+    CPU_INT16U              run;
+    CPU_INT16U              chunk;
+    CPU_INT16U              chunkLength;
+    CPU_INT08U              bounce[MBSLAVE_REGMAP_BITCHUNK_SIZE];
+
+    *p_error = MB_ERROR_NONE;
+
+    /*  Find the first window.  */
+    idx = MBSlave_RegMap_Find(p_map, address);
+    if (idx == p_map->windowCnt) {
+        return DEF_NO;
+    }
+
+    done = (CPU_SIZE_T)0U;
+    while (quantity != (CPU_INT16U)0U) {
+        /*  Get the run within current window.  */
+        p_window = &(p_map->windows[idx]);
+        offset   = (CPU_INT16U)(address - p_window->start);
+        run      = (CPU_INT16U)(p_window->count - offset);
+        if (run > quantity) {
+            run = quantity;
+        }
+
+        /*  Check whether the window is writable (a handler window without write handler is read-only).  */
+        if (writable && p_window->data == (void*)0 && p_window->cbWrite == (MBSLAVE_REGMAP_WRITE_CB)0) {
+            return DEF_NO;
+        }
+
+        /*  Transfer the run.  */
+        if (p_dst != (CPU_INT08U*)0 || p_src != (const CPU_INT08U*)0) {
+            if (!p_map->bitMapped) {
+                if (p_dst != (CPU_INT08U*)0) {
+                    MBSlave_RegMap_ReadWindow(p_map, p_window, offset, run, p_dst + (done << 1U), p_error);
+                } else {
+                    MBSlave_RegMap_WriteWindow(p_map, p_window, offset, run, p_src + (done << 1U), p_error);
+                }
+            } else if ((done & (CPU_SIZE_T)7U) == (CPU_SIZE_T)0U) {
+                if (p_dst != (CPU_INT08U*)0) {
+                    MBSlave_RegMap_ReadWindow(p_map, p_window, offset, run, p_dst + (done >> 3U), p_error);
+                } else {
+                    MBSlave_RegMap_WriteWindow(p_map, p_window, offset, run, p_src + (done >> 3U), p_error);
+                }
+            } else {
+                /*  The run doesn't start at a byte boundary, bounce it in chunks.  */
+                chunk = (CPU_INT16U)0U;
+                while (chunk < run) {
+                    chunkLength = (CPU_INT16U)(run - chunk);
+                    if (chunkLength > (CPU_INT16U)(MBSLAVE_REGMAP_BITCHUNK_SIZE << 3U)) {
+                        chunkLength = (CPU_INT16U)(MBSLAVE_REGMAP_BITCHUNK_SIZE << 3U);
+                    }
+                    if (p_dst != (CPU_INT08U*)0) {
+                        MBSlave_RegMap_ReadWindow(p_map, p_window, (CPU_INT16U)(offset + chunk), chunkLength, bounce, p_error);
+                        if (*p_error != MB_ERROR_NONE) {
+                            break;
+                        }
+                        MBUtil_InsertBits(p_dst, done + (CPU_SIZE_T)chunk, bounce, (CPU_SIZE_T)chunkLength);
+                    } else {
+                        MBUtil_ExtractBits(bounce, p_src, done + (CPU_SIZE_T)chunk, (CPU_SIZE_T)chunkLength);
+                        MBSlave_RegMap_WriteWindow(p_map, p_window, (CPU_INT16U)(offset + chunk), chunkLength, bounce, p_error);
+                        if (*p_error != MB_ERROR_NONE) {
+                            break;
+                        }
+                    }
+                    chunk = (CPU_INT16U)(chunk + chunkLength);
+                }
+            }
+            if (*p_error != MB_ERROR_NONE) {
+                return DEF_YES;
+            }
+        }
+
+        /*  Move to the next window (which must be adjacent).  */
+        quantity = (CPU_INT16U)(quantity - run);
+        if (quantity == (CPU_INT16U)0U) {
+            break;
+        }
+        address = (CPU_INT16U)(address + run);
+        done   += (CPU_SIZE_T)run;
+        ++(idx);
+        if (idx == p_map->windowCnt || p_map->windows[idx].start != address) {
+            return DEF_NO;
+        }
+    }
+
+    return DEF_YES;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_ReadWindow()
+*
+* Description : Read a run of items from a window.
+*
+* Argument(s) : (1) p_map           Pointer to the map.
+*               (2) p_window        Pointer to the window.
+*               (3) offset          Offset of the first item within the window.
+*               (4) quantity        Quantity of items.
+*               (5) p_values        Pointer to the first element of the buffer that receives the items.
+*               (6) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       (Other)                      Error returned by the read handler.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBSlave_RegMap_ReadWindow(
+    MBSLAVE_REGMAP                *p_map,
+    const MBSLAVE_REGMAP_WINDOW   *p_window,
+    CPU_INT16U                     offset,
+    CPU_INT16U                     quantity,
+    CPU_INT08U                    *p_values,
+    MB_ERROR                      *p_error
+) {
+    /*  Read from the handler.  */
+    if (p_window->data == (void*)0) {
+        *p_error = MB_ERROR_NONE;
+        p_window->cbRead(
+            (CPU_INT16U)(p_window->start + offset),
+            quantity,
+            p_values,
+            p_window->cbArg,
+            p_error
+        );
+        return;
+    }
+
+    /*  Read from the backing array.  */
+    if (p_map->bitMapped) {
+        MBUtil_ExtractBits(p_values, (const CPU_INT08U*)(p_window->data), (CPU_SIZE_T)offset, (CPU_SIZE_T)quantity);
+    } else {
+        MBUtil_CopyUInt16ToBE(p_values, (const CPU_INT16U*)(p_window->data) + offset, (CPU_SIZE_T)quantity);
+    }
+
+    *p_error = MB_ERROR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_WriteWindow()
+*
+* Description : Write a run of items to a window.
+*
+* Argument(s) : (1) p_map           Pointer to the map.
+*               (2) p_window        Pointer to the window.
+*               (3) offset          Offset of the first item within the window.
+*               (4) quantity        Quantity of items.
+*               (5) p_values        Pointer to the first element of the buffer that contains the items.
+*               (6) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    The window is read-only.
+*                                       (Other)                      Error returned by the write handler.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+static void MBSlave_RegMap_WriteWindow(
+    MBSLAVE_REGMAP                *p_map,
+    const MBSLAVE_REGMAP_WINDOW   *p_window,
+    CPU_INT16U                     offset,
+    CPU_INT16U                     quantity,
+    const CPU_INT08U              *p_values,
+    MB_ERROR                      *p_error
+) {
+    /*  Write to the handler.  */
+    if (p_window->data == (void*)0) {
+        if (p_window->cbWrite == (MBSLAVE_REGMAP_WRITE_CB)0) {
+            *p_error = MB_ERROR_INVALIDPARAMETER;
+            return;
+        }
+        *p_error = MB_ERROR_NONE;
+        p_window->cbWrite(
+            (CPU_INT16U)(p_window->start + offset),
+            quantity,
+            p_values,
+            p_window->cbArg,
+            p_error
+        );
+        return;
+    }
+
+    /*  Write to the backing array.  */
+    if (p_map->bitMapped) {
+        MBUtil_InsertBits((CPU_INT08U*)(p_window->data), (CPU_SIZE_T)offset, p_values, (CPU_SIZE_T)quantity);
+    } else {
+        MBUtil_CopyUInt16FromBE((CPU_INT16U*)(p_window->data) + offset, p_values, (CPU_SIZE_T)quantity);
+    }
+
+    *p_error = MB_ERROR_NONE;
+}
+
+#endif  /*  #if (MB_CFG_SLAVE_EN == DEF_ENABLED) && (MB_CFG_SLAVE_REGMAP_EN == DEF_ENABLED)  */
\ No newline at end of file
@@ -0,0 +1,509 @@
+/*
+*********************************************************************************************************
+*                                          MODBUS COMMUNICATION
+*                                              SLAVE MODULE
+*
+*
+*                           (c) Copyright 2019; XiaoJSoft Studio.;
+*                    All rights reserved.  Protected by international copyright laws.
+*
+* File      : MBSLAVE_REGMAP.H
+* Version   : V1.0.320
+* By        : Ji WenCong
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef MBSLAVE_REGMAP_H__
+#define MBSLAVE_REGMAP_H__
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include <mbslave_cfg.h>
+
+#include <mb_types.h>
+
+#include <cpu.h>
+
+#include <lib_def.h>
+
+
+#if (MB_CFG_SLAVE_EN == DEF_ENABLED) && (MB_CFG_SLAVE_REGMAP_EN == DEF_ENABLED)
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+/*
+ *  Window handler types.
+ *
+ *  Note(s): (1) For register maps, 'p_values' points to 'quantity' big-endian 16-bit values (2 * 'quantity'
+ *               bytes, not aligned).
+ *           (2) For bit maps, 'p_values' points to 'quantity' packed bits (LSB of the first byte is the bit at
+ *               'address').
+ *           (3) The address range is always within the window.
+ */
+typedef void (*MBSLAVE_REGMAP_READ_CB)(
+    CPU_INT16U        address,
+    CPU_INT16U        quantity,
+    CPU_INT08U       *p_values,
+    void             *p_arg,
+    MB_ERROR         *p_error
+);
+
+typedef void (*MBSLAVE_REGMAP_WRITE_CB)(
+    CPU_INT16U        address,
+    CPU_INT16U        quantity,
+    const CPU_INT08U *p_values,
+    void             *p_arg,
+    MB_ERROR         *p_error
+);
+
+typedef struct {
+    CPU_INT16U                 start;
+    CPU_INT16U                 count;
+    void                      *data;
+    MBSLAVE_REGMAP_READ_CB     cbRead;
+    MBSLAVE_REGMAP_WRITE_CB    cbWrite;
+    void                      *cbArg;
+} MBSLAVE_REGMAP_WINDOW;
+
+typedef struct {
+    MBSLAVE_REGMAP_WINDOW     *windows;
+    CPU_SIZE_T                 windowCnt;
+    CPU_SIZE_T                 windowCapacity;
+    CPU_SIZE_T                 windowLastHit;
+    CPU_BOOLEAN                bitMapped;
+} MBSLAVE_REGMAP;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_Initialize()
+*
+* Description : Initialize a sparse register (or bit) map.
+*
+* Argument(s) : (1) p_map           Pointer to the map.
+*               (2) p_windows       Pointer to the first element of the window storage.
+*               (3) capacity        Count of elements of the window storage.
+*               (4) bit_mapped      DEF_YES if the map holds coils or discrete inputs, DEF_NO if the map holds
+*                                   holding registers or input registers.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*                                       MB_ERROR_NULLREFERENCE    'p_map' is NULL or 'p_windows' is NULL while
+*                                                                 'capacity' is not zero.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_Initialize(
+    MBSLAVE_REGMAP          *p_map,
+    MBSLAVE_REGMAP_WINDOW   *p_windows,
+    CPU_SIZE_T               capacity,
+    CPU_BOOLEAN              bit_mapped,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_AddArray()
+*
+* Description : Add a window backed by an array to a map.
+*
+* Argument(s) : (1) p_map           Pointer to the map.
+*               (2) start           Address of the first item of the window.
+*               (3) count           Count of items of the window.
+*               (4) p_data          Pointer to the first element of the backing array ('count' CPU_INT16U
+*                                   elements for register maps, (('count' + 7) / 8) CPU_INT08U elements for
+*                                   bit maps, bit n is bit (n % 8) of byte (n / 8)).
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                       No error occurred.
+*                                       MB_ERROR_NULLREFERENCE              'p_map' or 'p_data' is NULL.
+*                                       MB_ERROR_INVALIDPARAMETER           'count' is zero.
+*                                       MB_ERROR_OVERFLOW                   The window exceeds the address space.
+*                                       MB_ERROR_SLAVE_NOFREETABLEITEM      The window storage is full.
+*                                       MB_ERROR_SLAVE_REGMAPOVERLAPPED     The window overlaps another window.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Windows can be added in any order, the map keeps them sorted by address.
+*               (2) Windows can't be added while the map is being used by a slave.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_AddArray(
+    MBSLAVE_REGMAP          *p_map,
+    CPU_INT16U               start,
+    CPU_INT16U               count,
+    void                    *p_data,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_AddHandler()
+*
+* Description : Add a window served by handlers to a map.
+*
+* Argument(s) : (1) p_map           Pointer to the map.
+*               (2) start           Address of the first item of the window.
+*               (3) count           Count of items of the window.
+*               (4) cb_read         The read handler.
+*               (5) cb_write        The write handler (NULL if the window is read-only).
+*               (6) p_arg           'p_arg' parameter passed to the handlers.
+*               (7) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                       No error occurred.
+*                                       MB_ERROR_NULLREFERENCE              'p_map' or 'cb_read' is NULL.
+*                                       MB_ERROR_INVALIDPARAMETER           'count' is zero.
+*                                       MB_ERROR_OVERFLOW                   The window exceeds the address space.
+*                                       MB_ERROR_SLAVE_NOFREETABLEITEM      The window storage is full.
+*                                       MB_ERROR_SLAVE_REGMAPOVERLAPPED     The window overlaps another window.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Windows can be added in any order, the map keeps them sorted by address.
+*               (2) Windows can't be added while the map is being used by a slave.
+*               (3) Writing to a read-only window makes the command fail with MB_ERROR_SLAVE_CALLBACKFAILED, so
+*                   read-only windows should be kept in maps that are only used by read commands.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_AddHandler(
+    MBSLAVE_REGMAP          *p_map,
+    CPU_INT16U               start,
+    CPU_INT16U               count,
+    MBSLAVE_REGMAP_READ_CB   cb_read,
+    MBSLAVE_REGMAP_WRITE_CB  cb_write,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_Validate()
+*
+* Description : Validate the address of an item (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the item.
+*               (2) p_arg           Pointer to the map.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : DEF_YES if the item is mapped, DEF_NO if not.
+*
+* Note(s)     : (1) This function can be used as any per-item validation callback (cbValidateCoil,
+*                   cbValidateDiscreteInput, cbValidateHoldingReg and cbValidateInputReg).
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN MBSlave_RegMap_Validate(
+    CPU_INT16U               address,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_ValidateRange()
+*
+* Description : Validate the address range of items (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first item.
+*               (2) quantity        Quantity of items.
+*               (3) p_arg           Pointer to the map.
+*               (4) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE             No error occurred.
+*
+* Return(s)   : DEF_YES if all items are mapped, DEF_NO if not.
+*
+* Note(s)     : (1) This function can be used as any range validation callback (cbValidateCoils,
+*                   cbValidateDiscreteInputs, cbValidateHoldingRegs and cbValidateInputRegs).
+*               (2) The range may span several adjacent windows, but not a hole between windows.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN MBSlave_RegMap_ValidateRange(
+    CPU_INT16U               address,
+    CPU_INT16U               quantity,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_ReadReg()
+*
+* Description : Read the value of a register (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the register.
+*               (2) p_arg           Pointer to the register map.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    The register is not mapped.
+*                                       (Other)                      Error returned by the read handler.
+*
+* Return(s)   : The register value.
+*********************************************************************************************************
+*/
+
+CPU_INT16U MBSlave_RegMap_ReadReg(
+    CPU_INT16U               address,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_WriteReg()
+*
+* Description : Write the value of a register (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the register.
+*               (2) value           New register value.
+*               (3) p_arg           Pointer to the register map.
+*               (4) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    The register is not mapped or is read-only.
+*                                       (Other)                      Error returned by the write handler.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_WriteReg(
+    CPU_INT16U               address,
+    CPU_INT16U               value,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_ReadRegs()
+*
+* Description : Read the values of a range of registers (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first register.
+*               (2) quantity        Quantity of registers.
+*               (3) p_values        Pointer to the first element of the big-endian register value buffer.
+*               (4) p_arg           Pointer to the register map.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    One of the registers is not mapped.
+*                                       (Other)                      Error returned by a read handler.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Each window is read with one block copy (or one handler call).
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_ReadRegs(
+    CPU_INT16U               address,
+    CPU_INT16U               quantity,
+    CPU_INT08U              *p_values,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_WriteRegs()
+*
+* Description : Write the values of a range of registers (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first register.
+*               (2) quantity        Quantity of registers.
+*               (3) p_values        Pointer to the first element of the big-endian register value buffer.
+*               (4) p_arg           Pointer to the register map.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    One of the registers is not mapped or is
+*                                                                    read-only.
+*                                       (Other)                      Error returned by a write handler.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Each window is written with one block copy (or one handler call).
+*               (2) Nothing is written if any register of the range is not mapped or read-only, but the
+*                   windows before a window whose write handler fails stay written.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_WriteRegs(
+    CPU_INT16U               address,
+    CPU_INT16U               quantity,
+    const CPU_INT08U        *p_values,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_ReadBit()
+*
+* Description : Read the status of a coil or a discrete input (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the bit.
+*               (2) p_arg           Pointer to the bit map.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    The bit is not mapped.
+*                                       (Other)                      Error returned by the read handler.
+*
+* Return(s)   : The bit status.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN MBSlave_RegMap_ReadBit(
+    CPU_INT16U               address,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_WriteBit()
+*
+* Description : Write the status of a coil (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the bit.
+*               (2) value           New bit status.
+*               (3) p_arg           Pointer to the bit map.
+*               (4) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    The bit is not mapped or is read-only.
+*                                       (Other)                      Error returned by the write handler.
+*
+* Return(s)   : None.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_WriteBit(
+    CPU_INT16U               address,
+    CPU_BOOLEAN              value,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_ReadBits()
+*
+* Description : Read the status of a range of coils or discrete inputs (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first bit.
+*               (2) quantity        Quantity of bits.
+*               (3) p_bits          Pointer to the first element of the packed bit buffer.
+*               (4) p_arg           Pointer to the bit map.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    One of the bits is not mapped.
+*                                       (Other)                      Error returned by a read handler.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Each window is read with one block copy (or one handler call) if it starts at a byte
+*                   boundary of the packed bit buffer.
+*               (2) The unused bits of the last byte of the packed bit buffer are undefined.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_ReadBits(
+    CPU_INT16U               address,
+    CPU_INT16U               quantity,
+    CPU_INT08U              *p_bits,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBSlave_RegMap_WriteBits()
+*
+* Description : Write the status of a range of coils (callback of built-in commands).
+*
+* Argument(s) : (1) address         Address of the first bit.
+*               (2) quantity        Quantity of bits.
+*               (3) p_bits          Pointer to the first element of the packed bit buffer.
+*               (4) p_arg           Pointer to the bit map.
+*               (5) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                No error occurred.
+*                                       MB_ERROR_INVALIDPARAMETER    One of the bits is not mapped or is
+*                                                                    read-only.
+*                                       (Other)                      Error returned by a write handler.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Each window is written with one block copy (or one handler call) if it starts at a byte
+*                   boundary of the packed bit buffer.
+*               (2) Nothing is written if any bit of the range is not mapped or read-only, but the windows
+*                   before a window whose write handler fails stay written.
+*********************************************************************************************************
+*/
+
+void MBSlave_RegMap_WriteBits(
+    CPU_INT16U               address,
+    CPU_INT16U               quantity,
+    const CPU_INT08U        *p_bits,
+    void                    *p_arg,
+    MB_ERROR                *p_error
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /*  #if (MB_CFG_SLAVE_EN == DEF_ENABLED) && (MB_CFG_SLAVE_REGMAP_EN == DEF_ENABLED)  */
+
+#endif
\ No newline at end of file
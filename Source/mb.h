@@ -47,6 +47,8 @@
 
 #if (MB_CFG_MASTER_EN == DEF_ENABLED)
 #include <mbmaster.h>
+#include <mbmaster_sched.h>
+#include <mbmaster_group.h>
 #endif
 
 
@@ -255,6 +255,35 @@ void MBBufEmitter_WriteUInt32LE(
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                    MBBufEmitter_WriteBlock()
+*
+* Description : Reserve a block at current position of specific buffer emitter so that it can be written 
+*               directly.
+*
+* Argument(s) : (1) p_emitter       Pointer to the emitter.
+*               (2) length          Length of the block.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                   No error occurred.
+*                                       MB_ERROR_NULLREFERENCE          'p_emitter' is NULL.
+*                                       MB_ERROR_BUFEMITTER_BUFFEREND   Length of remaining buffer is shorter than 'length'.
+*
+* Return(s)   : Pointer to the first element of the block.
+*
+* Note(s)     : (1) This function is NOT thread(task)-safe.
+*               (2) The cursor is moved to the end of the block, the caller must fill all 'length' bytes.
+*********************************************************************************************************
+*/
+
+CPU_INT08U *MBBufEmitter_WriteBlock(
+    MB_BUFFEREMITTER  *p_emitter,
+    CPU_SIZE_T         length,
+    MB_ERROR          *p_error
+);
+
+
 /*
 *********************************************************************************************************
 *                                    MBBufEmitter_GetWrittenLength()
@@ -385,6 +385,139 @@ CPU_INT16U  MBBufFetcher_ReadUInt16BE(
 }
 
 
+/*
+*********************************************************************************************************
+*                                    MBBufFetcher_ReadBlock()
+*
+* Description : Read a block from current position of specific buffer fetcher without copying it.
+*
+* Argument(s) : (1) p_fetcher       Pointer to the fetcher.
+*               (2) length          Length of the block.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_fetcher' is NULL.
+*                                       MB_ERROR_BUFFETCHER_BUFFEREND  Length of remaining data is shorter than 'length'.
+*
+* Return(s)   : Pointer to the first element of the block.
+*
+* Note(s)     : (1) This function is NOT thread(task)-safe.
+*********************************************************************************************************
+*/
+
+CPU_INT08U *MBBufFetcher_ReadBlock(
+    MB_BUFFERFETCHER  *p_fetcher,
+    CPU_SIZE_T         length,
+    MB_ERROR          *p_error
+) {
+    CPU_INT08U  *block;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_fetcher' parameter.  */
+    if (p_fetcher == (MB_BUFFERFETCHER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return (CPU_INT08U*)0;
+    }
+#endif
+
+    /*  Ensure at least 'length' bytes remained.  */
+    MBBufFetcher_EnsureRemaining(p_fetcher, length, p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return (CPU_INT08U*)0;
+    }
+
+    /*  Get the block.  */
+    block = &(p_fetcher->buffer[p_fetcher->cursor]);
+
+    /*  Move the cursor.  */
+    p_fetcher->cursor += length;
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+
+    return block;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBBufFetcher_ReadUInt16BEBlock()
+*
+* Description : Read a block of unsigned big-endian 16-bit integers from current position of specific buffer
+*               fetcher and convert them to host byte order without copying them to another buffer.
+*
+* Argument(s) : (1) p_fetcher       Pointer to the fetcher.
+*               (2) count           Count of integers.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_fetcher' is NULL.
+*                                       MB_ERROR_BUFFETCHER_BUFFEREND  Length of remaining data is shorter than (2 * count).
+*                                       MB_ERROR_INVALIDPARAMETER      The block is not aligned and the cursor is at the
+*                                                                      beginning of the buffer.
+*
+* Return(s)   : Pointer to the first integer.
+*
+* Note(s)     : (1) This function is NOT thread(task)-safe.
+*               (2) The integers are converted in place. If the block is not aligned, the integers are moved
+*                   toward the beginning of the buffer by one byte, which overwrites the last byte before the
+*                   block (so the byte must have been read).
+*********************************************************************************************************
+*/
+
+CPU_INT16U *MBBufFetcher_ReadUInt16BEBlock(
+    MB_BUFFERFETCHER  *p_fetcher,
+    CPU_SIZE_T         count,
+    MB_ERROR          *p_error
+) {
+    CPU_INT08U  *src;
+    CPU_INT16U  *dst;
+    CPU_SIZE_T   index;
+    CPU_INT16U   value;
+
+#if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
+    /*  Check 'p_fetcher' parameter.  */
+    if (p_fetcher == (MB_BUFFERFETCHER*)0) {
+        *p_error = MB_ERROR_NULLREFERENCE;
+        return (CPU_INT16U*)0;
+    }
+#endif
+
+    /*  Ensure at least (2 * count) bytes remained.  */
+    MBBufFetcher_EnsureRemaining(p_fetcher, count << 1, p_error);
+    if (*p_error != MB_ERROR_NONE) {
+        return (CPU_INT16U*)0;
+    }
+
+    /*  Get the destination (move the block by one byte if it is not aligned).  */
+    src = &(p_fetcher->buffer[p_fetcher->cursor]);
+    if (((CPU_ADDR)src % (CPU_ADDR)sizeof(CPU_INT16U)) == (CPU_ADDR)0U) {
+        dst = (CPU_INT16U*)(void*)src;
+    } else if (p_fetcher->cursor != (CPU_SIZE_T)0U) {
+        dst = (CPU_INT16U*)(void*)(src - 1);
+    } else {
+        *p_error = MB_ERROR_INVALIDPARAMETER;
+        return (CPU_INT16U*)0;
+    }
+
+    /*  Convert the integers (each destination never goes beyond its source, so forward order is safe).  */
+    for (index = (CPU_SIZE_T)0U; index < count; ++index) {
+        value   = (CPU_INT16U)(src[index << 1]);
+        value <<= (CPU_INT16U)8;
+        value  |= (CPU_INT16U)(src[(index << 1) + (CPU_SIZE_T)1U]);
+        dst[index] = value;
+    }
+
+    /*  Move the cursor.  */
+    p_fetcher->cursor += (count << 1);
+
+    /*  No error.  */
+    *p_error = MB_ERROR_NONE;
+
+    return dst;
+}
+
+
 #if 0
 /*
 *********************************************************************************************************
@@ -247,6 +247,66 @@ CPU_INT16U  MBBufFetcher_ReadUInt16BE(
 );
 
 
+/*
+*********************************************************************************************************
+*                                    MBBufFetcher_ReadBlock()
+*
+* Description : Read a block from current position of specific buffer fetcher without copying it.
+*
+* Argument(s) : (1) p_fetcher       Pointer to the fetcher.
+*               (2) length          Length of the block.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_fetcher' is NULL.
+*                                       MB_ERROR_BUFFETCHER_BUFFEREND  Length of remaining data is shorter than 'length'.
+*
+* Return(s)   : Pointer to the first element of the block.
+*
+* Note(s)     : (1) This function is NOT thread(task)-safe.
+*********************************************************************************************************
+*/
+
+CPU_INT08U *MBBufFetcher_ReadBlock(
+    MB_BUFFERFETCHER  *p_fetcher,
+    CPU_SIZE_T         length,
+    MB_ERROR          *p_error
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBBufFetcher_ReadUInt16BEBlock()
+*
+* Description : Read a block of unsigned big-endian 16-bit integers from current position of specific buffer
+*               fetcher and convert them to host byte order without copying them to another buffer.
+*
+* Argument(s) : (1) p_fetcher       Pointer to the fetcher.
+*               (2) count           Count of integers.
+*               (3) p_error         Pointer to the variable that receives error code from this function:
+*
+*                                       MB_ERROR_NONE                  No error occurred.
+*                                       MB_ERROR_NULLREFERENCE         'p_fetcher' is NULL.
+*                                       MB_ERROR_BUFFETCHER_BUFFEREND  Length of remaining data is shorter than (2 * count).
+*                                       MB_ERROR_INVALIDPARAMETER      The block is not aligned and the cursor is at the
+*                                                                      beginning of the buffer.
+*
+* Return(s)   : Pointer to the first integer.
+*
+* Note(s)     : (1) This function is NOT thread(task)-safe.
+*               (2) The integers are converted in place. If the block is not aligned, the integers are moved
+*                   toward the beginning of the buffer by one byte, which overwrites the last byte before the
+*                   block (so the byte must have been read).
+*********************************************************************************************************
+*/
+
+CPU_INT16U *MBBufFetcher_ReadUInt16BEBlock(
+    MB_BUFFERFETCHER  *p_fetcher,
+    CPU_SIZE_T         count,
+    MB_ERROR          *p_error
+);
+
+
 #if 0
 /*
 *********************************************************************************************************
@@ -120,6 +120,22 @@
 #define MB_CFG_CORE_ASCIIMODE                                DEF_DISABLED
 #endif
 
+#ifndef MB_CFG_CORE_RXRING_EN
+#define MB_CFG_CORE_RXRING_EN                                DEF_DISABLED
+#endif
+
+#ifndef MB_CFG_CORE_RXRING_SIZE
+#define MB_CFG_CORE_RXRING_SIZE                              256U
+#endif
+
+#ifndef MB_CFG_CORE_TXBLOCK_EN
+#define MB_CFG_CORE_TXBLOCK_EN                               DEF_DISABLED
+#endif
+
+#ifndef MB_CFG_CRC16_SELFTEST_EN
+#define MB_CFG_CRC16_SELFTEST_EN                             DEF_DISABLED
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -142,6 +158,15 @@
 #    error  "No available transmission mode defined in <app_cfg.h>."
 #endif
 
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+#    if (MB_CFG_CORE_RXRING_SIZE < 16U)
+#        error  "Illegal MB_CFG_CORE_RXRING_SIZE defined in <app_cfg.h>. It must not be lower than 16U."
+#    endif
+#    if ((MB_CFG_CORE_RXRING_SIZE & (MB_CFG_CORE_RXRING_SIZE - 1U)) != 0U)
+#        error  "Illegal MB_CFG_CORE_RXRING_SIZE defined in <app_cfg.h>. It must be a power of 2."
+#    endif
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -93,6 +93,7 @@ extern  "C" {
 #define MB_ERROR_OS_TIMER_FAILEDDISPOSE            ((MB_ERROR)121U)
 #define MB_ERROR_OS_TIMER_FAILEDSTART              ((MB_ERROR)122U)
 #define MB_ERROR_OS_TIMER_FAILEDSTOP               ((MB_ERROR)123U)
+#define MB_ERROR_OS_TIMER_FAILEDSET                ((MB_ERROR)124U)
 
 #define MB_ERROR_OS_TIME_FAILEDDELAY               ((MB_ERROR)125U)
 #define MB_ERROR_OS_TIME_FAILEDGET                 ((MB_ERROR)126U)
@@ -106,6 +107,7 @@ extern  "C" {
 #define MB_ERROR_SLAVE_LISTENONLYALREADYENTERED    ((MB_ERROR)156U)
 #define MB_ERROR_SLAVE_LISTENONLYALREADYEXITED     ((MB_ERROR)157U)
 #define MB_ERROR_SLAVE_STILLPOLLING                ((MB_ERROR)158U)
+#define MB_ERROR_SLAVE_REGMAPOVERLAPPED            ((MB_ERROR)159U)
 
 #define MB_ERROR_MASTER_RXBUFFERLOW                ((MB_ERROR)160U)
 #define MB_ERROR_MASTER_TXBUFFERLOW                ((MB_ERROR)160U)
@@ -118,6 +120,9 @@ extern  "C" {
 #define MB_ERROR_MASTER_STILLBUSY                  ((MB_ERROR)168U)
 
 #define MB_ERROR_MASTER_CALLBACKFAILED             ((MB_ERROR)170U)
+#define MB_ERROR_MASTER_QUEUEFULL                  ((MB_ERROR)171U)
+#define MB_ERROR_MASTER_SCHEDFULL                  ((MB_ERROR)172U)
+#define MB_ERROR_MASTER_SLAVEOFFLINE               ((MB_ERROR)173U)
 
 /*  Half-duplex modes.  */
 #define MB_HALFDUPLEX_RECEIVE                   ((MB_DUPLEXMODE)0U)
@@ -74,6 +74,40 @@
 #define MBASCIIRXSTATE_WAITCR           ((CPU_INT08U)(2U))
 #endif
 
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+/*  Modbus RX ring buffer wake-up modes.  */
+#define MBRXRING_WAKE_NONE              ((CPU_INT08U)(0U))
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+#define MBRXRING_WAKE_RTUIDLE           ((CPU_INT08U)(1U))
+#define MBRXRING_WAKE_RTUFIRSTCHAR      ((CPU_INT08U)(2U))
+#define MBRXRING_WAKE_RTUFRAME          ((CPU_INT08U)(3U))
+#endif
+#if (MB_CFG_CORE_ASCIIMODE == DEF_ENABLED)
+#define MBRXRING_WAKE_ASCIILF           ((CPU_INT08U)(4U))
+#endif
+
+/*  Modbus RX ring buffer index mask and wake-up watermark.  */
+#define MBRXRING_MASK                   ((CPU_SIZE_T)(MB_CFG_CORE_RXRING_SIZE - 1U))
+#define MBRXRING_WATERMARK              ((CPU_SIZE_T)(MB_CFG_CORE_RXRING_SIZE >> 1U))
+#endif
+
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+/*  Modbus TX block buffer size (maximum ADU size of enabled transmission modes).  */
+#if (MB_CFG_CORE_ASCIIMODE == DEF_ENABLED)
+#define MBTXBLOCK_SIZE                  ((CPU_SIZE_T)(513U))
+#else
+#define MBTXBLOCK_SIZE                  ((CPU_SIZE_T)(256U))
+#endif
+
+/*  Modbus TX block encoding overheads (address, function code and checksum).  */
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+#define MBTXBLOCK_OVERHEAD_RTU          ((CPU_SIZE_T)(4U))
+#endif
+#if (MB_CFG_CORE_ASCIIMODE == DEF_ENABLED)
+#define MBTXBLOCK_OVERHEAD_ASCII        ((CPU_SIZE_T)(9U))
+#endif
+#endif
+
 /*
 *********************************************************************************************************
 *                                          TYPE DEFINITIONS
@@ -84,13 +118,30 @@ typedef struct {
     CPU_INT08U     rxInProgressCounter;
     CPU_INT08U     txInProgressCounter;
 
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+    CPU_INT08U              rxRing[MB_CFG_CORE_RXRING_SIZE];
+    volatile CPU_SIZE_T     rxRingHead;
+    volatile CPU_SIZE_T     rxRingTail;
+    volatile CPU_SIZE_T     rxRingMark;
+    volatile CPU_INT08U     rxRingWakeMode;
+#if (MB_CFG_CORE_ASCIIMODE == DEF_ENABLED)
+    CPU_INT08U              rxRingWakeChar;
+#endif
+#else
     CPU_INT08U     rxDatum;
     CPU_BOOLEAN    rxDatumEaten;
+#endif
+
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+    CPU_INT08U     txBlock[MBTXBLOCK_SIZE];
+#endif
 
     MB_MUTEX       ioLock;
 
     MB_FLAGGROUP   evFlags;
 
+    MB_TIMER       rxTimeoutTmr;
+
 #if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
     CPU_INT32U     halfCharCounter;
 
@@ -139,10 +190,6 @@ typedef struct {
 #endif
 } MB_DEVICE;
 
-typedef struct {
-    MB_DEVICE  *device;
-} MB_RXTIMEOUT_CBINFO;
-
 
 /*
 *********************************************************************************************************
@@ -161,6 +208,27 @@ static void MB_Context_Initialize(
     MB_CONTEXT  *ctx, 
     MB_ERROR    *p_error
 );
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+static void MB_RxRing_Reset(
+    MB_CONTEXT  *ctx
+);
+static CPU_BOOLEAN MB_RxRing_Write(
+    MB_CONTEXT  *ctx,
+    CPU_INT08U   datum
+);
+static CPU_BOOLEAN MB_RxRing_Read(
+    MB_CONTEXT  *ctx,
+    CPU_SIZE_T   end,
+    CPU_INT08U  *p_datum
+);
+#endif
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+static CPU_SIZE_T MB_TxBlock_Encode(
+    MB_DEVICE   *ifdev,
+    MB_FRAME    *p_frame,
+    MB_ERROR    *p_error
+);
+#endif
 static void MB_ISR_RxTimeoutExceed(
     void        *p_tmr, 
     void        *p_arg
@@ -269,6 +337,7 @@ void MB_Initialize(
 *                                 MB_ERROR_DEVICENOFREE            No free device entry that can be used.
 *                                 MB_ERROR_OS_MUTEX_FAILEDCREATE   Unable to create a mutex object.
 *                                 MB_ERROR_OS_FGRP_FAILEDCREATE    Unable to create a flag group object.
+*                                 MB_ERROR_OS_TIMER_FAILEDCREATE   Unable to create a timer object.
 *
 * Return(s)   : The Modbus device interface ID.
 *********************************************************************************************************
@@ -1180,7 +1249,7 @@ MBGETHCTPRESCALE_EXIT:
 *                                      MB_ERROR_OS_FGRP_FAILEDPEND     Failed to pend on a flag group object.
 *                                      MB_ERROR_OS_FGRP_FAILEDPOST     Failed to post to a flag group object.
 *                                      MB_ERROR_OS_MUTEX_FAILEDPEND    Failed to pend on a mutex object.
-*                                      MB_ERROR_OS_TIMER_FAILEDCREATE  Failed to create timer object.
+*                                      MB_ERROR_OS_TIMER_FAILEDSET     Failed to set a timer object.
 *                                      MB_ERROR_OS_TIMER_FAILEDSTART   Failed to start a timer object.
 *
 * Return(s)   : None.
@@ -1205,12 +1274,6 @@ void MB_WaitStartup(
 
     MB_CONTEXT            *ctx;
 
-#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
-    MB_RXTIMEOUT_CBINFO    rxTimeoutCbInfo;
-#endif
-
-    MB_TIMER               timeouter;
-
 #if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
     MB_FLAGS               fgrpFlags;
 #endif
@@ -1325,15 +1388,11 @@ void MB_WaitStartup(
             goto MBWAITSTARTUP_EXIT;
         }
 
-        /*  Create the timeout timer.  */
+        /*  Re-arm the timeout timer.  */
         if (timeout != (MB_TIMESPAN)0U) {
-            rxTimeoutCbInfo.device = ifdev;
-            MBOS_TimerCreate(
-                &timeouter,
+            MBOS_TimerSetInterval(
+                &(ctx->rxTimeoutTmr),
                 timeout,
-                MB_TIMER_MODE_ONESHOT,
-                MB_ISR_RxTimeoutExceed,
-                (void*)(&rxTimeoutCbInfo),
                 p_error
             );
             if (*p_error != MB_ERROR_NONE) {
@@ -1341,7 +1400,7 @@ void MB_WaitStartup(
             }
             gc.clrRxTimeoutTmr = DEF_YES;
             MBOS_TimerStart(
-                &timeouter,
+                &(ctx->rxTimeoutTmr),
                 p_error
             );
             if (*p_error != MB_ERROR_NONE) {
@@ -1349,9 +1408,14 @@ void MB_WaitStartup(
             }
         }
 
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+        /*  Let the RX ISR restart the half-character timer on every received character.  */
+        ctx->rxRingWakeMode = MBRXRING_WAKE_RTUIDLE;
+#else
         /*  Clear RX datum.  */
         ctx->rxDatum = (CPU_INT08U)0U;
         ctx->rxDatumEaten = DEF_YES;
+#endif
 
         /*  Start the receiver.  */
         ifdrv->rxStart(p_error);
@@ -1360,6 +1424,86 @@ void MB_WaitStartup(
         }
         gc.clrRxReceiver = DEF_YES;
 
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+        /*  Reset the events.  */
+        MBOS_FlagGroupPost(
+            &(ctx->evFlags),
+            (
+                MBCTX_EVENT_1D5CTIMEEXCEED | 
+                MBCTX_EVENT_2D0CTIMEEXCEED | 
+                MBCTX_EVENT_3D5CTIMEEXCEED | 
+                MBCTX_EVENT_RXCOMPLETE
+            ),
+            MB_FLAGGROUP_OPT_CLR,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            goto MBWAITSTARTUP_EXIT;
+        }
+
+        /*  Reset the half-character counter.  */
+        ctx->halfCharCounter = (CPU_INT32U)0U;
+
+        /*  Start the half-character timer.  */
+        ifdrv->halfCharacterTimerStart(p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            goto MBWAITSTARTUP_EXIT;
+        }
+        gc.clrRxHalfCharTmr = DEF_YES;
+
+        /*
+         *  Note(s):
+         *    (1) Received characters are handled by the RX ISR directly (the half-character 
+         *        counter is reset there), so we would only be woken up once the serial line 
+         *        has been idle for 3.5 character time (or the timeout exceeds).
+         */
+        while (DEF_YES) {
+            /*  Exit critical section.  */
+            CPU_CRITICAL_EXIT();
+            gc.clrCriticalSect = DEF_NO;
+
+            /*  Wait for events.  */
+            fgrpFlags = (MB_FLAGS)(
+                MBCTX_EVENT_3D5CTIMEEXCEED | 
+                MBCTX_EVENT_RXTIMEOUT
+            );
+            MBOS_FlagGroupPend(
+                &(ctx->evFlags),
+                &fgrpFlags,
+                (MB_TIMESPAN)0U,
+                MB_FLAGGROUP_OPT_SET_ANY,
+                p_error
+            );
+            if (*p_error != MB_ERROR_NONE) {
+                goto MBWAITSTARTUP_EXIT;
+            }
+
+            /*  Enter critical section.  */
+            CPU_CRITICAL_ENTER();
+            gc.clrCriticalSect = DEF_YES;
+
+            /*  Check events.  */
+            if ((fgrpFlags & MBCTX_EVENT_3D5CTIMEEXCEED) != (MB_FLAGS)0) {
+                /*  3.5 character time exceeds without receiving any character, OK now.  */
+                break;
+            } else if ((fgrpFlags & MBCTX_EVENT_RXTIMEOUT) != (MB_FLAGS)0) {
+                /*  RX timeout exceeds.  */
+                *p_error = MB_ERROR_TIMEOUT;
+
+                goto MBWAITSTARTUP_EXIT;
+            } else {
+                /*  Unknown event.  */
+                continue;
+            }
+        }
+
+        /*  Stop the half-character timer.  */
+        ifdrv->halfCharacterTimerStop(p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            goto MBWAITSTARTUP_EXIT;
+        }
+        gc.clrRxHalfCharTmr = DEF_NO;
+#else
         while (DEF_YES) {
             /*  Reset the events.  */
             MBOS_FlagGroupPost(
@@ -1436,6 +1580,7 @@ void MB_WaitStartup(
                 continue;
             }
         }
+#endif  /*  #if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)  */
 
         /*  Stop the receiver.  */
         ifdrv->rxStop(p_error);
@@ -1443,6 +1588,11 @@ void MB_WaitStartup(
             goto MBWAITSTARTUP_EXIT;
         }
         gc.clrRxReceiver = DEF_NO;
+
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+        /*  Stop handling received characters in the RX ISR.  */
+        ctx->rxRingWakeMode = MBRXRING_WAKE_NONE;
+#endif
     }
 #endif  /*  #if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)  */
 
@@ -1456,6 +1606,11 @@ MBWAITSTARTUP_EXIT:
         if (ifdrv != (MB_DRIVER*)0) {
             ifdrv->rxStop(&error);
         }
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+        if (ctx != (MB_CONTEXT*)0) {
+            ctx->rxRingWakeMode = MBRXRING_WAKE_NONE;
+        }
+#endif
         gc.clrRxReceiver = DEF_NO;
     }
 
@@ -1469,10 +1624,10 @@ MBWAITSTARTUP_EXIT:
     }
 #endif
 
-    /*  Dispose the RX timeout timer (if needed).  */
+    /*  Stop the RX timeout timer (if needed).  */
     if (gc.clrRxTimeoutTmr) {
-        MBOS_TimerDispose(
-            &timeouter,
+        MBOS_TimerStop(
+            &(ctx->rxTimeoutTmr),
             &error
         );
         gc.clrRxTimeoutTmr = DEF_NO;
@@ -1545,7 +1700,7 @@ MBWAITSTARTUP_EXIT:
 *                                      MB_ERROR_OS_FGRP_FAILEDPEND     Failed to pend on a flag group object.
 *                                      MB_ERROR_OS_FGRP_FAILEDPOST     Failed to post to a flag group object.
 *                                      MB_ERROR_OS_MUTEX_FAILEDPEND    Failed to pend on a mutex object.
-*                                      MB_ERROR_OS_TIMER_FAILEDCREATE  Failed to create timer object.
+*                                      MB_ERROR_OS_TIMER_FAILEDSET     Failed to set a timer object.
 *                                      MB_ERROR_OS_TIMER_FAILEDSTART   Failed to start a timer object.
 *
 * Return(s)   : None.
@@ -1556,6 +1711,9 @@ MBWAITSTARTUP_EXIT:
 *
 *               (2) The 'timeout' parameter only affects the time of waiting a frame on the serial line.
 *               (3) The function would be blocked (without respecting the 'timeout' parameter) until previous I/O finished.
+*               (4) If MB_CFG_CORE_RXRING_EN is enabled, received characters are buffered by the RX ISR and the 
+*                   calling task is only woken up at frame boundaries (3.5 character time in RTU mode, line feed 
+*                   character in ASCII mode), on timeout or when the RX ring buffer is half full.
 *********************************************************************************************************
 */
 
@@ -1575,10 +1733,6 @@ void MB_ReceiveFrame(
 
     MB_CONTEXT            *ctx;
 
-    MB_RXTIMEOUT_CBINFO    rxTimeoutCbInfo;
-
-    MB_TIMER               timeouter;
-
     MB_FLAGS               fgrpFlags;
 
     struct {
@@ -1601,6 +1755,10 @@ void MB_ReceiveFrame(
 #endif
         struct {
             CPU_BOOLEAN    rtuFirstChar;
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+            CPU_INT08U     rxDatumTmp;
+            CPU_SIZE_T     rxRingEnd;
+#endif
         } rtuMode;
     } msv  /*  MSV. = Mode Specific Variables.  */;
 
@@ -1728,15 +1886,11 @@ void MB_ReceiveFrame(
         goto MBRXFRAME_EXIT;
     }
 
-    /*  Create the RX timeout timer.  */
+    /*  Re-arm the RX timeout timer.  */
     if (timeout != (MB_TIMESPAN)0U) {
-        rxTimeoutCbInfo.device = ifdev;
-        MBOS_TimerCreate(
-            &timeouter,
+        MBOS_TimerSetInterval(
+            &(ctx->rxTimeoutTmr),
             timeout,
-            MB_TIMER_MODE_ONESHOT,
-            MB_ISR_RxTimeoutExceed,
-            (void*)(&rxTimeoutCbInfo),
             p_error
         );
         if (*p_error != MB_ERROR_NONE) {
@@ -1744,7 +1898,7 @@ void MB_ReceiveFrame(
         }
         gc.clrRxTimeoutTmr = DEF_YES;
         MBOS_TimerStart(
-            &timeouter,
+            &(ctx->rxTimeoutTmr),
             p_error
         );
         if (*p_error != MB_ERROR_NONE) {
@@ -1752,9 +1906,14 @@ void MB_ReceiveFrame(
         }
     }
 
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+    /*  Drop all characters left in the RX ring buffer.  */
+    MB_RxRing_Reset(ctx);
+#else
     /*  Clear RX datum.  */
     ctx->rxDatum = (CPU_INT08U)0U;
     ctx->rxDatumEaten = DEF_YES;
+#endif
 
     /*  Read the frame.  */
     switch (ifdev->mode) {
@@ -1775,6 +1934,30 @@ void MB_ReceiveFrame(
                     goto MBRXFRAME_EXIT;
                 }
 
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+                /*  Reset the events.  */
+                MBOS_FlagGroupPost(
+                    &(ctx->evFlags),
+                    (
+                        MBCTX_EVENT_1D5CTIMEEXCEED | 
+                        MBCTX_EVENT_2D0CTIMEEXCEED | 
+                        MBCTX_EVENT_3D5CTIMEEXCEED | 
+                        MBCTX_EVENT_RXCOMPLETE
+                    ),
+                    MB_FLAGGROUP_OPT_CLR,
+                    p_error
+                );
+                if (*p_error != MB_ERROR_NONE) {
+                    goto MBRXFRAME_EXIT;
+                }
+
+                /*  Reset the half-character counter.  */
+                ctx->halfCharCounter = (CPU_INT32U)0U;
+
+                /*  Let the RX ISR start the half-character timer when the first character arrives.  */
+                ctx->rxRingWakeMode = MBRXRING_WAKE_RTUFIRSTCHAR;
+#endif
+
                 /*  Start the receiver.  */
                 ifdrv->rxStart(p_error);
                 if (*p_error != MB_ERROR_NONE) {
@@ -1782,6 +1965,150 @@ void MB_ReceiveFrame(
                 }
                 gc.clrRxReceiver = DEF_YES;
 
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+                /*  The half-character timer would be started by the RX ISR.  */
+                gc.clrRxHalfCharTmr = DEF_YES;
+
+                /*
+                *  Here we are going to the "Reception" state.
+                *
+                *  Note(s):
+                *    (1) Received characters are stored to the RX ring buffer by the RX ISR, which 
+                *        also restarts the half-character timer for every character that is received 
+                *        within 1.5 character time. Characters received after that are marked as 
+                *        redundant (by not moving 'rxRingMark').
+                *
+                *    (2) We would only be woken up when 3.5 character time exceeds (the end of the 
+                *        frame), the RX timeout exceeds or the RX ring buffer is half full.
+                */
+                while (DEF_YES) {
+                    /*  Exit critical section.  */
+                    CPU_CRITICAL_EXIT();
+                    gc.clrCriticalSect = DEF_NO;
+
+                    /*  Wait for events.  */
+                    fgrpFlags = (MB_FLAGS)(
+                        MBCTX_EVENT_3D5CTIMEEXCEED | 
+                        MBCTX_EVENT_RXCOMPLETE | 
+                        MBCTX_EVENT_RXTIMEOUT
+                    );
+                    MBOS_FlagGroupPend(
+                        &(ctx->evFlags),
+                        &fgrpFlags,
+                        (MB_TIMESPAN)0U,
+                        (MB_OPT)(MB_FLAGGROUP_OPT_SET_ANY | MB_FLAGGROUP_OPT_CONSUME),
+                        p_error
+                    );
+                    if (*p_error != MB_ERROR_NONE) {
+                        goto MBRXFRAME_EXIT;
+                    }
+
+                    /*  Enter critical section.  */
+                    CPU_CRITICAL_ENTER();
+                    gc.clrCriticalSect = DEF_YES;
+
+                    /*  Handle RX timeout event.  */
+                    if ((fgrpFlags & MBCTX_EVENT_RXTIMEOUT) != (MB_FLAGS)0) {
+                        /*  The RX timeout only applies to the first character.  */
+                        if (ctx->rxRingWakeMode == MBRXRING_WAKE_RTUFIRSTCHAR) {
+                            /*  Error: RX timeout exceeds.  */
+                            *p_error = MB_ERROR_TIMEOUT;
+
+                            goto MBRXFRAME_EXIT;
+                        }
+                    }
+
+                    /*  Handle RX complete (RX ring buffer half full) event.  */
+                    if ((fgrpFlags & MBCTX_EVENT_RXCOMPLETE) != (MB_FLAGS)0) {
+                        /*  Get the end of characters that belong to the frame.  */
+                        msv.rtuMode.rxRingEnd = ctx->rxRingMark;
+
+                        /*  Exit critical section.  */
+                        CPU_CRITICAL_EXIT();
+                        gc.clrCriticalSect = DEF_NO;
+
+                        /*  Push the characters to the frame decoder.  */
+                        while (MB_RxRing_Read(ctx, msv.rtuMode.rxRingEnd, &(msv.rtuMode.rxDatumTmp))) {
+                            MBFrameDecRTU_Update(
+                                &(decoder.rtuDecoder),
+                                msv.rtuMode.rxDatumTmp,
+                                p_error
+                            );
+                            if (*p_error != MB_ERROR_NONE) {
+                                goto MBRXFRAME_EXIT;
+                            }
+                        }
+
+                        /*  Enter critical section.  */
+                        CPU_CRITICAL_ENTER();
+                        gc.clrCriticalSect = DEF_YES;
+                    }
+
+                    /*  Handle 3.5 character time exceeds event.  */
+                    if ((fgrpFlags & MBCTX_EVENT_3D5CTIMEEXCEED) != (MB_FLAGS)0) {
+                        break;
+                    }
+                }
+
+                /*  Stop the receiver.  */
+                ifdrv->rxStop(p_error);
+                if (*p_error != MB_ERROR_NONE) {
+                    goto MBRXFRAME_EXIT;
+                }
+                gc.clrRxReceiver = DEF_NO;
+                ctx->rxRingWakeMode = MBRXRING_WAKE_NONE;
+
+                /*  Stop the half-character timer.  */
+                ifdrv->halfCharacterTimerStop(p_error);
+                if (*p_error != MB_ERROR_NONE) {
+                    goto MBRXFRAME_EXIT;
+                }
+                gc.clrRxHalfCharTmr = DEF_NO;
+
+                /*  Get the end of characters that belong to the frame.  */
+                msv.rtuMode.rxRingEnd = ctx->rxRingMark;
+
+                /*  Exit critical section.  */
+                CPU_CRITICAL_EXIT();
+                gc.clrCriticalSect = DEF_NO;
+
+                /*  Push remaining characters of the frame to the frame decoder.  */
+                while (MB_RxRing_Read(ctx, msv.rtuMode.rxRingEnd, &(msv.rtuMode.rxDatumTmp))) {
+                    MBFrameDecRTU_Update(
+                        &(decoder.rtuDecoder),
+                        msv.rtuMode.rxDatumTmp,
+                        p_error
+                    );
+                    if (*p_error != MB_ERROR_NONE) {
+                        goto MBRXFRAME_EXIT;
+                    }
+                }
+
+                /*  End the frame decoder.  */
+                MBFrameDecRTU_End(
+                    &(decoder.rtuDecoder),
+                    p_error
+                );
+                if (*p_error != MB_ERROR_NONE) {
+                    goto MBRXFRAME_EXIT;
+                }
+
+                /*  Push characters received after 1.5 character time to the frame decoder.  */
+                while (MB_RxRing_Read(ctx, ctx->rxRingHead, &(msv.rtuMode.rxDatumTmp))) {
+                    MBFrameDecRTU_Update(
+                        &(decoder.rtuDecoder),
+                        msv.rtuMode.rxDatumTmp,
+                        p_error
+                    );
+                    if (*p_error != MB_ERROR_NONE) {
+                        goto MBRXFRAME_EXIT;
+                    }
+                }
+
+                /*  Enter critical section.  */
+                CPU_CRITICAL_ENTER();
+                gc.clrCriticalSect = DEF_YES;
+#else
                 /*
                 *  Here we are going to the "Reception" state.
                 */
@@ -1981,6 +2308,7 @@ void MB_ReceiveFrame(
                     goto MBRXFRAME_EXIT;
                 }
                 gc.clrRxHalfCharTmr = DEF_NO;
+#endif  /*  #if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)  */
 
                 /*  Extract the frame from the decoder.  */
                 MBFrameDecRTU_ToFrame(
@@ -2001,6 +2329,23 @@ void MB_ReceiveFrame(
                 /*  Initialize MSV.  */
                 msv.asciiMode.rxState = MBASCIIRXSTATE_WAITCOLON;
 
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+                /*  Reset the RX complete bit.  */
+                MBOS_FlagGroupPost(
+                    &(ctx->evFlags),
+                    MBCTX_EVENT_RXCOMPLETE,
+                    MB_FLAGGROUP_OPT_CLR,
+                    p_error
+                );
+                if (*p_error != MB_ERROR_NONE) {
+                    goto MBRXFRAME_EXIT;
+                }
+
+                /*  Let the RX ISR wake us up when a line feed character arrives.  */
+                ctx->rxRingWakeChar = ifdev->asciiModeLF;
+                ctx->rxRingWakeMode = MBRXRING_WAKE_ASCIILF;
+#endif
+
                 /*  Start the receiver.  */
                 ifdrv->rxStart(p_error);
                 if (*p_error != MB_ERROR_NONE) {
@@ -2008,7 +2353,20 @@ void MB_ReceiveFrame(
                 }
                 gc.clrRxReceiver = DEF_YES;
 
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+                /*  Exit critical section (characters are handled outside of it).  */
+                CPU_CRITICAL_EXIT();
+                gc.clrCriticalSect = DEF_NO;
+
+                /*  No event yet.  */
+                fgrpFlags = (MB_FLAGS)0U;
+#endif
+
                 while (DEF_YES) {
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+                    /*  Handle all characters in the RX ring buffer.  */
+                    while (MB_RxRing_Read(ctx, ctx->rxRingHead, &(msv.asciiMode.rxDatumTmp))) {
+#else
                     /*  Reset events.  */
                     MBOS_FlagGroupPost(
                         &(ctx->evFlags),
@@ -2051,6 +2409,7 @@ void MB_ReceiveFrame(
                     if ((fgrpFlags & MBCTX_EVENT_RXCOMPLETE) != (MB_FLAGS)0) {
                         ctx->rxDatumEaten = DEF_YES;
                         msv.asciiMode.rxDatumTmp = ctx->rxDatum;
+#endif
                         switch (msv.asciiMode.rxState) {
                             case MBASCIIRXSTATE_WAITCOLON:
                                 if (msv.asciiMode.rxDatumTmp == (CPU_INT08U)ASCII_CHAR_COLON) {
@@ -2146,15 +2505,42 @@ void MB_ReceiveFrame(
 
                         goto MBRXFRAME_EXIT;
                     }
+
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+                    /*  Wait for events.  */
+                    fgrpFlags = (MB_FLAGS)(
+                        MBCTX_EVENT_RXCOMPLETE | 
+                        MBCTX_EVENT_RXTIMEOUT
+                    );
+                    MBOS_FlagGroupPend(
+                        &(ctx->evFlags),
+                        &fgrpFlags,
+                        (MB_TIMESPAN)0,
+                        (MB_OPT)(MB_FLAGGROUP_OPT_SET_ANY | MB_FLAGGROUP_OPT_CONSUME),
+                        p_error
+                    );
+                    if (*p_error != MB_ERROR_NONE) {
+                        goto MBRXFRAME_EXIT;
+                    }
+#endif
                 }
 
 MBRXFRAME_ASCII_FRAMEFINISH:
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+                /*  Enter critical section.  */
+                CPU_CRITICAL_ENTER();
+                gc.clrCriticalSect = DEF_YES;
+#endif
+
                 /*  Stop the receiver.  */
                 ifdrv->rxStop(p_error);
                 if (*p_error != MB_ERROR_NONE) {
                     goto MBRXFRAME_EXIT;
                 }
                 gc.clrRxReceiver = DEF_NO;
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+                ctx->rxRingWakeMode = MBRXRING_WAKE_NONE;
+#endif
 
                 /*  Extract the frame from the decoder.  */
                 MBFrameDecASCII_ToFrame(
@@ -2207,6 +2593,11 @@ MBRXFRAME_EXIT:
         if (ifdrv != (MB_DRIVER*)0) {
             ifdrv->rxStop(&error);
         }
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+        if (ctx != (MB_CONTEXT*)0) {
+            ctx->rxRingWakeMode = MBRXRING_WAKE_NONE;
+        }
+#endif
         gc.clrRxReceiver = DEF_NO;
     }
 
@@ -2220,10 +2611,10 @@ MBRXFRAME_EXIT:
     }
 #endif
 
-    /*  Dispose the RX timeout timer.  */
+    /*  Stop the RX timeout timer.  */
     if (gc.clrRxTimeoutTmr) {
-        MBOS_TimerDispose(
-            &timeouter,
+        MBOS_TimerStop(
+            &(ctx->rxTimeoutTmr),
             &error
         );
         gc.clrRxTimeoutTmr = DEF_NO;
@@ -2283,6 +2674,8 @@ MBRXFRAME_EXIT:
 * Return(s)   : None.
 *
 * Note(s)     : (1) The function would be blocked until previous I/O finished.
+*               (2) If MB_CFG_CORE_TXBLOCK_EN is enabled and the driver provides txTransmitBlock(), the whole 
+*                   frame would be encoded first and then be handed over to the driver at once.
 *********************************************************************************************************
 */
 
@@ -2322,6 +2715,10 @@ void MB_TransmitFrame(
     CPU_BOOLEAN  encoderHasNext;
     CPU_INT08U   encoderDatum;
 
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+    CPU_SIZE_T   txBlockLength;
+#endif
+
     CPU_SR_ALLOC();
 
 #if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
@@ -2355,6 +2752,9 @@ void MB_TransmitFrame(
     gc.clrTxRequestCnt   = DEF_NO;
     gc.clrCriticalSect   = DEF_NO;
     error                = MB_ERROR_NONE;
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+    txBlockLength        = (CPU_SIZE_T)0U;
+#endif
 
     /*  No error by default.  */
     *p_error             = MB_ERROR_NONE;
@@ -2417,6 +2817,25 @@ void MB_TransmitFrame(
     }
     gc.clrIoLock = DEF_YES;
 
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+    /*
+     *  Pre-encode the whole frame if the driver supports burst transmission.
+     * 
+     *  Note(s):
+     *    (1) The TX block buffer is protected by the I/O lock, so the frame
+     *        can be encoded with interrupts enabled.
+     *    (2) If the frame doesn't fit the TX block buffer, zero would be
+     *        returned and the frame would be transmitted character by 
+     *        character.
+     */
+    if (ifdrv->txTransmitBlock != (MB_DRIVER_TXTRANSMITBLOCK)0) {
+        txBlockLength = MB_TxBlock_Encode(ifdev, p_frame, p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            goto MBTXFRAME_EXIT;
+        }
+    }
+#endif
+
     /*  Enter critical section.  */
     CPU_CRITICAL_ENTER();
     gc.clrCriticalSect = DEF_YES;
@@ -2439,6 +2858,51 @@ void MB_TransmitFrame(
     }
     gc.clrTxTransmit = DEF_YES;
 
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+    /*  Transmit the pre-encoded frame at once (if any).  */
+    if (txBlockLength != (CPU_SIZE_T)0U) {
+        /*  Reset the events.  */
+        MBOS_FlagGroupPost(
+            &(ctx->evFlags),
+            MBCTX_EVENT_TXCOMPLETE,
+            MB_FLAGGROUP_OPT_CLR,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            goto MBTXFRAME_EXIT;
+        }
+
+        /*  Transmit the block.  */
+        ifdrv->txTransmitBlock(ctx->txBlock, txBlockLength, p_error);
+        if (*p_error != MB_ERROR_NONE) {
+            goto MBTXFRAME_EXIT;
+        }
+
+        /*  Exit critical section.  */
+        CPU_CRITICAL_EXIT();
+        gc.clrCriticalSect = DEF_NO;
+
+        /*  Wait for TX complete (signaled once the whole block was transmitted).  */
+        fgrpFlags = MBCTX_EVENT_TXCOMPLETE;
+        MBOS_FlagGroupPend(
+            &(ctx->evFlags),
+            &fgrpFlags,
+            (MB_TIMESPAN)0U,
+            MB_FLAGGROUP_OPT_SET_ANY,
+            p_error
+        );
+        if (*p_error != MB_ERROR_NONE) {
+            goto MBTXFRAME_EXIT;
+        }
+
+        /*  Enter critical section.  */
+        CPU_CRITICAL_ENTER();
+        gc.clrCriticalSect = DEF_YES;
+
+        goto MBTXFRAME_TXSTOP;
+    }
+#endif
+
     /*  Transmit the frame.  */
     switch (ifdev->mode) {
 #if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
@@ -2604,6 +3068,9 @@ void MB_TransmitFrame(
             goto MBTXFRAME_EXIT;
     }
 
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+MBTXFRAME_TXSTOP:
+#endif
     /*  Stop transmission.  */
     ifdrv->txStop(p_error);
     if (*p_error != MB_ERROR_NONE) {
@@ -3365,6 +3832,7 @@ static MB_DEVICE* MB_GetDevice(
 *                                 MB_ERROR_NULLREFERENCE           'ctx' is NULL.
 *                                 MB_ERROR_OS_MUTEX_FAILEDCREATE   Unable to create a mutex object.
 *                                 MB_ERROR_OS_FGRP_FAILEDCREATE    Unable to create a flag group object.
+*                                 MB_ERROR_OS_TIMER_FAILEDCREATE   Unable to create a timer object.
 *
 * Return(s)   : None.
 *
@@ -3379,6 +3847,7 @@ static void MB_Context_Initialize(
     MB_ERROR disposeError;
 
     CPU_BOOLEAN  clrIoLock;
+    CPU_BOOLEAN  clrEvFlags;
 
 #if (MB_CFG_ARG_CHK_EN == DEF_ENABLED)
     /*  Check 'ctx' parameter.  */
@@ -3389,7 +3858,8 @@ static void MB_Context_Initialize(
 #endif
 
     /*  Initialize local variables.  */
-    clrIoLock = DEF_NO;
+    clrIoLock  = DEF_NO;
+    clrEvFlags = DEF_NO;
 
     /*  No error by default.  */
     *p_error = MB_ERROR_NONE;
@@ -3419,6 +3889,27 @@ static void MB_Context_Initialize(
     if (*p_error != MB_ERROR_NONE) {
         goto MBCTXINIT_EXIT;
     }
+    clrEvFlags = DEF_YES;
+
+    /*
+     *  Initialize 'rxTimeoutTmr' member.
+     * 
+     *  Note(s):
+     *    (1) The timer is created once here and re-armed (with the timeout
+     *        of each request) by MB_WaitStartup() and MB_ReceiveFrame(), so
+     *        no kernel object would be created or deleted per request.
+     */
+    MBOS_TimerCreate(
+        &(ctx->rxTimeoutTmr),
+        (MB_TIMESPAN)1U,
+        MB_TIMER_MODE_ONESHOT,
+        MB_ISR_RxTimeoutExceed,
+        (void*)ctx,
+        p_error
+    );
+    if (*p_error != MB_ERROR_NONE) {
+        goto MBCTXINIT_EXIT;
+    }
 
 #if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
     /*  Initialize 'halfCharCounter' member.  */
@@ -3433,9 +3924,18 @@ static void MB_Context_Initialize(
     ctx->halfCharCountCache_3D5 = (CPU_INT32U)7U;
 #endif
 
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+    /*  Initialize the RX ring buffer.  */
+    MB_RxRing_Reset(ctx);
+    ctx->rxRingWakeMode = MBRXRING_WAKE_NONE;
+#if (MB_CFG_CORE_ASCIIMODE == DEF_ENABLED)
+    ctx->rxRingWakeChar = (CPU_INT08U)ASCII_CHAR_LINE_FEED;
+#endif
+#else
     /*  Clear RX datum.  */
     ctx->rxDatum = (CPU_INT08U)0U;
     ctx->rxDatumEaten = DEF_YES;
+#endif
 
     /*  Clear RX errors.  */
     ctx->rxParityError = DEF_NO;
@@ -3463,9 +3963,19 @@ static void MB_Context_Initialize(
 #endif
 
     /*  Now all members are initialized successfully, unmark cleanup flags.  */
-    clrIoLock = DEF_NO;
+    clrIoLock  = DEF_NO;
+    clrEvFlags = DEF_NO;
 
 MBCTXINIT_EXIT:
+    /*  Cleanup the event flags (if error occurred).  */
+    if (clrEvFlags) {
+        MBOS_FlagGroupDispose(
+            &(ctx->evFlags),
+            &disposeError
+        );
+        clrEvFlags = DEF_NO;
+    }
+
     /*  Cleanup the I/O lock (if error occurred).  */
     if (clrIoLock) {
         MBOS_MutexDispose(
@@ -3477,6 +3987,235 @@ MBCTXINIT_EXIT:
 }
 
 
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                    MB_RxRing_Reset()
+*
+* Description : Drop all characters in the RX ring buffer of a Modbus context.
+*
+* Argument(s) : (1) ctx     The Modbus context.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when calling this function.
+*               (2) The receiver is assumed to be stopped when calling this function.
+*********************************************************************************************************
+*/
+
+static void MB_RxRing_Reset(
+    MB_CONTEXT  *ctx
+) {
+    ctx->rxRingHead = (CPU_SIZE_T)0U;
+    ctx->rxRingTail = (CPU_SIZE_T)0U;
+    ctx->rxRingMark = (CPU_SIZE_T)0U;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MB_RxRing_Write()
+*
+* Description : (ISR) Store one character to the RX ring buffer of a Modbus context.
+*
+* Argument(s) : (1) ctx     The Modbus context.
+*               (2) datum   The character.
+*
+* Return(s)   : DEF_YES if the character was stored, DEF_NO if the RX ring buffer is full (the character is 
+*               dropped).
+*
+* Note(s)     : (1) Interrupts are assumed to be disabled when calling this function.
+*               (2) The RX ring buffer is a single-producer single-consumer queue. This function is the only 
+*                   writer of 'rxRingHead', while MB_RxRing_Read() is the only writer of 'rxRingTail'.
+*               (3) The RX complete bit would be set when the RX ring buffer becomes half full, so that the 
+*                   receiving task can drain it before it overflows.
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MB_RxRing_Write(
+    MB_CONTEXT  *ctx,
+    CPU_INT08U   datum
+) {
+    CPU_SIZE_T   head;
+    CPU_SIZE_T   used;
+    MB_ERROR     error;
+
+    /*  Get the count of characters in the RX ring buffer.  */
+    head = ctx->rxRingHead;
+    used = (CPU_SIZE_T)(head - ctx->rxRingTail);
+
+    /*  Drop the character if the RX ring buffer is full.  */
+    if (used >= (CPU_SIZE_T)MB_CFG_CORE_RXRING_SIZE) {
+        return DEF_NO;
+    }
+
+    /*  Store the character.  */
+    ctx->rxRing[head & MBRXRING_MASK] = datum;
+    ctx->rxRingHead = (CPU_SIZE_T)(head + (CPU_SIZE_T)1U);
+
+    /*  Wake up the receiving task if the RX ring buffer becomes half full.  */
+    if ((CPU_SIZE_T)(used + (CPU_SIZE_T)1U) == MBRXRING_WATERMARK) {
+        MBOS_FlagGroupPost(
+            &(ctx->evFlags),
+            MBCTX_EVENT_RXCOMPLETE,
+            MB_FLAGGROUP_OPT_SET,
+            &error
+        );
+    }
+
+    return DEF_YES;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MB_RxRing_Read()
+*
+* Description : Fetch one character from the RX ring buffer of a Modbus context.
+*
+* Argument(s) : (1) ctx     The Modbus context.
+*               (2) end     The (free-running) index where the reading stops.
+*               (3) p_datum Pointer to the variable that receives the character.
+*
+* Return(s)   : DEF_YES if a character was fetched, DEF_NO if no character available before 'end'.
+*
+* Note(s)     : (1) This function can be called with interrupts enabled (see Note #2 of MB_RxRing_Write()).
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN MB_RxRing_Read(
+    MB_CONTEXT  *ctx,
+    CPU_SIZE_T   end,
+    CPU_INT08U  *p_datum
+) {
+    CPU_SIZE_T   tail;
+
+    /*  Check whether there is any character before the end.  */
+    tail = ctx->rxRingTail;
+    if (tail == end) {
+        return DEF_NO;
+    }
+
+    /*  Fetch the character.  */
+    *p_datum = ctx->rxRing[tail & MBRXRING_MASK];
+    ctx->rxRingTail = (CPU_SIZE_T)(tail + (CPU_SIZE_T)1U);
+
+    return DEF_YES;
+}
+#endif  /*  #if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)  */
+
+
+#if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                    MB_TxBlock_Encode()
+*
+* Description : Encode a whole Modbus frame to the TX block buffer of a Modbus device.
+*
+* Argument(s) : (1) ifdev     The Modbus device.
+*               (2) p_frame   Pointer to the frame to be encoded.
+*               (3) p_error   Pointer to the variable that receives error code from this function:
+*
+*                                 MB_ERROR_NONE                   No error occurred.
+*                                 MB_ERROR_INVALIDMODE            Device transmission mode is not supported.
+*
+* Return(s)   : The count of encoded characters, or zero if the encoded frame doesn't fit the TX block 
+*               buffer.
+*
+* Note(s)     : (1) The I/O lock of the device is assumed to be held by the caller.
+*********************************************************************************************************
+*/
+
+static CPU_SIZE_T MB_TxBlock_Encode(
+    MB_DEVICE   *ifdev,
+    MB_FRAME    *p_frame,
+    MB_ERROR    *p_error
+) {
+    MB_CONTEXT            *ctx;
+    CPU_SIZE_T             length;
+
+    union {
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+        MB_FRAMEENC_RTU    rtuEncoder;
+#endif
+#if (MB_CFG_CORE_ASCIIMODE == DEF_ENABLED)
+        MB_FRAMEENC_ASCII  asciiEncoder;
+#endif
+    } encoder;
+
+    /*  Get the Modbus context.  */
+    ctx    = &(ifdev->context);
+
+    /*  No character by default.  */
+    length = (CPU_SIZE_T)0U;
+
+    switch (ifdev->mode) {
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+        case MB_TRMODE_RTU:
+            /*  Check whether the encoded frame fits the TX block buffer.  */
+            if (p_frame->dataLength > (CPU_SIZE_T)(MBTXBLOCK_SIZE - MBTXBLOCK_OVERHEAD_RTU)) {
+                return (CPU_SIZE_T)0U;
+            }
+
+            /*  Initialize the encoder.  */
+            MBFrameEncRTU_Initialize(
+                &(encoder.rtuEncoder),
+                p_frame,
+                p_error
+            );
+            if (*p_error != MB_ERROR_NONE) {
+                return (CPU_SIZE_T)0U;
+            }
+
+            /*  Encode all characters.  */
+            while (MBFrameEncRTU_HasNext(&(encoder.rtuEncoder), p_error)) {
+                ctx->txBlock[length] = MBFrameEncRTU_Next(&(encoder.rtuEncoder), p_error);
+                if (*p_error != MB_ERROR_NONE) {
+                    return (CPU_SIZE_T)0U;
+                }
+                ++length;
+            }
+            break;
+#endif
+#if (MB_CFG_CORE_ASCIIMODE == DEF_ENABLED)
+        case MB_TRMODE_ASCII:
+            /*  Check whether the encoded frame fits the TX block buffer.  */
+            if (p_frame->dataLength > (CPU_SIZE_T)((MBTXBLOCK_SIZE - MBTXBLOCK_OVERHEAD_ASCII) >> 1U)) {
+                return (CPU_SIZE_T)0U;
+            }
+
+            /*  Initialize the encoder.  */
+            MBFrameEncASCII_Initialize(
+                &(encoder.asciiEncoder), 
+                p_frame, 
+                (CPU_CHAR)(ifdev->asciiModeLF), 
+                p_error
+            );
+            if (*p_error != MB_ERROR_NONE) {
+                return (CPU_SIZE_T)0U;
+            }
+
+            /*  Encode all characters.  */
+            while (MBFrameEncASCII_HasNext(&(encoder.asciiEncoder), p_error)) {
+                ctx->txBlock[length] = MBFrameEncASCII_Next(&(encoder.asciiEncoder), p_error);
+                if (*p_error != MB_ERROR_NONE) {
+                    return (CPU_SIZE_T)0U;
+                }
+                ++length;
+            }
+            break;
+#endif
+        default:
+            /*  Error: Invalid transmission mode.  */
+            *p_error = MB_ERROR_INVALIDMODE;
+            return (CPU_SIZE_T)0U;
+    }
+
+    return length;
+}
+#endif  /*  #if (MB_CFG_CORE_TXBLOCK_EN == DEF_ENABLED)  */
+
+
 /*
 *********************************************************************************************************
 *                                    MB_ISR_RxTimeoutExceed()
@@ -3484,7 +4223,7 @@ MBCTXINIT_EXIT:
 * Description : (ISR) Handle RX timeout exceed event.
 *
 * Argument(s) : (1) p_tmr   The timer object.
-*               (1) p_arg   The callback argument.
+*               (2) p_arg   The callback argument (the Modbus context).
 *
 * Return(s)   : None.
 *
@@ -3494,12 +4233,10 @@ MBCTXINIT_EXIT:
 
 static void MB_ISR_RxTimeoutExceed(void *p_tmr, void *p_arg) {
     MB_ERROR     error;
-    MB_RXTIMEOUT_CBINFO   *cbinfo;
-    MB_CONTEXT *mbctx;
+    MB_CONTEXT  *mbctx;
 
     /*  Get the Modbus context.  */
-    cbinfo = (MB_RXTIMEOUT_CBINFO*)p_arg;
-    mbctx = &(cbinfo->device->context);
+    mbctx = (MB_CONTEXT*)p_arg;
 
     /*  Set the RX timeout bit.  */
     MBOS_FlagGroupPost(
@@ -3592,6 +4329,10 @@ static void MB_ISR_HalfCharacterTimeExceed(MB_DRIVER *mbdrv, void *mbctx_) {
 static void MB_ISR_RxComplete(MB_DRIVER *mbdrv, void *mbctx_) {
     MB_CONTEXT  *mbctx;
     MB_ERROR     error;
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+    CPU_INT08U   datum;
+    CPU_BOOLEAN  overrun;
+#endif
 #if (MB_CFG_CORE_PARITYERRORCOUNTER_EN == DEF_ENABLED) || \
     (MB_CFG_CORE_DATAOVERRUNERRORCOUNTER_EN == DEF_ENABLED) || \
     (MB_CFG_CORE_FRAMEERRORCOUNTER_EN == DEF_ENABLED)
@@ -3603,6 +4344,80 @@ static void MB_ISR_RxComplete(MB_DRIVER *mbdrv, void *mbctx_) {
     /*  Type cast.  */
     mbctx = (MB_CONTEXT*)mbctx_;
 
+#if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)
+    /*  Read the character data.  */
+    datum = mbdrv->rxRead(&error);
+    if (error != MB_ERROR_NONE) {
+        return;
+    }
+
+    /*  Handle the character.  */
+    overrun = DEF_NO;
+    switch (mbctx->rxRingWakeMode) {
+#if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
+        case MBRXRING_WAKE_RTUIDLE:
+            /*  Restart the half-character timer (the character itself is not needed).  */
+            mbctx->halfCharCounter = (CPU_INT32U)0U;
+            mbdrv->halfCharacterTimerStop(&error);
+            mbdrv->halfCharacterTimerStart(&error);
+            break;
+        case MBRXRING_WAKE_RTUFIRSTCHAR:
+        case MBRXRING_WAKE_RTUFRAME:
+            /*  Store the character.  */
+            if (!MB_RxRing_Write(mbctx, datum)) {
+                overrun = DEF_YES;
+            }
+
+            /*  Only characters received within 1.5 character time belong to the frame.  */
+            if (
+                (mbctx->rxRingWakeMode  == MBRXRING_WAKE_RTUFIRSTCHAR) || 
+                (mbctx->halfCharCounter <  mbctx->halfCharCountCache_1D5)
+            ) {
+                /*  Move the frame end mark.  */
+                mbctx->rxRingMark = mbctx->rxRingHead;
+                mbctx->rxRingWakeMode = MBRXRING_WAKE_RTUFRAME;
+
+                /*  Restart the half-character timer.  */
+                mbctx->halfCharCounter = (CPU_INT32U)0U;
+                mbdrv->halfCharacterTimerStop(&error);
+                mbdrv->halfCharacterTimerStart(&error);
+            }
+            break;
+#endif
+#if (MB_CFG_CORE_ASCIIMODE == DEF_ENABLED)
+        case MBRXRING_WAKE_ASCIILF:
+            /*  Store the character.  */
+            if (!MB_RxRing_Write(mbctx, datum)) {
+                overrun = DEF_YES;
+            }
+
+            /*  Wake up the receiving task when the line feed character arrives.  */
+            if (datum == mbctx->rxRingWakeChar) {
+                MBOS_FlagGroupPost(
+                    &(mbctx->evFlags),
+                    MBCTX_EVENT_RXCOMPLETE,
+                    MB_FLAGGROUP_OPT_SET,
+                    &error
+                );
+            }
+            break;
+#endif
+        default:
+            break;
+    }
+
+    if (overrun) {
+        /*  Soft overrun deteted.  */
+        mbctx->rxDataOverRunError = DEF_YES;
+#if (MB_CFG_CORE_DATAOVERRUNERRORCOUNTER_EN == DEF_ENABLED)
+        cnt = mbctx->cntDataOverRunError;
+        if (cnt != MB_COUNTERVALUE_MAX) {
+            ++cnt;
+            mbctx->cntDataOverRunError = cnt;
+        }
+#endif
+    }
+#else
     /*  Read the character data.  */
     if (mbctx->rxDatumEaten) {
         mbctx->rxDatum = mbdrv->rxRead(&error);
@@ -3627,6 +4442,7 @@ static void MB_ISR_RxComplete(MB_DRIVER *mbdrv, void *mbctx_) {
         }
 #endif
     }
+#endif  /*  #if (MB_CFG_CORE_RXRING_EN == DEF_ENABLED)  */
 
     /*  Update error status.  */
     if (mbdrv->hasParityError()) {
@@ -3663,6 +4479,7 @@ static void MB_ISR_RxComplete(MB_DRIVER *mbdrv, void *mbctx_) {
 #endif
     }
 
+#if (MB_CFG_CORE_RXRING_EN != DEF_ENABLED)
     /*  Set the RX complete bit.  */
     MBOS_FlagGroupPost(
         &(mbctx->evFlags),
@@ -3670,6 +4487,7 @@ static void MB_ISR_RxComplete(MB_DRIVER *mbdrv, void *mbctx_) {
         MB_FLAGGROUP_OPT_SET,
         &error
     );
+#endif
 }
 
 
@@ -110,6 +110,7 @@ void MB_Initialize(
 *                                 MB_ERROR_DEVICENOFREE            No free device entry that can be used.
 *                                 MB_ERROR_OS_MUTEX_FAILEDCREATE   Unable to create a mutex object.
 *                                 MB_ERROR_OS_FGRP_FAILEDCREATE    Unable to create a flag group object.
+*                                 MB_ERROR_OS_TIMER_FAILEDCREATE   Unable to create a timer object.
 *
 * Return(s)   : The Modbus device interface ID.
 *********************************************************************************************************
@@ -388,7 +389,7 @@ CPU_INT16U MB_GetCharTimePrescale(
 *                                      MB_ERROR_OS_FGRP_FAILEDPEND     Failed to pend on a flag group object.
 *                                      MB_ERROR_OS_FGRP_FAILEDPOST     Failed to post to a flag group object.
 *                                      MB_ERROR_OS_MUTEX_FAILEDPEND    Failed to pend on a mutex object.
-*                                      MB_ERROR_OS_TIMER_FAILEDCREATE  Failed to create timer object.
+*                                      MB_ERROR_OS_TIMER_FAILEDSET     Failed to set a timer object.
 *                                      MB_ERROR_OS_TIMER_FAILEDSTART   Failed to start a timer object.
 *
 * Return(s)   : None.
@@ -449,7 +450,7 @@ void MB_WaitStartup(
 *                                      MB_ERROR_OS_FGRP_FAILEDPEND     Failed to pend on a flag group object.
 *                                      MB_ERROR_OS_FGRP_FAILEDPOST     Failed to post to a flag group object.
 *                                      MB_ERROR_OS_MUTEX_FAILEDPEND    Failed to pend on a mutex object.
-*                                      MB_ERROR_OS_TIMER_FAILEDCREATE  Failed to create timer object.
+*                                      MB_ERROR_OS_TIMER_FAILEDSET     Failed to set a timer object.
 *                                      MB_ERROR_OS_TIMER_FAILEDSTART   Failed to start a timer object.
 *
 * Return(s)   : None.
@@ -460,6 +461,9 @@ void MB_WaitStartup(
 *
 *               (2) The 'timeout' parameter only affects the time of waiting a frame on the serial line.
 *               (3) The function would be blocked (without respecting the 'timeout' parameter) until previous I/O finished.
+*               (4) If MB_CFG_CORE_RXRING_EN is enabled, received characters are buffered by the RX ISR and the 
+*                   calling task is only woken up at frame boundaries (3.5 character time in RTU mode, line feed 
+*                   character in ASCII mode), on timeout or when the RX ring buffer is half full.
 *********************************************************************************************************
 */
 
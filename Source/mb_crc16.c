@@ -41,6 +41,60 @@
 
 #if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)
 
+#if (MB_CFG_CRC16_SELFTEST_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+/*  Size of the self-test pattern buffer.  */
+#define MBCRC16_SELFTEST_BUFSIZE          ((CPU_SIZE_T)64U)
+
+
+/*
+*********************************************************************************************************
+*                                          TYPE DEFINITIONS
+*********************************************************************************************************
+*/
+
+typedef struct {
+    const CPU_CHAR    *data;
+    CPU_SIZE_T         size;
+    CPU_INT16U         crc;
+} MBCRC16_TESTVECTOR;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/*  Conformance test vectors (CRC-16/MODBUS, seed 0xFFFF).  */
+static const MBCRC16_TESTVECTOR g_MBCRC16_TestVectors[] = {
+    {"",                                  (CPU_SIZE_T)0U, (CPU_INT16U)0xFFFFU},
+    {"123456789",                         (CPU_SIZE_T)9U, (CPU_INT16U)0x4B37U},
+    {"\x01\x03\x00\x00\x00\x0A",          (CPU_SIZE_T)6U, (CPU_INT16U)0xCDC5U},
+    {"\x11\x03\x00\x6B\x00\x03",          (CPU_SIZE_T)6U, (CPU_INT16U)0x8776U},
+    {"\x00\x00\x00\x00\x00\x00\x00\x00",  (CPU_SIZE_T)8U, (CPU_INT16U)0x0B40U}
+};
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static CPU_INT16U MBCRC16_Reference(
+    const CPU_INT08U  *p_data,
+    CPU_SIZE_T         size,
+    CPU_INT16U         seed
+);
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    MBCRC16_Initialize()
@@ -78,11 +132,35 @@ void MBCRC16_Initialize(MBCRC16_CTX *ctx) {
 */
 
 void MBCRC16_Update(MBCRC16_CTX *ctx, CPU_INT08U ch) {
-    CPU_INT08U offset;
-    CPU_INT16U table_item;
-    offset = (CPU_INT08U)((ctx->crc ^ (CPU_INT16U)ch) & (CPU_INT16U)0xFFU);
-    table_item = MBPort_CRC16_GetTableItem(offset);
-    ctx->crc = ((ctx->crc >> 8) ^ table_item);
+    ctx->crc = MBPort_CRC16_Compute(&ch, (CPU_SIZE_T)1U, ctx->crc);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBCRC16_UpdateBlock()
+*
+* Description : Update a CRC-16 context with a block of characters.
+*
+* Argument(s) : ctx     The CRC-16 context.
+*               p_data  Pointer to the first character.
+*               size    Count of characters.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) 'ctx' is assumed to be not NULL.
+*               (2) 'p_data' is assumed to be not NULL if 'size' is not zero.
+*               (3) This function is not thread(task)-safe.
+*               (4) The CRC-16 is computed by MBPort_CRC16_Compute().
+*********************************************************************************************************
+*/
+
+void MBCRC16_UpdateBlock(
+    MBCRC16_CTX       *ctx,
+    const CPU_INT08U  *p_data,
+    CPU_SIZE_T         size
+) {
+    ctx->crc = MBPort_CRC16_Compute(p_data, size, ctx->crc);
 }
 
 
@@ -106,6 +184,78 @@ CPU_INT16U MBCRC16_Final(MBCRC16_CTX *ctx) {
 }
 
 
+#if (MB_CFG_CRC16_SELFTEST_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                     MBCRC16_SelfTest()
+*
+* Description : Check the CRC-16 implementation of the port layer (MBPort_CRC16_Compute()) against the 
+*               conformance test vectors.
+*
+* Argument(s) : None.
+*
+* Return(s)   : DEF_YES if all tests passed, DEF_NO if not.
+*
+* Note(s)     : (1) Following tests are done:
+*
+*                       (a) Fixed test vectors (including the standard "123456789" check value 0x4B37).
+*                       (b) A 256-bytes pattern computed in chunks, to check that the 'seed' argument 
+*                           continues a previous computation.
+*                       (c) Every length from 0 to 32 at every offset from 0 to 7, compared with a 
+*                           bit-wise reference implementation (to check unaligned and tail handling).
+*
+*               (2) Any port (including hardware CRC implementations) must pass this test.
+*               (3) Only available if MB_CFG_CRC16_SELFTEST_EN is enabled.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN MBCRC16_SelfTest() {
+    CPU_INT08U   buf[MBCRC16_SELFTEST_BUFSIZE];
+    CPU_SIZE_T   idx, offset, size;
+    CPU_INT16U   crc;
+
+    /*  Test (a): Fixed test vectors.  */
+    for (idx = 0U; idx < sizeof(g_MBCRC16_TestVectors) / sizeof(g_MBCRC16_TestVectors[0]); ++idx) {
+        crc = MBPort_CRC16_Compute(
+            (const CPU_INT08U*)(g_MBCRC16_TestVectors[idx].data),
+            g_MBCRC16_TestVectors[idx].size,
+            MBPORT_UINT16_MAX
+        );
+        if (crc != g_MBCRC16_TestVectors[idx].crc) {
+            return DEF_NO;
+        }
+    }
+
+    /*  Test (b): Bytes 0x00 to 0xFF, computed in chunks.  */
+    crc = MBPORT_UINT16_MAX;
+    for (offset = 0U; offset < (CPU_SIZE_T)256U; offset += MBCRC16_SELFTEST_BUFSIZE) {
+        for (idx = 0U; idx < MBCRC16_SELFTEST_BUFSIZE; ++idx) {
+            buf[idx] = (CPU_INT08U)(offset + idx);
+        }
+        crc = MBPort_CRC16_Compute(buf, MBCRC16_SELFTEST_BUFSIZE, crc);
+    }
+    if (crc != (CPU_INT16U)0xDE6CU) {
+        return DEF_NO;
+    }
+
+    /*  Test (c): Every length at every offset.  */
+    for (idx = 0U; idx < MBCRC16_SELFTEST_BUFSIZE; ++idx) {
+        buf[idx] = (CPU_INT08U)((idx * 0x9DU) + 0x35U);
+    }
+    for (offset = 0U; offset < (CPU_SIZE_T)8U; ++offset) {
+        for (size = 0U; size <= (CPU_SIZE_T)32U; ++size) {
+            crc = MBPort_CRC16_Compute(&(buf[offset]), size, (CPU_INT16U)(0x1D0FU + size));
+            if (crc != MBCRC16_Reference(&(buf[offset]), size, (CPU_INT16U)(0x1D0FU + size))) {
+                return DEF_NO;
+            }
+        }
+    }
+
+    return DEF_YES;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                     MBCRC16Util_HiLo()
@@ -131,4 +281,47 @@ void MBCRC16Util_HiLo(
     *p_hi = (CPU_INT08U)(crc >> 8);
 }
 
+
+#if (MB_CFG_CRC16_SELFTEST_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                    MBCRC16_Reference()
+*
+* Description : Compute the CRC-16 of a block of characters bit by bit (reference implementation for the 
+*               self-test).
+*
+* Argument(s) : p_data  Pointer to the first character.
+*               size    Count of characters.
+*               seed    The initial CRC-16 value.
+*
+* Return(s)   : The CRC-16 value.
+*********************************************************************************************************
+*/
+
+static CPU_INT16U MBCRC16_Reference(
+    const CPU_INT08U  *p_data,
+    CPU_SIZE_T         size,
+    CPU_INT16U         seed
+) {
+    CPU_INT16U  crc;
+    CPU_INT08U  bit;
+
+    crc = seed;
+    while (size != (CPU_SIZE_T)0U) {
+        crc ^= (CPU_INT16U)(*p_data);
+        for (bit = 0U; bit < 8U; ++bit) {
+            if ((crc & (CPU_INT16U)1U) != (CPU_INT16U)0U) {
+                crc = (CPU_INT16U)((crc >> 1) ^ (CPU_INT16U)0xA001U);
+            } else {
+                crc = (CPU_INT16U)(crc >> 1);
+            }
+        }
+        ++p_data;
+        --size;
+    }
+
+    return crc;
+}
+#endif
+
 #endif  /*  #if (MB_CFG_CORE_RTUMODE == DEF_ENABLED)  */
\ No newline at end of file
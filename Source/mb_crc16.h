@@ -97,6 +97,32 @@ void MBCRC16_Initialize(MBCRC16_CTX *ctx);
 void MBCRC16_Update(MBCRC16_CTX *ctx, CPU_INT08U ch);
 
 
+/*
+*********************************************************************************************************
+*                                    MBCRC16_UpdateBlock()
+*
+* Description : Update a CRC-16 context with a block of characters.
+*
+* Argument(s) : ctx     The CRC-16 context.
+*               p_data  Pointer to the first character.
+*               size    Count of characters.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) 'ctx' is assumed to be not NULL.
+*               (2) 'p_data' is assumed to be not NULL if 'size' is not zero.
+*               (3) This function is not thread(task)-safe.
+*               (4) The CRC-16 is computed by MBPort_CRC16_Compute().
+*********************************************************************************************************
+*/
+
+void MBCRC16_UpdateBlock(
+    MBCRC16_CTX       *ctx,
+    const CPU_INT08U  *p_data,
+    CPU_SIZE_T         size
+);
+
+
 /*
 *********************************************************************************************************
 *                                      MBCRC16_Final()
@@ -115,6 +141,27 @@ void MBCRC16_Update(MBCRC16_CTX *ctx, CPU_INT08U ch);
 CPU_INT16U MBCRC16_Final(MBCRC16_CTX *ctx);
 
 
+#if (MB_CFG_CRC16_SELFTEST_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                     MBCRC16_SelfTest()
+*
+* Description : Check the CRC-16 implementation of the port layer (MBPort_CRC16_Compute()) against the 
+*               conformance test vectors.
+*
+* Argument(s) : None.
+*
+* Return(s)   : DEF_YES if all tests passed, DEF_NO if not.
+*
+* Note(s)     : (1) Any port (including hardware CRC implementations) must pass this test.
+*               (2) Only available if MB_CFG_CRC16_SELFTEST_EN is enabled.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN MBCRC16_SelfTest();
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                     MBCRC16Util_HiLo()
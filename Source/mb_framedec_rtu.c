@@ -280,13 +280,32 @@ void MBFrameDecRTU_Update(
             /*  Get the byte to be written to the tail of the 'Data' field.  */
             databyte = p_decoder->crcLo;
 
-            /*  Do step (1).  */
+            /*
+             *  Do step (1).
+             * 
+             *  Note(s):
+             *    (1) The CRC of the bytes in the data buffer is updated at once
+             *        when the frame ends (or when the buffer overflows), only
+             *        the overflowed bytes are updated one by one.
+             */
             if (p_decoder->dataBufferWrittenSize == p_decoder->dataBufferSize) {
+                /*  Update the CRC with the whole data buffer on the first overflow.  */
+                if ((p_decoder->flags & MB_FRAMEFLAGS_BUFFEROVERFLOW) == (MB_FRAMEFLAGS)0U) {
+                    MBCRC16_UpdateBlock(
+                        &(p_decoder->crcContext), 
+                        p_decoder->dataBuffer, 
+                        p_decoder->dataBufferWrittenSize
+                    );
+                }
+
                 /*  Buffer is full, set the DROP and BUFFEROVERFLOW bits.  */
                 p_decoder->flags |= (MB_FRAMEFLAGS)(
                     MB_FRAMEFLAGS_DROP | 
                     MB_FRAMEFLAGS_BUFFEROVERFLOW
                 );
+
+                /*  Update the CRC.  */
+                MBCRC16_Update(&(p_decoder->crcContext), databyte);
             } else {
                 /*  Append to the tail of the 'Data' field.  */
                 *(p_decoder->dataBufferWritePtr) = databyte;
@@ -294,9 +313,6 @@ void MBFrameDecRTU_Update(
                 ++(p_decoder->dataBufferWrittenSize);
             }
 
-            /*  Update the CRC.  */
-            MBCRC16_Update(&(p_decoder->crcContext), databyte);
-
             /*  Do step (2).  */
             p_decoder->crcLo = p_decoder->crcHi;
 
@@ -374,6 +390,15 @@ void MBFrameDecRTU_End(
 
             break;
         case MB_FRAMEDECRTU_STATE_DATA:
+            /*  Update the CRC with the whole data buffer (if not updated yet).  */
+            if ((p_decoder->flags & MB_FRAMEFLAGS_BUFFEROVERFLOW) == (MB_FRAMEFLAGS)0U) {
+                MBCRC16_UpdateBlock(
+                    &(p_decoder->crcContext), 
+                    p_decoder->dataBuffer, 
+                    p_decoder->dataBufferWrittenSize
+                );
+            }
+
             /*  Calculate the real CRC checksum.  */
             crcReal = MBCRC16_Final(&(p_decoder->crcContext));
             MBCRC16Util_HiLo(crcReal, &crcRealHi, &crcRealLo);
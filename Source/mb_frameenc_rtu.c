@@ -178,6 +178,13 @@ CPU_INT08U  MBFrameEncRTU_Next(
                 /*  Go to 'CRCLO' state directly since there is no data.  */
                 p_encoder->state = MB_FRAMEENCRTU_STATE_CRCLO;
             } else {
+                /*  Update the CRC with the whole 'Data' field (it's contiguous).  */
+                MBCRC16_UpdateBlock(
+                    &(p_encoder->crcCtx), 
+                    frame->data, 
+                    frame->dataLength
+                );
+
                 /*  Go to 'DATA' state.  */
                 p_encoder->state = MB_FRAMEENCRTU_STATE_DATA;
             }
@@ -195,9 +202,6 @@ CPU_INT08U  MBFrameEncRTU_Next(
                 ++(p_encoder->dataReadPtr);
             }
 
-            /*  Update the CRC.  */
-            MBCRC16_Update(&(p_encoder->crcCtx), txDatum);
-
             break;
         case MB_FRAMEENCRTU_STATE_CRCLO:
             /*  Calculate the final CRC and transmit the low-order byte of the CRC.  */
@@ -180,3 +180,197 @@ CPU_INT32U MBUtil_GetHalfSerialCharacterTime(
 
     return timeValue;
 }
+
+
+/*
+*********************************************************************************************************
+*                                    MBUtil_CopyUInt16ToBE()
+*
+* Description : Copy an array of unsigned 16-bit integers to a big-endian (Modbus) byte stream.
+*
+* Argument(s) : (1) p_dst    Pointer to the first element of the byte stream (2 * 'count' bytes).
+*               (2) p_src    Pointer to the first element of the integer array.
+*               (3) count    Count of integers.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) 'p_dst' doesn't need to be aligned.
+*********************************************************************************************************
+*/
+
+void MBUtil_CopyUInt16ToBE(
+    CPU_INT08U       *p_dst,
+    const CPU_INT16U *p_src,
+    CPU_SIZE_T        count
+) {
+    CPU_INT16U  value;
+
+    while (count != (CPU_SIZE_T)0U) {
+        value    = *p_src;
+        p_dst[0] = (CPU_INT08U)(value >> 8);
+        p_dst[1] = (CPU_INT08U)(value & (CPU_INT16U)0xFFU);
+        p_dst   += 2;
+        ++(p_src);
+        --(count);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBUtil_CopyUInt16FromBE()
+*
+* Description : Copy a big-endian (Modbus) byte stream to an array of unsigned 16-bit integers.
+*
+* Argument(s) : (1) p_dst    Pointer to the first element of the integer array.
+*               (2) p_src    Pointer to the first element of the byte stream (2 * 'count' bytes).
+*               (3) count    Count of integers.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) 'p_src' doesn't need to be aligned.
+*********************************************************************************************************
+*/
+
+void MBUtil_CopyUInt16FromBE(
+    CPU_INT16U       *p_dst,
+    const CPU_INT08U *p_src,
+    CPU_SIZE_T        count
+) {
+    CPU_INT16U  value;
+
+    while (count != (CPU_SIZE_T)0U) {
+        value    = (CPU_INT16U)p_src[0];
+        value  <<= 8;
+        value   |= (CPU_INT16U)p_src[1];
+        *p_dst   = value;
+        p_src   += 2;
+        ++(p_dst);
+        --(count);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBUtil_ExtractBits()
+*
+* Description : Copy a run of bits from a bit array to a packed (Modbus) bit stream.
+*
+* Argument(s) : (1) p_dst       Pointer to the first element of the bit stream ((('count' + 7) / 8) bytes).
+*               (2) p_src       Pointer to the first element of the bit array.
+*               (3) src_offset  Bit offset of the run in the bit array.
+*               (4) count       Count of bits.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Bit n of the bit array is bit (n % 8) of byte (n / 8), the first bit of the run is copied 
+*                   to the LSB of the first byte of the bit stream.
+*               (2) The unused bits of the last byte of the bit stream are cleared.
+*               (3) No bytes beyond the run are read from 'p_src'.
+*********************************************************************************************************
+*/
+
+void MBUtil_ExtractBits(
+    CPU_INT08U       *p_dst,
+    const CPU_INT08U *p_src,
+    CPU_SIZE_T        src_offset,
+    CPU_SIZE_T        count
+) {
+    CPU_SIZE_T  nbytes;
+    CPU_SIZE_T  last;
+    CPU_SIZE_T  i;
+    CPU_INT08U  shift;
+    CPU_INT16U  window;
+
+    if (count == (CPU_SIZE_T)0U) {
+        return;
+    }
+
+    /*  Locate the first byte of the run.  */
+    p_src  += (src_offset >> 3);
+    shift   = (CPU_INT08U)(src_offset & (CPU_SIZE_T)7U);
+    nbytes  = ((count - (CPU_SIZE_T)1U) >> 3) + (CPU_SIZE_T)1U;
+    last    = ((CPU_SIZE_T)shift + count - (CPU_SIZE_T)1U) >> 3;
+
+    if (shift == (CPU_INT08U)0U) {
+        /*  Byte-aligned run, copy directly.  */
+        for (i = (CPU_SIZE_T)0U; i < nbytes; ++i) {
+            p_dst[i] = p_src[i];
+        }
+    } else {
+        /*  Shift the run through a 16-bit window, each source byte is read once.  */
+        window = (CPU_INT16U)p_src[0];
+        for (i = (CPU_SIZE_T)0U; i < nbytes; ++i) {
+            if (i < last) {
+                window |= (CPU_INT16U)((CPU_INT16U)p_src[i + (CPU_SIZE_T)1U] << 8);
+            }
+            p_dst[i]   = (CPU_INT08U)(window >> shift);
+            window   >>= 8;
+        }
+    }
+
+    /*  Clear the unused bits of the last byte.  */
+    if ((count & (CPU_SIZE_T)7U) != (CPU_SIZE_T)0U) {
+        p_dst[nbytes - (CPU_SIZE_T)1U] &= (CPU_INT08U)(
+            ((CPU_INT08U)1U << (CPU_INT08U)(count & (CPU_SIZE_T)7U)) - (CPU_INT08U)1U
+        );
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    MBUtil_InsertBits()
+*
+* Description : Copy a packed (Modbus) bit stream to a run of bits in a bit array.
+*
+* Argument(s) : (1) p_dst       Pointer to the first element of the bit array.
+*               (2) dst_offset  Bit offset of the run in the bit array.
+*               (3) p_src       Pointer to the first element of the bit stream ((('count' + 7) / 8) bytes).
+*               (4) count       Count of bits.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Bit n of the bit array is bit (n % 8) of byte (n / 8), the LSB of the first byte of the bit 
+*                   stream is copied to the first bit of the run.
+*               (2) Bits outside the run are left unchanged.
+*********************************************************************************************************
+*/
+
+void MBUtil_InsertBits(
+    CPU_INT08U       *p_dst,
+    CPU_SIZE_T        dst_offset,
+    const CPU_INT08U *p_src,
+    CPU_SIZE_T        count
+) {
+    CPU_INT08U  shift;
+    CPU_INT16U  bits;
+    CPU_INT16U  mask;
+
+    /*  Locate the first byte of the run.  */
+    p_dst += (dst_offset >> 3);
+    shift  = (CPU_INT08U)(dst_offset & (CPU_SIZE_T)7U);
+
+    while (count != (CPU_SIZE_T)0U) {
+        /*  Get (up to) 8 bits and the mask of them.  */
+        if (count >= (CPU_SIZE_T)8U) {
+            mask   = (CPU_INT16U)0x00FFU;
+            count -= (CPU_SIZE_T)8U;
+        } else {
+            mask   = (CPU_INT16U)(((CPU_INT16U)1U << (CPU_INT16U)count) - (CPU_INT16U)1U);
+            count  = (CPU_SIZE_T)0U;
+        }
+        bits  = (CPU_INT16U)((CPU_INT16U)(*p_src) & mask);
+        ++(p_src);
+
+        /*  Merge them to the (two) destination bytes.  */
+        bits <<= shift;
+        mask <<= shift;
+        p_dst[0] = (CPU_INT08U)((p_dst[0] & (CPU_INT08U)~mask) | (CPU_INT08U)bits);
+        if ((mask >> 8) != (CPU_INT16U)0U) {
+            p_dst[1] = (CPU_INT08U)((p_dst[1] & (CPU_INT08U)~(mask >> 8)) | (CPU_INT08U)(bits >> 8));
+        }
+        ++(p_dst);
+    }
+}
@@ -98,6 +98,107 @@ CPU_INT32U MBUtil_GetHalfSerialCharacterTime(
 );
 
 
+/*
+*********************************************************************************************************
+*                                    MBUtil_CopyUInt16ToBE()
+*
+* Description : Copy an array of unsigned 16-bit integers to a big-endian (Modbus) byte stream.
+*
+* Argument(s) : (1) p_dst    Pointer to the first element of the byte stream (2 * 'count' bytes).
+*               (2) p_src    Pointer to the first element of the integer array.
+*               (3) count    Count of integers.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) 'p_dst' doesn't need to be aligned.
+*********************************************************************************************************
+*/
+
+void MBUtil_CopyUInt16ToBE(
+    CPU_INT08U       *p_dst,
+    const CPU_INT16U *p_src,
+    CPU_SIZE_T        count
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBUtil_CopyUInt16FromBE()
+*
+* Description : Copy a big-endian (Modbus) byte stream to an array of unsigned 16-bit integers.
+*
+* Argument(s) : (1) p_dst    Pointer to the first element of the integer array.
+*               (2) p_src    Pointer to the first element of the byte stream (2 * 'count' bytes).
+*               (3) count    Count of integers.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) 'p_src' doesn't need to be aligned.
+*********************************************************************************************************
+*/
+
+void MBUtil_CopyUInt16FromBE(
+    CPU_INT16U       *p_dst,
+    const CPU_INT08U *p_src,
+    CPU_SIZE_T        count
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBUtil_ExtractBits()
+*
+* Description : Copy a run of bits from a bit array to a packed (Modbus) bit stream.
+*
+* Argument(s) : (1) p_dst       Pointer to the first element of the bit stream ((('count' + 7) / 8) bytes).
+*               (2) p_src       Pointer to the first element of the bit array.
+*               (3) src_offset  Bit offset of the run in the bit array.
+*               (4) count       Count of bits.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Bit n of the bit array is bit (n % 8) of byte (n / 8), the first bit of the run is copied 
+*                   to the LSB of the first byte of the bit stream.
+*               (2) The unused bits of the last byte of the bit stream are cleared.
+*               (3) No bytes beyond the run are read from 'p_src'.
+*********************************************************************************************************
+*/
+
+void MBUtil_ExtractBits(
+    CPU_INT08U       *p_dst,
+    const CPU_INT08U *p_src,
+    CPU_SIZE_T        src_offset,
+    CPU_SIZE_T        count
+);
+
+
+/*
+*********************************************************************************************************
+*                                    MBUtil_InsertBits()
+*
+* Description : Copy a packed (Modbus) bit stream to a run of bits in a bit array.
+*
+* Argument(s) : (1) p_dst       Pointer to the first element of the bit array.
+*               (2) dst_offset  Bit offset of the run in the bit array.
+*               (3) p_src       Pointer to the first element of the bit stream ((('count' + 7) / 8) bytes).
+*               (4) count       Count of bits.
+*
+* Return(s)   : None.
+*
+* Note(s)     : (1) Bit n of the bit array is bit (n % 8) of byte (n / 8), the LSB of the first byte of the bit 
+*                   stream is copied to the first bit of the run.
+*               (2) Bits outside the run are left unchanged.
+*********************************************************************************************************
+*/
+
+void MBUtil_InsertBits(
+    CPU_INT08U       *p_dst,
+    CPU_SIZE_T        dst_offset,
+    const CPU_INT08U *p_src,
+    CPU_SIZE_T        count
+);
+
+
 #ifdef __cplusplus
 }
 #endif